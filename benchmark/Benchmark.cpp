@@ -0,0 +1,229 @@
+#include "Benchmark.h"
+
+#include <utils/Profiler.h>                        // for library usage
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+namespace
+{
+   /// every allocation of the process, counted by the replaced operator new.
+   std::atomic<unsigned long long> g_allocations( 0 );
+
+   void* Allocate(std::size_t size)
+   {
+      g_allocations.fetch_add( 1 , std::memory_order_relaxed );
+#if defined(DIS_PROFILING)
+      // attributes the allocation to the PDU type and stage being profiled on this thread.
+      DIS::Profiler::CountAllocation( size );
+#endif
+      void* memory = malloc( size == 0 ? 1 : size );
+      if( memory == NULL )
+      {
+         throw std::bad_alloc();
+      }
+      return memory;
+   }
+
+   /// @return the text with the characters JSON does not allow in a string escaped.
+   std::string Escape(const std::string& text)
+   {
+      std::string escaped;
+      for(size_t i=0; i<text.size(); ++i)
+      {
+         const char c = text[i];
+         if( c == '"' || c == '\\' )
+         {
+            escaped += '\\';
+            escaped += c;
+         }
+         else if( static_cast<unsigned char>( c ) < 0x20 )
+         {
+            char code[8];
+            snprintf( code , sizeof(code) , "\\u%04x" , c );
+            escaped += code;
+         }
+         else
+         {
+            escaped += c;
+         }
+      }
+      return escaped;
+   }
+}
+
+void* operator new(std::size_t size)
+{
+   return Allocate( size );
+}
+
+void* operator new[](std::size_t size)
+{
+   return Allocate( size );
+}
+
+void operator delete(void* memory) noexcept
+{
+   free( memory );
+}
+
+void operator delete[](void* memory) noexcept
+{
+   free( memory );
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+   free( memory );
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+   free( memory );
+}
+
+using namespace BenchmarkDIS;
+
+unsigned long long BenchmarkDIS::GetAllocationCount()
+{
+   return g_allocations.load( std::memory_order_relaxed );
+}
+
+Runner::Runner(const std::string& library, int argc, char* argv[])
+   : _library(library)
+   , _filter()
+   , _json()
+   , _minSeconds(0.1)
+   , _valid(true)
+   , _results()
+   , _failures()
+{
+   for(int i=1; i<argc; ++i)
+   {
+      const std::string option = argv[i];
+      if( option == "--filter" && i + 1 < argc )
+      {
+         _filter = argv[++i];
+      }
+      else if( option == "--min-time" && i + 1 < argc )
+      {
+         _minSeconds = atof( argv[++i] ) / 1000.0;
+      }
+      else if( option == "--json" && i + 1 < argc )
+      {
+         _json = argv[++i];
+      }
+      else
+      {
+         _valid = false;
+      }
+   }
+
+   if( !_valid )
+   {
+      std::cerr << "usage: " << argv[0] << " [--filter <text>] [--min-time <ms>] [--json <path|->]" << std::endl;
+   }
+}
+
+bool Runner::IsValid() const
+{
+   return _valid;
+}
+
+unsigned long long Runner::Grow(unsigned long long iterations, double seconds) const
+{
+   // aim a little past the minimum, but never grow more than tenfold from a loop too short to time well.
+   if( seconds <= _minSeconds / 10 )
+   {
+      return iterations * 10;
+   }
+
+   const double scaled = iterations * ( _minSeconds * 1.2 / seconds );
+   return( scaled >= MAX_ITERATIONS ) ? MAX_ITERATIONS : static_cast<unsigned long long>( scaled ) + 1;
+}
+
+void Runner::Add(const Result& result)
+{
+   _results.push_back( result );
+
+   // the text report goes to standard error when the JSON takes standard output.
+   std::ostream& out = ( _json == "-" ) ? std::cerr : std::cout;
+   const double nanoseconds = result.seconds * 1e9 / result.iterations;
+   const double operations = result.iterations / result.seconds;
+   out << std::left << std::setw(48) << result.name << std::right
+       << std::fixed << std::setprecision(1)
+       << std::setw(12) << nanoseconds << " ns/op"
+       << std::setw(14) << std::setprecision(0) << operations << " op/s"
+       << std::setw(10) << std::setprecision(1) << operations * result.bytes / 1e6 << " MB/s"
+       << std::setw(8) << std::setprecision(2) << static_cast<double>( result.allocations ) / result.iterations << " allocs/op"
+       << std::endl;
+}
+
+void Runner::Fail(const std::string& name, const std::string& reason)
+{
+   _failures.push_back( std::make_pair( name , reason ) );
+
+   std::ostream& out = ( _json == "-" ) ? std::cerr : std::cout;
+   out << std::left << std::setw(48) << name << " FAILED: " << reason << std::endl;
+}
+
+int Runner::Report() const
+{
+   if( _json.empty() )
+   {
+      return 0;
+   }
+
+   if( _json == "-" )
+   {
+      WriteJson( std::cout );
+      return 0;
+   }
+
+   std::ofstream file( _json.c_str() );
+   WriteJson( file );
+   file.close();
+   if( !file )
+   {
+      std::cerr << "unable to write " << _json << std::endl;
+      return 1;
+   }
+   return 0;
+}
+
+void Runner::WriteJson(std::ostream& out) const
+{
+   out << "{\n  \"library\": \"" << Escape( _library ) << "\",\n  \"results\": [";
+   for(size_t i=0; i<_results.size(); ++i)
+   {
+      const Result& result = _results[i];
+      const double operations = result.iterations / result.seconds;
+
+      std::ostringstream line;
+      line.precision( 17 );
+      line << "\n    { \"name\": \"" << Escape( result.name ) << "\""
+           << ", \"iterations\": " << result.iterations
+           << ", \"seconds\": " << result.seconds
+           << ", \"ns_per_op\": " << result.seconds * 1e9 / result.iterations
+           << ", \"ops_per_second\": " << operations
+           << ", \"bytes_per_op\": " << result.bytes
+           << ", \"bytes_per_second\": " << operations * result.bytes
+           << ", \"allocations_per_op\": " << static_cast<double>( result.allocations ) / result.iterations
+           << " }";
+      out << line.str() << ( i + 1 < _results.size() ? "," : "" );
+   }
+   out << "\n  ],\n  \"failures\": [";
+   for(size_t i=0; i<_failures.size(); ++i)
+   {
+      out << "\n    { \"name\": \"" << Escape( _failures[i].first ) << "\", \"reason\": \"" << Escape( _failures[i].second ) << "\" }"
+          << ( i + 1 < _failures.size() ? "," : "" );
+   }
+   out << "\n  ]\n}\n";
+}
@@ -0,0 +1,121 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_benchmark_h_
+#define _dcl_dis_benchmark_h_
+
+#include <chrono>                   // for usage
+#include <iosfwd>                   // for parameter
+#include <string>                   // for member
+#include <utility>                  // for member
+#include <vector>                   // for member
+
+namespace BenchmarkDIS
+{
+   /// @return the number of allocations made through operator new by the whole process so far.
+   unsigned long long GetAllocationCount();
+
+   /// keep the compiler from optimizing away the work that produced the object.
+   inline void Keep(const void* object)
+   {
+#if defined(__GNUC__)
+      __asm__ __volatile__( "" : : "g"(object) : "memory" );
+#else
+      static const void* volatile sink = 0;
+      sink = object;
+#endif
+   }
+
+   /// the measurement of one operation.
+   struct Result
+   {
+      std::string name;
+
+      /// the number of times the operation ran in the measured loop, and how long the loop took.
+      unsigned long long iterations;
+      double seconds;
+
+      /// the bytes handled by one operation, and the allocations made by the loop.
+      unsigned long long bytes;
+      unsigned long long allocations;
+   };
+
+   /// runs each operation until it has taken a minimum time, and reports the throughput.
+   /// the options are
+   ///   --filter <text>     only run the operations whose name holds the text
+   ///   --min-time <ms>     the shortest measured loop, 100 ms by default
+   ///   --json <path>       also write the results as JSON, to standard output for '-'
+   class Runner
+   {
+   public:
+      Runner(const std::string& library, int argc, char* argv[]);
+
+      /// measure the operation, which handles the number of bytes each time it runs.
+      template<typename Operation>
+      void Run(const std::string& name, unsigned long long bytes, Operation operation)
+      {
+         if( !_filter.empty() && name.find( _filter ) == std::string::npos )
+         {
+            return;
+         }
+
+         // the loop grows until it is long enough to measure.
+         unsigned long long iterations = 1;
+         while( true )
+         {
+            const unsigned long long allocations = GetAllocationCount();
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for(unsigned long long i=0; i<iterations; ++i)
+            {
+               operation();
+            }
+            const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+            if( seconds >= _minSeconds || iterations >= MAX_ITERATIONS )
+            {
+               Result result;
+               result.name = name;
+               result.iterations = iterations;
+               result.seconds = seconds;
+               result.bytes = bytes;
+               result.allocations = GetAllocationCount() - allocations;
+               Add( result );
+               return;
+            }
+
+            iterations = Grow( iterations , seconds );
+         }
+      }
+
+      /// print the results, and write them as JSON when asked to.
+      /// @return the exit code of the program: 0, or 1 if the results could not be written.
+      int Report() const;
+
+      /// mark a result as failed, such as a PDU that does not decode to its encoded size.
+      void Fail(const std::string& name, const std::string& reason);
+
+      /// @return 'false' if the options were not understood, after printing the usage.
+      bool IsValid() const;
+
+   private:
+      static const unsigned long long MAX_ITERATIONS = 1ull << 40;
+
+      /// @return the number of iterations expected to take the minimum time.
+      unsigned long long Grow(unsigned long long iterations, double seconds) const;
+
+      void Add(const Result& result);
+
+      void WriteJson(std::ostream& out) const;
+
+      std::string _library;
+      std::string _filter;
+      std::string _json;
+      double _minSeconds;
+      bool _valid;
+
+      std::vector<Result> _results;
+      std::vector< std::pair<std::string,std::string> > _failures;
+   };
+}
+
+#endif  // _dcl_dis_benchmark_h_
@@ -0,0 +1,182 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pdu_benchmarks_h_
+#define _dcl_dis_pdu_benchmarks_h_
+
+#include "Benchmark.h"              // for usage
+
+#include <utils/DataStream.h>        // for usage
+
+#include <sstream>                  // for usage
+#include <string>                   // for parameter
+#include <vector>                   // for parameter
+
+/// the benchmarks shared by the DIS 6 and DIS 7 executables.  they only use the members common to
+/// both versions, or detect the members a PDU has, so that each executable includes one version.
+namespace BenchmarkDIS
+{
+   /// give a list element recognisable content, when it has the fields for it.
+   template<typename Element>
+   auto InitElement(Element& element, unsigned int index, int) -> decltype( element.setFixedDatumValue( 0u ) , void() )
+   {
+      element.setFixedDatumID( 1000 + index );
+      element.setFixedDatumValue( index * 7 );
+   }
+
+   template<typename Element>
+   auto InitElement(Element& element, unsigned int index, long) -> decltype( element.setVariableDatums( "" , 0u ) , void() )
+   {
+      const char data[32] = "populated variable datum";
+      element.setVariableDatumID( 2000 + index );
+      element.setVariableDatums( data , sizeof(data) );
+   }
+
+   template<typename Element>
+   void InitElement(Element& /*element*/, unsigned int /*index*/, ...)
+   {
+   }
+
+   template<typename Element>
+   void Grow(std::vector<Element>& list, unsigned int count)
+   {
+      list.resize( count );
+      for(unsigned int i=0; i<count; ++i)
+      {
+         InitElement( list[i] , i , 0 );
+      }
+   }
+
+   /// fill a list of the PDU with a number of elements, when the PDU has the list.
+#define BENCHMARK_POPULATE_LIST(getter, count) \
+   template<typename PduType> \
+   auto Populate_##getter(PduType& pdu, int) -> decltype( pdu.getter() , void() ) \
+   { \
+      Grow( pdu.getter() , count ); \
+   } \
+   template<typename PduType> \
+   void Populate_##getter(PduType& /*pdu*/, long) \
+   { \
+   }
+
+   BENCHMARK_POPULATE_LIST(getFixedDatums, 4)
+   BENCHMARK_POPULATE_LIST(getFixedDatumRecords, 4)
+   BENCHMARK_POPULATE_LIST(getVariableDatums, 2)
+   BENCHMARK_POPULATE_LIST(getVariableDatumRecords, 2)
+   BENCHMARK_POPULATE_LIST(getArticulationParameters, 4)
+   BENCHMARK_POPULATE_LIST(getVariableParameters, 4)
+   BENCHMARK_POPULATE_LIST(getSupplies, 2)
+   BENCHMARK_POPULATE_LIST(getSystems, 2)
+   BENCHMARK_POPULATE_LIST(getData, 160)
+
+#undef BENCHMARK_POPULATE_LIST
+
+   /// fill a PDU the way it is typically sent: a header, and a few elements in each of its common lists.
+   /// an Entity State PDU with four articulations, a Signal PDU with a 20 ms voice frame, and so on.
+   template<typename PduType>
+   void Populate(PduType& pdu)
+   {
+      pdu.setExerciseID( 1 );
+      pdu.setTimestamp( 0x12345679 );
+      Populate_getFixedDatums( pdu , 0 );
+      Populate_getFixedDatumRecords( pdu , 0 );
+      Populate_getVariableDatums( pdu , 0 );
+      Populate_getVariableDatumRecords( pdu , 0 );
+      Populate_getArticulationParameters( pdu , 0 );
+      Populate_getVariableParameters( pdu , 0 );
+      Populate_getSupplies( pdu , 0 );
+      Populate_getSystems( pdu , 0 );
+      Populate_getData( pdu , 0 );
+   }
+
+   /// measure marshalling a populated PDU into a reused stream, and unmarshalling it into a reused instance.
+   /// a PDU whose decoding does not read exactly the bytes it encoded, or whose getMarshalledSize() is not
+   /// the size it encodes, is reported as a failure.
+   template<typename PduType>
+   void BenchmarkPdu(Runner& runner, const std::string& name)
+   {
+      PduType pdu;
+      Populate( pdu );
+
+      DIS::DataStream stream( DIS::BIG );
+      pdu.marshal( stream );
+      const size_t size = stream.size();
+      const std::vector<char> bytes( &stream[0] , &stream[0] + size );
+
+      // a wrong reported size is noted but still measured.  a PDU that does not decode what it encoded is not.
+      PduType decoded;
+      {
+         DIS::DataStream in( &bytes[0] , size , DIS::BIG );
+         decoded.unmarshal( in );
+         if( in.GetReadPos() != size || static_cast<size_t>( pdu.getMarshalledSize() ) != size )
+         {
+            std::ostringstream reason;
+            reason << "encoded " << size << " bytes, the size is " << pdu.getMarshalledSize()
+                   << " and decoding read " << in.GetReadPos();
+            runner.Fail( "pdu." + name , reason.str() );
+         }
+         if( in.GetReadPos() != size )
+         {
+            return;
+         }
+      }
+
+      runner.Run( "pdu." + name + ".marshal" , size , [&]()
+      {
+         stream.clear();
+         pdu.marshal( stream );
+         Keep( &stream[0] );
+      });
+
+      DIS::DataStream in( DIS::BIG );
+      runner.Run( "pdu." + name + ".unmarshal" , size , [&]()
+      {
+         in.SetStream( &bytes[0] , size , DIS::BIG );
+         decoded.unmarshal( in );
+         Keep( &decoded );
+      });
+   }
+
+   /// measure the DataStream primitives, writing and reading a block of values of each type.
+   template<typename Value>
+   void BenchmarkPrimitive(Runner& runner, const std::string& type, Value value)
+   {
+      const unsigned int COUNT = 256;
+
+      DIS::DataStream out( DIS::BIG );
+      runner.Run( "datastream.write." + type , COUNT * sizeof(Value) , [&]()
+      {
+         out.clear();
+         for(unsigned int i=0; i<COUNT; ++i)
+         {
+            out << value;
+         }
+         Keep( &out[0] );
+      });
+
+      const std::vector<char> bytes( &out[0] , &out[0] + out.size() );
+      DIS::DataStream in( DIS::BIG );
+      Value read = Value();
+      runner.Run( "datastream.read." + type , COUNT * sizeof(Value) , [&]()
+      {
+         in.SetStream( &bytes[0] , bytes.size() , DIS::BIG );
+         for(unsigned int i=0; i<COUNT; ++i)
+         {
+            in >> read;
+         }
+         Keep( &read );
+      });
+   }
+
+   inline void BenchmarkPrimitives(Runner& runner)
+   {
+      BenchmarkPrimitive<char>( runner , "char" , 'd' );
+      BenchmarkPrimitive<unsigned short>( runner , "ushort" , 0x1234 );
+      BenchmarkPrimitive<unsigned int>( runner , "uint" , 0x12345678u );
+      BenchmarkPrimitive<unsigned long long>( runner , "ulonglong" , 0x123456789abcdefull );
+      BenchmarkPrimitive<float>( runner , "float" , 1.5f );
+      BenchmarkPrimitive<double>( runner , "double" , -2000000.25 );
+   }
+}
+
+#endif  // _dcl_dis_pdu_benchmarks_h_
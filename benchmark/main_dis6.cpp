@@ -0,0 +1,245 @@
+#include "Benchmark.h"
+#include "PduBenchmarks.h"
+
+#include <utils/IncomingMessage.h>                 // for library usage
+#include <utils/IPacketProcessor.h>                // for library usage
+#include <utils/DataStream.h>                      // for library usage
+
+#include <dis6/AcknowledgePdu.h>
+#include <dis6/AcknowledgeReliablePdu.h>
+#include <dis6/ActionRequestPdu.h>
+#include <dis6/ActionRequestReliablePdu.h>
+#include <dis6/ActionResponsePdu.h>
+#include <dis6/ActionResponseReliablePdu.h>
+#include <dis6/AggregateStatePdu.h>
+#include <dis6/ArealObjectStatePdu.h>
+#include <dis6/CollisionElasticPdu.h>
+#include <dis6/CollisionPdu.h>
+#include <dis6/CommentPdu.h>
+#include <dis6/CommentReliablePdu.h>
+#include <dis6/CreateEntityPdu.h>
+#include <dis6/CreateEntityReliablePdu.h>
+#include <dis6/DataPdu.h>
+#include <dis6/DataQueryPdu.h>
+#include <dis6/DataQueryReliablePdu.h>
+#include <dis6/DataReliablePdu.h>
+#include <dis6/DesignatorPdu.h>
+#include <dis6/DetonationPdu.h>
+#include <dis6/DistributedEmissionsFamilyPdu.h>
+#include <dis6/ElectromagneticEmissionsPdu.h>
+#include <dis6/EntityInformationFamilyPdu.h>
+#include <dis6/EntityManagementFamilyPdu.h>
+#include <dis6/EntityStatePdu.h>
+#include <dis6/EntityStateUpdatePdu.h>
+#include <dis6/EnvironmentalProcessPdu.h>
+#include <dis6/EventReportPdu.h>
+#include <dis6/EventReportReliablePdu.h>
+#include <dis6/FastEntityStatePdu.h>
+#include <dis6/FirePdu.h>
+#include <dis6/GriddedDataPdu.h>
+#include <dis6/IffAtcNavAidsLayer1Pdu.h>
+#include <dis6/IffAtcNavAidsLayer2Pdu.h>
+#include <dis6/IntercomControlPdu.h>
+#include <dis6/IntercomSignalPdu.h>
+#include <dis6/IsGroupOfPdu.h>
+#include <dis6/IsPartOfPdu.h>
+#include <dis6/LinearObjectStatePdu.h>
+#include <dis6/LogisticsFamilyPdu.h>
+#include <dis6/LogisticsPdu.h>
+#include <dis6/MinefieldDataPdu.h>
+#include <dis6/MinefieldFamilyPdu.h>
+#include <dis6/MinefieldQueryPdu.h>
+#include <dis6/MinefieldResponseNackPdu.h>
+#include <dis6/MinefieldStatePdu.h>
+#include <dis6/Pdu.h>
+#include <dis6/PointObjectStatePdu.h>
+#include <dis6/RadioCommunicationsFamilyPdu.h>
+#include <dis6/ReceiverPdu.h>
+#include <dis6/RecordQueryReliablePdu.h>
+#include <dis6/RemoveEntityPdu.h>
+#include <dis6/RemoveEntityReliablePdu.h>
+#include <dis6/RepairCompletePdu.h>
+#include <dis6/RepairResponsePdu.h>
+#include <dis6/ResupplyCancelPdu.h>
+#include <dis6/ResupplyOfferPdu.h>
+#include <dis6/ResupplyReceivedPdu.h>
+#include <dis6/SeesPdu.h>
+#include <dis6/ServiceRequestPdu.h>
+#include <dis6/SetDataPdu.h>
+#include <dis6/SetDataReliablePdu.h>
+#include <dis6/SetRecordReliablePdu.h>
+#include <dis6/SignalPdu.h>
+#include <dis6/SimulationManagementFamilyPdu.h>
+#include <dis6/SimulationManagementWithReliabilityFamilyPdu.h>
+#include <dis6/StartResumePdu.h>
+#include <dis6/StartResumeReliablePdu.h>
+#include <dis6/StopFreezePdu.h>
+#include <dis6/StopFreezeReliablePdu.h>
+#include <dis6/SyntheticEnvironmentFamilyPdu.h>
+#include <dis6/TransferControlRequestPdu.h>
+#include <dis6/TransmitterPdu.h>
+#include <dis6/UaPdu.h>
+#include <dis6/WarfareFamilyPdu.h>
+
+#include <vector>
+
+using namespace BenchmarkDIS;
+
+namespace
+{
+   /// counts the PDUs it is given.
+   class CountingProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      CountingProcessor()
+         : _count(0)
+      {
+      }
+
+      void Process(const DIS::Pdu& /*p*/)
+      {
+         ++_count;
+      }
+
+      unsigned long long _count;
+   };
+
+   /// measure decoding datagrams and handing their PDUs to the processors.
+   void BenchmarkIncomingMessage(Runner& runner)
+   {
+      DIS::EntityStatePdu entityState;
+      Populate( entityState );
+      DIS::FirePdu fire;
+      Populate( fire );
+      DIS::DetonationPdu detonation;
+      Populate( detonation );
+
+      DIS::DataStream single( DIS::BIG );
+      entityState.marshal( single );
+      const std::vector<char> entityStateBytes( &single[0] , &single[0] + single.size() );
+
+      DIS::DataStream bundle( DIS::BIG );
+      entityState.marshal( bundle );
+      fire.marshal( bundle );
+      detonation.marshal( bundle );
+      const std::vector<char> bundleBytes( &bundle[0] , &bundle[0] + bundle.size() );
+
+      CountingProcessor processor;
+      DIS::IncomingMessage incoming;
+      DIS::ReceiveContext context;
+
+      // PDUs no processor is registered for are skipped without being decoded.
+      runner.Run( "incoming.unhandled" , entityStateBytes.size() , [&]()
+      {
+         incoming.Process( &entityStateBytes[0] , static_cast<unsigned int>( entityStateBytes.size() ) , DIS::BIG , context );
+      });
+
+      incoming.AddProcessor( DIS::PDU_ENTITY_STATE , &processor );
+      incoming.AddProcessor( DIS::PDU_FIRE , &processor );
+      incoming.AddProcessor( DIS::PDU_DETONATION , &processor );
+
+      runner.Run( "incoming.entitystate" , entityStateBytes.size() , [&]()
+      {
+         incoming.Process( &entityStateBytes[0] , static_cast<unsigned int>( entityStateBytes.size() ) , DIS::BIG , context );
+      });
+
+      runner.Run( "incoming.bundle" , bundleBytes.size() , [&]()
+      {
+         incoming.Process( &bundleBytes[0] , static_cast<unsigned int>( bundleBytes.size() ) , DIS::BIG , context );
+      });
+
+      Keep( &processor._count );
+   }
+}
+
+/// measures the encoding and decoding of every DIS 6 PDU, the DataStream primitives,
+/// and the dispatch of received datagrams.  see Benchmark.h for the options.
+int main(int argc, char* argv[])
+{
+   Runner runner( "dis6" , argc , argv );
+   if( !runner.IsValid() )
+   {
+      return 1;
+   }
+
+   BenchmarkPrimitives( runner );
+   BenchmarkIncomingMessage( runner );
+
+   BenchmarkPdu<DIS::AcknowledgePdu>( runner , "AcknowledgePdu" );
+   BenchmarkPdu<DIS::AcknowledgeReliablePdu>( runner , "AcknowledgeReliablePdu" );
+   BenchmarkPdu<DIS::ActionRequestPdu>( runner , "ActionRequestPdu" );
+   BenchmarkPdu<DIS::ActionRequestReliablePdu>( runner , "ActionRequestReliablePdu" );
+   BenchmarkPdu<DIS::ActionResponsePdu>( runner , "ActionResponsePdu" );
+   BenchmarkPdu<DIS::ActionResponseReliablePdu>( runner , "ActionResponseReliablePdu" );
+   BenchmarkPdu<DIS::AggregateStatePdu>( runner , "AggregateStatePdu" );
+   BenchmarkPdu<DIS::ArealObjectStatePdu>( runner , "ArealObjectStatePdu" );
+   BenchmarkPdu<DIS::CollisionElasticPdu>( runner , "CollisionElasticPdu" );
+   BenchmarkPdu<DIS::CollisionPdu>( runner , "CollisionPdu" );
+   BenchmarkPdu<DIS::CommentPdu>( runner , "CommentPdu" );
+   BenchmarkPdu<DIS::CommentReliablePdu>( runner , "CommentReliablePdu" );
+   BenchmarkPdu<DIS::CreateEntityPdu>( runner , "CreateEntityPdu" );
+   BenchmarkPdu<DIS::CreateEntityReliablePdu>( runner , "CreateEntityReliablePdu" );
+   BenchmarkPdu<DIS::DataPdu>( runner , "DataPdu" );
+   BenchmarkPdu<DIS::DataQueryPdu>( runner , "DataQueryPdu" );
+   BenchmarkPdu<DIS::DataQueryReliablePdu>( runner , "DataQueryReliablePdu" );
+   BenchmarkPdu<DIS::DataReliablePdu>( runner , "DataReliablePdu" );
+   BenchmarkPdu<DIS::DesignatorPdu>( runner , "DesignatorPdu" );
+   BenchmarkPdu<DIS::DetonationPdu>( runner , "DetonationPdu" );
+   BenchmarkPdu<DIS::DistributedEmissionsFamilyPdu>( runner , "DistributedEmissionsFamilyPdu" );
+   BenchmarkPdu<DIS::ElectromagneticEmissionsPdu>( runner , "ElectromagneticEmissionsPdu" );
+   BenchmarkPdu<DIS::EntityInformationFamilyPdu>( runner , "EntityInformationFamilyPdu" );
+   BenchmarkPdu<DIS::EntityManagementFamilyPdu>( runner , "EntityManagementFamilyPdu" );
+   BenchmarkPdu<DIS::EntityStatePdu>( runner , "EntityStatePdu" );
+   BenchmarkPdu<DIS::EntityStateUpdatePdu>( runner , "EntityStateUpdatePdu" );
+   BenchmarkPdu<DIS::EnvironmentalProcessPdu>( runner , "EnvironmentalProcessPdu" );
+   BenchmarkPdu<DIS::EventReportPdu>( runner , "EventReportPdu" );
+   BenchmarkPdu<DIS::EventReportReliablePdu>( runner , "EventReportReliablePdu" );
+   BenchmarkPdu<DIS::FastEntityStatePdu>( runner , "FastEntityStatePdu" );
+   BenchmarkPdu<DIS::FirePdu>( runner , "FirePdu" );
+   BenchmarkPdu<DIS::GriddedDataPdu>( runner , "GriddedDataPdu" );
+   BenchmarkPdu<DIS::IffAtcNavAidsLayer1Pdu>( runner , "IffAtcNavAidsLayer1Pdu" );
+   BenchmarkPdu<DIS::IffAtcNavAidsLayer2Pdu>( runner , "IffAtcNavAidsLayer2Pdu" );
+   BenchmarkPdu<DIS::IntercomControlPdu>( runner , "IntercomControlPdu" );
+   BenchmarkPdu<DIS::IntercomSignalPdu>( runner , "IntercomSignalPdu" );
+   BenchmarkPdu<DIS::IsGroupOfPdu>( runner , "IsGroupOfPdu" );
+   BenchmarkPdu<DIS::IsPartOfPdu>( runner , "IsPartOfPdu" );
+   BenchmarkPdu<DIS::LinearObjectStatePdu>( runner , "LinearObjectStatePdu" );
+   BenchmarkPdu<DIS::LogisticsFamilyPdu>( runner , "LogisticsFamilyPdu" );
+   BenchmarkPdu<DIS::LogisticsPdu>( runner , "LogisticsPdu" );
+   BenchmarkPdu<DIS::MinefieldDataPdu>( runner , "MinefieldDataPdu" );
+   BenchmarkPdu<DIS::MinefieldFamilyPdu>( runner , "MinefieldFamilyPdu" );
+   BenchmarkPdu<DIS::MinefieldQueryPdu>( runner , "MinefieldQueryPdu" );
+   BenchmarkPdu<DIS::MinefieldResponseNackPdu>( runner , "MinefieldResponseNackPdu" );
+   BenchmarkPdu<DIS::MinefieldStatePdu>( runner , "MinefieldStatePdu" );
+   BenchmarkPdu<DIS::Pdu>( runner , "Pdu" );
+   BenchmarkPdu<DIS::PointObjectStatePdu>( runner , "PointObjectStatePdu" );
+   BenchmarkPdu<DIS::RadioCommunicationsFamilyPdu>( runner , "RadioCommunicationsFamilyPdu" );
+   BenchmarkPdu<DIS::ReceiverPdu>( runner , "ReceiverPdu" );
+   BenchmarkPdu<DIS::RecordQueryReliablePdu>( runner , "RecordQueryReliablePdu" );
+   BenchmarkPdu<DIS::RemoveEntityPdu>( runner , "RemoveEntityPdu" );
+   BenchmarkPdu<DIS::RemoveEntityReliablePdu>( runner , "RemoveEntityReliablePdu" );
+   BenchmarkPdu<DIS::RepairCompletePdu>( runner , "RepairCompletePdu" );
+   BenchmarkPdu<DIS::RepairResponsePdu>( runner , "RepairResponsePdu" );
+   BenchmarkPdu<DIS::ResupplyCancelPdu>( runner , "ResupplyCancelPdu" );
+   BenchmarkPdu<DIS::ResupplyOfferPdu>( runner , "ResupplyOfferPdu" );
+   BenchmarkPdu<DIS::ResupplyReceivedPdu>( runner , "ResupplyReceivedPdu" );
+   BenchmarkPdu<DIS::SeesPdu>( runner , "SeesPdu" );
+   BenchmarkPdu<DIS::ServiceRequestPdu>( runner , "ServiceRequestPdu" );
+   BenchmarkPdu<DIS::SetDataPdu>( runner , "SetDataPdu" );
+   BenchmarkPdu<DIS::SetDataReliablePdu>( runner , "SetDataReliablePdu" );
+   BenchmarkPdu<DIS::SetRecordReliablePdu>( runner , "SetRecordReliablePdu" );
+   BenchmarkPdu<DIS::SignalPdu>( runner , "SignalPdu" );
+   BenchmarkPdu<DIS::SimulationManagementFamilyPdu>( runner , "SimulationManagementFamilyPdu" );
+   BenchmarkPdu<DIS::SimulationManagementWithReliabilityFamilyPdu>( runner , "SimulationManagementWithReliabilityFamilyPdu" );
+   BenchmarkPdu<DIS::StartResumePdu>( runner , "StartResumePdu" );
+   BenchmarkPdu<DIS::StartResumeReliablePdu>( runner , "StartResumeReliablePdu" );
+   BenchmarkPdu<DIS::StopFreezePdu>( runner , "StopFreezePdu" );
+   BenchmarkPdu<DIS::StopFreezeReliablePdu>( runner , "StopFreezeReliablePdu" );
+   BenchmarkPdu<DIS::SyntheticEnvironmentFamilyPdu>( runner , "SyntheticEnvironmentFamilyPdu" );
+   BenchmarkPdu<DIS::TransferControlRequestPdu>( runner , "TransferControlRequestPdu" );
+   BenchmarkPdu<DIS::TransmitterPdu>( runner , "TransmitterPdu" );
+   BenchmarkPdu<DIS::UaPdu>( runner , "UaPdu" );
+   BenchmarkPdu<DIS::WarfareFamilyPdu>( runner , "WarfareFamilyPdu" );
+
+   return runner.Report();
+}
@@ -0,0 +1,151 @@
+#include "Benchmark.h"
+#include "PduBenchmarks.h"
+
+#include <dis7/AcknowledgePdu.h>
+#include <dis7/AcknowledgeReliablePdu.h>
+#include <dis7/ActionRequestPdu.h>
+#include <dis7/ActionRequestReliablePdu.h>
+#include <dis7/ActionResponsePdu.h>
+#include <dis7/ActionResponseReliablePdu.h>
+#include <dis7/ArealObjectStatePdu.h>
+#include <dis7/AttributePdu.h>
+#include <dis7/CollisionElasticPdu.h>
+#include <dis7/CollisionPdu.h>
+#include <dis7/CommentPdu.h>
+#include <dis7/CommentReliablePdu.h>
+#include <dis7/CreateEntityPdu.h>
+#include <dis7/CreateEntityReliablePdu.h>
+#include <dis7/DataPdu.h>
+#include <dis7/DataQueryPdu.h>
+#include <dis7/DataQueryReliablePdu.h>
+#include <dis7/DataReliablePdu.h>
+#include <dis7/DesignatorPdu.h>
+#include <dis7/DetonationPdu.h>
+#include <dis7/DirectedEnergyFirePdu.h>
+#include <dis7/DistributedEmissionsFamilyPdu.h>
+#include <dis7/ElectromagneticEmissionsPdu.h>
+#include <dis7/EntityDamageStatusPdu.h>
+#include <dis7/EntityInformationFamilyPdu.h>
+#include <dis7/EntityManagementFamilyPdu.h>
+#include <dis7/EntityStatePdu.h>
+#include <dis7/EntityStateUpdatePdu.h>
+#include <dis7/EventReportPdu.h>
+#include <dis7/EventReportReliablePdu.h>
+#include <dis7/FastEntityStatePdu.h>
+#include <dis7/FirePdu.h>
+#include <dis7/IFFPdu.h>
+#include <dis7/IntercomSignalPdu.h>
+#include <dis7/IsPartOfPdu.h>
+#include <dis7/LinearObjectStatePdu.h>
+#include <dis7/LiveEntityPdu.h>
+#include <dis7/LogisticsFamilyPdu.h>
+#include <dis7/MinefieldFamilyPdu.h>
+#include <dis7/MinefieldResponseNackPdu.h>
+#include <dis7/MinefieldStatePdu.h>
+#include <dis7/Pdu.h>
+#include <dis7/PointObjectStatePdu.h>
+#include <dis7/RadioCommunicationsFamilyPdu.h>
+#include <dis7/ReceiverPdu.h>
+#include <dis7/RecordQueryReliablePdu.h>
+#include <dis7/RemoveEntityPdu.h>
+#include <dis7/RemoveEntityReliablePdu.h>
+#include <dis7/RepairCompletePdu.h>
+#include <dis7/RepairResponsePdu.h>
+#include <dis7/ResupplyOfferPdu.h>
+#include <dis7/ResupplyReceivedPdu.h>
+#include <dis7/SeesPdu.h>
+#include <dis7/ServiceRequestPdu.h>
+#include <dis7/SetDataPdu.h>
+#include <dis7/SetDataReliablePdu.h>
+#include <dis7/SimulationManagementFamilyPdu.h>
+#include <dis7/SimulationManagementWithReliabilityFamilyPdu.h>
+#include <dis7/StartResumePdu.h>
+#include <dis7/StartResumeReliablePdu.h>
+#include <dis7/StopFreezePdu.h>
+#include <dis7/StopFreezeReliablePdu.h>
+#include <dis7/SyntheticEnvironmentFamilyPdu.h>
+#include <dis7/UaPdu.h>
+#include <dis7/WarfareFamilyPdu.h>
+
+using namespace BenchmarkDIS;
+
+/// measures the encoding and decoding of every DIS 7 PDU, and the DataStream primitives.
+/// see Benchmark.h for the options.
+int main(int argc, char* argv[])
+{
+   Runner runner( "dis7" , argc , argv );
+   if( !runner.IsValid() )
+   {
+      return 1;
+   }
+
+   BenchmarkPrimitives( runner );
+
+   BenchmarkPdu<DIS::AcknowledgePdu>( runner , "AcknowledgePdu" );
+   BenchmarkPdu<DIS::AcknowledgeReliablePdu>( runner , "AcknowledgeReliablePdu" );
+   BenchmarkPdu<DIS::ActionRequestPdu>( runner , "ActionRequestPdu" );
+   BenchmarkPdu<DIS::ActionRequestReliablePdu>( runner , "ActionRequestReliablePdu" );
+   BenchmarkPdu<DIS::ActionResponsePdu>( runner , "ActionResponsePdu" );
+   BenchmarkPdu<DIS::ActionResponseReliablePdu>( runner , "ActionResponseReliablePdu" );
+   BenchmarkPdu<DIS::ArealObjectStatePdu>( runner , "ArealObjectStatePdu" );
+   BenchmarkPdu<DIS::AttributePdu>( runner , "AttributePdu" );
+   BenchmarkPdu<DIS::CollisionElasticPdu>( runner , "CollisionElasticPdu" );
+   BenchmarkPdu<DIS::CollisionPdu>( runner , "CollisionPdu" );
+   BenchmarkPdu<DIS::CommentPdu>( runner , "CommentPdu" );
+   BenchmarkPdu<DIS::CommentReliablePdu>( runner , "CommentReliablePdu" );
+   BenchmarkPdu<DIS::CreateEntityPdu>( runner , "CreateEntityPdu" );
+   BenchmarkPdu<DIS::CreateEntityReliablePdu>( runner , "CreateEntityReliablePdu" );
+   BenchmarkPdu<DIS::DataPdu>( runner , "DataPdu" );
+   BenchmarkPdu<DIS::DataQueryPdu>( runner , "DataQueryPdu" );
+   BenchmarkPdu<DIS::DataQueryReliablePdu>( runner , "DataQueryReliablePdu" );
+   BenchmarkPdu<DIS::DataReliablePdu>( runner , "DataReliablePdu" );
+   BenchmarkPdu<DIS::DesignatorPdu>( runner , "DesignatorPdu" );
+   BenchmarkPdu<DIS::DetonationPdu>( runner , "DetonationPdu" );
+   BenchmarkPdu<DIS::DirectedEnergyFirePdu>( runner , "DirectedEnergyFirePdu" );
+   BenchmarkPdu<DIS::DistributedEmissionsFamilyPdu>( runner , "DistributedEmissionsFamilyPdu" );
+   BenchmarkPdu<DIS::ElectromagneticEmissionsPdu>( runner , "ElectromagneticEmissionsPdu" );
+   BenchmarkPdu<DIS::EntityDamageStatusPdu>( runner , "EntityDamageStatusPdu" );
+   BenchmarkPdu<DIS::EntityInformationFamilyPdu>( runner , "EntityInformationFamilyPdu" );
+   BenchmarkPdu<DIS::EntityManagementFamilyPdu>( runner , "EntityManagementFamilyPdu" );
+   BenchmarkPdu<DIS::EntityStatePdu>( runner , "EntityStatePdu" );
+   BenchmarkPdu<DIS::EntityStateUpdatePdu>( runner , "EntityStateUpdatePdu" );
+   BenchmarkPdu<DIS::EventReportPdu>( runner , "EventReportPdu" );
+   BenchmarkPdu<DIS::EventReportReliablePdu>( runner , "EventReportReliablePdu" );
+   BenchmarkPdu<DIS::FastEntityStatePdu>( runner , "FastEntityStatePdu" );
+   BenchmarkPdu<DIS::FirePdu>( runner , "FirePdu" );
+   BenchmarkPdu<DIS::IFFPdu>( runner , "IFFPdu" );
+   BenchmarkPdu<DIS::IntercomSignalPdu>( runner , "IntercomSignalPdu" );
+   BenchmarkPdu<DIS::IsPartOfPdu>( runner , "IsPartOfPdu" );
+   BenchmarkPdu<DIS::LinearObjectStatePdu>( runner , "LinearObjectStatePdu" );
+   BenchmarkPdu<DIS::LiveEntityPdu>( runner , "LiveEntityPdu" );
+   BenchmarkPdu<DIS::LogisticsFamilyPdu>( runner , "LogisticsFamilyPdu" );
+   BenchmarkPdu<DIS::MinefieldFamilyPdu>( runner , "MinefieldFamilyPdu" );
+   BenchmarkPdu<DIS::MinefieldResponseNackPdu>( runner , "MinefieldResponseNackPdu" );
+   BenchmarkPdu<DIS::MinefieldStatePdu>( runner , "MinefieldStatePdu" );
+   BenchmarkPdu<DIS::Pdu>( runner , "Pdu" );
+   BenchmarkPdu<DIS::PointObjectStatePdu>( runner , "PointObjectStatePdu" );
+   BenchmarkPdu<DIS::RadioCommunicationsFamilyPdu>( runner , "RadioCommunicationsFamilyPdu" );
+   BenchmarkPdu<DIS::ReceiverPdu>( runner , "ReceiverPdu" );
+   BenchmarkPdu<DIS::RecordQueryReliablePdu>( runner , "RecordQueryReliablePdu" );
+   BenchmarkPdu<DIS::RemoveEntityPdu>( runner , "RemoveEntityPdu" );
+   BenchmarkPdu<DIS::RemoveEntityReliablePdu>( runner , "RemoveEntityReliablePdu" );
+   BenchmarkPdu<DIS::RepairCompletePdu>( runner , "RepairCompletePdu" );
+   BenchmarkPdu<DIS::RepairResponsePdu>( runner , "RepairResponsePdu" );
+   BenchmarkPdu<DIS::ResupplyOfferPdu>( runner , "ResupplyOfferPdu" );
+   BenchmarkPdu<DIS::ResupplyReceivedPdu>( runner , "ResupplyReceivedPdu" );
+   BenchmarkPdu<DIS::SeesPdu>( runner , "SeesPdu" );
+   BenchmarkPdu<DIS::ServiceRequestPdu>( runner , "ServiceRequestPdu" );
+   BenchmarkPdu<DIS::SetDataPdu>( runner , "SetDataPdu" );
+   BenchmarkPdu<DIS::SetDataReliablePdu>( runner , "SetDataReliablePdu" );
+   BenchmarkPdu<DIS::SimulationManagementFamilyPdu>( runner , "SimulationManagementFamilyPdu" );
+   BenchmarkPdu<DIS::SimulationManagementWithReliabilityFamilyPdu>( runner , "SimulationManagementWithReliabilityFamilyPdu" );
+   BenchmarkPdu<DIS::StartResumePdu>( runner , "StartResumePdu" );
+   BenchmarkPdu<DIS::StartResumeReliablePdu>( runner , "StartResumeReliablePdu" );
+   BenchmarkPdu<DIS::StopFreezePdu>( runner , "StopFreezePdu" );
+   BenchmarkPdu<DIS::StopFreezeReliablePdu>( runner , "StopFreezeReliablePdu" );
+   BenchmarkPdu<DIS::SyntheticEnvironmentFamilyPdu>( runner , "SyntheticEnvironmentFamilyPdu" );
+   BenchmarkPdu<DIS::UaPdu>( runner , "UaPdu" );
+   BenchmarkPdu<DIS::WarfareFamilyPdu>( runner , "WarfareFamilyPdu" );
+
+   return runner.Report();
+}
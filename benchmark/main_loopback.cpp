@@ -0,0 +1,521 @@
+#include "Benchmark.h"
+#include "PduBenchmarks.h"
+
+#include <utils/DataStream.h>                      // for library usage
+#include <utils/Histogram.h>                       // for library usage
+#include <utils/IncomingMessage.h>                 // for library usage
+#include <utils/IPacketProcessor.h>                // for library usage
+#include <utils/Profiler.h>                        // for library usage
+#include <utils/UdpTransport.h>                    // for library usage
+
+#include <dis6/DetonationPdu.h>
+#include <dis6/EntityStatePdu.h>
+#include <dis6/FirePdu.h>
+#include <dis6/SignalPdu.h>
+#include <dis6/TransmitterPdu.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+namespace
+{
+   /// the number of send times remembered, a power of 2.  a PDU still in flight
+   /// after this many more were sent is measured against the wrong send time.
+   const unsigned int SEND_TIME_SLOTS = 1u << 20;
+
+   long long Now()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+   }
+
+   /// the options of the harness.
+   struct Options
+   {
+      Options()
+         : group("239.1.2.3")
+         , interfaceAddress("127.0.0.1")
+         , port(62040)
+         , batchSize(16)
+         , entities(1000)
+         , mix("entitystate=80,fire=10,detonation=5,signal=5")
+         , rate(10000)
+         , step(1.5)
+         , maxRate(10000000)
+         , duration(1000)
+         , drain(200)
+         , maxLoss(0.001)
+         , json()
+      {
+      }
+
+      std::string group;
+      std::string interfaceAddress;
+      unsigned short port;
+      unsigned int batchSize;
+      unsigned int entities;
+      std::string mix;
+      double rate;
+      double step;
+      double maxRate;
+      unsigned int duration;
+      unsigned int drain;
+      double maxLoss;
+      std::string json;
+   };
+
+   /// one kind of PDU of the mix, populated once and sent with a new sequence number each time.
+   struct MixEntry
+   {
+      std::string name;
+      DIS::Pdu* pdu;
+      int weight;
+
+      /// the credit of the smooth weighted round robin.
+      int current;
+   };
+
+   /// the measurement of one rate of the ramp.
+   struct Step
+   {
+      double targetRate;
+      double achievedRate;
+      unsigned long long sent;
+      unsigned long long received;
+
+      /// the lost PDUs the kernel reported dropping for want of receive buffer.
+      unsigned long long kernelDrops;
+      unsigned long long allocations;
+      DIS::Histogram latency;
+   };
+
+   /// the times the PDUs were sent, indexed by the sequence number carried in their timestamp.
+   std::vector< std::atomic<long long> > g_sendTimes( SEND_TIME_SLOTS );
+
+   /// measures the time from the start of marshalling to the processor, for every PDU received.
+   class LatencyProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      LatencyProcessor()
+         : _mutex()
+         , _latency()
+         , _received(0)
+      {
+      }
+
+      void Process(const DIS::Pdu& p)
+      {
+         const long long sent = g_sendTimes[p.getTimestamp() & ( SEND_TIME_SLOTS - 1 )].load( std::memory_order_relaxed );
+         const long long latency = Now() - sent;
+
+         std::lock_guard<std::mutex> lock( _mutex );
+         _latency.Record( latency > 0 ? static_cast<unsigned long long>( latency ) : 0 );
+         ++_received;
+      }
+
+      /// move the measurements made since the last call into the step.
+      void Take(Step& step)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         step.latency.Merge( _latency );
+         step.received = _received;
+         _latency.Reset();
+         _received = 0;
+      }
+
+   private:
+      std::mutex _mutex;
+      DIS::Histogram _latency;
+      unsigned long long _received;
+   };
+
+   void Usage(const char* program)
+   {
+      std::cerr << "usage: " << program << " [--group <address>] [--interface <address>] [--port <port>] [--batch <count>]\n"
+                << "          [--entities <count>] [--mix <name=weight,...>] [--rate <pdu/s>] [--step <factor>]\n"
+                << "          [--max-rate <pdu/s>] [--duration <ms>] [--drain <ms>] [--max-loss <fraction>] [--json <path|->]" << std::endl;
+   }
+
+   bool Parse(int argc, char* argv[], Options& options)
+   {
+      for(int i=1; i<argc; ++i)
+      {
+         const std::string option = argv[i];
+         if( i + 1 >= argc )
+         {
+            return false;
+         }
+
+         const char* value = argv[++i];
+         if( option == "--group" )            { options.group = value; }
+         else if( option == "--interface" )   { options.interfaceAddress = value; }
+         else if( option == "--port" )        { options.port = static_cast<unsigned short>( atoi( value ) ); }
+         else if( option == "--batch" )       { options.batchSize = static_cast<unsigned int>( atoi( value ) ); }
+         else if( option == "--entities" )    { options.entities = static_cast<unsigned int>( atoi( value ) ); }
+         else if( option == "--mix" )         { options.mix = value; }
+         else if( option == "--rate" )        { options.rate = atof( value ); }
+         else if( option == "--step" )        { options.step = atof( value ); }
+         else if( option == "--max-rate" )    { options.maxRate = atof( value ); }
+         else if( option == "--duration" )    { options.duration = static_cast<unsigned int>( atoi( value ) ); }
+         else if( option == "--drain" )       { options.drain = static_cast<unsigned int>( atoi( value ) ); }
+         else if( option == "--max-loss" )    { options.maxLoss = atof( value ); }
+         else if( option == "--json" )        { options.json = value; }
+         else
+         {
+            return false;
+         }
+      }
+
+      return options.rate > 0 && options.step > 1 && options.duration > 0
+          && options.batchSize > 0 && options.entities > 0 && options.entities <= 65535;
+   }
+
+   /// @return the populated PDU of the name, or NULL for a name that is not part of the harness.
+   DIS::Pdu* CreatePdu(const std::string& name)
+   {
+      if( name == "entitystate" )
+      {
+         DIS::EntityStatePdu* pdu = new DIS::EntityStatePdu();
+         BenchmarkDIS::Populate( *pdu );
+         return pdu;
+      }
+      if( name == "fire" )
+      {
+         DIS::FirePdu* pdu = new DIS::FirePdu();
+         BenchmarkDIS::Populate( *pdu );
+         return pdu;
+      }
+      if( name == "detonation" )
+      {
+         DIS::DetonationPdu* pdu = new DIS::DetonationPdu();
+         BenchmarkDIS::Populate( *pdu );
+         return pdu;
+      }
+      if( name == "signal" )
+      {
+         DIS::SignalPdu* pdu = new DIS::SignalPdu();
+         BenchmarkDIS::Populate( *pdu );
+         return pdu;
+      }
+      if( name == "transmitter" )
+      {
+         DIS::TransmitterPdu* pdu = new DIS::TransmitterPdu();
+         BenchmarkDIS::Populate( *pdu );
+         return pdu;
+      }
+      return NULL;
+   }
+
+   /// read a mix such as "entitystate=80,fire=10,detonation=5,signal=5".
+   bool ParseMix(const std::string& text, std::vector<MixEntry>& mix)
+   {
+      std::istringstream in( text );
+      std::string item;
+      while( std::getline( in , item , ',' ) )
+      {
+         const size_t equals = item.find( '=' );
+         MixEntry entry;
+         entry.name = item.substr( 0 , equals );
+         entry.weight = ( equals == std::string::npos ) ? 1 : atoi( item.c_str() + equals + 1 );
+         entry.current = 0;
+         entry.pdu = CreatePdu( entry.name );
+         if( entry.pdu == NULL || entry.weight <= 0 )
+         {
+            delete entry.pdu;
+            std::cerr << "unknown PDU or weight in the mix: " << item
+                      << ", the PDUs are entitystate, fire, detonation, signal and transmitter" << std::endl;
+            return false;
+         }
+         mix.push_back( entry );
+      }
+      return !mix.empty();
+   }
+
+   /// @return the next PDU of the mix.  the smooth weighted round robin spreads
+   /// each kind evenly among the others, rather than sending them in runs.
+   MixEntry& Next(std::vector<MixEntry>& mix)
+   {
+      int total = 0;
+      size_t best = 0;
+      for(size_t i=0; i<mix.size(); ++i)
+      {
+         mix[i].current += mix[i].weight;
+         total += mix[i].weight;
+         if( mix[i].current > mix[best].current )
+         {
+            best = i;
+         }
+      }
+      mix[best].current -= total;
+      return mix[best];
+   }
+
+   /// send at the rate for the duration, each PDU at its due time.
+   /// the sender flushes its batch and waits whenever it is ahead of the schedule,
+   /// and sends without waiting when it is behind.
+   void Send(DIS::UdpTransport& transport, std::vector<MixEntry>& mix, const Options& options,
+             double rate, unsigned int& sequence, unsigned int& entity, Step& step)
+   {
+      const unsigned long long count = static_cast<unsigned long long>( rate * options.duration / 1000.0 );
+      const double interval = 1e9 / rate;
+      DIS::DataStream stream( DIS::BIG );
+
+      const unsigned long long allocations = BenchmarkDIS::GetAllocationCount();
+      const long long start = Now();
+      unsigned long long sent = 0;
+      while( sent < count )
+      {
+         const long long now = Now();
+         const long long due = start + static_cast<long long>( sent * interval );
+         if( now < due )
+         {
+            transport.Flush();
+
+            // sleeping is only precise to tens of microseconds, the rest is spun.
+            if( due - now > 200000 )
+            {
+               std::this_thread::sleep_for( std::chrono::nanoseconds( due - now - 100000 ) );
+            }
+            continue;
+         }
+
+         MixEntry& entry = Next( mix );
+         if( DIS::EntityStatePdu* entityState = dynamic_cast<DIS::EntityStatePdu*>( entry.pdu ) )
+         {
+            entityState->getEntityID().setEntity( static_cast<unsigned short>( entity + 1 ) );
+            entity = ( entity + 1 ) % options.entities;
+         }
+
+         g_sendTimes[sequence & ( SEND_TIME_SLOTS - 1 )].store( Now() , std::memory_order_relaxed );
+         entry.pdu->setTimestamp( sequence++ );
+         stream.clear();
+         entry.pdu->marshal( stream );
+         transport.Send( &stream[0] , stream.size() );
+         ++sent;
+      }
+      transport.Flush();
+
+      const double seconds = ( Now() - start ) / 1e9;
+      step.targetRate = rate;
+      step.achievedRate = sent / seconds;
+      step.sent = sent;
+      step.allocations = BenchmarkDIS::GetAllocationCount() - allocations;
+   }
+
+   void Print(std::ostream& out, const Step& step)
+   {
+      const unsigned long long lost = ( step.received < step.sent ) ? step.sent - step.received : 0;
+      out << std::fixed << std::setprecision(0)
+          << std::setw(10) << step.targetRate << std::setw(10) << step.achievedRate
+          << std::setw(10) << step.sent << std::setw(10) << step.received << std::setw(8) << lost << std::setw(8) << step.kernelDrops
+          << std::setprecision(1)
+          << std::setw(10) << step.latency.GetPercentile( 50 ) / 1000.0
+          << std::setw(10) << step.latency.GetPercentile( 99 ) / 1000.0
+          << std::setw(10) << step.latency.GetPercentile( 99.9 ) / 1000.0
+          << std::setw(10) << step.latency.GetMax() / 1000.0
+          << std::setprecision(2) << std::setw(9) << static_cast<double>( step.allocations ) / ( step.sent ? step.sent : 1 )
+          << std::endl;
+   }
+
+#if defined(DIS_PROFILING)
+   /// the time taken to decode and to process each PDU type received, and the allocations made,
+   /// with a library built with OPENDIS_PROFILING.
+   void PrintProfile(std::ostream& out)
+   {
+      out << "pdu type  stage          count   p50(us)   p99(us)   max(us) allocs/pdu bytes/pdu" << std::endl;
+      for(unsigned int type=0; type<256; ++type)
+      {
+         const DIS::ProfileStage stages[] = { DIS::PROFILE_UNMARSHAL , DIS::PROFILE_DISPATCH };
+         const char* names[] = { "unmarshal" , "dispatch" };
+         for(unsigned int i=0; i<2; ++i)
+         {
+            const DIS::Histogram histogram = DIS::Profiler::GetHistogram( stages[i] , static_cast<unsigned char>( type ) );
+            if( histogram.GetCount() == 0 )
+            {
+               continue;
+            }
+            const DIS::ProfileAllocations allocations = DIS::Profiler::GetAllocations( stages[i] , static_cast<unsigned char>( type ) );
+            out << std::fixed << std::setw(8) << type << "  " << std::left << std::setw(10) << names[i] << std::right
+                << std::setw(10) << histogram.GetCount() << std::setprecision(2)
+                << std::setw(10) << histogram.GetPercentile( 50 ) / 1000.0
+                << std::setw(10) << histogram.GetPercentile( 99 ) / 1000.0
+                << std::setw(10) << histogram.GetMax() / 1000.0
+                << std::setw(11) << static_cast<double>( allocations.allocations ) / allocations.calls
+                << std::setw(10) << static_cast<double>( allocations.bytes ) / allocations.calls << std::endl;
+         }
+      }
+   }
+#endif
+
+   void WriteJson(std::ostream& out, const std::vector<Step>& steps, const Options& options, double sustainable)
+   {
+      out.precision( 17 );
+      out << "{\n  \"library\": \"OpenDIS6\",\n  \"mix\": \"" << options.mix << "\",\n  \"entities\": " << options.entities
+          << ",\n  \"max_loss\": " << options.maxLoss << ",\n  \"max_sustainable_rate\": " << sustainable << ",\n  \"steps\": [";
+      for(size_t i=0; i<steps.size(); ++i)
+      {
+         const Step& step = steps[i];
+         out << "\n    { \"target_rate\": " << step.targetRate
+             << ", \"achieved_rate\": " << step.achievedRate
+             << ", \"sent\": " << step.sent
+             << ", \"received\": " << step.received
+             << ", \"kernel_drops\": " << step.kernelDrops
+             << ", \"p50_ns\": " << step.latency.GetPercentile( 50 )
+             << ", \"p99_ns\": " << step.latency.GetPercentile( 99 )
+             << ", \"p999_ns\": " << step.latency.GetPercentile( 99.9 )
+             << ", \"max_ns\": " << step.latency.GetMax()
+             << ", \"mean_ns\": " << step.latency.GetMean()
+             << ", \"allocations_per_pdu\": " << static_cast<double>( step.allocations ) / ( step.sent ? step.sent : 1 )
+             << " }" << ( i + 1 < steps.size() ? "," : "" );
+      }
+      out << "\n  ]\n}\n";
+   }
+}
+#endif
+
+/// sends a mix of PDUs over loopback multicast to a receiver in another thread, which decodes them
+/// with IncomingMessage and hands them to processors, at a rate increased step by step until PDUs are lost.
+/// each step reports the latency from marshalling to the processor, and the highest rate sent without
+/// losing more than the allowed fraction is reported as the max sustainable rate.
+int main(int argc, char* argv[])
+{
+#if defined(__linux__)
+   Options options;
+   std::vector<MixEntry> mix;
+   if( !Parse( argc , argv , options ) )
+   {
+      Usage( argv[0] );
+      return 1;
+   }
+   if( !ParseMix( options.mix , mix ) )
+   {
+      return 1;
+   }
+
+   DIS::UdpTransportSettings receiveSettings;
+   receiveSettings.port = options.port;
+   receiveSettings.address = options.group;
+   receiveSettings.interfaceAddress = options.interfaceAddress;
+   receiveSettings.batchSize = options.batchSize;
+   receiveSettings.timestamps = false;
+
+   DIS::UdpTransportSettings sendSettings;
+   sendSettings.port = 0;
+   sendSettings.interfaceAddress = options.interfaceAddress;
+   sendSettings.destination = options.group;
+   sendSettings.destinationPort = options.port;
+   sendSettings.batchSize = options.batchSize;
+   sendSettings.multicastLoop = true;
+
+   DIS::UdpTransport receiver;
+   DIS::UdpTransport sender;
+   if( !receiver.Open( receiveSettings ) || !sender.Open( sendSettings ) )
+   {
+      const int error = receiver.GetLastError() ? receiver.GetLastError() : sender.GetLastError();
+      std::cerr << "unable to open the sockets: " << strerror( error ) << std::endl;
+      return 1;
+   }
+
+   LatencyProcessor processor;
+   DIS::IncomingMessage incoming;
+   for(size_t i=0; i<mix.size(); ++i)
+   {
+      incoming.AddProcessor( mix[i].pdu->getPduType() , &processor );
+   }
+
+   std::atomic<bool> stop( false );
+   std::thread receiving( [&]()
+   {
+      while( !stop.load( std::memory_order_relaxed ) )
+      {
+         receiver.Receive( incoming , 100 );
+      }
+   });
+
+   std::ostream& out = ( options.json == "-" ) ? std::cerr : std::cout;
+   out << "    target  achieved      sent  received    lost  kdrops   p50(us)   p99(us) p99.9(us)   max(us) allocs/pdu" << std::endl;
+
+   std::vector<Step> steps;
+   double sustainable = 0;
+   unsigned int sequence = 0;
+   unsigned int entity = 0;
+   unsigned long long kernelDrops = 0;
+   for(double rate=options.rate; rate<=options.maxRate; rate*=options.step)
+   {
+      steps.push_back( Step() );
+      Step& step = steps.back();
+      Send( sender , mix , options , rate , sequence , entity , step );
+
+      // the PDUs still in flight are given time to arrive before they are counted as lost.
+      std::this_thread::sleep_for( std::chrono::milliseconds( options.drain ) );
+      processor.Take( step );
+      const unsigned long long drops = receiver.GetStatistics().kernelDrops;
+      step.kernelDrops = drops - kernelDrops;
+      kernelDrops = drops;
+      Print( out , step );
+
+      const double loss = ( step.received < step.sent ) ? static_cast<double>( step.sent - step.received ) / step.sent : 0.0;
+      if( loss > options.maxLoss )
+      {
+         break;
+      }
+      if( step.achievedRate > sustainable )
+      {
+         sustainable = step.achievedRate;
+      }
+
+      // the sender cannot go faster, so a higher target would only repeat this step.
+      if( step.achievedRate < rate * 0.9 )
+      {
+         break;
+      }
+   }
+
+   stop.store( true , std::memory_order_relaxed );
+   receiver.Interrupt();
+   receiving.join();
+   receiver.Close();
+   sender.Close();
+
+   out << "max sustainable rate: " << std::fixed << std::setprecision(0) << sustainable << " pdu/s" << std::endl;
+#if defined(DIS_PROFILING)
+   PrintProfile( out );
+#endif
+
+   for(size_t i=0; i<mix.size(); ++i)
+   {
+      incoming.RemoveProcessor( mix[i].pdu->getPduType() , &processor );
+      delete mix[i].pdu;
+   }
+
+   if( options.json == "-" )
+   {
+      WriteJson( std::cout , steps , options , sustainable );
+   }
+   else if( !options.json.empty() )
+   {
+      std::ofstream file( options.json.c_str() );
+      WriteJson( file , steps , options , sustainable );
+      file.close();
+      if( !file )
+      {
+         std::cerr << "unable to write " << options.json << std::endl;
+         return 1;
+      }
+   }
+   return 0;
+#else
+   std::cerr << argv[0] << " is only available on Linux" << std::endl;
+   return 1;
+#endif
+}
@@ -0,0 +1,178 @@
+#include <utils/TrafficGenerator.h>                 // for library usage
+#include <utils/PcapWriter.h>                      // for library usage
+#include <utils/RecordingWriter.h>                 // for library usage
+#include <utils/UdpTransport.h>                    // for library usage
+#include <utils/IBufferProcessor.h>                // for library usage
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#if defined(__linux__)
+namespace
+{
+   /// sends every PDU as one datagram.
+   class TransportProcessor : public DIS::IBufferProcessor
+   {
+   public:
+      explicit TransportProcessor(DIS::UdpTransport& transport)
+         : _transport(transport)
+      {
+      }
+
+      void Process(const char* buf, unsigned int size, DIS::Endian /*e*/)
+      {
+         _transport.Send( buf , size );
+      }
+
+   private:
+      DIS::UdpTransport& _transport;
+   };
+
+   void Usage(const char* program)
+   {
+      std::cerr << "usage: " << program << " <udp:address:port|pcap:path|recording:path> [--entities <count>] [--threads <count>]\n"
+                << "          [--seed <number>] [--motion <static|linear|circle|random|mixed>] [--duration <seconds>] [--realtime <0|1>]\n"
+                << "          [--start <seconds since the epoch>]" << std::endl;
+   }
+}
+#endif
+
+/// simulates a number of entities and sends the PDUs they generate to a multicast group or a host,
+/// or writes them to a pcap capture or a recording.  the same seed and start time generate the same traffic.
+/// the traffic is sent at the simulated pace by default, and written as fast as possible to files.
+int main(int argc, char* argv[])
+{
+#if defined(__linux__)
+   if( argc < 2 )
+   {
+      Usage( argv[0] );
+      return 1;
+   }
+
+   DIS::TrafficGeneratorSettings settings;
+   double duration = 60.0;
+   int realtime = -1;
+   for(int i=2; i<argc; ++i)
+   {
+      const std::string option = argv[i];
+      if( i + 1 >= argc )
+      {
+         Usage( argv[0] );
+         return 1;
+      }
+
+      const std::string value = argv[++i];
+      if( option == "--entities" )        { settings.entities = static_cast<unsigned int>( atoi( value.c_str() ) ); }
+      else if( option == "--threads" )    { settings.threads = static_cast<unsigned int>( atoi( value.c_str() ) ); }
+      else if( option == "--seed" )       { settings.seed = static_cast<unsigned int>( atoi( value.c_str() ) ); }
+      else if( option == "--duration" )   { duration = atof( value.c_str() ); }
+      else if( option == "--realtime" )   { realtime = atoi( value.c_str() ); }
+      else if( option == "--start" )      { settings.startTime = static_cast<long long>( atof( value.c_str() ) * 1e9 ); }
+      else if( option == "--motion" && value == "static" )   { settings.motion = DIS::MOTION_STATIC; }
+      else if( option == "--motion" && value == "linear" )   { settings.motion = DIS::MOTION_LINEAR; }
+      else if( option == "--motion" && value == "circle" )   { settings.motion = DIS::MOTION_CIRCLE; }
+      else if( option == "--motion" && value == "random" )   { settings.motion = DIS::MOTION_RANDOM_WALK; }
+      else if( option == "--motion" && value == "mixed" )    { settings.motion = DIS::MOTION_MIXED; }
+      else
+      {
+         Usage( argv[0] );
+         return 1;
+      }
+   }
+
+   // the traffic goes to one of the outputs.
+   const std::string output = argv[1];
+   DIS::UdpTransport transport;
+   TransportProcessor sender( transport );
+   DIS::PcapWriter capture;
+   DIS::RecordingWriter recording;
+   DIS::IBufferProcessor* processor = NULL;
+   int error = 0;
+   if( output.compare( 0 , 4 , "udp:" ) == 0 && output.rfind( ':' ) > 4 )
+   {
+      const size_t colon = output.rfind( ':' );
+      DIS::UdpTransportSettings transportSettings;
+      transportSettings.destination = output.substr( 4 , colon - 4 );
+      transportSettings.destinationPort = static_cast<unsigned short>( atoi( output.c_str() + colon + 1 ) );
+      processor = &sender;
+      error = transport.Open( transportSettings ) ? 0 : transport.GetLastError();
+      realtime = ( realtime < 0 ) ? 1 : realtime;
+   }
+   else if( output.compare( 0 , 5 , "pcap:" ) == 0 )
+   {
+      processor = &capture;
+      error = capture.Open( output.substr( 5 ) ) ? 0 : capture.GetLastError();
+   }
+   else if( output.compare( 0 , 10 , "recording:" ) == 0 )
+   {
+      DIS::RecordingWriterSettings recordingSettings;
+      recordingSettings.waitForChunks = true;
+      processor = &recording;
+      error = recording.Open( output.substr( 10 ) , recordingSettings ) ? 0 : recording.GetLastError();
+   }
+   else
+   {
+      Usage( argv[0] );
+      return 1;
+   }
+   if( error != 0 )
+   {
+      std::cerr << "unable to open " << output << ": " << strerror( error ) << std::endl;
+      return 1;
+   }
+
+   DIS::TrafficGenerator generator;
+   if( !generator.Start( settings ) )
+   {
+      std::cerr << "the settings are not valid" << std::endl;
+      return 1;
+   }
+
+   // the PDUs appear to come from this host.
+   DIS::ReceiveContext context;
+   context.sourceAddress = 0x7f000001;
+   context.sourcePort = 3000;
+
+   const unsigned long long ticks = static_cast<unsigned long long>( duration * 1000 / settings.tickMs );
+   const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   unsigned long long pdus = 0;
+   for(unsigned long long tick=0; tick<ticks; ++tick)
+   {
+      if( realtime > 0 )
+      {
+         std::this_thread::sleep_until( start + std::chrono::milliseconds( tick * settings.tickMs ) );
+      }
+      pdus += generator.Generate( *processor , context );
+      if( processor == &sender )
+      {
+         transport.Flush();
+      }
+   }
+   const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+   const unsigned int threads = generator.GetThreadCount();
+   generator.Stop();
+   transport.Close();
+   capture.Close();
+   recording.Close();
+
+   const DIS::TrafficStatistics statistics = generator.GetStatistics();
+   std::cout << "threads:       " << threads << std::endl;
+   std::cout << "entity state:  " << statistics.entityStates << std::endl;
+   std::cout << "fire:          " << statistics.fires << std::endl;
+   std::cout << "detonation:    " << statistics.detonations << std::endl;
+   std::cout << "transmitter:   " << statistics.transmitters << std::endl;
+   std::cout << "signal:        " << statistics.signals << std::endl;
+   std::cout << "emission:      " << statistics.emissions << std::endl;
+   std::cout << "bytes:         " << statistics.bytes << std::endl;
+   std::cout << "rate:          " << static_cast<unsigned long long>( pdus / seconds ) << " pdu/s over " << seconds << " s" << std::endl;
+   return 0;
+#else
+   std::cerr << argv[0] << " is only available on Linux" << std::endl;
+   return 1;
+#endif
+}
@@ -0,0 +1,90 @@
+
+#include <utils/PcapReader.h>                      // for library usage
+#include <utils/IncomingMessage.h>                 // for library usage
+#include <utils/IPacketProcessor.h>                // for library usage
+#include <dis6/Pdu.h>                             // for library usage
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+/// counts the decoded PDUs of each type.
+class CountingProcessor : public DIS::IPacketProcessor
+{
+public:
+   CountingProcessor()
+      : total(0)
+   {
+      memset( counts , 0 , sizeof(counts) );
+   }
+
+   void Process(const DIS::Pdu& packet)
+   {
+      ++counts[packet.getPduType()];
+      ++total;
+   }
+
+   unsigned long long counts[256];
+   unsigned long long total;
+};
+
+/// decodes every DIS PDU of a pcap or pcapng capture as fast as possible,
+/// and reports the throughput.  the capture can be decoded several times over,
+/// so that a short capture still gives a steady measurement.
+int main(int argc, char* argv[])
+{
+   if( argc < 2 )
+   {
+      std::cerr << "usage: " << argv[0] << " <capture.pcap> [port] [passes]" << std::endl;
+      return 1;
+   }
+
+   const unsigned short port = ( argc > 2 ) ? static_cast<unsigned short>( atoi( argv[2] ) ) : 0;
+   const unsigned int passes = ( argc > 3 ) ? static_cast<unsigned int>( atoi( argv[3] ) ) : 1;
+
+   DIS::PcapReader reader;
+   if( !reader.Open( argv[1] ) )
+   {
+      std::cerr << "unable to read " << argv[1] << ": " << strerror( reader.GetLastError() ) << std::endl;
+      return 1;
+   }
+
+   // every PDU type is decoded, even the ones nobody is listening to.
+   CountingProcessor processor;
+   DIS::IncomingMessage incoming;
+   for(unsigned int type=0; type<256; ++type)
+   {
+      incoming.AddProcessor( static_cast<unsigned char>( type ) , &processor );
+   }
+
+   unsigned long long datagrams = 0;
+   const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+   for(unsigned int pass=0; pass<passes; ++pass)
+   {
+      reader.Rewind();
+      datagrams += reader.Process( incoming , port );
+   }
+   const double seconds = std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+
+   std::cout << "file bytes:     " << reader.GetSize() << std::endl;
+   std::cout << "link type:      " << reader.GetLinkType() << std::endl;
+   std::cout << "datagrams:      " << datagrams << std::endl;
+   std::cout << "skipped frames: " << reader.GetSkippedCount() << std::endl;
+   std::cout << "decoded PDUs:   " << processor.total << std::endl;
+   for(unsigned int type=0; type<256; ++type)
+   {
+      if( processor.counts[type] > 0 )
+      {
+         std::cout << "   type " << type << ": " << processor.counts[type] << std::endl;
+      }
+   }
+   std::cout << "seconds:        " << seconds << std::endl;
+   if( seconds > 0 )
+   {
+      std::cout << "PDUs/second:    " << static_cast<unsigned long long>( processor.total / seconds ) << std::endl;
+      std::cout << "MB/second:      " << ( reader.GetSize() * static_cast<double>( passes ) / seconds / 1e6 ) << std::endl;
+   }
+
+   return 0;
+}
@@ -0,0 +1,86 @@
+#include <utils/PlaybackEngine.h>                  // for library usage
+#include <utils/RecordingReader.h>                 // for library usage
+#include <utils/PcapReader.h>                      // for library usage
+#include <utils/UdpTransport.h>                    // for library usage
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+/// plays a recording or a pcap capture back onto the network, at its recorded pace
+/// scaled by the speed, or as fast as possible with a speed of 0.
+/// the optional start time is in seconds from the beginning of the recording.
+int main(int argc, char* argv[])
+{
+#if defined(__linux__)
+   if( argc < 2 )
+   {
+      std::cerr << "usage: " << argv[0] << " <recording|capture.pcap> [destination] [port] [speed] [start] [rewrite]" << std::endl;
+      return 1;
+   }
+
+   DIS::UdpTransportSettings transportSettings;
+   transportSettings.port = 0;
+   transportSettings.destination = ( argc > 2 ) ? argv[2] : "127.0.0.1";
+   transportSettings.destinationPort = static_cast<unsigned short>( ( argc > 3 ) ? atoi( argv[3] ) : 3000 );
+
+   DIS::PlaybackSettings settings;
+   settings.speed = ( argc > 4 ) ? atof( argv[4] ) : 1.0;
+   const double start = ( argc > 5 ) ? atof( argv[5] ) : 0.0;
+   settings.rewriteTimestamps = ( argc > 6 ) && atoi( argv[6] ) != 0;
+
+   // the file is either a recording, or a capture.
+   DIS::RecordingReader recording;
+   DIS::PcapReader capture;
+   DIS::IPlaybackSource* source = NULL;
+   long long first = 0;
+   if( recording.Open( argv[1] ) )
+   {
+      source = &recording;
+      first = recording.GetFirstTimestamp();
+   }
+   else if( capture.Open( argv[1] ) )
+   {
+      source = &capture;
+      DIS::PcapDatagram datagram;
+      if( capture.Next( datagram ) )
+      {
+         first = datagram.timestamp;
+      }
+      capture.Rewind();
+   }
+   else
+   {
+      std::cerr << "unable to read " << argv[1] << ": " << strerror( capture.GetLastError() ) << std::endl;
+      return 1;
+   }
+
+   if( start > 0 && !source->Seek( first + static_cast<long long>( start * 1e9 ) ) )
+   {
+      std::cerr << "the recording ends before " << start << " seconds" << std::endl;
+      return 1;
+   }
+
+   DIS::UdpTransport transport;
+   if( !transport.Open( transportSettings ) )
+   {
+      std::cerr << "unable to open the socket: " << strerror( transport.GetLastError() ) << std::endl;
+      return 1;
+   }
+
+   DIS::PlaybackEngine engine;
+   engine.Play( *source , transport , settings );
+   transport.Close();
+
+   const DIS::PlaybackStatistics statistics = engine.GetStatistics();
+   std::cout << "sent:          " << statistics.sent << std::endl;
+   std::cout << "batches:       " << statistics.batches << std::endl;
+   std::cout << "late:          " << statistics.late << std::endl;
+   std::cout << "max lateness:  " << statistics.maxLateness / 1000 << " us" << std::endl;
+   return 0;
+#else
+   std::cerr << argv[0] << " is only available on Linux" << std::endl;
+   return 1;
+#endif
+}
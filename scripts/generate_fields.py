@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Generates src/dis6/Fields.h and src/dis7/Fields.h from the marshal functions of the classes.
+
+Each VisitFields() lists the fields of a class in the order its marshal() writes them,
+through the getters of the class.  Run it again after a class is added or its marshal()
+changes, rather than editing the headers:
+
+    python3 scripts/generate_fields.py [path/to/src]
+
+The parser reads the marshal() bodies as written by the code generator of the classes.
+A line it does not recognize stops the script, naming the class; such a class is then
+written by hand in SPECIAL below.
+"""
+
+import glob
+import os
+import re
+import sys
+
+# the classes whose marshal() does not follow the generated pattern.
+SPECIAL = {
+    ('dis6', 'VariableDatum'): [
+        'v.Field( "variableDatumID" , r.getVariableDatumID() , others.getVariableDatumID()... );',
+        'v.Field( "variableDatumLength" , r.getVariableDatumLength() , others.getVariableDatumLength()... );',
+        'v.Array( "variableDatums" , MakeFieldArray( r.getVariableDatums() , r.getArrayLength() ) , MakeFieldArray( others.getVariableDatums() , others.getArrayLength() )... );'],
+    ('dis7', 'VariableDatum'): [
+        'v.Field( "variableDatumID" , r.getVariableDatumID() , others.getVariableDatumID()... );',
+        'v.Count( "variableDatumLength" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() * 64 ) , static_cast<unsigned int>( others.getVariableDatums().size() * 64 )... );',
+        'v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );'],
+}
+
+COUNT = re.compile(r'dataStream << \(\s*([\w ]+?)\s*\)(_\w+)\.size\(\);')
+LOOP = re.compile(r'for\((?:size_t|unsigned int) idx = 0; idx < (\w+)(\.size\(\))?; idx\+\+\)')
+
+
+def read(*paths):
+    text = ''
+    for path in paths:
+        if os.path.exists(path):
+            with open(path, encoding='latin1') as f:
+                text += f.read()
+    return text
+
+
+def parse_class(lib, name):
+    """@return the class name, its header, its members and the operations of its marshal()."""
+    header = read('%s/%s.h' % (lib, name))
+    m = re.search(r'class\s+EXPORT_MACRO\s+(\w+)\s*(?::\s*public\s+(\w+))?\s*\{', header)
+    if not m:
+        return None
+    cname = m.group(1)
+
+    body = header[m.end():]
+    members = []
+    for dm in re.finditer(r'^\s*([\w:<> ]+?)\s+(_\w+)\s*(\[(\w+)\])?\s*;', body[:body.find('public:')], re.M):
+        members.append((dm.group(1).strip(), dm.group(2), dm.group(4)))
+
+    source = read('%s/%s.cpp' % (lib, name), '%s/%s.h' % (lib, name))
+    mm = re.search(r'void %s::marshal\(DataStream& dataStream\) const\s*\{(.*?)\n ?\}' % cname, source, re.S)
+    if not mm:
+        return None
+
+    ops = []
+    lines = [l.strip() for l in mm.group(1).split('\n') if l.strip()]
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        if re.match(r'\w+::marshal\(dataStream\);', line):
+            ops.append(('base', line.split('::')[0]))
+        elif re.match(r'dataStream << (_\w+);$', line):
+            ops.append(('prim', line[14:-1]))
+        elif re.match(r'(_\w+)\.marshal\(dataStream\);', line):
+            ops.append(('rec', line.split('.')[0]))
+        elif COUNT.match(line):
+            ops.append(('count', COUNT.match(line).group(2)))
+        elif line.startswith('for(') and LOOP.match(line):
+            loop = LOOP.match(line)
+            if loop.group(2):
+                ops.append(('list', loop.group(1)))
+            else:
+                ops.append(('array', lines[i + 2].split('<<')[1].strip().split('[')[0]))
+            while lines[i] != '}':
+                i += 1
+        elif line == 'dataStream << this->getLength();':
+            ops.append(('length', '_length'))
+        elif (lib, cname) not in SPECIAL:
+            sys.exit('%s/%s: cannot read "%s"' % (lib, cname, line))
+        i += 1
+
+    casts = dict((b, a) for a, b in COUNT.findall(source))
+    return cname, dict(header=header, members=members, ops=ops, casts=casts)
+
+
+def getter(header, field):
+    m = re.search(r'\b(get%s)\(\)\s*const' % re.escape(field[1:]), header, re.I)
+    if not m:
+        sys.exit('no getter for %s' % field)
+    return m.group(1)
+
+
+def visit_lines(lib, cname, c):
+    if (lib, cname) in SPECIAL:
+        return list(SPECIAL[(lib, cname)])
+
+    h = c['header']
+    names = [m[1] for m in c['members']]
+    dims = dict((m[1], m[2]) for m in c['members'])
+    used = set(ref for kind, ref in c['ops'] if kind not in ('base', 'count'))
+    unused = [n for n in names if n not in used]
+    ops = [o for o in c['ops'] if o[0] != 'base']
+
+    lines = []
+    for i, (kind, ref) in enumerate(ops):
+        if kind == 'count':
+            # the member holding the count is the one in the same position, or else a _numberOf member.
+            name = names[i] if i < len(names) and names[i] in unused else None
+            if name is None:
+                name = [n for n in unused if n.lower().startswith('_numberof')][0]
+            unused.remove(name)
+            g = getter(h, ref)
+            cast = c['casts'][ref]
+            lines.append('v.Count( "%s" , "%s" , static_cast<%s>( r.%s().size() ) , static_cast<%s>( others.%s().size() )... );'
+                         % (name[1:], ref[1:], cast, g, cast, g))
+        elif kind == 'length':
+            lines.append('v.Field( "length" , r.getLength() , others.getLength()... );')
+        elif kind in ('prim', 'rec'):
+            g = getter(h, ref)
+            lines.append('v.Field( "%s" , r.%s() , others.%s()... );' % (ref[1:], g, g))
+        elif kind == 'list':
+            g = getter(h, ref)
+            lines.append('v.List( "%s" , r.%s() , others.%s()... );' % (ref[1:], g, g))
+        elif kind == 'array':
+            g = getter(h, ref)
+            lines.append('v.Array( "%s" , MakeFieldArray( r.%s() , %s ) , MakeFieldArray( others.%s() , %s )... );'
+                         % (ref[1:], g, dims[ref], g, dims[ref]))
+    return lines
+
+
+def generate(lib):
+    classes = {}
+    for path in sorted(glob.glob('%s/*.h' % lib)):
+        parsed = parse_class(lib, os.path.basename(path)[:-2])
+        if parsed:
+            classes[parsed[0]] = parsed[1]
+
+    out = []
+    for cname in sorted(classes):
+        c = classes[cname]
+        body = []
+        bases = [ref for kind, ref in c['ops'] if kind == 'base']
+        if bases:
+            body.append('VisitFields( v , static_cast<const %s&>( r ) , static_cast<const %s&>( others )... );'
+                        % (bases[0], bases[0]))
+        body += visit_lines(lib, cname, c)
+
+        if not body:
+            out.append('   template<typename Visitor, typename... Others>\n'
+                       '   void VisitFields(Visitor& /*v*/, const %s& /*r*/, const Others&... /*others*/)\n'
+                       '   {\n'
+                       '   }\n' % cname)
+        else:
+            out.append('   template<typename Visitor, typename... Others>\n'
+                       '   void VisitFields(Visitor& v, const %s& r, const Others&... others)\n'
+                       '   {\n'
+                       '%s\n'
+                       '   }\n' % (cname, '\n'.join('      ' + l for l in body)))
+
+    includes = '#include <utils/FieldVisitor.h>\n' + ''.join('#include <%s/%s.h>\n' % (lib, n) for n in sorted(classes))
+    guard = '_dcl_%s_fields_h_' % lib
+    text = '''/// Copyright goes here
+/// License goes here
+
+#ifndef %(guard)s
+#define %(guard)s
+
+%(includes)s
+/// the fields of every %(version)s PDU and record, in the order they are marshalled.
+/// see utils/FieldVisitor.h for the calls made to the visitor, and utils/FieldAlgorithms.h for the
+/// algorithms written on them.
+/// generated by scripts/generate_fields.py from the marshal functions, and not edited by hand.
+namespace DIS
+{
+%(body)s}
+
+#endif  // %(guard)s
+''' % dict(guard=guard, includes=includes, version={'dis6': 'DIS 6', 'dis7': 'DIS 7'}[lib], body='\n'.join(out))
+
+    with open('%s/Fields.h' % lib, 'w') as f:
+        f.write(text)
+
+
+if __name__ == '__main__':
+    os.chdir(sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'src'))
+    for lib in ('dis6', 'dis7'):
+        generate(lib)
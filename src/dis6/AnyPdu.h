@@ -0,0 +1,16 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis6_any_pdu_h_
+#define _dcl_dis6_any_pdu_h_
+
+#include <utils/AnyPdu.h>             // for BasicAnyPdu
+#include <dis6/PduRegistry.h>         // for PduRegistry
+
+namespace DIS
+{
+   /// holds any PDU of dis6/PduRegistry.h inline.
+   typedef BasicAnyPdu<PduRegistry, Pdu> AnyPdu;
+}
+
+#endif  // _dcl_dis6_any_pdu_h_
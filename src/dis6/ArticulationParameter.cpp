@@ -1,3 +1,4 @@
+#define DIS_ARTICULATION_PARAMETER_DEFINITIONS
 #include <dis6/ArticulationParameter.h>
 
 using namespace DIS;
@@ -66,25 +67,6 @@ void ArticulationParameter::setParameterValue(double pX)
     _parameterValue = pX;
 }
 
-void ArticulationParameter::marshal(DataStream& dataStream) const
-{
-    dataStream << _parameterTypeDesignator;
-    dataStream << _changeIndicator;
-    dataStream << _partAttachedTo;
-    dataStream << _parameterType;
-    dataStream << _parameterValue;
-}
-
-void ArticulationParameter::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _parameterTypeDesignator;
-    dataStream >> _changeIndicator;
-    dataStream >> _partAttachedTo;
-    dataStream >> _parameterType;
-    dataStream >> _parameterValue;
-}
-
-
 bool ArticulationParameter::operator ==(const ArticulationParameter& rhs) const
  {
      bool ivarsEqual = true;
@@ -98,18 +80,6 @@ bool ArticulationParameter::operator ==(const ArticulationParameter& rhs) const
     return ivarsEqual;
  }
 
-int ArticulationParameter::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 1;  // _parameterTypeDesignator
-   marshalSize = marshalSize + 1;  // _changeIndicator
-   marshalSize = marshalSize + 2;  // _partAttachedTo
-   marshalSize = marshalSize + 4;  // _parameterType
-   marshalSize = marshalSize + 8;  // _parameterValue
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -55,6 +56,42 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by ArticulationParameter.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_ARTICULATION_PARAMETER_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void ArticulationParameter::marshal(DataStream& dataStream) const
+{
+    dataStream << _parameterTypeDesignator;
+    dataStream << _changeIndicator;
+    dataStream << _partAttachedTo;
+    dataStream << _parameterType;
+    dataStream << _parameterValue;
+}
+
+DIS_RECORD_CODEC void ArticulationParameter::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _parameterTypeDesignator;
+    dataStream >> _changeIndicator;
+    dataStream >> _partAttachedTo;
+    dataStream >> _parameterType;
+    dataStream >> _parameterValue;
+}
+
+DIS_RECORD_CODEC int ArticulationParameter::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 1;  // _parameterTypeDesignator
+   marshalSize = marshalSize + 1;  // _changeIndicator
+   marshalSize = marshalSize + 2;  // _partAttachedTo
+   marshalSize = marshalSize + 4;  // _parameterType
+   marshalSize = marshalSize + 8;  // _parameterValue
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -1,3 +1,4 @@
+#define DIS_BURST_DESCRIPTOR_DEFINITIONS
 #include <dis6/BurstDescriptor.h>
 
 using namespace DIS;
@@ -71,25 +72,6 @@ void BurstDescriptor::setRate(unsigned short pX)
     _rate = pX;
 }
 
-void BurstDescriptor::marshal(DataStream& dataStream) const
-{
-    _munition.marshal(dataStream);
-    dataStream << _warhead;
-    dataStream << _fuse;
-    dataStream << _quantity;
-    dataStream << _rate;
-}
-
-void BurstDescriptor::unmarshal(DataStream& dataStream)
-{
-    _munition.unmarshal(dataStream);
-    dataStream >> _warhead;
-    dataStream >> _fuse;
-    dataStream >> _quantity;
-    dataStream >> _rate;
-}
-
-
 bool BurstDescriptor::operator ==(const BurstDescriptor& rhs) const
  {
      bool ivarsEqual = true;
@@ -103,18 +85,6 @@ bool BurstDescriptor::operator ==(const BurstDescriptor& rhs) const
     return ivarsEqual;
  }
 
-int BurstDescriptor::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + _munition.getMarshalledSize();  // _munition
-   marshalSize = marshalSize + 2;  // _warhead
-   marshalSize = marshalSize + 2;  // _fuse
-   marshalSize = marshalSize + 2;  // _quantity
-   marshalSize = marshalSize + 2;  // _rate
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
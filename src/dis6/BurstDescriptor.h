@@ -3,6 +3,7 @@
 #include <dis6/EntityType.h>
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -62,6 +63,42 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by BurstDescriptor.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_BURST_DESCRIPTOR_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void BurstDescriptor::marshal(DataStream& dataStream) const
+{
+    _munition.marshal(dataStream);
+    dataStream << _warhead;
+    dataStream << _fuse;
+    dataStream << _quantity;
+    dataStream << _rate;
+}
+
+DIS_RECORD_CODEC void BurstDescriptor::unmarshal(DataStream& dataStream)
+{
+    _munition.unmarshal(dataStream);
+    dataStream >> _warhead;
+    dataStream >> _fuse;
+    dataStream >> _quantity;
+    dataStream >> _rate;
+}
+
+DIS_RECORD_CODEC int BurstDescriptor::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + _munition.getMarshalledSize();  // _munition
+   marshalSize = marshalSize + 2;  // _warhead
+   marshalSize = marshalSize + 2;  // _fuse
+   marshalSize = marshalSize + 2;  // _quantity
+   marshalSize = marshalSize + 2;  // _rate
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
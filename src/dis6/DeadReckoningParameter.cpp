@@ -1,3 +1,4 @@
+#define DIS_DEAD_RECKONING_PARAMETER_DEFINITIONS
 #include <dis6/DeadReckoningParameter.h>
 
 using namespace DIS;
@@ -78,33 +79,6 @@ void DeadReckoningParameter::setEntityAngularVelocity(const Vector3Float &pX)
     _entityAngularVelocity = pX;
 }
 
-void DeadReckoningParameter::marshal(DataStream& dataStream) const
-{
-    dataStream << _deadReckoningAlgorithm;
-
-     for(size_t idx = 0; idx < 15; idx++)
-     {
-        dataStream << _otherParameters[idx];
-     }
-
-    _entityLinearAcceleration.marshal(dataStream);
-    _entityAngularVelocity.marshal(dataStream);
-}
-
-void DeadReckoningParameter::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _deadReckoningAlgorithm;
-
-     for(size_t idx = 0; idx < 15; idx++)
-     {
-        dataStream >> _otherParameters[idx];
-     }
-
-    _entityLinearAcceleration.unmarshal(dataStream);
-    _entityAngularVelocity.unmarshal(dataStream);
-}
-
-
 bool DeadReckoningParameter::operator ==(const DeadReckoningParameter& rhs) const
  {
      bool ivarsEqual = true;
@@ -122,17 +96,6 @@ bool DeadReckoningParameter::operator ==(const DeadReckoningParameter& rhs) cons
     return ivarsEqual;
  }
 
-int DeadReckoningParameter::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 1;  // _deadReckoningAlgorithm
-   marshalSize = marshalSize + 15 * 1;  // _otherParameters
-   marshalSize = marshalSize + _entityLinearAcceleration.getMarshalledSize();  // _entityLinearAcceleration
-   marshalSize = marshalSize + _entityAngularVelocity.getMarshalledSize();  // _entityAngularVelocity
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
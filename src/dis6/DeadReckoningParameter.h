@@ -4,6 +4,7 @@
 #include <dis6/Vector3Float.h>
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -59,6 +60,49 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by DeadReckoningParameter.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_DEAD_RECKONING_PARAMETER_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void DeadReckoningParameter::marshal(DataStream& dataStream) const
+{
+    dataStream << _deadReckoningAlgorithm;
+
+     for(size_t idx = 0; idx < 15; idx++)
+     {
+        dataStream << _otherParameters[idx];
+     }
+
+    _entityLinearAcceleration.marshal(dataStream);
+    _entityAngularVelocity.marshal(dataStream);
+}
+
+DIS_RECORD_CODEC void DeadReckoningParameter::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _deadReckoningAlgorithm;
+
+     for(size_t idx = 0; idx < 15; idx++)
+     {
+        dataStream >> _otherParameters[idx];
+     }
+
+    _entityLinearAcceleration.unmarshal(dataStream);
+    _entityAngularVelocity.unmarshal(dataStream);
+}
+
+DIS_RECORD_CODEC int DeadReckoningParameter::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 1;  // _deadReckoningAlgorithm
+   marshalSize = marshalSize + 15 * 1;  // _otherParameters
+   marshalSize = marshalSize + _entityLinearAcceleration.getMarshalledSize();  // _entityLinearAcceleration
+   marshalSize = marshalSize + _entityAngularVelocity.getMarshalledSize();  // _entityAngularVelocity
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -1,3 +1,4 @@
+#define DIS_DISTRIBUTED_EMISSIONS_FAMILY_PDU_DEFINITIONS
 #include <dis6/DistributedEmissionsFamilyPdu.h>
 
 using namespace DIS;
@@ -13,17 +14,6 @@ DistributedEmissionsFamilyPdu::~DistributedEmissionsFamilyPdu()
 {
 }
 
-void DistributedEmissionsFamilyPdu::marshal(DataStream& dataStream) const
-{
-    Pdu::marshal(dataStream); // Marshal information in superclass first
-}
-
-void DistributedEmissionsFamilyPdu::unmarshal(DataStream& dataStream)
-{
-    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
-}
-
-
 bool DistributedEmissionsFamilyPdu::operator ==(const DistributedEmissionsFamilyPdu& rhs) const
  {
      bool ivarsEqual = true;
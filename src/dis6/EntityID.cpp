@@ -1,3 +1,4 @@
+#define DIS_ENTITY_ID_DEFINITIONS
 #include <dis6/EntityID.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void EntityID::setEntity(unsigned short pX)
     _entity = pX;
 }
 
-void EntityID::marshal(DataStream& dataStream) const
-{
-    dataStream << _site;
-    dataStream << _application;
-    dataStream << _entity;
-}
-
-void EntityID::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _site;
-    dataStream >> _application;
-    dataStream >> _entity;
-}
-
-
 bool EntityID::operator ==(const EntityID& rhs) const
  {
      bool ivarsEqual = true;
@@ -70,16 +56,6 @@ bool EntityID::operator ==(const EntityID& rhs) const
     return ivarsEqual;
  }
 
-int EntityID::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 2;  // _site
-   marshalSize = marshalSize + 2;  // _application
-   marshalSize = marshalSize + 2;  // _entity
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
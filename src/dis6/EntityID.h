@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -48,6 +49,36 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by EntityID.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_ENTITY_ID_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void EntityID::marshal(DataStream& dataStream) const
+{
+    dataStream << _site;
+    dataStream << _application;
+    dataStream << _entity;
+}
+
+DIS_RECORD_CODEC void EntityID::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _site;
+    dataStream >> _application;
+    dataStream >> _entity;
+}
+
+DIS_RECORD_CODEC int EntityID::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 2;  // _site
+   marshalSize = marshalSize + 2;  // _application
+   marshalSize = marshalSize + 2;  // _entity
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
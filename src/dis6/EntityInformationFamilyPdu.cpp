@@ -1,3 +1,4 @@
+#define DIS_ENTITY_INFORMATION_FAMILY_PDU_DEFINITIONS
 #include <dis6/EntityInformationFamilyPdu.h>
 
 using namespace DIS;
@@ -13,17 +14,6 @@ EntityInformationFamilyPdu::~EntityInformationFamilyPdu()
 {
 }
 
-void EntityInformationFamilyPdu::marshal(DataStream& dataStream) const
-{
-    Pdu::marshal(dataStream); // Marshal information in superclass first
-}
-
-void EntityInformationFamilyPdu::unmarshal(DataStream& dataStream)
-{
-    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
-}
-
-
 bool EntityInformationFamilyPdu::operator ==(const EntityInformationFamilyPdu& rhs) const
  {
      bool ivarsEqual = true;
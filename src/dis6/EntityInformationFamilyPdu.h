@@ -3,6 +3,7 @@
 #include <dis6/Pdu.h>
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -31,6 +32,22 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by EntityInformationFamilyPdu.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_ENTITY_INFORMATION_FAMILY_PDU_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void EntityInformationFamilyPdu::marshal(DataStream& dataStream) const
+{
+    Pdu::marshal(dataStream); // Marshal information in superclass first
+}
+
+DIS_RECORD_CODEC void EntityInformationFamilyPdu::unmarshal(DataStream& dataStream)
+{
+    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
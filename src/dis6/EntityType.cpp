@@ -1,3 +1,4 @@
+#define DIS_ENTITY_TYPE_DEFINITIONS
 #include <dis6/EntityType.h>
 
 using namespace DIS;
@@ -88,29 +89,6 @@ void EntityType::setExtra(unsigned char pX)
     _extra = pX;
 }
 
-void EntityType::marshal(DataStream& dataStream) const
-{
-    dataStream << _entityKind;
-    dataStream << _domain;
-    dataStream << _country;
-    dataStream << _category;
-    dataStream << _subcategory;
-    dataStream << _specific;
-    dataStream << _extra;
-}
-
-void EntityType::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _entityKind;
-    dataStream >> _domain;
-    dataStream >> _country;
-    dataStream >> _category;
-    dataStream >> _subcategory;
-    dataStream >> _specific;
-    dataStream >> _extra;
-}
-
-
 bool EntityType::operator ==(const EntityType& rhs) const
  {
      bool ivarsEqual = true;
@@ -126,20 +104,6 @@ bool EntityType::operator ==(const EntityType& rhs) const
     return ivarsEqual;
  }
 
-int EntityType::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 1;  // _entityKind
-   marshalSize = marshalSize + 1;  // _domain
-   marshalSize = marshalSize + 2;  // _country
-   marshalSize = marshalSize + 1;  // _category
-   marshalSize = marshalSize + 1;  // _subcategory
-   marshalSize = marshalSize + 1;  // _specific
-   marshalSize = marshalSize + 1;  // _extra
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -71,6 +72,48 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by EntityType.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_ENTITY_TYPE_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void EntityType::marshal(DataStream& dataStream) const
+{
+    dataStream << _entityKind;
+    dataStream << _domain;
+    dataStream << _country;
+    dataStream << _category;
+    dataStream << _subcategory;
+    dataStream << _specific;
+    dataStream << _extra;
+}
+
+DIS_RECORD_CODEC void EntityType::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _entityKind;
+    dataStream >> _domain;
+    dataStream >> _country;
+    dataStream >> _category;
+    dataStream >> _subcategory;
+    dataStream >> _specific;
+    dataStream >> _extra;
+}
+
+DIS_RECORD_CODEC int EntityType::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 1;  // _entityKind
+   marshalSize = marshalSize + 1;  // _domain
+   marshalSize = marshalSize + 2;  // _country
+   marshalSize = marshalSize + 1;  // _category
+   marshalSize = marshalSize + 1;  // _subcategory
+   marshalSize = marshalSize + 1;  // _specific
+   marshalSize = marshalSize + 1;  // _extra
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
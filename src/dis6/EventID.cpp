@@ -1,3 +1,4 @@
+#define DIS_EVENT_ID_DEFINITIONS
 #include <dis6/EventID.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void EventID::setEventNumber(unsigned short pX)
     _eventNumber = pX;
 }
 
-void EventID::marshal(DataStream& dataStream) const
-{
-    dataStream << _site;
-    dataStream << _application;
-    dataStream << _eventNumber;
-}
-
-void EventID::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _site;
-    dataStream >> _application;
-    dataStream >> _eventNumber;
-}
-
-
 bool EventID::operator ==(const EventID& rhs) const
  {
      bool ivarsEqual = true;
@@ -70,16 +56,6 @@ bool EventID::operator ==(const EventID& rhs) const
     return ivarsEqual;
  }
 
-int EventID::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 2;  // _site
-   marshalSize = marshalSize + 2;  // _application
-   marshalSize = marshalSize + 2;  // _eventNumber
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -0,0 +1,1666 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis6_fields_h_
+#define _dcl_dis6_fields_h_
+
+#include <utils/FieldVisitor.h>
+#include <dis6/AcknowledgePdu.h>
+#include <dis6/AcknowledgeReliablePdu.h>
+#include <dis6/AcousticBeamData.h>
+#include <dis6/AcousticBeamFundamentalParameter.h>
+#include <dis6/AcousticEmitter.h>
+#include <dis6/AcousticEmitterSystem.h>
+#include <dis6/AcousticEmitterSystemData.h>
+#include <dis6/ActionRequestPdu.h>
+#include <dis6/ActionRequestReliablePdu.h>
+#include <dis6/ActionResponsePdu.h>
+#include <dis6/ActionResponseReliablePdu.h>
+#include <dis6/AggregateID.h>
+#include <dis6/AggregateMarking.h>
+#include <dis6/AggregateStatePdu.h>
+#include <dis6/AggregateType.h>
+#include <dis6/AngularVelocityVector.h>
+#include <dis6/AntennaLocation.h>
+#include <dis6/ApaData.h>
+#include <dis6/ArealObjectStatePdu.h>
+#include <dis6/ArticulationParameter.h>
+#include <dis6/BeamAntennaPattern.h>
+#include <dis6/BeamData.h>
+#include <dis6/BurstDescriptor.h>
+#include <dis6/ClockTime.h>
+#include <dis6/CollisionElasticPdu.h>
+#include <dis6/CollisionPdu.h>
+#include <dis6/CommentPdu.h>
+#include <dis6/CommentReliablePdu.h>
+#include <dis6/CreateEntityPdu.h>
+#include <dis6/CreateEntityReliablePdu.h>
+#include <dis6/DataPdu.h>
+#include <dis6/DataQueryPdu.h>
+#include <dis6/DataQueryReliablePdu.h>
+#include <dis6/DataReliablePdu.h>
+#include <dis6/DeadReckoningParameter.h>
+#include <dis6/DesignatorPdu.h>
+#include <dis6/DetonationPdu.h>
+#include <dis6/DistributedEmissionsFamilyPdu.h>
+#include <dis6/EightByteChunk.h>
+#include <dis6/ElectromagneticEmissionBeamData.h>
+#include <dis6/ElectromagneticEmissionSystemData.h>
+#include <dis6/ElectromagneticEmissionsPdu.h>
+#include <dis6/EmitterSystem.h>
+#include <dis6/EntityID.h>
+#include <dis6/EntityInformationFamilyPdu.h>
+#include <dis6/EntityManagementFamilyPdu.h>
+#include <dis6/EntityStatePdu.h>
+#include <dis6/EntityStateUpdatePdu.h>
+#include <dis6/EntityType.h>
+#include <dis6/Environment.h>
+#include <dis6/EnvironmentalProcessPdu.h>
+#include <dis6/EventID.h>
+#include <dis6/EventReportPdu.h>
+#include <dis6/EventReportReliablePdu.h>
+#include <dis6/FastEntityStatePdu.h>
+#include <dis6/FirePdu.h>
+#include <dis6/FixedDatum.h>
+#include <dis6/FourByteChunk.h>
+#include <dis6/FundamentalParameterData.h>
+#include <dis6/FundamentalParameterDataIff.h>
+#include <dis6/GridAxisRecord.h>
+#include <dis6/GridAxisRecordRepresentation0.h>
+#include <dis6/GridAxisRecordRepresentation1.h>
+#include <dis6/GridAxisRecordRepresentation2.h>
+#include <dis6/GriddedDataPdu.h>
+#include <dis6/IffAtcNavAidsLayer1Pdu.h>
+#include <dis6/IffAtcNavAidsLayer2Pdu.h>
+#include <dis6/IffFundamentalData.h>
+#include <dis6/IntercomCommunicationsParameters.h>
+#include <dis6/IntercomControlPdu.h>
+#include <dis6/IntercomSignalPdu.h>
+#include <dis6/IsGroupOfPdu.h>
+#include <dis6/IsPartOfPdu.h>
+#include <dis6/LayerHeader.h>
+#include <dis6/LinearObjectStatePdu.h>
+#include <dis6/LinearSegmentParameter.h>
+#include <dis6/LogisticsFamilyPdu.h>
+#include <dis6/LogisticsPdu.h>
+#include <dis6/Marking.h>
+#include <dis6/MinefieldDataPdu.h>
+#include <dis6/MinefieldFamilyPdu.h>
+#include <dis6/MinefieldPduFamily.h>
+#include <dis6/MinefieldQueryPdu.h>
+#include <dis6/MinefieldResponseNackPdu.h>
+#include <dis6/MinefieldStatePdu.h>
+#include <dis6/ModulationType.h>
+#include <dis6/NamedLocation.h>
+#include <dis6/ObjectType.h>
+#include <dis6/OneByteChunk.h>
+#include <dis6/Orientation.h>
+#include <dis6/Pdu.h>
+#include <dis6/PduContainer.h>
+#include <dis6/Point.h>
+#include <dis6/PointObjectStatePdu.h>
+#include <dis6/PropulsionSystemData.h>
+#include <dis6/RadioCommunicationsFamilyPdu.h>
+#include <dis6/RadioEntityType.h>
+#include <dis6/ReceiverPdu.h>
+#include <dis6/RecordQueryReliablePdu.h>
+#include <dis6/RecordSet.h>
+#include <dis6/Relationship.h>
+#include <dis6/RemoveEntityPdu.h>
+#include <dis6/RemoveEntityReliablePdu.h>
+#include <dis6/RepairCompletePdu.h>
+#include <dis6/RepairResponsePdu.h>
+#include <dis6/ResupplyCancelPdu.h>
+#include <dis6/ResupplyOfferPdu.h>
+#include <dis6/ResupplyReceivedPdu.h>
+#include <dis6/SeesPdu.h>
+#include <dis6/ServiceRequestPdu.h>
+#include <dis6/SetDataPdu.h>
+#include <dis6/SetDataReliablePdu.h>
+#include <dis6/SetRecordReliablePdu.h>
+#include <dis6/ShaftRPMs.h>
+#include <dis6/SignalPdu.h>
+#include <dis6/SimulationAddress.h>
+#include <dis6/SimulationManagementFamilyPdu.h>
+#include <dis6/SimulationManagementWithReliabilityFamilyPdu.h>
+#include <dis6/SixByteChunk.h>
+#include <dis6/SphericalHarmonicAntennaPattern.h>
+#include <dis6/StartResumePdu.h>
+#include <dis6/StartResumeReliablePdu.h>
+#include <dis6/StopFreezePdu.h>
+#include <dis6/StopFreezeReliablePdu.h>
+#include <dis6/SupplyQuantity.h>
+#include <dis6/SyntheticEnvironmentFamilyPdu.h>
+#include <dis6/SystemID.h>
+#include <dis6/TrackJamTarget.h>
+#include <dis6/TransferControlRequestPdu.h>
+#include <dis6/TransmitterPdu.h>
+#include <dis6/TwoByteChunk.h>
+#include <dis6/UaPdu.h>
+#include <dis6/VariableDatum.h>
+#include <dis6/Vector3Double.h>
+#include <dis6/Vector3Float.h>
+#include <dis6/VectoringNozzleSystemData.h>
+#include <dis6/WarfareFamilyPdu.h>
+
+/// the fields of every DIS 6 PDU and record, in the order they are marshalled.
+/// see utils/FieldVisitor.h for the calls made to the visitor, and utils/FieldAlgorithms.h for the
+/// algorithms written on them.
+/// generated by scripts/generate_fields.py from the marshal functions, and not edited by hand.
+namespace DIS
+{
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcknowledgePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "acknowledgeFlag" , r.getAcknowledgeFlag() , others.getAcknowledgeFlag()... );
+      v.Field( "responseFlag" , r.getResponseFlag() , others.getResponseFlag()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcknowledgeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "acknowledgeFlag" , r.getAcknowledgeFlag() , others.getAcknowledgeFlag()... );
+      v.Field( "responseFlag" , r.getResponseFlag() , others.getResponseFlag()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticBeamData& r, const Others&... others)
+   {
+      v.Field( "beamDataLength" , r.getBeamDataLength() , others.getBeamDataLength()... );
+      v.Field( "beamIDNumber" , r.getBeamIDNumber() , others.getBeamIDNumber()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "fundamentalDataParameters" , r.getFundamentalDataParameters() , others.getFundamentalDataParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticBeamFundamentalParameter& r, const Others&... others)
+   {
+      v.Field( "activeEmissionParameterIndex" , r.getActiveEmissionParameterIndex() , others.getActiveEmissionParameterIndex()... );
+      v.Field( "scanPattern" , r.getScanPattern() , others.getScanPattern()... );
+      v.Field( "beamCenterAzimuth" , r.getBeamCenterAzimuth() , others.getBeamCenterAzimuth()... );
+      v.Field( "azimuthalBeamwidth" , r.getAzimuthalBeamwidth() , others.getAzimuthalBeamwidth()... );
+      v.Field( "beamCenterDE" , r.getBeamCenterDE() , others.getBeamCenterDE()... );
+      v.Field( "deBeamwidth" , r.getDeBeamwidth() , others.getDeBeamwidth()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticEmitter& r, const Others&... others)
+   {
+      v.Field( "acousticName" , r.getAcousticName() , others.getAcousticName()... );
+      v.Field( "function" , r.getFunction() , others.getFunction()... );
+      v.Field( "acousticIdNumber" , r.getAcousticIdNumber() , others.getAcousticIdNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticEmitterSystem& r, const Others&... others)
+   {
+      v.Field( "acousticName" , r.getAcousticName() , others.getAcousticName()... );
+      v.Field( "acousticFunction" , r.getAcousticFunction() , others.getAcousticFunction()... );
+      v.Field( "acousticID" , r.getAcousticID() , others.getAcousticID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticEmitterSystemData& r, const Others&... others)
+   {
+      v.Field( "emitterSystemDataLength" , r.getEmitterSystemDataLength() , others.getEmitterSystemDataLength()... );
+      v.Count( "numberOfBeams" , "beamRecords" , static_cast<unsigned char>( r.getBeamRecords().size() ) , static_cast<unsigned char>( others.getBeamRecords().size() )... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "acousticEmitterSystem" , r.getAcousticEmitterSystem() , others.getAcousticEmitterSystem()... );
+      v.Field( "emitterLocation" , r.getEmitterLocation() , others.getEmitterLocation()... );
+      v.List( "beamRecords" , r.getBeamRecords() , others.getBeamRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionRequestPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "actionID" , r.getActionID() , others.getActionID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionRequestReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "actionID" , r.getActionID() , others.getActionID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionResponsePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requestStatus" , r.getRequestStatus() , others.getRequestStatus()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionResponseReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "responseStatus" , r.getResponseStatus() , others.getResponseStatus()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateID& r, const Others&... others)
+   {
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+      v.Field( "aggregateID" , r.getAggregateID() , others.getAggregateID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateMarking& r, const Others&... others)
+   {
+      v.Field( "characterSet" , r.getCharacterSet() , others.getCharacterSet()... );
+      v.Array( "characters" , MakeFieldArray( r.getCharacters() , 31 ) , MakeFieldArray( others.getCharacters() , 31 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityManagementFamilyPdu&>( r ) , static_cast<const EntityManagementFamilyPdu&>( others )... );
+      v.Field( "aggregateID" , r.getAggregateID() , others.getAggregateID()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Field( "aggregateState" , r.getAggregateState() , others.getAggregateState()... );
+      v.Field( "aggregateType" , r.getAggregateType() , others.getAggregateType()... );
+      v.Field( "formation" , r.getFormation() , others.getFormation()... );
+      v.Field( "aggregateMarking" , r.getAggregateMarking() , others.getAggregateMarking()... );
+      v.Field( "dimensions" , r.getDimensions() , others.getDimensions()... );
+      v.Field( "orientation" , r.getOrientation() , others.getOrientation()... );
+      v.Field( "centerOfMass" , r.getCenterOfMass() , others.getCenterOfMass()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Count( "numberOfDisAggregates" , "aggregateIDList" , static_cast<unsigned short>( r.getAggregateIDList().size() ) , static_cast<unsigned short>( others.getAggregateIDList().size() )... );
+      v.Count( "numberOfDisEntities" , "entityIDList" , static_cast<unsigned short>( r.getEntityIDList().size() ) , static_cast<unsigned short>( others.getEntityIDList().size() )... );
+      v.Count( "numberOfSilentAggregateTypes" , "silentAggregateSystemList" , static_cast<unsigned short>( r.getSilentAggregateSystemList().size() ) , static_cast<unsigned short>( others.getSilentAggregateSystemList().size() )... );
+      v.Count( "numberOfSilentEntityTypes" , "silentEntitySystemList" , static_cast<unsigned short>( r.getSilentEntitySystemList().size() ) , static_cast<unsigned short>( others.getSilentEntitySystemList().size() )... );
+      v.List( "aggregateIDList" , r.getAggregateIDList() , others.getAggregateIDList()... );
+      v.List( "entityIDList" , r.getEntityIDList() , others.getEntityIDList()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.List( "silentAggregateSystemList" , r.getSilentAggregateSystemList() , others.getSilentAggregateSystemList()... );
+      v.List( "silentEntitySystemList" , r.getSilentEntitySystemList() , others.getSilentEntitySystemList()... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumList" , static_cast<unsigned int>( r.getVariableDatumList().size() ) , static_cast<unsigned int>( others.getVariableDatumList().size() )... );
+      v.List( "variableDatumList" , r.getVariableDatumList() , others.getVariableDatumList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateType& r, const Others&... others)
+   {
+      v.Field( "aggregateKind" , r.getAggregateKind() , others.getAggregateKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AngularVelocityVector& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AntennaLocation& r, const Others&... others)
+   {
+      v.Field( "antennaLocation" , r.getAntennaLocation() , others.getAntennaLocation()... );
+      v.Field( "relativeAntennaLocation" , r.getRelativeAntennaLocation() , others.getRelativeAntennaLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ApaData& r, const Others&... others)
+   {
+      v.Field( "parameterIndex" , r.getParameterIndex() , others.getParameterIndex()... );
+      v.Field( "parameterValue" , r.getParameterValue() , others.getParameterValue()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ArealObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Field( "modifications" , r.getModifications() , others.getModifications()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.Field( "objectAppearance" , r.getObjectAppearance() , others.getObjectAppearance()... );
+      v.Count( "numberOfPoints" , "objectLocation" , static_cast<unsigned short>( r.getObjectLocation().size() ) , static_cast<unsigned short>( others.getObjectLocation().size() )... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.List( "objectLocation" , r.getObjectLocation() , others.getObjectLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ArticulationParameter& r, const Others&... others)
+   {
+      v.Field( "parameterTypeDesignator" , r.getParameterTypeDesignator() , others.getParameterTypeDesignator()... );
+      v.Field( "changeIndicator" , r.getChangeIndicator() , others.getChangeIndicator()... );
+      v.Field( "partAttachedTo" , r.getPartAttachedTo() , others.getPartAttachedTo()... );
+      v.Field( "parameterType" , r.getParameterType() , others.getParameterType()... );
+      v.Field( "parameterValue" , r.getParameterValue() , others.getParameterValue()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BeamAntennaPattern& r, const Others&... others)
+   {
+      v.Field( "beamDirection" , r.getBeamDirection() , others.getBeamDirection()... );
+      v.Field( "azimuthBeamwidth" , r.getAzimuthBeamwidth() , others.getAzimuthBeamwidth()... );
+      v.Field( "referenceSystem" , r.getReferenceSystem() , others.getReferenceSystem()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "ez" , r.getEz() , others.getEz()... );
+      v.Field( "ex" , r.getEx() , others.getEx()... );
+      v.Field( "phase" , r.getPhase() , others.getPhase()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BeamData& r, const Others&... others)
+   {
+      v.Field( "beamAzimuthCenter" , r.getBeamAzimuthCenter() , others.getBeamAzimuthCenter()... );
+      v.Field( "beamAzimuthSweep" , r.getBeamAzimuthSweep() , others.getBeamAzimuthSweep()... );
+      v.Field( "beamElevationCenter" , r.getBeamElevationCenter() , others.getBeamElevationCenter()... );
+      v.Field( "beamElevationSweep" , r.getBeamElevationSweep() , others.getBeamElevationSweep()... );
+      v.Field( "beamSweepSync" , r.getBeamSweepSync() , others.getBeamSweepSync()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BurstDescriptor& r, const Others&... others)
+   {
+      v.Field( "munition" , r.getMunition() , others.getMunition()... );
+      v.Field( "warhead" , r.getWarhead() , others.getWarhead()... );
+      v.Field( "fuse" , r.getFuse() , others.getFuse()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+      v.Field( "rate" , r.getRate() , others.getRate()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ClockTime& r, const Others&... others)
+   {
+      v.Field( "hour" , r.getHour() , others.getHour()... );
+      v.Field( "timePastHour" , r.getTimePastHour() , others.getTimePastHour()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CollisionElasticPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "issuingEntityID" , r.getIssuingEntityID() , others.getIssuingEntityID()... );
+      v.Field( "collidingEntityID" , r.getCollidingEntityID() , others.getCollidingEntityID()... );
+      v.Field( "collisionEventID" , r.getCollisionEventID() , others.getCollisionEventID()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "contactVelocity" , r.getContactVelocity() , others.getContactVelocity()... );
+      v.Field( "mass" , r.getMass() , others.getMass()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+      v.Field( "collisionResultXX" , r.getCollisionResultXX() , others.getCollisionResultXX()... );
+      v.Field( "collisionResultXY" , r.getCollisionResultXY() , others.getCollisionResultXY()... );
+      v.Field( "collisionResultXZ" , r.getCollisionResultXZ() , others.getCollisionResultXZ()... );
+      v.Field( "collisionResultYY" , r.getCollisionResultYY() , others.getCollisionResultYY()... );
+      v.Field( "collisionResultYZ" , r.getCollisionResultYZ() , others.getCollisionResultYZ()... );
+      v.Field( "collisionResultZZ" , r.getCollisionResultZZ() , others.getCollisionResultZZ()... );
+      v.Field( "unitSurfaceNormal" , r.getUnitSurfaceNormal() , others.getUnitSurfaceNormal()... );
+      v.Field( "coefficientOfRestitution" , r.getCoefficientOfRestitution() , others.getCoefficientOfRestitution()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CollisionPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "issuingEntityID" , r.getIssuingEntityID() , others.getIssuingEntityID()... );
+      v.Field( "collidingEntityID" , r.getCollidingEntityID() , others.getCollidingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "collisionType" , r.getCollisionType() , others.getCollisionType()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "mass" , r.getMass() , others.getMass()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CommentPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CommentReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CreateEntityPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CreateEntityReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataQueryPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "timeInterval" , r.getTimeInterval() , others.getTimeInterval()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataQueryReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "timeInterval" , r.getTimeInterval() , others.getTimeInterval()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DeadReckoningParameter& r, const Others&... others)
+   {
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 15 ) , MakeFieldArray( others.getOtherParameters() , 15 )... );
+      v.Field( "entityLinearAcceleration" , r.getEntityLinearAcceleration() , others.getEntityLinearAcceleration()... );
+      v.Field( "entityAngularVelocity" , r.getEntityAngularVelocity() , others.getEntityAngularVelocity()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DesignatorPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "designatingEntityID" , r.getDesignatingEntityID() , others.getDesignatingEntityID()... );
+      v.Field( "codeName" , r.getCodeName() , others.getCodeName()... );
+      v.Field( "designatedEntityID" , r.getDesignatedEntityID() , others.getDesignatedEntityID()... );
+      v.Field( "designatorCode" , r.getDesignatorCode() , others.getDesignatorCode()... );
+      v.Field( "designatorPower" , r.getDesignatorPower() , others.getDesignatorPower()... );
+      v.Field( "designatorWavelength" , r.getDesignatorWavelength() , others.getDesignatorWavelength()... );
+      v.Field( "designatorSpotWrtDesignated" , r.getDesignatorSpotWrtDesignated() , others.getDesignatorSpotWrtDesignated()... );
+      v.Field( "designatorSpotLocation" , r.getDesignatorSpotLocation() , others.getDesignatorSpotLocation()... );
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "entityLinearAcceleration" , r.getEntityLinearAcceleration() , others.getEntityLinearAcceleration()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DetonationPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "munitionID" , r.getMunitionID() , others.getMunitionID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "locationInWorldCoordinates" , r.getLocationInWorldCoordinates() , others.getLocationInWorldCoordinates()... );
+      v.Field( "burstDescriptor" , r.getBurstDescriptor() , others.getBurstDescriptor()... );
+      v.Field( "locationInEntityCoordinates" , r.getLocationInEntityCoordinates() , others.getLocationInEntityCoordinates()... );
+      v.Field( "detonationResult" , r.getDetonationResult() , others.getDetonationResult()... );
+      v.Count( "numberOfArticulationParameters" , "articulationParameters" , static_cast<unsigned char>( r.getArticulationParameters().size() ) , static_cast<unsigned char>( others.getArticulationParameters().size() )... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.List( "articulationParameters" , r.getArticulationParameters() , others.getArticulationParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DistributedEmissionsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EightByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 8 ) , MakeFieldArray( others.getOtherParameters() , 8 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionBeamData& r, const Others&... others)
+   {
+      v.Field( "beamDataLength" , r.getBeamDataLength() , others.getBeamDataLength()... );
+      v.Field( "beamIDNumber" , r.getBeamIDNumber() , others.getBeamIDNumber()... );
+      v.Field( "beamParameterIndex" , r.getBeamParameterIndex() , others.getBeamParameterIndex()... );
+      v.Field( "fundamentalParameterData" , r.getFundamentalParameterData() , others.getFundamentalParameterData()... );
+      v.Field( "beamFunction" , r.getBeamFunction() , others.getBeamFunction()... );
+      v.Count( "numberOfTrackJamTargets" , "trackJamTargets" , static_cast<unsigned char>( r.getTrackJamTargets().size() ) , static_cast<unsigned char>( others.getTrackJamTargets().size() )... );
+      v.Field( "highDensityTrackJam" , r.getHighDensityTrackJam() , others.getHighDensityTrackJam()... );
+      v.Field( "pad4" , r.getPad4() , others.getPad4()... );
+      v.Field( "jammingModeSequence" , r.getJammingModeSequence() , others.getJammingModeSequence()... );
+      v.List( "trackJamTargets" , r.getTrackJamTargets() , others.getTrackJamTargets()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionSystemData& r, const Others&... others)
+   {
+      v.Field( "systemDataLength" , r.getSystemDataLength() , others.getSystemDataLength()... );
+      v.Count( "numberOfBeams" , "beamDataRecords" , static_cast<unsigned char>( r.getBeamDataRecords().size() ) , static_cast<unsigned char>( others.getBeamDataRecords().size() )... );
+      v.Field( "emissionsPadding2" , r.getEmissionsPadding2() , others.getEmissionsPadding2()... );
+      v.Field( "emitterSystem" , r.getEmitterSystem() , others.getEmitterSystem()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+      v.List( "beamDataRecords" , r.getBeamDataRecords() , others.getBeamDataRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionsPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityID" , r.getEmittingEntityID() , others.getEmittingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "stateUpdateIndicator" , r.getStateUpdateIndicator() , others.getStateUpdateIndicator()... );
+      v.Count( "numberOfSystems" , "systems" , static_cast<unsigned char>( r.getSystems().size() ) , static_cast<unsigned char>( others.getSystems().size() )... );
+      v.Field( "paddingForEmissionsPdu" , r.getPaddingForEmissionsPdu() , others.getPaddingForEmissionsPdu()... );
+      v.List( "systems" , r.getSystems() , others.getSystems()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EmitterSystem& r, const Others&... others)
+   {
+      v.Field( "emitterName" , r.getEmitterName() , others.getEmitterName()... );
+      v.Field( "function" , r.getFunction() , others.getFunction()... );
+      v.Field( "emitterIdNumber" , r.getEmitterIdNumber() , others.getEmitterIdNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityID& r, const Others&... others)
+   {
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+      v.Field( "entity" , r.getEntity() , others.getEntity()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityInformationFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityManagementFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "forceId" , r.getForceId() , others.getForceId()... );
+      v.Count( "numberOfArticulationParameters" , "articulationParameters" , static_cast<char>( r.getArticulationParameters().size() ) , static_cast<char>( others.getArticulationParameters().size() )... );
+      v.Field( "entityType" , r.getEntityType() , others.getEntityType()... );
+      v.Field( "alternativeEntityType" , r.getAlternativeEntityType() , others.getAlternativeEntityType()... );
+      v.Field( "entityLinearVelocity" , r.getEntityLinearVelocity() , others.getEntityLinearVelocity()... );
+      v.Field( "entityLocation" , r.getEntityLocation() , others.getEntityLocation()... );
+      v.Field( "entityOrientation" , r.getEntityOrientation() , others.getEntityOrientation()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.Field( "deadReckoningParameters" , r.getDeadReckoningParameters() , others.getDeadReckoningParameters()... );
+      v.Field( "marking" , r.getMarking() , others.getMarking()... );
+      v.Field( "capabilities" , r.getCapabilities() , others.getCapabilities()... );
+      v.List( "articulationParameters" , r.getArticulationParameters() , others.getArticulationParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityStateUpdatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfArticulationParameters" , "articulationParameters" , static_cast<unsigned char>( r.getArticulationParameters().size() ) , static_cast<unsigned char>( others.getArticulationParameters().size() )... );
+      v.Field( "entityLinearVelocity" , r.getEntityLinearVelocity() , others.getEntityLinearVelocity()... );
+      v.Field( "entityLocation" , r.getEntityLocation() , others.getEntityLocation()... );
+      v.Field( "entityOrientation" , r.getEntityOrientation() , others.getEntityOrientation()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.List( "articulationParameters" , r.getArticulationParameters() , others.getArticulationParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Environment& r, const Others&... others)
+   {
+      v.Field( "environmentType" , r.getEnvironmentType() , others.getEnvironmentType()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+      v.Field( "index" , r.getIndex() , others.getIndex()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "geometry" , r.getGeometry() , others.getGeometry()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EnvironmentalProcessPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "environementalProcessID" , r.getEnvironementalProcessID() , others.getEnvironementalProcessID()... );
+      v.Field( "environmentType" , r.getEnvironmentType() , others.getEnvironmentType()... );
+      v.Field( "modelType" , r.getModelType() , others.getModelType()... );
+      v.Field( "environmentStatus" , r.getEnvironmentStatus() , others.getEnvironmentStatus()... );
+      v.Count( "numberOfEnvironmentRecords" , "environmentRecords" , static_cast<unsigned char>( r.getEnvironmentRecords().size() ) , static_cast<unsigned char>( others.getEnvironmentRecords().size() )... );
+      v.Field( "sequenceNumber" , r.getSequenceNumber() , others.getSequenceNumber()... );
+      v.List( "environmentRecords" , r.getEnvironmentRecords() , others.getEnvironmentRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventID& r, const Others&... others)
+   {
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+      v.Field( "eventNumber" , r.getEventNumber() , others.getEventNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventReportPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventReportReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FastEntityStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+      v.Field( "entity" , r.getEntity() , others.getEntity()... );
+      v.Field( "forceId" , r.getForceId() , others.getForceId()... );
+      v.Count( "numberOfArticulationParameters" , "articulationParameters" , static_cast<char>( r.getArticulationParameters().size() ) , static_cast<char>( others.getArticulationParameters().size() )... );
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+      v.Field( "altEntityKind" , r.getAltEntityKind() , others.getAltEntityKind()... );
+      v.Field( "altDomain" , r.getAltDomain() , others.getAltDomain()... );
+      v.Field( "altCountry" , r.getAltCountry() , others.getAltCountry()... );
+      v.Field( "altCategory" , r.getAltCategory() , others.getAltCategory()... );
+      v.Field( "altSubcategory" , r.getAltSubcategory() , others.getAltSubcategory()... );
+      v.Field( "altSpecific" , r.getAltSpecific() , others.getAltSpecific()... );
+      v.Field( "altExtra" , r.getAltExtra() , others.getAltExtra()... );
+      v.Field( "xVelocity" , r.getXVelocity() , others.getXVelocity()... );
+      v.Field( "yVelocity" , r.getYVelocity() , others.getYVelocity()... );
+      v.Field( "zVelocity" , r.getZVelocity() , others.getZVelocity()... );
+      v.Field( "xLocation" , r.getXLocation() , others.getXLocation()... );
+      v.Field( "yLocation" , r.getYLocation() , others.getYLocation()... );
+      v.Field( "zLocation" , r.getZLocation() , others.getZLocation()... );
+      v.Field( "psi" , r.getPsi() , others.getPsi()... );
+      v.Field( "theta" , r.getTheta() , others.getTheta()... );
+      v.Field( "phi" , r.getPhi() , others.getPhi()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 15 ) , MakeFieldArray( others.getOtherParameters() , 15 )... );
+      v.Field( "xAcceleration" , r.getXAcceleration() , others.getXAcceleration()... );
+      v.Field( "yAcceleration" , r.getYAcceleration() , others.getYAcceleration()... );
+      v.Field( "zAcceleration" , r.getZAcceleration() , others.getZAcceleration()... );
+      v.Field( "xAngularVelocity" , r.getXAngularVelocity() , others.getXAngularVelocity()... );
+      v.Field( "yAngularVelocity" , r.getYAngularVelocity() , others.getYAngularVelocity()... );
+      v.Field( "zAngularVelocity" , r.getZAngularVelocity() , others.getZAngularVelocity()... );
+      v.Array( "marking" , MakeFieldArray( r.getMarking() , 12 ) , MakeFieldArray( others.getMarking() , 12 )... );
+      v.Field( "capabilities" , r.getCapabilities() , others.getCapabilities()... );
+      v.List( "articulationParameters" , r.getArticulationParameters() , others.getArticulationParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FirePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "munitionID" , r.getMunitionID() , others.getMunitionID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "fireMissionIndex" , r.getFireMissionIndex() , others.getFireMissionIndex()... );
+      v.Field( "locationInWorldCoordinates" , r.getLocationInWorldCoordinates() , others.getLocationInWorldCoordinates()... );
+      v.Field( "burstDescriptor" , r.getBurstDescriptor() , others.getBurstDescriptor()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "range" , r.getRange() , others.getRange()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FixedDatum& r, const Others&... others)
+   {
+      v.Field( "fixedDatumID" , r.getFixedDatumID() , others.getFixedDatumID()... );
+      v.Field( "fixedDatumValue" , r.getFixedDatumValue() , others.getFixedDatumValue()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FourByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 4 ) , MakeFieldArray( others.getOtherParameters() , 4 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FundamentalParameterData& r, const Others&... others)
+   {
+      v.Field( "frequency" , r.getFrequency() , others.getFrequency()... );
+      v.Field( "frequencyRange" , r.getFrequencyRange() , others.getFrequencyRange()... );
+      v.Field( "effectiveRadiatedPower" , r.getEffectiveRadiatedPower() , others.getEffectiveRadiatedPower()... );
+      v.Field( "pulseRepetitionFrequency" , r.getPulseRepetitionFrequency() , others.getPulseRepetitionFrequency()... );
+      v.Field( "pulseWidth" , r.getPulseWidth() , others.getPulseWidth()... );
+      v.Field( "beamAzimuthCenter" , r.getBeamAzimuthCenter() , others.getBeamAzimuthCenter()... );
+      v.Field( "beamAzimuthSweep" , r.getBeamAzimuthSweep() , others.getBeamAzimuthSweep()... );
+      v.Field( "beamElevationCenter" , r.getBeamElevationCenter() , others.getBeamElevationCenter()... );
+      v.Field( "beamElevationSweep" , r.getBeamElevationSweep() , others.getBeamElevationSweep()... );
+      v.Field( "beamSweepSync" , r.getBeamSweepSync() , others.getBeamSweepSync()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FundamentalParameterDataIff& r, const Others&... others)
+   {
+      v.Field( "erp" , r.getErp() , others.getErp()... );
+      v.Field( "frequency" , r.getFrequency() , others.getFrequency()... );
+      v.Field( "pgrf" , r.getPgrf() , others.getPgrf()... );
+      v.Field( "pulseWidth" , r.getPulseWidth() , others.getPulseWidth()... );
+      v.Field( "burstLength" , r.getBurstLength() , others.getBurstLength()... );
+      v.Field( "applicableModes" , r.getApplicableModes() , others.getApplicableModes()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "pad3" , r.getPad3() , others.getPad3()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GridAxisRecord& r, const Others&... others)
+   {
+      v.Field( "sampleType" , r.getSampleType() , others.getSampleType()... );
+      v.Field( "dataRepresentation" , r.getDataRepresentation() , others.getDataRepresentation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GridAxisRecordRepresentation0& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const GridAxisRecord&>( r ) , static_cast<const GridAxisRecord&>( others )... );
+      v.Count( "numberOfBytes" , "dataValues" , static_cast<unsigned short>( r.getDataValues().size() ) , static_cast<unsigned short>( others.getDataValues().size() )... );
+      v.List( "dataValues" , r.getDataValues() , others.getDataValues()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GridAxisRecordRepresentation1& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const GridAxisRecord&>( r ) , static_cast<const GridAxisRecord&>( others )... );
+      v.Field( "fieldScale" , r.getFieldScale() , others.getFieldScale()... );
+      v.Field( "fieldOffset" , r.getFieldOffset() , others.getFieldOffset()... );
+      v.Count( "numberOfValues" , "dataValues" , static_cast<unsigned short>( r.getDataValues().size() ) , static_cast<unsigned short>( others.getDataValues().size() )... );
+      v.List( "dataValues" , r.getDataValues() , others.getDataValues()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GridAxisRecordRepresentation2& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const GridAxisRecord&>( r ) , static_cast<const GridAxisRecord&>( others )... );
+      v.Count( "numberOfValues" , "dataValues" , static_cast<unsigned short>( r.getDataValues().size() ) , static_cast<unsigned short>( others.getDataValues().size() )... );
+      v.List( "dataValues" , r.getDataValues() , others.getDataValues()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GriddedDataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "environmentalSimulationApplicationID" , r.getEnvironmentalSimulationApplicationID() , others.getEnvironmentalSimulationApplicationID()... );
+      v.Field( "fieldNumber" , r.getFieldNumber() , others.getFieldNumber()... );
+      v.Field( "pduNumber" , r.getPduNumber() , others.getPduNumber()... );
+      v.Field( "pduTotal" , r.getPduTotal() , others.getPduTotal()... );
+      v.Field( "coordinateSystem" , r.getCoordinateSystem() , others.getCoordinateSystem()... );
+      v.Count( "numberOfGridAxes" , "gridDataList" , static_cast<unsigned char>( r.getGridDataList().size() ) , static_cast<unsigned char>( others.getGridDataList().size() )... );
+      v.Field( "constantGrid" , r.getConstantGrid() , others.getConstantGrid()... );
+      v.Field( "environmentType" , r.getEnvironmentType() , others.getEnvironmentType()... );
+      v.Field( "orientation" , r.getOrientation() , others.getOrientation()... );
+      v.Field( "sampleTime" , r.getSampleTime() , others.getSampleTime()... );
+      v.Field( "totalValues" , r.getTotalValues() , others.getTotalValues()... );
+      v.Field( "vectorDimension" , r.getVectorDimension() , others.getVectorDimension()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.List( "gridDataList" , r.getGridDataList() , others.getGridDataList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IffAtcNavAidsLayer1Pdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityId" , r.getEmittingEntityId() , others.getEmittingEntityId()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+      v.Field( "systemID" , r.getSystemID() , others.getSystemID()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "fundamentalParameters" , r.getFundamentalParameters() , others.getFundamentalParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IffAtcNavAidsLayer2Pdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const IffAtcNavAidsLayer1Pdu&>( r ) , static_cast<const IffAtcNavAidsLayer1Pdu&>( others )... );
+      v.Field( "layerHeader" , r.getLayerHeader() , others.getLayerHeader()... );
+      v.Field( "beamData" , r.getBeamData() , others.getBeamData()... );
+      v.Field( "secondaryOperationalData" , r.getSecondaryOperationalData() , others.getSecondaryOperationalData()... );
+      v.List( "fundamentalIffParameters" , r.getFundamentalIffParameters() , others.getFundamentalIffParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IffFundamentalData& r, const Others&... others)
+   {
+      v.Field( "systemStatus" , r.getSystemStatus() , others.getSystemStatus()... );
+      v.Field( "alternateParameter4" , r.getAlternateParameter4() , others.getAlternateParameter4()... );
+      v.Field( "informationLayers" , r.getInformationLayers() , others.getInformationLayers()... );
+      v.Field( "modifier" , r.getModifier() , others.getModifier()... );
+      v.Field( "parameter1" , r.getParameter1() , others.getParameter1()... );
+      v.Field( "parameter2" , r.getParameter2() , others.getParameter2()... );
+      v.Field( "parameter3" , r.getParameter3() , others.getParameter3()... );
+      v.Field( "parameter4" , r.getParameter4() , others.getParameter4()... );
+      v.Field( "parameter5" , r.getParameter5() , others.getParameter5()... );
+      v.Field( "parameter6" , r.getParameter6() , others.getParameter6()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomCommunicationsParameters& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "recordSpecificField" , r.getRecordSpecificField() , others.getRecordSpecificField()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomControlPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "controlType" , r.getControlType() , others.getControlType()... );
+      v.Field( "communicationsChannelType" , r.getCommunicationsChannelType() , others.getCommunicationsChannelType()... );
+      v.Field( "sourceEntityID" , r.getSourceEntityID() , others.getSourceEntityID()... );
+      v.Field( "sourceCommunicationsDeviceID" , r.getSourceCommunicationsDeviceID() , others.getSourceCommunicationsDeviceID()... );
+      v.Field( "sourceLineID" , r.getSourceLineID() , others.getSourceLineID()... );
+      v.Field( "transmitPriority" , r.getTransmitPriority() , others.getTransmitPriority()... );
+      v.Field( "transmitLineState" , r.getTransmitLineState() , others.getTransmitLineState()... );
+      v.Field( "command" , r.getCommand() , others.getCommand()... );
+      v.Field( "masterEntityID" , r.getMasterEntityID() , others.getMasterEntityID()... );
+      v.Field( "masterCommunicationsDeviceID" , r.getMasterCommunicationsDeviceID() , others.getMasterCommunicationsDeviceID()... );
+      v.Count( "intercomParametersLength" , "intercomParameters" , static_cast<unsigned int>( r.getIntercomParameters().size() ) , static_cast<unsigned int>( others.getIntercomParameters().size() )... );
+      v.List( "intercomParameters" , r.getIntercomParameters() , others.getIntercomParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomSignalPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "communicationsDeviceID" , r.getCommunicationsDeviceID() , others.getCommunicationsDeviceID()... );
+      v.Field( "encodingScheme" , r.getEncodingScheme() , others.getEncodingScheme()... );
+      v.Field( "tdlType" , r.getTdlType() , others.getTdlType()... );
+      v.Field( "sampleRate" , r.getSampleRate() , others.getSampleRate()... );
+      v.Count( "dataLength" , "data" , static_cast<unsigned short>( r.getData().size() ) , static_cast<unsigned short>( others.getData().size() )... );
+      v.Field( "samples" , r.getSamples() , others.getSamples()... );
+      v.List( "data" , r.getData() , others.getData()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IsGroupOfPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityManagementFamilyPdu&>( r ) , static_cast<const EntityManagementFamilyPdu&>( others )... );
+      v.Field( "groupEntityID" , r.getGroupEntityID() , others.getGroupEntityID()... );
+      v.Field( "groupedEntityCategory" , r.getGroupedEntityCategory() , others.getGroupedEntityCategory()... );
+      v.Count( "numberOfGroupedEntities" , "groupedEntityDescriptions" , static_cast<unsigned char>( r.getGroupedEntityDescriptions().size() ) , static_cast<unsigned char>( others.getGroupedEntityDescriptions().size() )... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "latitude" , r.getLatitude() , others.getLatitude()... );
+      v.Field( "longitude" , r.getLongitude() , others.getLongitude()... );
+      v.List( "groupedEntityDescriptions" , r.getGroupedEntityDescriptions() , others.getGroupedEntityDescriptions()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IsPartOfPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityManagementFamilyPdu&>( r ) , static_cast<const EntityManagementFamilyPdu&>( others )... );
+      v.Field( "orginatingEntityID" , r.getOrginatingEntityID() , others.getOrginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "relationship" , r.getRelationship() , others.getRelationship()... );
+      v.Field( "partLocation" , r.getPartLocation() , others.getPartLocation()... );
+      v.Field( "namedLocationID" , r.getNamedLocationID() , others.getNamedLocationID()... );
+      v.Field( "partEntityType" , r.getPartEntityType() , others.getPartEntityType()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LayerHeader& r, const Others&... others)
+   {
+      v.Field( "layerNumber" , r.getLayerNumber() , others.getLayerNumber()... );
+      v.Field( "layerSpecificInformaiton" , r.getLayerSpecificInformaiton() , others.getLayerSpecificInformaiton()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LinearObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Count( "numberOfSegments" , "linearSegmentParameters" , static_cast<unsigned char>( r.getLinearSegmentParameters().size() ) , static_cast<unsigned char>( others.getLinearSegmentParameters().size() )... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.List( "linearSegmentParameters" , r.getLinearSegmentParameters() , others.getLinearSegmentParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LinearSegmentParameter& r, const Others&... others)
+   {
+      v.Field( "segmentNumber" , r.getSegmentNumber() , others.getSegmentNumber()... );
+      v.Field( "segmentAppearance" , r.getSegmentAppearance() , others.getSegmentAppearance()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+      v.Field( "orientation" , r.getOrientation() , others.getOrientation()... );
+      v.Field( "segmentLength" , r.getSegmentLength() , others.getSegmentLength()... );
+      v.Field( "segmentWidth" , r.getSegmentWidth() , others.getSegmentWidth()... );
+      v.Field( "segmentHeight" , r.getSegmentHeight() , others.getSegmentHeight()... );
+      v.Field( "segmentDepth" , r.getSegmentDepth() , others.getSegmentDepth()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LogisticsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LogisticsPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Marking& r, const Others&... others)
+   {
+      v.Field( "characterSet" , r.getCharacterSet() , others.getCharacterSet()... );
+      v.Array( "characters" , MakeFieldArray( r.getCharacters() , 11 ) , MakeFieldArray( others.getCharacters() , 11 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldDataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "minefieldSequenceNumbeer" , r.getMinefieldSequenceNumbeer() , others.getMinefieldSequenceNumbeer()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "pduSequenceNumber" , r.getPduSequenceNumber() , others.getPduSequenceNumber()... );
+      v.Field( "numberOfPdus" , r.getNumberOfPdus() , others.getNumberOfPdus()... );
+      v.Count( "numberOfMinesInThisPdu" , "mineLocation" , static_cast<unsigned char>( r.getMineLocation().size() ) , static_cast<unsigned char>( others.getMineLocation().size() )... );
+      v.Count( "numberOfSensorTypes" , "sensorTypes" , static_cast<unsigned char>( r.getSensorTypes().size() ) , static_cast<unsigned char>( others.getSensorTypes().size() )... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "dataFilter" , r.getDataFilter() , others.getDataFilter()... );
+      v.Field( "mineType" , r.getMineType() , others.getMineType()... );
+      v.List( "sensorTypes" , r.getSensorTypes() , others.getSensorTypes()... );
+      v.Field( "pad3" , r.getPad3() , others.getPad3()... );
+      v.List( "mineLocation" , r.getMineLocation() , others.getMineLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldPduFamily& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldQueryPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Count( "numberOfPerimeterPoints" , "requestedPerimeterPoints" , static_cast<unsigned char>( r.getRequestedPerimeterPoints().size() ) , static_cast<unsigned char>( others.getRequestedPerimeterPoints().size() )... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Count( "numberOfSensorTypes" , "sensorTypes" , static_cast<unsigned char>( r.getSensorTypes().size() ) , static_cast<unsigned char>( others.getSensorTypes().size() )... );
+      v.Field( "dataFilter" , r.getDataFilter() , others.getDataFilter()... );
+      v.Field( "requestedMineType" , r.getRequestedMineType() , others.getRequestedMineType()... );
+      v.List( "requestedPerimeterPoints" , r.getRequestedPerimeterPoints() , others.getRequestedPerimeterPoints()... );
+      v.List( "sensorTypes" , r.getSensorTypes() , others.getSensorTypes()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldResponseNackPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Count( "numberOfMissingPdus" , "missingPduSequenceNumbers" , static_cast<unsigned char>( r.getMissingPduSequenceNumbers().size() ) , static_cast<unsigned char>( others.getMissingPduSequenceNumbers().size() )... );
+      v.List( "missingPduSequenceNumbers" , r.getMissingPduSequenceNumbers() , others.getMissingPduSequenceNumbers()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "minefieldSequence" , r.getMinefieldSequence() , others.getMinefieldSequence()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Count( "numberOfPerimeterPoints" , "perimeterPoints" , static_cast<unsigned char>( r.getPerimeterPoints().size() ) , static_cast<unsigned char>( others.getPerimeterPoints().size() )... );
+      v.Field( "minefieldType" , r.getMinefieldType() , others.getMinefieldType()... );
+      v.Count( "numberOfMineTypes" , "mineType" , static_cast<unsigned short>( r.getMineType().size() ) , static_cast<unsigned short>( others.getMineType().size() )... );
+      v.Field( "minefieldLocation" , r.getMinefieldLocation() , others.getMinefieldLocation()... );
+      v.Field( "minefieldOrientation" , r.getMinefieldOrientation() , others.getMinefieldOrientation()... );
+      v.Field( "appearance" , r.getAppearance() , others.getAppearance()... );
+      v.Field( "protocolMode" , r.getProtocolMode() , others.getProtocolMode()... );
+      v.List( "perimeterPoints" , r.getPerimeterPoints() , others.getPerimeterPoints()... );
+      v.List( "mineType" , r.getMineType() , others.getMineType()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ModulationType& r, const Others&... others)
+   {
+      v.Field( "spreadSpectrum" , r.getSpreadSpectrum() , others.getSpreadSpectrum()... );
+      v.Field( "major" , r.getMajor() , others.getMajor()... );
+      v.Field( "detail" , r.getDetail() , others.getDetail()... );
+      v.Field( "system" , r.getSystem() , others.getSystem()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const NamedLocation& r, const Others&... others)
+   {
+      v.Field( "stationName" , r.getStationName() , others.getStationName()... );
+      v.Field( "stationNumber" , r.getStationNumber() , others.getStationNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ObjectType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const OneByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 1 ) , MakeFieldArray( others.getOtherParameters() , 1 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Orientation& r, const Others&... others)
+   {
+      v.Field( "psi" , r.getPsi() , others.getPsi()... );
+      v.Field( "theta" , r.getTheta() , others.getTheta()... );
+      v.Field( "phi" , r.getPhi() , others.getPhi()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Pdu& r, const Others&... others)
+   {
+      v.Field( "protocolVersion" , r.getProtocolVersion() , others.getProtocolVersion()... );
+      v.Field( "exerciseID" , r.getExerciseID() , others.getExerciseID()... );
+      v.Field( "pduType" , r.getPduType() , others.getPduType()... );
+      v.Field( "protocolFamily" , r.getProtocolFamily() , others.getProtocolFamily()... );
+      v.Field( "timestamp" , r.getTimestamp() , others.getTimestamp()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PduContainer& r, const Others&... others)
+   {
+      v.Count( "numberOfPdus" , "pdus" , static_cast<int>( r.getPdus().size() ) , static_cast<int>( others.getPdus().size() )... );
+      v.List( "pdus" , r.getPdus() , others.getPdus()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Point& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PointObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Field( "modifications" , r.getModifications() , others.getModifications()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.Field( "objectLocation" , r.getObjectLocation() , others.getObjectLocation()... );
+      v.Field( "objectOrientation" , r.getObjectOrientation() , others.getObjectOrientation()... );
+      v.Field( "objectAppearance" , r.getObjectAppearance() , others.getObjectAppearance()... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PropulsionSystemData& r, const Others&... others)
+   {
+      v.Field( "powerSetting" , r.getPowerSetting() , others.getPowerSetting()... );
+      v.Field( "engineRpm" , r.getEngineRpm() , others.getEngineRpm()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RadioCommunicationsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "entityId" , r.getEntityId() , others.getEntityId()... );
+      v.Field( "radioId" , r.getRadioId() , others.getRadioId()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RadioEntityType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "nomenclatureVersion" , r.getNomenclatureVersion() , others.getNomenclatureVersion()... );
+      v.Field( "nomenclature" , r.getNomenclature() , others.getNomenclature()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ReceiverPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "receiverState" , r.getReceiverState() , others.getReceiverState()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "receivedPower" , r.getReceivedPower() , others.getReceivedPower()... );
+      v.Field( "transmitterEntityId" , r.getTransmitterEntityId() , others.getTransmitterEntityId()... );
+      v.Field( "transmitterRadioId" , r.getTransmitterRadioId() , others.getTransmitterRadioId()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordQueryReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "time" , r.getTime() , others.getTime()... );
+      v.Count( "numberOfRecords" , "recordIDs" , static_cast<unsigned int>( r.getRecordIDs().size() ) , static_cast<unsigned int>( others.getRecordIDs().size() )... );
+      v.List( "recordIDs" , r.getRecordIDs() , others.getRecordIDs()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordSet& r, const Others&... others)
+   {
+      v.Field( "recordID" , r.getRecordID() , others.getRecordID()... );
+      v.Field( "recordSetSerialNumber" , r.getRecordSetSerialNumber() , others.getRecordSetSerialNumber()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "recordCount" , r.getRecordCount() , others.getRecordCount()... );
+      v.Field( "recordValues" , r.getRecordValues() , others.getRecordValues()... );
+      v.Field( "pad4" , r.getPad4() , others.getPad4()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Relationship& r, const Others&... others)
+   {
+      v.Field( "nature" , r.getNature() , others.getNature()... );
+      v.Field( "position" , r.getPosition() , others.getPosition()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RemoveEntityPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RemoveEntityReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RepairCompletePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "repairingEntityID" , r.getRepairingEntityID() , others.getRepairingEntityID()... );
+      v.Field( "repair" , r.getRepair() , others.getRepair()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RepairResponsePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "repairingEntityID" , r.getRepairingEntityID() , others.getRepairingEntityID()... );
+      v.Field( "repairResult" , r.getRepairResult() , others.getRepairResult()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ResupplyCancelPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "supplyingEntityID" , r.getSupplyingEntityID() , others.getSupplyingEntityID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ResupplyOfferPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "supplyingEntityID" , r.getSupplyingEntityID() , others.getSupplyingEntityID()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ResupplyReceivedPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "supplyingEntityID" , r.getSupplyingEntityID() , others.getSupplyingEntityID()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SeesPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "orginatingEntityID" , r.getOrginatingEntityID() , others.getOrginatingEntityID()... );
+      v.Field( "infraredSignatureRepresentationIndex" , r.getInfraredSignatureRepresentationIndex() , others.getInfraredSignatureRepresentationIndex()... );
+      v.Field( "acousticSignatureRepresentationIndex" , r.getAcousticSignatureRepresentationIndex() , others.getAcousticSignatureRepresentationIndex()... );
+      v.Field( "radarCrossSectionSignatureRepresentationIndex" , r.getRadarCrossSectionSignatureRepresentationIndex() , others.getRadarCrossSectionSignatureRepresentationIndex()... );
+      v.Count( "numberOfPropulsionSystems" , "propulsionSystemData" , static_cast<unsigned short>( r.getPropulsionSystemData().size() ) , static_cast<unsigned short>( others.getPropulsionSystemData().size() )... );
+      v.Count( "numberOfVectoringNozzleSystems" , "vectoringSystemData" , static_cast<unsigned short>( r.getVectoringSystemData().size() ) , static_cast<unsigned short>( others.getVectoringSystemData().size() )... );
+      v.List( "propulsionSystemData" , r.getPropulsionSystemData() , others.getPropulsionSystemData()... );
+      v.List( "vectoringSystemData" , r.getVectoringSystemData() , others.getVectoringSystemData()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ServiceRequestPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "servicingEntityID" , r.getServicingEntityID() , others.getServicingEntityID()... );
+      v.Field( "serviceTypeRequested" , r.getServiceTypeRequested() , others.getServiceTypeRequested()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "serviceRequestPadding" , r.getServiceRequestPadding() , others.getServiceRequestPadding()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SetDataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SetDataReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SetRecordReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Count( "numberOfRecordSets" , "recordSets" , static_cast<unsigned int>( r.getRecordSets().size() ) , static_cast<unsigned int>( others.getRecordSets().size() )... );
+      v.List( "recordSets" , r.getRecordSets() , others.getRecordSets()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ShaftRPMs& r, const Others&... others)
+   {
+      v.Field( "currentShaftRPMs" , r.getCurrentShaftRPMs() , others.getCurrentShaftRPMs()... );
+      v.Field( "orderedShaftRPMs" , r.getOrderedShaftRPMs() , others.getOrderedShaftRPMs()... );
+      v.Field( "shaftRPMRateOfChange" , r.getShaftRPMRateOfChange() , others.getShaftRPMRateOfChange()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SignalPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "encodingScheme" , r.getEncodingScheme() , others.getEncodingScheme()... );
+      v.Field( "tdlType" , r.getTdlType() , others.getTdlType()... );
+      v.Field( "sampleRate" , r.getSampleRate() , others.getSampleRate()... );
+      v.Count( "dataLength" , "data" , static_cast<short>( r.getData().size() ) , static_cast<short>( others.getData().size() )... );
+      v.Field( "samples" , r.getSamples() , others.getSamples()... );
+      v.List( "data" , r.getData() , others.getData()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationAddress& r, const Others&... others)
+   {
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationManagementFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "originatingEntityID" , r.getOriginatingEntityID() , others.getOriginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationManagementWithReliabilityFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "originatingEntityID" , r.getOriginatingEntityID() , others.getOriginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SixByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 6 ) , MakeFieldArray( others.getOtherParameters() , 6 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SphericalHarmonicAntennaPattern& r, const Others&... others)
+   {
+      v.Field( "order" , r.getOrder() , others.getOrder()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StartResumePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "simulationTime" , r.getSimulationTime() , others.getSimulationTime()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StartResumeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "simulationTime" , r.getSimulationTime() , others.getSimulationTime()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StopFreezePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "reason" , r.getReason() , others.getReason()... );
+      v.Field( "frozenBehavior" , r.getFrozenBehavior() , others.getFrozenBehavior()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StopFreezeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "reason" , r.getReason() , others.getReason()... );
+      v.Field( "frozenBehavior" , r.getFrozenBehavior() , others.getFrozenBehavior()... );
+      v.Field( "requiredReliablityService" , r.getRequiredReliablityService() , others.getRequiredReliablityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SupplyQuantity& r, const Others&... others)
+   {
+      v.Field( "supplyType" , r.getSupplyType() , others.getSupplyType()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SyntheticEnvironmentFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SystemID& r, const Others&... others)
+   {
+      v.Field( "systemType" , r.getSystemType() , others.getSystemType()... );
+      v.Field( "systemName" , r.getSystemName() , others.getSystemName()... );
+      v.Field( "systemMode" , r.getSystemMode() , others.getSystemMode()... );
+      v.Field( "changeOptions" , r.getChangeOptions() , others.getChangeOptions()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TrackJamTarget& r, const Others&... others)
+   {
+      v.Field( "trackJam" , r.getTrackJam() , others.getTrackJam()... );
+      v.Field( "emitterID" , r.getEmitterID() , others.getEmitterID()... );
+      v.Field( "beamID" , r.getBeamID() , others.getBeamID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TransferControlRequestPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityManagementFamilyPdu&>( r ) , static_cast<const EntityManagementFamilyPdu&>( others )... );
+      v.Field( "orginatingEntityID" , r.getOrginatingEntityID() , others.getOrginatingEntityID()... );
+      v.Field( "recevingEntityID" , r.getRecevingEntityID() , others.getRecevingEntityID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "tranferType" , r.getTranferType() , others.getTranferType()... );
+      v.Field( "transferEntityID" , r.getTransferEntityID() , others.getTransferEntityID()... );
+      v.Count( "numberOfRecordSets" , "recordSets" , static_cast<unsigned char>( r.getRecordSets().size() ) , static_cast<unsigned char>( others.getRecordSets().size() )... );
+      v.List( "recordSets" , r.getRecordSets() , others.getRecordSets()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TransmitterPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "radioEntityType" , r.getRadioEntityType() , others.getRadioEntityType()... );
+      v.Field( "transmitState" , r.getTransmitState() , others.getTransmitState()... );
+      v.Field( "inputSource" , r.getInputSource() , others.getInputSource()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "antennaLocation" , r.getAntennaLocation() , others.getAntennaLocation()... );
+      v.Field( "relativeAntennaLocation" , r.getRelativeAntennaLocation() , others.getRelativeAntennaLocation()... );
+      v.Field( "antennaPatternType" , r.getAntennaPatternType() , others.getAntennaPatternType()... );
+      v.Count( "antennaPatternCount" , "antennaPatternList" , static_cast<unsigned short>( r.getAntennaPatternList().size() ) , static_cast<unsigned short>( others.getAntennaPatternList().size() )... );
+      v.Field( "frequency" , r.getFrequency() , others.getFrequency()... );
+      v.Field( "transmitFrequencyBandwidth" , r.getTransmitFrequencyBandwidth() , others.getTransmitFrequencyBandwidth()... );
+      v.Field( "power" , r.getPower() , others.getPower()... );
+      v.Field( "modulationType" , r.getModulationType() , others.getModulationType()... );
+      v.Field( "cryptoSystem" , r.getCryptoSystem() , others.getCryptoSystem()... );
+      v.Field( "cryptoKeyId" , r.getCryptoKeyId() , others.getCryptoKeyId()... );
+      v.Count( "modulationParameterCount" , "modulationParametersList" , static_cast<unsigned char>( r.getModulationParametersList().size() ) , static_cast<unsigned char>( others.getModulationParametersList().size() )... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+      v.List( "modulationParametersList" , r.getModulationParametersList() , others.getModulationParametersList()... );
+      v.List( "antennaPatternList" , r.getAntennaPatternList() , others.getAntennaPatternList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TwoByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 2 ) , MakeFieldArray( others.getOtherParameters() , 2 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const UaPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityID" , r.getEmittingEntityID() , others.getEmittingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "stateChangeIndicator" , r.getStateChangeIndicator() , others.getStateChangeIndicator()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "passiveParameterIndex" , r.getPassiveParameterIndex() , others.getPassiveParameterIndex()... );
+      v.Field( "propulsionPlantConfiguration" , r.getPropulsionPlantConfiguration() , others.getPropulsionPlantConfiguration()... );
+      v.Count( "numberOfShafts" , "shaftRPMs" , static_cast<unsigned char>( r.getShaftRPMs().size() ) , static_cast<unsigned char>( others.getShaftRPMs().size() )... );
+      v.Count( "numberOfAPAs" , "apaData" , static_cast<unsigned char>( r.getApaData().size() ) , static_cast<unsigned char>( others.getApaData().size() )... );
+      v.Count( "numberOfUAEmitterSystems" , "emitterSystems" , static_cast<unsigned char>( r.getEmitterSystems().size() ) , static_cast<unsigned char>( others.getEmitterSystems().size() )... );
+      v.List( "shaftRPMs" , r.getShaftRPMs() , others.getShaftRPMs()... );
+      v.List( "apaData" , r.getApaData() , others.getApaData()... );
+      v.List( "emitterSystems" , r.getEmitterSystems() , others.getEmitterSystems()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VariableDatum& r, const Others&... others)
+   {
+      v.Field( "variableDatumID" , r.getVariableDatumID() , others.getVariableDatumID()... );
+      v.Field( "variableDatumLength" , r.getVariableDatumLength() , others.getVariableDatumLength()... );
+      v.Array( "variableDatums" , MakeFieldArray( r.getVariableDatums() , r.getArrayLength() ) , MakeFieldArray( others.getVariableDatums() , others.getArrayLength() )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Vector3Double& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Vector3Float& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VectoringNozzleSystemData& r, const Others&... others)
+   {
+      v.Field( "horizontalDeflectionAngle" , r.getHorizontalDeflectionAngle() , others.getHorizontalDeflectionAngle()... );
+      v.Field( "verticalDeflectionAngle" , r.getVerticalDeflectionAngle() , others.getVerticalDeflectionAngle()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const WarfareFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "firingEntityID" , r.getFiringEntityID() , others.getFiringEntityID()... );
+      v.Field( "targetEntityID" , r.getTargetEntityID() , others.getTargetEntityID()... );
+   }
+}
+
+#endif  // _dcl_dis6_fields_h_
@@ -1,3 +1,4 @@
+#define DIS_MARKING_DEFINITIONS
 #include <dis6/Marking.h>
 
 #include <cstring>
@@ -55,29 +56,6 @@ void Marking::setByStringCharacters(const char* x)
    _characters[11 -1] = '\0';
 }
 
-void Marking::marshal(DataStream& dataStream) const
-{
-    dataStream << _characterSet;
-
-     for(size_t idx = 0; idx < 11; idx++)
-     {
-        dataStream << _characters[idx];
-     }
-
-}
-
-void Marking::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _characterSet;
-
-     for(size_t idx = 0; idx < 11; idx++)
-     {
-        dataStream >> _characters[idx];
-     }
-
-}
-
-
 bool Marking::operator ==(const Marking& rhs) const
  {
      bool ivarsEqual = true;
@@ -93,15 +71,6 @@ bool Marking::operator ==(const Marking& rhs) const
     return ivarsEqual;
  }
 
-int Marking::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 1;  // _characterSet
-   marshalSize = marshalSize + 11 * 1;  // _characters
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
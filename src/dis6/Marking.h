@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -44,6 +45,43 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by Marking.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_MARKING_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void Marking::marshal(DataStream& dataStream) const
+{
+    dataStream << _characterSet;
+
+     for(size_t idx = 0; idx < 11; idx++)
+     {
+        dataStream << _characters[idx];
+     }
+
+}
+
+DIS_RECORD_CODEC void Marking::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _characterSet;
+
+     for(size_t idx = 0; idx < 11; idx++)
+     {
+        dataStream >> _characters[idx];
+     }
+
+}
+
+DIS_RECORD_CODEC int Marking::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 1;  // _characterSet
+   marshalSize = marshalSize + 11 * 1;  // _characters
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -1,3 +1,4 @@
+#define DIS_MODULATION_TYPE_DEFINITIONS
 #include <dis6/ModulationType.h>
 
 using namespace DIS;
@@ -55,23 +56,6 @@ void ModulationType::setSystem(unsigned short pX)
     _system = pX;
 }
 
-void ModulationType::marshal(DataStream& dataStream) const
-{
-    dataStream << _spreadSpectrum;
-    dataStream << _major;
-    dataStream << _detail;
-    dataStream << _system;
-}
-
-void ModulationType::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _spreadSpectrum;
-    dataStream >> _major;
-    dataStream >> _detail;
-    dataStream >> _system;
-}
-
-
 bool ModulationType::operator ==(const ModulationType& rhs) const
  {
      bool ivarsEqual = true;
@@ -84,17 +68,6 @@ bool ModulationType::operator ==(const ModulationType& rhs) const
     return ivarsEqual;
  }
 
-int ModulationType::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 2;  // _spreadSpectrum
-   marshalSize = marshalSize + 2;  // _major
-   marshalSize = marshalSize + 2;  // _detail
-   marshalSize = marshalSize + 2;  // _system
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
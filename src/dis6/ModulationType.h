@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -54,6 +55,39 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by ModulationType.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_MODULATION_TYPE_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void ModulationType::marshal(DataStream& dataStream) const
+{
+    dataStream << _spreadSpectrum;
+    dataStream << _major;
+    dataStream << _detail;
+    dataStream << _system;
+}
+
+DIS_RECORD_CODEC void ModulationType::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _spreadSpectrum;
+    dataStream >> _major;
+    dataStream >> _detail;
+    dataStream >> _system;
+}
+
+DIS_RECORD_CODEC int ModulationType::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 2;  // _spreadSpectrum
+   marshalSize = marshalSize + 2;  // _major
+   marshalSize = marshalSize + 2;  // _detail
+   marshalSize = marshalSize + 2;  // _system
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
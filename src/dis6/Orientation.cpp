@@ -1,3 +1,4 @@
+#define DIS_ORIENTATION_DEFINITIONS
 #include <dis6/Orientation.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void Orientation::setPhi(float pX)
     _phi = pX;
 }
 
-void Orientation::marshal(DataStream& dataStream) const
-{
-    dataStream << _psi;
-    dataStream << _theta;
-    dataStream << _phi;
-}
-
-void Orientation::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _psi;
-    dataStream >> _theta;
-    dataStream >> _phi;
-}
-
-
 bool Orientation::operator ==(const Orientation& rhs) const
  {
      bool ivarsEqual = true;
@@ -70,16 +56,6 @@ bool Orientation::operator ==(const Orientation& rhs) const
     return ivarsEqual;
  }
 
-int Orientation::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 4;  // _psi
-   marshalSize = marshalSize + 4;  // _theta
-   marshalSize = marshalSize + 4;  // _phi
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
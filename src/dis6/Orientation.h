@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -45,6 +46,36 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by Orientation.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_ORIENTATION_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void Orientation::marshal(DataStream& dataStream) const
+{
+    dataStream << _psi;
+    dataStream << _theta;
+    dataStream << _phi;
+}
+
+DIS_RECORD_CODEC void Orientation::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _psi;
+    dataStream >> _theta;
+    dataStream >> _phi;
+}
+
+DIS_RECORD_CODEC int Orientation::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 4;  // _psi
+   marshalSize = marshalSize + 4;  // _theta
+   marshalSize = marshalSize + 4;  // _phi
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -1,3 +1,4 @@
+#define DIS_PDU_DEFINITIONS
 #include <dis6/Pdu.h>
 
 using namespace DIS;
@@ -88,29 +89,6 @@ void Pdu::setPadding(short pX)
     _padding = pX;
 }
 
-void Pdu::marshal(DataStream& dataStream) const
-{
-    dataStream << _protocolVersion;
-    dataStream << _exerciseID;
-    dataStream << _pduType;
-    dataStream << _protocolFamily;
-    dataStream << _timestamp;
-    dataStream << this->getLength();
-    dataStream << _padding;
-}
-
-void Pdu::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _protocolVersion;
-    dataStream >> _exerciseID;
-    dataStream >> _pduType;
-    dataStream >> _protocolFamily;
-    dataStream >> _timestamp;
-    dataStream >> _length;
-    dataStream >> _padding;
-}
-
-
 bool Pdu::operator ==(const Pdu& rhs) const
  {
      bool ivarsEqual = true;
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -72,6 +73,34 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by Pdu.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_PDU_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void Pdu::marshal(DataStream& dataStream) const
+{
+    dataStream << _protocolVersion;
+    dataStream << _exerciseID;
+    dataStream << _pduType;
+    dataStream << _protocolFamily;
+    dataStream << _timestamp;
+    dataStream << this->getLength();
+    dataStream << _padding;
+}
+
+DIS_RECORD_CODEC void Pdu::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _protocolVersion;
+    dataStream >> _exerciseID;
+    dataStream >> _pduType;
+    dataStream >> _protocolFamily;
+    dataStream >> _timestamp;
+    dataStream >> _length;
+    dataStream >> _padding;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -0,0 +1,142 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis6_pdu_registry_h_
+#define _dcl_dis6_pdu_registry_h_
+
+#include <utils/PduTypeList.h>        // for PduTypeList
+#include <utils/PDUType.h>            // for enum
+#include <dis6/AcknowledgePdu.h>
+#include <dis6/AcknowledgeReliablePdu.h>
+#include <dis6/ActionRequestPdu.h>
+#include <dis6/ActionRequestReliablePdu.h>
+#include <dis6/ActionResponsePdu.h>
+#include <dis6/ActionResponseReliablePdu.h>
+#include <dis6/AggregateStatePdu.h>
+#include <dis6/ArealObjectStatePdu.h>
+#include <dis6/CollisionElasticPdu.h>
+#include <dis6/CollisionPdu.h>
+#include <dis6/CommentPdu.h>
+#include <dis6/CommentReliablePdu.h>
+#include <dis6/CreateEntityPdu.h>
+#include <dis6/CreateEntityReliablePdu.h>
+#include <dis6/DataPdu.h>
+#include <dis6/DataQueryPdu.h>
+#include <dis6/DataQueryReliablePdu.h>
+#include <dis6/DataReliablePdu.h>
+#include <dis6/DesignatorPdu.h>
+#include <dis6/DetonationPdu.h>
+#include <dis6/ElectromagneticEmissionsPdu.h>
+#include <dis6/EntityStatePdu.h>
+#include <dis6/EntityStateUpdatePdu.h>
+#include <dis6/EnvironmentalProcessPdu.h>
+#include <dis6/EventReportPdu.h>
+#include <dis6/EventReportReliablePdu.h>
+#include <dis6/FirePdu.h>
+#include <dis6/GriddedDataPdu.h>
+#include <dis6/IffAtcNavAidsLayer1Pdu.h>
+#include <dis6/IntercomControlPdu.h>
+#include <dis6/IntercomSignalPdu.h>
+#include <dis6/IsGroupOfPdu.h>
+#include <dis6/IsPartOfPdu.h>
+#include <dis6/LinearObjectStatePdu.h>
+#include <dis6/MinefieldDataPdu.h>
+#include <dis6/MinefieldQueryPdu.h>
+#include <dis6/MinefieldResponseNackPdu.h>
+#include <dis6/MinefieldStatePdu.h>
+#include <dis6/PointObjectStatePdu.h>
+#include <dis6/ReceiverPdu.h>
+#include <dis6/RecordQueryReliablePdu.h>
+#include <dis6/RemoveEntityPdu.h>
+#include <dis6/RemoveEntityReliablePdu.h>
+#include <dis6/RepairCompletePdu.h>
+#include <dis6/RepairResponsePdu.h>
+#include <dis6/ResupplyCancelPdu.h>
+#include <dis6/ResupplyOfferPdu.h>
+#include <dis6/ResupplyReceivedPdu.h>
+#include <dis6/SeesPdu.h>
+#include <dis6/ServiceRequestPdu.h>
+#include <dis6/SetDataPdu.h>
+#include <dis6/SetDataReliablePdu.h>
+#include <dis6/SetRecordReliablePdu.h>
+#include <dis6/SignalPdu.h>
+#include <dis6/StartResumePdu.h>
+#include <dis6/StartResumeReliablePdu.h>
+#include <dis6/StopFreezePdu.h>
+#include <dis6/StopFreezeReliablePdu.h>
+#include <dis6/TransferControlRequestPdu.h>
+#include <dis6/TransmitterPdu.h>
+#include <dis6/UaPdu.h>
+
+namespace DIS
+{
+   /// every DIS 6 PDU class, by the value of the PDU type field it marshals.  the banks, factories
+   /// and dispatch tables of the library are generated from this list, see utils/PduTypeList.h.
+   /// the types without a name in PDUType are written as numbers.  FastEntityStatePdu has the type of
+   /// EntityStatePdu, which is the class registered for it.
+   typedef PduTypeList<
+      PduRegistryEntry< PDU_ENTITY_STATE                 , EntityStatePdu              >,
+      PduRegistryEntry< PDU_FIRE                         , FirePdu                     >,
+      PduRegistryEntry< PDU_DETONATION                   , DetonationPdu               >,
+      PduRegistryEntry< PDU_COLLISION                    , CollisionPdu                >,
+      PduRegistryEntry< PDU_SERVICE_REQUEST              , ServiceRequestPdu           >,
+      PduRegistryEntry< PDU_RESUPPLY_OFFER               , ResupplyOfferPdu            >,
+      PduRegistryEntry< PDU_RESUPPLY_RECEIVED            , ResupplyReceivedPdu         >,
+      PduRegistryEntry< PDU_RESUPPLY_CANCEL              , ResupplyCancelPdu           >,
+      PduRegistryEntry< PDU_REPAIR_COMPLETE              , RepairCompletePdu           >,
+      PduRegistryEntry< PDU_REPAIR_RESPONSE              , RepairResponsePdu           >,
+      PduRegistryEntry< PDU_CREATE_ENTITY                , CreateEntityPdu             >,
+      PduRegistryEntry< PDU_REMOVE_ENTITY                , RemoveEntityPdu             >,
+      PduRegistryEntry< PDU_START_RESUME                 , StartResumePdu              >,
+      PduRegistryEntry< PDU_STOP_FREEZE                  , StopFreezePdu               >,
+      PduRegistryEntry< PDU_ACKNOWLEDGE                  , AcknowledgePdu              >,
+      PduRegistryEntry< PDU_ACTION_REQUEST               , ActionRequestPdu            >,
+      PduRegistryEntry< PDU_ACTION_RESPONSE              , ActionResponsePdu           >,
+      PduRegistryEntry< PDU_DATA_QUERY                   , DataQueryPdu                >,
+      PduRegistryEntry< PDU_SET_DATA                     , SetDataPdu                  >,
+      PduRegistryEntry< PDU_DATA                         , DataPdu                     >,
+      PduRegistryEntry< PDU_EVENT_REPORT                 , EventReportPdu              >,
+      PduRegistryEntry< PDU_COMMENT                      , CommentPdu                  >,
+      PduRegistryEntry< PDU_ELECTRONIC_EMMISIONS         , ElectromagneticEmissionsPdu >,
+      PduRegistryEntry< PDU_DESIGNATOR                   , DesignatorPdu               >,
+      PduRegistryEntry< PDU_TRANSMITTER                  , TransmitterPdu              >,
+      PduRegistryEntry< PDU_SIGNAL                       , SignalPdu                   >,
+      PduRegistryEntry< PDU_RECEIVER                     , ReceiverPdu                 >,
+      PduRegistryEntry< PDU_IFF                          , IffAtcNavAidsLayer1Pdu      >,
+      PduRegistryEntry< PDU_UNDERWATER_ACOUSTIC          , UaPdu                       >,
+      PduRegistryEntry< PDU_SUPPLEMENTAL_EMISSION_ENTITY , SeesPdu                     >,
+      PduRegistryEntry< PDU_INTERCOM_SIGNAL              , IntercomSignalPdu           >,
+      PduRegistryEntry< PDU_INTERCOM_CONTROL             , IntercomControlPdu          >,
+      PduRegistryEntry< PDU_AGGREGATE_STATE              , AggregateStatePdu           >,
+      PduRegistryEntry< PDU_ISGROUPOF                    , IsGroupOfPdu                >,
+      PduRegistryEntry< PDU_TRANSFER_OWNERSHIP           , TransferControlRequestPdu   >,
+      PduRegistryEntry< PDU_ISPARTOF                     , IsPartOfPdu                 >,
+      PduRegistryEntry< PDU_MINEFIELD_STATE              , MinefieldStatePdu           >,
+      PduRegistryEntry< PDU_MINEFIELD_QUERY              , MinefieldQueryPdu           >,
+      PduRegistryEntry< PDU_MINEFIELD_DATA               , MinefieldDataPdu            >,
+      PduRegistryEntry< PDU_MINEFIELD_RESPONSE_NACK      , MinefieldResponseNackPdu    >,
+      PduRegistryEntry< PDU_ENVIRONMENTAL_PROCESS        , EnvironmentalProcessPdu     >,
+      PduRegistryEntry< PDU_GRIDDED_DATA                 , GriddedDataPdu              >,
+      PduRegistryEntry< PDU_POINT_OBJECT_STATE           , PointObjectStatePdu         >,
+      PduRegistryEntry< PDU_LINEAR_OBJECT_STATE          , LinearObjectStatePdu        >,
+      PduRegistryEntry< PDU_AREAL_OBJECT_STATE           , ArealObjectStatePdu         >,
+      PduRegistryEntry< 51                               , CreateEntityReliablePdu     >,
+      PduRegistryEntry< 52                               , RemoveEntityReliablePdu     >,
+      PduRegistryEntry< 53                               , StartResumeReliablePdu      >,
+      PduRegistryEntry< 54                               , StopFreezeReliablePdu       >,
+      PduRegistryEntry< 55                               , AcknowledgeReliablePdu      >,
+      PduRegistryEntry< 56                               , ActionRequestReliablePdu    >,
+      PduRegistryEntry< 57                               , ActionResponseReliablePdu   >,
+      PduRegistryEntry< 58                               , DataQueryReliablePdu        >,
+      PduRegistryEntry< 59                               , SetDataReliablePdu          >,
+      PduRegistryEntry< 60                               , DataReliablePdu             >,
+      PduRegistryEntry< 61                               , EventReportReliablePdu      >,
+      PduRegistryEntry< 62                               , CommentReliablePdu          >,
+      PduRegistryEntry< 63                               , RecordQueryReliablePdu      >,
+      PduRegistryEntry< 64                               , SetRecordReliablePdu        >,
+      PduRegistryEntry< 66                               , CollisionElasticPdu         >,
+      PduRegistryEntry< 67                               , EntityStateUpdatePdu        >
+   > PduRegistry;
+}
+
+#endif  // _dcl_dis6_pdu_registry_h_
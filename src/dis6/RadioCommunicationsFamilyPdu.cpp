@@ -1,3 +1,4 @@
+#define DIS_RADIO_COMMUNICATIONS_FAMILY_PDU_DEFINITIONS
 #include <dis6/RadioCommunicationsFamilyPdu.h>
 
 using namespace DIS;
@@ -39,21 +40,6 @@ void RadioCommunicationsFamilyPdu::setRadioId(unsigned short pX)
     _radioId = pX;
 }
 
-void RadioCommunicationsFamilyPdu::marshal(DataStream& dataStream) const
-{
-    Pdu::marshal(dataStream); // Marshal information in superclass first
-    _entityId.marshal(dataStream);
-    dataStream << _radioId;
-}
-
-void RadioCommunicationsFamilyPdu::unmarshal(DataStream& dataStream)
-{
-    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
-    _entityId.unmarshal(dataStream);
-    dataStream >> _radioId;
-}
-
-
 bool RadioCommunicationsFamilyPdu::operator ==(const RadioCommunicationsFamilyPdu& rhs) const
  {
      bool ivarsEqual = true;
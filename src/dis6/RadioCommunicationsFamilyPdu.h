@@ -4,6 +4,7 @@
 #include <dis6/Pdu.h>
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -45,6 +46,26 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by RadioCommunicationsFamilyPdu.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_RADIO_COMMUNICATIONS_FAMILY_PDU_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void RadioCommunicationsFamilyPdu::marshal(DataStream& dataStream) const
+{
+    Pdu::marshal(dataStream); // Marshal information in superclass first
+    _entityId.marshal(dataStream);
+    dataStream << _radioId;
+}
+
+DIS_RECORD_CODEC void RadioCommunicationsFamilyPdu::unmarshal(DataStream& dataStream)
+{
+    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
+    _entityId.unmarshal(dataStream);
+    dataStream >> _radioId;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -1,3 +1,4 @@
+#define DIS_RADIO_ENTITY_TYPE_DEFINITIONS
 #include <dis6/RadioEntityType.h>
 
 using namespace DIS;
@@ -77,27 +78,6 @@ void RadioEntityType::setNomenclature(unsigned short pX)
     _nomenclature = pX;
 }
 
-void RadioEntityType::marshal(DataStream& dataStream) const
-{
-    dataStream << _entityKind;
-    dataStream << _domain;
-    dataStream << _country;
-    dataStream << _category;
-    dataStream << _nomenclatureVersion;
-    dataStream << _nomenclature;
-}
-
-void RadioEntityType::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _entityKind;
-    dataStream >> _domain;
-    dataStream >> _country;
-    dataStream >> _category;
-    dataStream >> _nomenclatureVersion;
-    dataStream >> _nomenclature;
-}
-
-
 bool RadioEntityType::operator ==(const RadioEntityType& rhs) const
  {
      bool ivarsEqual = true;
@@ -112,19 +92,6 @@ bool RadioEntityType::operator ==(const RadioEntityType& rhs) const
     return ivarsEqual;
  }
 
-int RadioEntityType::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 1;  // _entityKind
-   marshalSize = marshalSize + 1;  // _domain
-   marshalSize = marshalSize + 2;  // _country
-   marshalSize = marshalSize + 1;  // _category
-   marshalSize = marshalSize + 1;  // _nomenclatureVersion
-   marshalSize = marshalSize + 2;  // _nomenclature
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
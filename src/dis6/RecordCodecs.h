@@ -0,0 +1,19 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_record_codecs_h_
+#define _dcl_dis_record_codecs_h_
+
+/// the marshal and unmarshal of the records every PDU is made of, the PDU headers and the fixed-layout
+/// records, are defined in the header of each record, below its class.  by default they are compiled
+/// once, by the source file of the record, which defines the DIS_<RECORD>_DEFINITIONS macro of its header.
+/// a library built with OPENDIS_INLINE_RECORDS defines DIS_INLINE_RECORDS for itself and its clients,
+/// so that the codecs, and the primitive operators of the DataStream, are inline where they are called.
+/// the compiler can then flatten the marshal of a PDU into the marshal of its records.
+#if defined(DIS_INLINE_RECORDS)
+#define DIS_RECORD_CODEC inline
+#else
+#define DIS_RECORD_CODEC
+#endif
+
+#endif  // _dcl_dis_record_codecs_h_
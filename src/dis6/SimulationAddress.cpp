@@ -1,3 +1,4 @@
+#define DIS_SIMULATION_ADDRESS_DEFINITIONS
 #include <dis6/SimulationAddress.h>
 
 using namespace DIS;
@@ -33,19 +34,6 @@ void SimulationAddress::setApplication(unsigned short pX)
     _application = pX;
 }
 
-void SimulationAddress::marshal(DataStream& dataStream) const
-{
-    dataStream << _site;
-    dataStream << _application;
-}
-
-void SimulationAddress::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _site;
-    dataStream >> _application;
-}
-
-
 bool SimulationAddress::operator ==(const SimulationAddress& rhs) const
  {
      bool ivarsEqual = true;
@@ -56,15 +44,6 @@ bool SimulationAddress::operator ==(const SimulationAddress& rhs) const
     return ivarsEqual;
  }
 
-int SimulationAddress::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 2;  // _site
-   marshalSize = marshalSize + 2;  // _application
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -42,6 +43,33 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by SimulationAddress.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_SIMULATION_ADDRESS_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void SimulationAddress::marshal(DataStream& dataStream) const
+{
+    dataStream << _site;
+    dataStream << _application;
+}
+
+DIS_RECORD_CODEC void SimulationAddress::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _site;
+    dataStream >> _application;
+}
+
+DIS_RECORD_CODEC int SimulationAddress::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 2;  // _site
+   marshalSize = marshalSize + 2;  // _application
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -48,6 +48,11 @@ const char* VariableDatum::getVariableDatums() const
     return _variableDatums.data();
 }
 
+unsigned int VariableDatum::getArrayLength() const
+{
+    return _arrayLength;
+}
+
 void VariableDatum::setVariableDatums(const char* x, const unsigned int length)
 {
     // convert and store length as bits
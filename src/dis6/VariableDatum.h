@@ -46,6 +46,9 @@ protected:
     const char*  getVariableDatums() const;
     void setVariableDatums(const char* pX, const unsigned int length);
 
+    /// @return the bytes of getVariableDatums() that are marshalled, padded to whole 8 byte chunks.
+    unsigned int getArrayLength() const;
+
 
 virtual unsigned int getMarshalledSize() const;
 
@@ -1,3 +1,4 @@
+#define DIS_VECTOR3_DOUBLE_DEFINITIONS
 #include <dis6/Vector3Double.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void Vector3Double::setZ(double pX)
     _z = pX;
 }
 
-void Vector3Double::marshal(DataStream& dataStream) const
-{
-    dataStream << _x;
-    dataStream << _y;
-    dataStream << _z;
-}
-
-void Vector3Double::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _x;
-    dataStream >> _y;
-    dataStream >> _z;
-}
-
-
 bool Vector3Double::operator ==(const Vector3Double& rhs) const
  {
      bool ivarsEqual = true;
@@ -70,16 +56,6 @@ bool Vector3Double::operator ==(const Vector3Double& rhs) const
     return ivarsEqual;
  }
 
-int Vector3Double::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 8;  // _x
-   marshalSize = marshalSize + 8;  // _y
-   marshalSize = marshalSize + 8;  // _z
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -48,6 +49,36 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by Vector3Double.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_VECTOR3_DOUBLE_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void Vector3Double::marshal(DataStream& dataStream) const
+{
+    dataStream << _x;
+    dataStream << _y;
+    dataStream << _z;
+}
+
+DIS_RECORD_CODEC void Vector3Double::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _x;
+    dataStream >> _y;
+    dataStream >> _z;
+}
+
+DIS_RECORD_CODEC int Vector3Double::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 8;  // _x
+   marshalSize = marshalSize + 8;  // _y
+   marshalSize = marshalSize + 8;  // _z
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
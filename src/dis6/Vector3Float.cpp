@@ -1,3 +1,4 @@
+#define DIS_VECTOR3_FLOAT_DEFINITIONS
 #include <dis6/Vector3Float.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void Vector3Float::setZ(float pX)
     _z = pX;
 }
 
-void Vector3Float::marshal(DataStream& dataStream) const
-{
-    dataStream << _x;
-    dataStream << _y;
-    dataStream << _z;
-}
-
-void Vector3Float::unmarshal(DataStream& dataStream)
-{
-    dataStream >> _x;
-    dataStream >> _y;
-    dataStream >> _z;
-}
-
-
 bool Vector3Float::operator ==(const Vector3Float& rhs) const
  {
      bool ivarsEqual = true;
@@ -70,16 +56,6 @@ bool Vector3Float::operator ==(const Vector3Float& rhs) const
     return ivarsEqual;
  }
 
-int Vector3Float::getMarshalledSize() const
-{
-   int marshalSize = 0;
-
-   marshalSize = marshalSize + 4;  // _x
-   marshalSize = marshalSize + 4;  // _y
-   marshalSize = marshalSize + 4;  // _z
-    return marshalSize;
-}
-
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
@@ -2,6 +2,7 @@
 
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -48,6 +49,36 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by Vector3Float.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_VECTOR3_FLOAT_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void Vector3Float::marshal(DataStream& dataStream) const
+{
+    dataStream << _x;
+    dataStream << _y;
+    dataStream << _z;
+}
+
+DIS_RECORD_CODEC void Vector3Float::unmarshal(DataStream& dataStream)
+{
+    dataStream >> _x;
+    dataStream >> _y;
+    dataStream >> _z;
+}
+
+DIS_RECORD_CODEC int Vector3Float::getMarshalledSize() const
+{
+   int marshalSize = 0;
+
+   marshalSize = marshalSize + 4;  // _x
+   marshalSize = marshalSize + 4;  // _y
+   marshalSize = marshalSize + 4;  // _z
+    return marshalSize;
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
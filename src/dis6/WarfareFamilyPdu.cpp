@@ -1,3 +1,4 @@
+#define DIS_WARFARE_FAMILY_PDU_DEFINITIONS
 #include <dis6/WarfareFamilyPdu.h>
 
 using namespace DIS;
@@ -44,21 +45,6 @@ void WarfareFamilyPdu::setTargetEntityID(const EntityID &pX)
     _targetEntityID = pX;
 }
 
-void WarfareFamilyPdu::marshal(DataStream& dataStream) const
-{
-    Pdu::marshal(dataStream); // Marshal information in superclass first
-    _firingEntityID.marshal(dataStream);
-    _targetEntityID.marshal(dataStream);
-}
-
-void WarfareFamilyPdu::unmarshal(DataStream& dataStream)
-{
-    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
-    _firingEntityID.unmarshal(dataStream);
-    _targetEntityID.unmarshal(dataStream);
-}
-
-
 bool WarfareFamilyPdu::operator ==(const WarfareFamilyPdu& rhs) const
  {
      bool ivarsEqual = true;
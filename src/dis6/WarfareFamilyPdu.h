@@ -5,6 +5,7 @@
 #include <dis6/Pdu.h>
 #include <utils/DataStream.h>
 #include <dis6/msLibMacro.h>
+#include <dis6/RecordCodecs.h>
 
 
 namespace DIS
@@ -47,6 +48,26 @@ virtual int getMarshalledSize() const;
 };
 }
 
+// the codecs, inline with OPENDIS_INLINE_RECORDS, otherwise compiled by WarfareFamilyPdu.cpp.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_WARFARE_FAMILY_PDU_DEFINITIONS)
+namespace DIS
+{
+DIS_RECORD_CODEC void WarfareFamilyPdu::marshal(DataStream& dataStream) const
+{
+    Pdu::marshal(dataStream); // Marshal information in superclass first
+    _firingEntityID.marshal(dataStream);
+    _targetEntityID.marshal(dataStream);
+}
+
+DIS_RECORD_CODEC void WarfareFamilyPdu::unmarshal(DataStream& dataStream)
+{
+    Pdu::unmarshal(dataStream); // unmarshal information in superclass first
+    _firingEntityID.unmarshal(dataStream);
+    _targetEntityID.unmarshal(dataStream);
+}
+}
+#endif
+
 // Copyright (c) 1995-2009 held by the author(s).  All rights reserved.
 // Redistribution and use in source and binary forms, with or without
 // modification, are permitted provided that the following conditions
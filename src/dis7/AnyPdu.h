@@ -0,0 +1,16 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis7_any_pdu_h_
+#define _dcl_dis7_any_pdu_h_
+
+#include <utils/AnyPdu.h>             // for BasicAnyPdu
+#include <dis7/PduRegistry.h>         // for PduRegistry
+
+namespace DIS
+{
+   /// holds any PDU of dis7/PduRegistry.h inline.
+   typedef BasicAnyPdu<PduRegistry, Pdu> AnyPdu;
+}
+
+#endif  // _dcl_dis7_any_pdu_h_
@@ -67,6 +67,16 @@ void ArticulatedParts::setParameterValue(float pX)
     _parameterValue = pX;
 }
 
+unsigned int ArticulatedParts::getPadding() const
+{
+    return _padding;
+}
+
+void ArticulatedParts::setPadding(unsigned int pX)
+{
+    _padding = pX;
+}
+
 void ArticulatedParts::marshal(DataStream& dataStream) const
 {
     dataStream << _recordType;
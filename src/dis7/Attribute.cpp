@@ -75,7 +75,7 @@ int Attribute::getMarshalledSize() const
    int marshalSize = 0;
 
    marshalSize = marshalSize + 4;  // _recordType
-   marshalSize = marshalSize + 1;  // _recordLength
+   marshalSize = marshalSize + 2;  // _recordLength
    marshalSize = marshalSize + 8;  // _recordSpecificFields
     return marshalSize;
 }
@@ -27,6 +27,16 @@ void ElectromagneticEmissionSystemData::setSystemDataLength(unsigned char pX)
     _systemDataLength = pX;
 }
 
+unsigned short ElectromagneticEmissionSystemData::getEmissionsPadding2() const
+{
+    return _emissionsPadding2;
+}
+
+void ElectromagneticEmissionSystemData::setEmissionsPadding2(unsigned short pX)
+{
+    _emissionsPadding2 = pX;
+}
+
 unsigned char ElectromagneticEmissionSystemData::getNumberOfBeams() const
 {
     return _beamDataRecords.size();
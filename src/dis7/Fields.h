@@ -0,0 +1,2060 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis7_fields_h_
+#define _dcl_dis7_fields_h_
+
+#include <utils/FieldVisitor.h>
+#include <dis7/AcknowledgePdu.h>
+#include <dis7/AcknowledgeReliablePdu.h>
+#include <dis7/AcousticEmitter.h>
+#include <dis7/ActionRequestPdu.h>
+#include <dis7/ActionRequestReliablePdu.h>
+#include <dis7/ActionResponsePdu.h>
+#include <dis7/ActionResponseReliablePdu.h>
+#include <dis7/AggregateIdentifier.h>
+#include <dis7/AggregateMarking.h>
+#include <dis7/AggregateType.h>
+#include <dis7/AngleDeception.h>
+#include <dis7/AngularVelocityVector.h>
+#include <dis7/AntennaLocation.h>
+#include <dis7/ArealObjectStatePdu.h>
+#include <dis7/ArticulatedParts.h>
+#include <dis7/Association.h>
+#include <dis7/AttachedParts.h>
+#include <dis7/Attribute.h>
+#include <dis7/AttributePdu.h>
+#include <dis7/BeamAntennaPattern.h>
+#include <dis7/BeamData.h>
+#include <dis7/BeamStatus.h>
+#include <dis7/BlankingSector.h>
+#include <dis7/ClockTime.h>
+#include <dis7/CollisionElasticPdu.h>
+#include <dis7/CollisionPdu.h>
+#include <dis7/CommentPdu.h>
+#include <dis7/CommentReliablePdu.h>
+#include <dis7/CommunicationsNodeID.h>
+#include <dis7/CreateEntityPdu.h>
+#include <dis7/CreateEntityReliablePdu.h>
+#include <dis7/DataPdu.h>
+#include <dis7/DataQueryDatumSpecification.h>
+#include <dis7/DataQueryPdu.h>
+#include <dis7/DataQueryReliablePdu.h>
+#include <dis7/DataReliablePdu.h>
+#include <dis7/DatumSpecification.h>
+#include <dis7/DeadReckoningParameters.h>
+#include <dis7/DesignatorPdu.h>
+#include <dis7/DetonationPdu.h>
+#include <dis7/DirectedEnergyAreaAimpoint.h>
+#include <dis7/DirectedEnergyDamage.h>
+#include <dis7/DirectedEnergyFirePdu.h>
+#include <dis7/DirectedEnergyPrecisionAimpoint.h>
+#include <dis7/DirectedEnergyTargetEnergyDeposition.h>
+#include <dis7/DistributedEmissionsFamilyPdu.h>
+#include <dis7/EEFundamentalParameterData.h>
+#include <dis7/EightByteChunk.h>
+#include <dis7/ElectromagneticEmissionBeamData.h>
+#include <dis7/ElectromagneticEmissionSystemData.h>
+#include <dis7/ElectromagneticEmissionsPdu.h>
+#include <dis7/EmitterSystem.h>
+#include <dis7/EngineFuel.h>
+#include <dis7/EngineFuelReload.h>
+#include <dis7/EntityAssociation.h>
+#include <dis7/EntityDamageStatusPdu.h>
+#include <dis7/EntityID.h>
+#include <dis7/EntityInformationFamilyPdu.h>
+#include <dis7/EntityManagementFamilyPdu.h>
+#include <dis7/EntityMarking.h>
+#include <dis7/EntityStatePdu.h>
+#include <dis7/EntityStateUpdatePdu.h>
+#include <dis7/EntityType.h>
+#include <dis7/EntityTypeVP.h>
+#include <dis7/Environment.h>
+#include <dis7/EnvironmentGeneral.h>
+#include <dis7/EnvironmentType.h>
+#include <dis7/EulerAngles.h>
+#include <dis7/EventIdentifier.h>
+#include <dis7/EventIdentifierLiveEntity.h>
+#include <dis7/EventReportPdu.h>
+#include <dis7/EventReportReliablePdu.h>
+#include <dis7/Expendable.h>
+#include <dis7/ExpendableDescriptor.h>
+#include <dis7/ExpendableReload.h>
+#include <dis7/ExplosionDescriptor.h>
+#include <dis7/FalseTargetsAttribute.h>
+#include <dis7/FastEntityStatePdu.h>
+#include <dis7/FirePdu.h>
+#include <dis7/FixedDatum.h>
+#include <dis7/FourByteChunk.h>
+#include <dis7/FundamentalOperationalData.h>
+#include <dis7/GridAxis.h>
+#include <dis7/GroupIdentifier.h>
+#include <dis7/IFFFundamentalParameterData.h>
+#include <dis7/IFFPdu.h>
+#include <dis7/IOCommunicationsNode.h>
+#include <dis7/IOEffect.h>
+#include <dis7/IffDataSpecification.h>
+#include <dis7/IntercomCommunicationsParameters.h>
+#include <dis7/IntercomIdentifier.h>
+#include <dis7/IntercomSignalPdu.h>
+#include <dis7/IsPartOfPdu.h>
+#include <dis7/JammingTechnique.h>
+#include <dis7/LaunchedMunitionRecord.h>
+#include <dis7/LayerHeader.h>
+#include <dis7/LinearObjectStatePdu.h>
+#include <dis7/LinearSegmentParameter.h>
+#include <dis7/LiveEntityIdentifier.h>
+#include <dis7/LiveEntityPdu.h>
+#include <dis7/LiveSimulationAddress.h>
+#include <dis7/LogisticsFamilyPdu.h>
+#include <dis7/MineEntityIdentifier.h>
+#include <dis7/MinefieldFamilyPdu.h>
+#include <dis7/MinefieldIdentifier.h>
+#include <dis7/MinefieldResponseNackPdu.h>
+#include <dis7/MinefieldStatePdu.h>
+#include <dis7/ModulationParameters.h>
+#include <dis7/ModulationType.h>
+#include <dis7/Munition.h>
+#include <dis7/MunitionDescriptor.h>
+#include <dis7/MunitionReload.h>
+#include <dis7/NamedLocationIdentification.h>
+#include <dis7/ObjectIdentifier.h>
+#include <dis7/ObjectType.h>
+#include <dis7/OneByteChunk.h>
+#include <dis7/OwnershipStatus.h>
+#include <dis7/Pdu.h>
+#include <dis7/PduContainer.h>
+#include <dis7/PduHeader.h>
+#include <dis7/PduStatus.h>
+#include <dis7/PduSuperclass.h>
+#include <dis7/PointObjectStatePdu.h>
+#include <dis7/PropulsionSystemData.h>
+#include <dis7/RadioCommunicationsFamilyPdu.h>
+#include <dis7/RadioIdentifier.h>
+#include <dis7/RadioType.h>
+#include <dis7/ReceiverPdu.h>
+#include <dis7/RecordQueryReliablePdu.h>
+#include <dis7/RecordQuerySpecification.h>
+#include <dis7/RecordSpecification.h>
+#include <dis7/RecordSpecificationElement.h>
+#include <dis7/Relationship.h>
+#include <dis7/RemoveEntityPdu.h>
+#include <dis7/RemoveEntityReliablePdu.h>
+#include <dis7/RepairCompletePdu.h>
+#include <dis7/RepairResponsePdu.h>
+#include <dis7/ResupplyOfferPdu.h>
+#include <dis7/ResupplyReceivedPdu.h>
+#include <dis7/SecondaryOperationalData.h>
+#include <dis7/SeesPdu.h>
+#include <dis7/Sensor.h>
+#include <dis7/SeparationVP.h>
+#include <dis7/ServiceRequestPdu.h>
+#include <dis7/SetDataPdu.h>
+#include <dis7/SetDataReliablePdu.h>
+#include <dis7/SimulationAddress.h>
+#include <dis7/SimulationIdentifier.h>
+#include <dis7/SimulationManagementFamilyPdu.h>
+#include <dis7/SimulationManagementPduHeader.h>
+#include <dis7/SimulationManagementWithReliabilityFamilyPdu.h>
+#include <dis7/StandardVariableSpecification.h>
+#include <dis7/StartResumePdu.h>
+#include <dis7/StartResumeReliablePdu.h>
+#include <dis7/StopFreezePdu.h>
+#include <dis7/StopFreezeReliablePdu.h>
+#include <dis7/StorageFuel.h>
+#include <dis7/StorageFuelReload.h>
+#include <dis7/SupplyQuantity.h>
+#include <dis7/SyntheticEnvironmentFamilyPdu.h>
+#include <dis7/SystemIdentifier.h>
+#include <dis7/TotalRecordSets.h>
+#include <dis7/TrackJamData.h>
+#include <dis7/TwoByteChunk.h>
+#include <dis7/UAFundamentalParameter.h>
+#include <dis7/UaPdu.h>
+#include <dis7/UnattachedIdentifier.h>
+#include <dis7/UnsignedDISInteger.h>
+#include <dis7/VariableDatum.h>
+#include <dis7/VariableParameter.h>
+#include <dis7/VariableTransmitterParameters.h>
+#include <dis7/Vector2Float.h>
+#include <dis7/Vector3Double.h>
+#include <dis7/Vector3Float.h>
+#include <dis7/VectoringNozzleSystem.h>
+#include <dis7/WarfareFamilyPdu.h>
+
+/// the fields of every DIS 7 PDU and record, in the order they are marshalled.
+/// see utils/FieldVisitor.h for the calls made to the visitor, and utils/FieldAlgorithms.h for the
+/// algorithms written on them.
+/// generated by scripts/generate_fields.py from the marshal functions, and not edited by hand.
+namespace DIS
+{
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcknowledgePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "acknowledgeFlag" , r.getAcknowledgeFlag() , others.getAcknowledgeFlag()... );
+      v.Field( "responseFlag" , r.getResponseFlag() , others.getResponseFlag()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcknowledgeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "acknowledgeFlag" , r.getAcknowledgeFlag() , others.getAcknowledgeFlag()... );
+      v.Field( "responseFlag" , r.getResponseFlag() , others.getResponseFlag()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AcousticEmitter& r, const Others&... others)
+   {
+      v.Field( "acousticName" , r.getAcousticName() , others.getAcousticName()... );
+      v.Field( "function" , r.getFunction() , others.getFunction()... );
+      v.Field( "acousticIdNumber" , r.getAcousticIdNumber() , others.getAcousticIdNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionRequestPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "actionID" , r.getActionID() , others.getActionID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionRequestReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "actionID" , r.getActionID() , others.getActionID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionResponsePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requestStatus" , r.getRequestStatus() , others.getRequestStatus()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ActionResponseReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "responseStatus" , r.getResponseStatus() , others.getResponseStatus()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "aggregateID" , r.getAggregateID() , others.getAggregateID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateMarking& r, const Others&... others)
+   {
+      v.Field( "characterSet" , r.getCharacterSet() , others.getCharacterSet()... );
+      v.Array( "characters" , MakeFieldArray( r.getCharacters() , 31 ) , MakeFieldArray( others.getCharacters() , 31 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AggregateType& r, const Others&... others)
+   {
+      v.Field( "aggregateKind" , r.getAggregateKind() , others.getAggregateKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AngleDeception& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "emitterNumber" , r.getEmitterNumber() , others.getEmitterNumber()... );
+      v.Field( "beamNumber" , r.getBeamNumber() , others.getBeamNumber()... );
+      v.Field( "stateIndicator" , r.getStateIndicator() , others.getStateIndicator()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "azimuthOffset" , r.getAzimuthOffset() , others.getAzimuthOffset()... );
+      v.Field( "azimuthWidth" , r.getAzimuthWidth() , others.getAzimuthWidth()... );
+      v.Field( "azimuthPullRate" , r.getAzimuthPullRate() , others.getAzimuthPullRate()... );
+      v.Field( "azimuthPullAcceleration" , r.getAzimuthPullAcceleration() , others.getAzimuthPullAcceleration()... );
+      v.Field( "elevationOffset" , r.getElevationOffset() , others.getElevationOffset()... );
+      v.Field( "elevationWidth" , r.getElevationWidth() , others.getElevationWidth()... );
+      v.Field( "elevationPullRate" , r.getElevationPullRate() , others.getElevationPullRate()... );
+      v.Field( "elevationPullAcceleration" , r.getElevationPullAcceleration() , others.getElevationPullAcceleration()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AngularVelocityVector& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AntennaLocation& r, const Others&... others)
+   {
+      v.Field( "antennaLocation" , r.getAntennaLocation() , others.getAntennaLocation()... );
+      v.Field( "relativeAntennaLocation" , r.getRelativeAntennaLocation() , others.getRelativeAntennaLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ArealObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Field( "modifications" , r.getModifications() , others.getModifications()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.Field( "specificObjectAppearance" , r.getSpecificObjectAppearance() , others.getSpecificObjectAppearance()... );
+      v.Field( "generalObjectAppearance" , r.getGeneralObjectAppearance() , others.getGeneralObjectAppearance()... );
+      v.Count( "numberOfPoints" , "objectLocation" , static_cast<unsigned short>( r.getObjectLocation().size() ) , static_cast<unsigned short>( others.getObjectLocation().size() )... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.List( "objectLocation" , r.getObjectLocation() , others.getObjectLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ArticulatedParts& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "changeIndicator" , r.getChangeIndicator() , others.getChangeIndicator()... );
+      v.Field( "partAttachedTo" , r.getPartAttachedTo() , others.getPartAttachedTo()... );
+      v.Field( "parameterType" , r.getParameterType() , others.getParameterType()... );
+      v.Field( "parameterValue" , r.getParameterValue() , others.getParameterValue()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Association& r, const Others&... others)
+   {
+      v.Field( "associationType" , r.getAssociationType() , others.getAssociationType()... );
+      v.Field( "padding4" , r.getPadding4() , others.getPadding4()... );
+      v.Field( "associatedEntityID" , r.getAssociatedEntityID() , others.getAssociatedEntityID()... );
+      v.Field( "associatedLocation" , r.getAssociatedLocation() , others.getAssociatedLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AttachedParts& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "detachedIndicator" , r.getDetachedIndicator() , others.getDetachedIndicator()... );
+      v.Field( "partAttachedTo" , r.getPartAttachedTo() , others.getPartAttachedTo()... );
+      v.Field( "parameterType" , r.getParameterType() , others.getParameterType()... );
+      v.Field( "attachedPartType" , r.getAttachedPartType() , others.getAttachedPartType()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Attribute& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "recordSpecificFields" , r.getRecordSpecificFields() , others.getRecordSpecificFields()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const AttributePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "originatingSimulationAddress" , r.getOriginatingSimulationAddress() , others.getOriginatingSimulationAddress()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "attributeRecordPduType" , r.getAttributeRecordPduType() , others.getAttributeRecordPduType()... );
+      v.Field( "attributeRecordProtocolVersion" , r.getAttributeRecordProtocolVersion() , others.getAttributeRecordProtocolVersion()... );
+      v.Field( "masterAttributeRecordType" , r.getMasterAttributeRecordType() , others.getMasterAttributeRecordType()... );
+      v.Field( "actionCode" , r.getActionCode() , others.getActionCode()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+      v.Field( "numberAttributeRecordSet" , r.getNumberAttributeRecordSet() , others.getNumberAttributeRecordSet()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BeamAntennaPattern& r, const Others&... others)
+   {
+      v.Field( "beamDirection" , r.getBeamDirection() , others.getBeamDirection()... );
+      v.Field( "azimuthBeamwidth" , r.getAzimuthBeamwidth() , others.getAzimuthBeamwidth()... );
+      v.Field( "elevationBeamwidth" , r.getElevationBeamwidth() , others.getElevationBeamwidth()... );
+      v.Field( "referenceSystem" , r.getReferenceSystem() , others.getReferenceSystem()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "ez" , r.getEz() , others.getEz()... );
+      v.Field( "ex" , r.getEx() , others.getEx()... );
+      v.Field( "phase" , r.getPhase() , others.getPhase()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BeamData& r, const Others&... others)
+   {
+      v.Field( "beamAzimuthCenter" , r.getBeamAzimuthCenter() , others.getBeamAzimuthCenter()... );
+      v.Field( "beamAzimuthSweep" , r.getBeamAzimuthSweep() , others.getBeamAzimuthSweep()... );
+      v.Field( "beamElevationCenter" , r.getBeamElevationCenter() , others.getBeamElevationCenter()... );
+      v.Field( "beamElevationSweep" , r.getBeamElevationSweep() , others.getBeamElevationSweep()... );
+      v.Field( "beamSweepSync" , r.getBeamSweepSync() , others.getBeamSweepSync()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BeamStatus& r, const Others&... others)
+   {
+      v.Field( "beamState" , r.getBeamState() , others.getBeamState()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const BlankingSector& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "emitterNumber" , r.getEmitterNumber() , others.getEmitterNumber()... );
+      v.Field( "beamNumber" , r.getBeamNumber() , others.getBeamNumber()... );
+      v.Field( "stateIndicator" , r.getStateIndicator() , others.getStateIndicator()... );
+      v.Field( "leftAzimuth" , r.getLeftAzimuth() , others.getLeftAzimuth()... );
+      v.Field( "rightAzimuth" , r.getRightAzimuth() , others.getRightAzimuth()... );
+      v.Field( "lowerElevation" , r.getLowerElevation() , others.getLowerElevation()... );
+      v.Field( "upperElevation" , r.getUpperElevation() , others.getUpperElevation()... );
+      v.Field( "residualPower" , r.getResidualPower() , others.getResidualPower()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ClockTime& r, const Others&... others)
+   {
+      v.Field( "hour" , r.getHour() , others.getHour()... );
+      v.Field( "timePastHour" , r.getTimePastHour() , others.getTimePastHour()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CollisionElasticPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "issuingEntityID" , r.getIssuingEntityID() , others.getIssuingEntityID()... );
+      v.Field( "collidingEntityID" , r.getCollidingEntityID() , others.getCollidingEntityID()... );
+      v.Field( "collisionEventID" , r.getCollisionEventID() , others.getCollisionEventID()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "contactVelocity" , r.getContactVelocity() , others.getContactVelocity()... );
+      v.Field( "mass" , r.getMass() , others.getMass()... );
+      v.Field( "locationOfImpact" , r.getLocationOfImpact() , others.getLocationOfImpact()... );
+      v.Field( "collisionIntermediateResultXX" , r.getCollisionIntermediateResultXX() , others.getCollisionIntermediateResultXX()... );
+      v.Field( "collisionIntermediateResultXY" , r.getCollisionIntermediateResultXY() , others.getCollisionIntermediateResultXY()... );
+      v.Field( "collisionIntermediateResultXZ" , r.getCollisionIntermediateResultXZ() , others.getCollisionIntermediateResultXZ()... );
+      v.Field( "collisionIntermediateResultYY" , r.getCollisionIntermediateResultYY() , others.getCollisionIntermediateResultYY()... );
+      v.Field( "collisionIntermediateResultYZ" , r.getCollisionIntermediateResultYZ() , others.getCollisionIntermediateResultYZ()... );
+      v.Field( "collisionIntermediateResultZZ" , r.getCollisionIntermediateResultZZ() , others.getCollisionIntermediateResultZZ()... );
+      v.Field( "unitSurfaceNormal" , r.getUnitSurfaceNormal() , others.getUnitSurfaceNormal()... );
+      v.Field( "coefficientOfRestitution" , r.getCoefficientOfRestitution() , others.getCoefficientOfRestitution()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CollisionPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "issuingEntityID" , r.getIssuingEntityID() , others.getIssuingEntityID()... );
+      v.Field( "collidingEntityID" , r.getCollidingEntityID() , others.getCollidingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "collisionType" , r.getCollisionType() , others.getCollisionType()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "mass" , r.getMass() , others.getMass()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CommentPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CommentReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CommunicationsNodeID& r, const Others&... others)
+   {
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "elementID" , r.getElementID() , others.getElementID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CreateEntityPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const CreateEntityReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataQueryDatumSpecification& r, const Others&... others)
+   {
+      v.Count( "numberOfFixedDatums" , "fixedDatumIDList" , static_cast<unsigned int>( r.getFixedDatumIDList().size() ) , static_cast<unsigned int>( others.getFixedDatumIDList().size() )... );
+      v.Count( "numberOfVariableDatums" , "variableDatumIDList" , static_cast<unsigned int>( r.getVariableDatumIDList().size() ) , static_cast<unsigned int>( others.getVariableDatumIDList().size() )... );
+      v.List( "fixedDatumIDList" , r.getFixedDatumIDList() , others.getFixedDatumIDList()... );
+      v.List( "variableDatumIDList" , r.getVariableDatumIDList() , others.getVariableDatumIDList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataQueryPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "timeInterval" , r.getTimeInterval() , others.getTimeInterval()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataQueryReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "timeInterval" , r.getTimeInterval() , others.getTimeInterval()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DataReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DatumSpecification& r, const Others&... others)
+   {
+      v.Count( "numberOfFixedDatums" , "fixedDatumIDList" , static_cast<unsigned int>( r.getFixedDatumIDList().size() ) , static_cast<unsigned int>( others.getFixedDatumIDList().size() )... );
+      v.Count( "numberOfVariableDatums" , "variableDatumIDList" , static_cast<unsigned int>( r.getVariableDatumIDList().size() ) , static_cast<unsigned int>( others.getVariableDatumIDList().size() )... );
+      v.List( "fixedDatumIDList" , r.getFixedDatumIDList() , others.getFixedDatumIDList()... );
+      v.List( "variableDatumIDList" , r.getVariableDatumIDList() , others.getVariableDatumIDList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DeadReckoningParameters& r, const Others&... others)
+   {
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Array( "parameters" , MakeFieldArray( r.getParameters() , 15 ) , MakeFieldArray( others.getParameters() , 15 )... );
+      v.Field( "entityLinearAcceleration" , r.getEntityLinearAcceleration() , others.getEntityLinearAcceleration()... );
+      v.Field( "entityAngularVelocity" , r.getEntityAngularVelocity() , others.getEntityAngularVelocity()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DesignatorPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "designatingEntityID" , r.getDesignatingEntityID() , others.getDesignatingEntityID()... );
+      v.Field( "codeName" , r.getCodeName() , others.getCodeName()... );
+      v.Field( "designatedEntityID" , r.getDesignatedEntityID() , others.getDesignatedEntityID()... );
+      v.Field( "designatorCode" , r.getDesignatorCode() , others.getDesignatorCode()... );
+      v.Field( "designatorPower" , r.getDesignatorPower() , others.getDesignatorPower()... );
+      v.Field( "designatorWavelength" , r.getDesignatorWavelength() , others.getDesignatorWavelength()... );
+      v.Field( "designatorSpotWrtDesignated" , r.getDesignatorSpotWrtDesignated() , others.getDesignatorSpotWrtDesignated()... );
+      v.Field( "designatorSpotLocation" , r.getDesignatorSpotLocation() , others.getDesignatorSpotLocation()... );
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "entityLinearAcceleration" , r.getEntityLinearAcceleration() , others.getEntityLinearAcceleration()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DetonationPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "explodingEntityID" , r.getExplodingEntityID() , others.getExplodingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "locationInWorldCoordinates" , r.getLocationInWorldCoordinates() , others.getLocationInWorldCoordinates()... );
+      v.Field( "descriptor" , r.getDescriptor() , others.getDescriptor()... );
+      v.Field( "locationOfEntityCoordinates" , r.getLocationOfEntityCoordinates() , others.getLocationOfEntityCoordinates()... );
+      v.Field( "detonationResult" , r.getDetonationResult() , others.getDetonationResult()... );
+      v.Count( "numberOfVariableParameters" , "variableParameters" , static_cast<unsigned char>( r.getVariableParameters().size() ) , static_cast<unsigned char>( others.getVariableParameters().size() )... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.List( "variableParameters" , r.getVariableParameters() , others.getVariableParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DirectedEnergyAreaAimpoint& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Count( "beamAntennaPatternRecordCount" , "beamAntennaParameterList" , static_cast<unsigned short>( r.getBeamAntennaParameterList().size() ) , static_cast<unsigned short>( others.getBeamAntennaParameterList().size() )... );
+      v.Count( "directedEnergyTargetEnergyDepositionRecordCount" , "directedEnergyTargetEnergyDepositionRecordList" , static_cast<unsigned short>( r.getDirectedEnergyTargetEnergyDepositionRecordList().size() ) , static_cast<unsigned short>( others.getDirectedEnergyTargetEnergyDepositionRecordList().size() )... );
+      v.List( "beamAntennaParameterList" , r.getBeamAntennaParameterList() , others.getBeamAntennaParameterList()... );
+      v.List( "directedEnergyTargetEnergyDepositionRecordList" , r.getDirectedEnergyTargetEnergyDepositionRecordList() , others.getDirectedEnergyTargetEnergyDepositionRecordList()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DirectedEnergyDamage& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "damageLocation" , r.getDamageLocation() , others.getDamageLocation()... );
+      v.Field( "damageDiameter" , r.getDamageDiameter() , others.getDamageDiameter()... );
+      v.Field( "temperature" , r.getTemperature() , others.getTemperature()... );
+      v.Field( "componentIdentification" , r.getComponentIdentification() , others.getComponentIdentification()... );
+      v.Field( "componentDamageStatus" , r.getComponentDamageStatus() , others.getComponentDamageStatus()... );
+      v.Field( "componentVisualDamageStatus" , r.getComponentVisualDamageStatus() , others.getComponentVisualDamageStatus()... );
+      v.Field( "componentVisualSmokeColor" , r.getComponentVisualSmokeColor() , others.getComponentVisualSmokeColor()... );
+      v.Field( "fireEventID" , r.getFireEventID() , others.getFireEventID()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DirectedEnergyFirePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "munitionType" , r.getMunitionType() , others.getMunitionType()... );
+      v.Field( "shotStartTime" , r.getShotStartTime() , others.getShotStartTime()... );
+      v.Field( "commulativeShotTime" , r.getCommulativeShotTime() , others.getCommulativeShotTime()... );
+      v.Field( "ApertureEmitterLocation" , r.getApertureEmitterLocation() , others.getApertureEmitterLocation()... );
+      v.Field( "apertureDiameter" , r.getApertureDiameter() , others.getApertureDiameter()... );
+      v.Field( "wavelength" , r.getWavelength() , others.getWavelength()... );
+      v.Field( "peakIrradiance" , r.getPeakIrradiance() , others.getPeakIrradiance()... );
+      v.Field( "pulseRepetitionFrequency" , r.getPulseRepetitionFrequency() , others.getPulseRepetitionFrequency()... );
+      v.Field( "pulseWidth" , r.getPulseWidth() , others.getPulseWidth()... );
+      v.Field( "flags" , r.getFlags() , others.getFlags()... );
+      v.Field( "pulseShape" , r.getPulseShape() , others.getPulseShape()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+      v.Count( "numberOfDERecords" , "dERecords" , static_cast<unsigned short>( r.getDERecords().size() ) , static_cast<unsigned short>( others.getDERecords().size() )... );
+      v.List( "dERecords" , r.getDERecords() , others.getDERecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DirectedEnergyPrecisionAimpoint& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "targetSpotLocation" , r.getTargetSpotLocation() , others.getTargetSpotLocation()... );
+      v.Field( "targetSpotEntityLocation" , r.getTargetSpotEntityLocation() , others.getTargetSpotEntityLocation()... );
+      v.Field( "targetSpotVelocity" , r.getTargetSpotVelocity() , others.getTargetSpotVelocity()... );
+      v.Field( "targetSpotAcceleration" , r.getTargetSpotAcceleration() , others.getTargetSpotAcceleration()... );
+      v.Field( "targetEntityID" , r.getTargetEntityID() , others.getTargetEntityID()... );
+      v.Field( "targetComponentID" , r.getTargetComponentID() , others.getTargetComponentID()... );
+      v.Field( "SpotShape" , r.getSpotShape() , others.getSpotShape()... );
+      v.Field( "BeamSpotXSecSemiMajorAxis" , r.getBeamSpotXSecSemiMajorAxis() , others.getBeamSpotXSecSemiMajorAxis()... );
+      v.Field( "BeamSpotCrossSectionSemiMinorAxis" , r.getBeamSpotCrossSectionSemiMinorAxis() , others.getBeamSpotCrossSectionSemiMinorAxis()... );
+      v.Field( "BeamSpotCrossSectionOrientAngle" , r.getBeamSpotCrossSectionOrientAngle() , others.getBeamSpotCrossSectionOrientAngle()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DirectedEnergyTargetEnergyDeposition& r, const Others&... others)
+   {
+      v.Field( "targetEntityID" , r.getTargetEntityID() , others.getTargetEntityID()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "peakIrradiance" , r.getPeakIrradiance() , others.getPeakIrradiance()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const DistributedEmissionsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EEFundamentalParameterData& r, const Others&... others)
+   {
+      v.Field( "frequency" , r.getFrequency() , others.getFrequency()... );
+      v.Field( "frequencyRange" , r.getFrequencyRange() , others.getFrequencyRange()... );
+      v.Field( "effectiveRadiatedPower" , r.getEffectiveRadiatedPower() , others.getEffectiveRadiatedPower()... );
+      v.Field( "pulseRepetitionFrequency" , r.getPulseRepetitionFrequency() , others.getPulseRepetitionFrequency()... );
+      v.Field( "pulseWidth" , r.getPulseWidth() , others.getPulseWidth()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EightByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 8 ) , MakeFieldArray( others.getOtherParameters() , 8 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionBeamData& r, const Others&... others)
+   {
+      v.Field( "beamDataLength" , r.getBeamDataLength() , others.getBeamDataLength()... );
+      v.Field( "beamIDNumber" , r.getBeamIDNumber() , others.getBeamIDNumber()... );
+      v.Field( "beamParameterIndex" , r.getBeamParameterIndex() , others.getBeamParameterIndex()... );
+      v.Field( "fundamentalParameterData" , r.getFundamentalParameterData() , others.getFundamentalParameterData()... );
+      v.Field( "beamData" , r.getBeamData() , others.getBeamData()... );
+      v.Field( "beamFunction" , r.getBeamFunction() , others.getBeamFunction()... );
+      v.Count( "numberOfTrackJamTargets" , "trackJamTargets" , static_cast<unsigned char>( r.getTrackJamTargets().size() ) , static_cast<unsigned char>( others.getTrackJamTargets().size() )... );
+      v.Field( "highDensityTrackJam" , r.getHighDensityTrackJam() , others.getHighDensityTrackJam()... );
+      v.Field( "beamStatus" , r.getBeamStatus() , others.getBeamStatus()... );
+      v.Field( "jammingTechnique" , r.getJammingTechnique() , others.getJammingTechnique()... );
+      v.List( "trackJamTargets" , r.getTrackJamTargets() , others.getTrackJamTargets()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionSystemData& r, const Others&... others)
+   {
+      v.Field( "systemDataLength" , r.getSystemDataLength() , others.getSystemDataLength()... );
+      v.Count( "numberOfBeams" , "beamDataRecords" , static_cast<unsigned char>( r.getBeamDataRecords().size() ) , static_cast<unsigned char>( others.getBeamDataRecords().size() )... );
+      v.Field( "emissionsPadding2" , r.getEmissionsPadding2() , others.getEmissionsPadding2()... );
+      v.Field( "emitterSystem" , r.getEmitterSystem() , others.getEmitterSystem()... );
+      v.Field( "location" , r.getLocation() , others.getLocation()... );
+      v.List( "beamDataRecords" , r.getBeamDataRecords() , others.getBeamDataRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ElectromagneticEmissionsPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityID" , r.getEmittingEntityID() , others.getEmittingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "stateUpdateIndicator" , r.getStateUpdateIndicator() , others.getStateUpdateIndicator()... );
+      v.Count( "numberOfSystems" , "systems" , static_cast<unsigned char>( r.getSystems().size() ) , static_cast<unsigned char>( others.getSystems().size() )... );
+      v.Field( "paddingForEmissionsPdu" , r.getPaddingForEmissionsPdu() , others.getPaddingForEmissionsPdu()... );
+      v.List( "systems" , r.getSystems() , others.getSystems()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EmitterSystem& r, const Others&... others)
+   {
+      v.Field( "emitterName" , r.getEmitterName() , others.getEmitterName()... );
+      v.Field( "function" , r.getFunction() , others.getFunction()... );
+      v.Field( "emitterIdNumber" , r.getEmitterIdNumber() , others.getEmitterIdNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EngineFuel& r, const Others&... others)
+   {
+      v.Field( "fuelQuantity" , r.getFuelQuantity() , others.getFuelQuantity()... );
+      v.Field( "fuelMeasurementUnits" , r.getFuelMeasurementUnits() , others.getFuelMeasurementUnits()... );
+      v.Field( "fuelType" , r.getFuelType() , others.getFuelType()... );
+      v.Field( "fuelLocation" , r.getFuelLocation() , others.getFuelLocation()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EngineFuelReload& r, const Others&... others)
+   {
+      v.Field( "standardQuantity" , r.getStandardQuantity() , others.getStandardQuantity()... );
+      v.Field( "maximumQuantity" , r.getMaximumQuantity() , others.getMaximumQuantity()... );
+      v.Field( "standardQuantityReloadTime" , r.getStandardQuantityReloadTime() , others.getStandardQuantityReloadTime()... );
+      v.Field( "maximumQuantityReloadTime" , r.getMaximumQuantityReloadTime() , others.getMaximumQuantityReloadTime()... );
+      v.Field( "fuelMeasurmentUnits" , r.getFuelMeasurmentUnits() , others.getFuelMeasurmentUnits()... );
+      v.Field( "fuelLocation" , r.getFuelLocation() , others.getFuelLocation()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityAssociation& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "changeIndicator" , r.getChangeIndicator() , others.getChangeIndicator()... );
+      v.Field( "associationStatus" , r.getAssociationStatus() , others.getAssociationStatus()... );
+      v.Field( "associationType" , r.getAssociationType() , others.getAssociationType()... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "owsSttionLocation" , r.getOwsSttionLocation() , others.getOwsSttionLocation()... );
+      v.Field( "physicalConnectionType" , r.getPhysicalConnectionType() , others.getPhysicalConnectionType()... );
+      v.Field( "groupMemberType" , r.getGroupMemberType() , others.getGroupMemberType()... );
+      v.Field( "groupNumber" , r.getGroupNumber() , others.getGroupNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityDamageStatusPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "damagedEntityID" , r.getDamagedEntityID() , others.getDamagedEntityID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Count( "numberOfDamageDescription" , "damageDescriptionRecords" , static_cast<unsigned short>( r.getDamageDescriptionRecords().size() ) , static_cast<unsigned short>( others.getDamageDescriptionRecords().size() )... );
+      v.List( "damageDescriptionRecords" , r.getDamageDescriptionRecords() , others.getDamageDescriptionRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityID& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "entityNumber" , r.getEntityNumber() , others.getEntityNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityInformationFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityManagementFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityMarking& r, const Others&... others)
+   {
+      v.Field( "characterSet" , r.getCharacterSet() , others.getCharacterSet()... );
+      v.Array( "characters" , MakeFieldArray( r.getCharacters() , 11 ) , MakeFieldArray( others.getCharacters() , 11 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "forceId" , r.getForceId() , others.getForceId()... );
+      v.Count( "numberOfVariableParameters" , "variableParameters" , static_cast<unsigned char>( r.getVariableParameters().size() ) , static_cast<unsigned char>( others.getVariableParameters().size() )... );
+      v.Field( "entityType" , r.getEntityType() , others.getEntityType()... );
+      v.Field( "alternativeEntityType" , r.getAlternativeEntityType() , others.getAlternativeEntityType()... );
+      v.Field( "entityLinearVelocity" , r.getEntityLinearVelocity() , others.getEntityLinearVelocity()... );
+      v.Field( "entityLocation" , r.getEntityLocation() , others.getEntityLocation()... );
+      v.Field( "entityOrientation" , r.getEntityOrientation() , others.getEntityOrientation()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.Field( "deadReckoningParameters" , r.getDeadReckoningParameters() , others.getDeadReckoningParameters()... );
+      v.Field( "marking" , r.getMarking() , others.getMarking()... );
+      v.Field( "capabilities" , r.getCapabilities() , others.getCapabilities()... );
+      v.List( "variableParameters" , r.getVariableParameters() , others.getVariableParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityStateUpdatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfVariableParameters" , "variableParameters" , static_cast<unsigned char>( r.getVariableParameters().size() ) , static_cast<unsigned char>( others.getVariableParameters().size() )... );
+      v.Field( "entityLinearVelocity" , r.getEntityLinearVelocity() , others.getEntityLinearVelocity()... );
+      v.Field( "entityLocation" , r.getEntityLocation() , others.getEntityLocation()... );
+      v.Field( "entityOrientation" , r.getEntityOrientation() , others.getEntityOrientation()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.List( "variableParameters" , r.getVariableParameters() , others.getVariableParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EntityTypeVP& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "changeIndicator" , r.getChangeIndicator() , others.getChangeIndicator()... );
+      v.Field( "entityType" , r.getEntityType() , others.getEntityType()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Environment& r, const Others&... others)
+   {
+      v.Field( "environmentType" , r.getEnvironmentType() , others.getEnvironmentType()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+      v.Field( "index" , r.getIndex() , others.getIndex()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EnvironmentGeneral& r, const Others&... others)
+   {
+      v.Field( "environmentType" , r.getEnvironmentType() , others.getEnvironmentType()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+      v.Field( "index" , r.getIndex() , others.getIndex()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "geometry" , r.getGeometry() , others.getGeometry()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EnvironmentType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "entityClass" , r.getEntityClass() , others.getEntityClass()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EulerAngles& r, const Others&... others)
+   {
+      v.Field( "psi" , r.getPsi() , others.getPsi()... );
+      v.Field( "theta" , r.getTheta() , others.getTheta()... );
+      v.Field( "phi" , r.getPhi() , others.getPhi()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "eventNumber" , r.getEventNumber() , others.getEventNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventIdentifierLiveEntity& r, const Others&... others)
+   {
+      v.Field( "siteNumber" , r.getSiteNumber() , others.getSiteNumber()... );
+      v.Field( "applicationNumber" , r.getApplicationNumber() , others.getApplicationNumber()... );
+      v.Field( "eventNumber" , r.getEventNumber() , others.getEventNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventReportPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const EventReportReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Expendable& r, const Others&... others)
+   {
+      v.Field( "expendable" , r.getExpendable() , others.getExpendable()... );
+      v.Field( "station" , r.getStation() , others.getStation()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+      v.Field( "expendableStatus" , r.getExpendableStatus() , others.getExpendableStatus()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ExpendableDescriptor& r, const Others&... others)
+   {
+      v.Field( "expendableType" , r.getExpendableType() , others.getExpendableType()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ExpendableReload& r, const Others&... others)
+   {
+      v.Field( "expendable" , r.getExpendable() , others.getExpendable()... );
+      v.Field( "station" , r.getStation() , others.getStation()... );
+      v.Field( "standardQuantity" , r.getStandardQuantity() , others.getStandardQuantity()... );
+      v.Field( "maximumQuantity" , r.getMaximumQuantity() , others.getMaximumQuantity()... );
+      v.Field( "standardQuantityReloadTime" , r.getStandardQuantityReloadTime() , others.getStandardQuantityReloadTime()... );
+      v.Field( "maximumQuantityReloadTime" , r.getMaximumQuantityReloadTime() , others.getMaximumQuantityReloadTime()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ExplosionDescriptor& r, const Others&... others)
+   {
+      v.Field( "explodingObject" , r.getExplodingObject() , others.getExplodingObject()... );
+      v.Field( "explosiveMaterial" , r.getExplosiveMaterial() , others.getExplosiveMaterial()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "explosiveForce" , r.getExplosiveForce() , others.getExplosiveForce()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FalseTargetsAttribute& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "emitterNumber" , r.getEmitterNumber() , others.getEmitterNumber()... );
+      v.Field( "beamNumber" , r.getBeamNumber() , others.getBeamNumber()... );
+      v.Field( "stateIndicator" , r.getStateIndicator() , others.getStateIndicator()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "falseTargetCount" , r.getFalseTargetCount() , others.getFalseTargetCount()... );
+      v.Field( "walkSpeed" , r.getWalkSpeed() , others.getWalkSpeed()... );
+      v.Field( "walkAcceleration" , r.getWalkAcceleration() , others.getWalkAcceleration()... );
+      v.Field( "maximumWalkDistance" , r.getMaximumWalkDistance() , others.getMaximumWalkDistance()... );
+      v.Field( "keepTime" , r.getKeepTime() , others.getKeepTime()... );
+      v.Field( "echoSpacing" , r.getEchoSpacing() , others.getEchoSpacing()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FastEntityStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityInformationFamilyPdu&>( r ) , static_cast<const EntityInformationFamilyPdu&>( others )... );
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+      v.Field( "entity" , r.getEntity() , others.getEntity()... );
+      v.Field( "forceId" , r.getForceId() , others.getForceId()... );
+      v.Count( "numberOfVariableParameters" , "variableParameters" , static_cast<char>( r.getVariableParameters().size() ) , static_cast<char>( others.getVariableParameters().size() )... );
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+      v.Field( "altEntityKind" , r.getAltEntityKind() , others.getAltEntityKind()... );
+      v.Field( "altDomain" , r.getAltDomain() , others.getAltDomain()... );
+      v.Field( "altCountry" , r.getAltCountry() , others.getAltCountry()... );
+      v.Field( "altCategory" , r.getAltCategory() , others.getAltCategory()... );
+      v.Field( "altSubcategory" , r.getAltSubcategory() , others.getAltSubcategory()... );
+      v.Field( "altSpecific" , r.getAltSpecific() , others.getAltSpecific()... );
+      v.Field( "altExtra" , r.getAltExtra() , others.getAltExtra()... );
+      v.Field( "xVelocity" , r.getXVelocity() , others.getXVelocity()... );
+      v.Field( "yVelocity" , r.getYVelocity() , others.getYVelocity()... );
+      v.Field( "zVelocity" , r.getZVelocity() , others.getZVelocity()... );
+      v.Field( "xLocation" , r.getXLocation() , others.getXLocation()... );
+      v.Field( "yLocation" , r.getYLocation() , others.getYLocation()... );
+      v.Field( "zLocation" , r.getZLocation() , others.getZLocation()... );
+      v.Field( "psi" , r.getPsi() , others.getPsi()... );
+      v.Field( "theta" , r.getTheta() , others.getTheta()... );
+      v.Field( "phi" , r.getPhi() , others.getPhi()... );
+      v.Field( "entityAppearance" , r.getEntityAppearance() , others.getEntityAppearance()... );
+      v.Field( "deadReckoningAlgorithm" , r.getDeadReckoningAlgorithm() , others.getDeadReckoningAlgorithm()... );
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 15 ) , MakeFieldArray( others.getOtherParameters() , 15 )... );
+      v.Field( "xAcceleration" , r.getXAcceleration() , others.getXAcceleration()... );
+      v.Field( "yAcceleration" , r.getYAcceleration() , others.getYAcceleration()... );
+      v.Field( "zAcceleration" , r.getZAcceleration() , others.getZAcceleration()... );
+      v.Field( "xAngularVelocity" , r.getXAngularVelocity() , others.getXAngularVelocity()... );
+      v.Field( "yAngularVelocity" , r.getYAngularVelocity() , others.getYAngularVelocity()... );
+      v.Field( "zAngularVelocity" , r.getZAngularVelocity() , others.getZAngularVelocity()... );
+      v.Array( "marking" , MakeFieldArray( r.getMarking() , 12 ) , MakeFieldArray( others.getMarking() , 12 )... );
+      v.Field( "capabilities" , r.getCapabilities() , others.getCapabilities()... );
+      v.List( "variableParameters" , r.getVariableParameters() , others.getVariableParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FirePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const WarfareFamilyPdu&>( r ) , static_cast<const WarfareFamilyPdu&>( others )... );
+      v.Field( "munitionExpendibleID" , r.getMunitionExpendibleID() , others.getMunitionExpendibleID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "fireMissionIndex" , r.getFireMissionIndex() , others.getFireMissionIndex()... );
+      v.Field( "locationInWorldCoordinates" , r.getLocationInWorldCoordinates() , others.getLocationInWorldCoordinates()... );
+      v.Field( "descriptor" , r.getDescriptor() , others.getDescriptor()... );
+      v.Field( "velocity" , r.getVelocity() , others.getVelocity()... );
+      v.Field( "range" , r.getRange() , others.getRange()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FixedDatum& r, const Others&... others)
+   {
+      v.Field( "fixedDatumID" , r.getFixedDatumID() , others.getFixedDatumID()... );
+      v.Field( "fixedDatumValue" , r.getFixedDatumValue() , others.getFixedDatumValue()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FourByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 4 ) , MakeFieldArray( others.getOtherParameters() , 4 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const FundamentalOperationalData& r, const Others&... others)
+   {
+      v.Field( "systemStatus" , r.getSystemStatus() , others.getSystemStatus()... );
+      v.Field( "dataField1" , r.getDataField1() , others.getDataField1()... );
+      v.Field( "informationLayers" , r.getInformationLayers() , others.getInformationLayers()... );
+      v.Field( "dataField2" , r.getDataField2() , others.getDataField2()... );
+      v.Field( "parameter1" , r.getParameter1() , others.getParameter1()... );
+      v.Field( "parameter2" , r.getParameter2() , others.getParameter2()... );
+      v.Field( "parameter3" , r.getParameter3() , others.getParameter3()... );
+      v.Field( "parameter4" , r.getParameter4() , others.getParameter4()... );
+      v.Field( "parameter5" , r.getParameter5() , others.getParameter5()... );
+      v.Field( "parameter6" , r.getParameter6() , others.getParameter6()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GridAxis& r, const Others&... others)
+   {
+      v.Field( "domainInitialXi" , r.getDomainInitialXi() , others.getDomainInitialXi()... );
+      v.Field( "domainFinalXi" , r.getDomainFinalXi() , others.getDomainFinalXi()... );
+      v.Field( "domainPointsXi" , r.getDomainPointsXi() , others.getDomainPointsXi()... );
+      v.Field( "interleafFactor" , r.getInterleafFactor() , others.getInterleafFactor()... );
+      v.Field( "axisType" , r.getAxisType() , others.getAxisType()... );
+      v.Field( "numberOfPointsOnXiAxis" , r.getNumberOfPointsOnXiAxis() , others.getNumberOfPointsOnXiAxis()... );
+      v.Field( "initialIndex" , r.getInitialIndex() , others.getInitialIndex()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const GroupIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "groupNumber" , r.getGroupNumber() , others.getGroupNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IFFFundamentalParameterData& r, const Others&... others)
+   {
+      v.Field( "erp" , r.getErp() , others.getErp()... );
+      v.Field( "frequency" , r.getFrequency() , others.getFrequency()... );
+      v.Field( "pgrf" , r.getPgrf() , others.getPgrf()... );
+      v.Field( "pulseWidth" , r.getPulseWidth() , others.getPulseWidth()... );
+      v.Field( "burstLength" , r.getBurstLength() , others.getBurstLength()... );
+      v.Field( "applicableModes" , r.getApplicableModes() , others.getApplicableModes()... );
+      v.Array( "systemSpecificData" , MakeFieldArray( r.getSystemSpecificData() , 3 ) , MakeFieldArray( others.getSystemSpecificData() , 3 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IFFPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityID" , r.getEmittingEntityID() , others.getEmittingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "relativeAntennaLocation" , r.getRelativeAntennaLocation() , others.getRelativeAntennaLocation()... );
+      v.Field( "systemID" , r.getSystemID() , others.getSystemID()... );
+      v.Field( "systemDesignator" , r.getSystemDesignator() , others.getSystemDesignator()... );
+      v.Field( "systemSpecificData" , r.getSystemSpecificData() , others.getSystemSpecificData()... );
+      v.Field( "fundamentalOperationalData" , r.getFundamentalOperationalData() , others.getFundamentalOperationalData()... );
+      v.Field( "layerHeader" , r.getLayerHeader() , others.getLayerHeader()... );
+      v.Field( "beamData" , r.getBeamData() , others.getBeamData()... );
+      v.Field( "secondaryOperationalData" , r.getSecondaryOperationalData() , others.getSecondaryOperationalData()... );
+      v.Count( "numberOfIFFParameters" , "iffParameters" , static_cast<unsigned char>( r.getIFFParameters().size() ) , static_cast<unsigned char>( others.getIFFParameters().size() )... );
+      v.List( "iffParameters" , r.getIFFParameters() , others.getIFFParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IOCommunicationsNode& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "communcationsNodeType" , r.getCommuncationsNodeType() , others.getCommuncationsNodeType()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "communicationsNode" , r.getCommunicationsNode() , others.getCommunicationsNode()... );
+      v.Field( "elementID" , r.getElementID() , others.getElementID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IOEffect& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "ioStatus" , r.getIoStatus() , others.getIoStatus()... );
+      v.Field( "ioLinkType" , r.getIoLinkType() , others.getIoLinkType()... );
+      v.Field( "ioEffect" , r.getIoEffect() , others.getIoEffect()... );
+      v.Field( "ioEffectDutyCycle" , r.getIoEffectDutyCycle() , others.getIoEffectDutyCycle()... );
+      v.Field( "ioEffectDuration" , r.getIoEffectDuration() , others.getIoEffectDuration()... );
+      v.Field( "ioProcess" , r.getIoProcess() , others.getIoProcess()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IffDataSpecification& r, const Others&... others)
+   {
+      v.Field( "numberOfIffDataRecords" , r.getNumberOfIffDataRecords() , others.getNumberOfIffDataRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomCommunicationsParameters& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "recordSpecificField" , r.getRecordSpecificField() , others.getRecordSpecificField()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomIdentifier& r, const Others&... others)
+   {
+      v.Field( "siteNumber" , r.getSiteNumber() , others.getSiteNumber()... );
+      v.Field( "applicationNumber" , r.getApplicationNumber() , others.getApplicationNumber()... );
+      v.Field( "referenceNumber" , r.getReferenceNumber() , others.getReferenceNumber()... );
+      v.Field( "intercomNumber" , r.getIntercomNumber() , others.getIntercomNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IntercomSignalPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "communicationsDeviceID" , r.getCommunicationsDeviceID() , others.getCommunicationsDeviceID()... );
+      v.Field( "encodingScheme" , r.getEncodingScheme() , others.getEncodingScheme()... );
+      v.Field( "tdlType" , r.getTdlType() , others.getTdlType()... );
+      v.Field( "sampleRate" , r.getSampleRate() , others.getSampleRate()... );
+      v.Count( "dataLength" , "data" , static_cast<unsigned short>( r.getData().size() ) , static_cast<unsigned short>( others.getData().size() )... );
+      v.Field( "samples" , r.getSamples() , others.getSamples()... );
+      v.List( "data" , r.getData() , others.getData()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const IsPartOfPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const EntityManagementFamilyPdu&>( r ) , static_cast<const EntityManagementFamilyPdu&>( others )... );
+      v.Field( "orginatingEntityID" , r.getOrginatingEntityID() , others.getOrginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "relationship" , r.getRelationship() , others.getRelationship()... );
+      v.Field( "partLocation" , r.getPartLocation() , others.getPartLocation()... );
+      v.Field( "namedLocationID" , r.getNamedLocationID() , others.getNamedLocationID()... );
+      v.Field( "partEntityType" , r.getPartEntityType() , others.getPartEntityType()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const JammingTechnique& r, const Others&... others)
+   {
+      v.Field( "kind" , r.getKind() , others.getKind()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LaunchedMunitionRecord& r, const Others&... others)
+   {
+      v.Field( "fireEventID" , r.getFireEventID() , others.getFireEventID()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+      v.Field( "firingEntityID" , r.getFiringEntityID() , others.getFiringEntityID()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "targetEntityID" , r.getTargetEntityID() , others.getTargetEntityID()... );
+      v.Field( "padding3" , r.getPadding3() , others.getPadding3()... );
+      v.Field( "targetLocation" , r.getTargetLocation() , others.getTargetLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LayerHeader& r, const Others&... others)
+   {
+      v.Field( "layerNumber" , r.getLayerNumber() , others.getLayerNumber()... );
+      v.Field( "layerSpecificInformation" , r.getLayerSpecificInformation() , others.getLayerSpecificInformation()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LinearObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Count( "numberOfSegments" , "linearSegmentParameters" , static_cast<unsigned char>( r.getLinearSegmentParameters().size() ) , static_cast<unsigned char>( others.getLinearSegmentParameters().size() )... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.List( "linearSegmentParameters" , r.getLinearSegmentParameters() , others.getLinearSegmentParameters()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LinearSegmentParameter& r, const Others&... others)
+   {
+      v.Field( "segmentNumber" , r.getSegmentNumber() , others.getSegmentNumber()... );
+      v.Field( "segmentModification" , r.getSegmentModification() , others.getSegmentModification()... );
+      v.Field( "generalSegmentAppearance" , r.getGeneralSegmentAppearance() , others.getGeneralSegmentAppearance()... );
+      v.Field( "specificSegmentAppearance" , r.getSpecificSegmentAppearance() , others.getSpecificSegmentAppearance()... );
+      v.Field( "segmentLocation" , r.getSegmentLocation() , others.getSegmentLocation()... );
+      v.Field( "segmentOrientation" , r.getSegmentOrientation() , others.getSegmentOrientation()... );
+      v.Field( "segmentLength" , r.getSegmentLength() , others.getSegmentLength()... );
+      v.Field( "segmentWidth" , r.getSegmentWidth() , others.getSegmentWidth()... );
+      v.Field( "segmentHeight" , r.getSegmentHeight() , others.getSegmentHeight()... );
+      v.Field( "segmentDepth" , r.getSegmentDepth() , others.getSegmentDepth()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LiveEntityIdentifier& r, const Others&... others)
+   {
+      v.Field( "liveSimulationAddress" , r.getLiveSimulationAddress() , others.getLiveSimulationAddress()... );
+      v.Field( "entityNumber" , r.getEntityNumber() , others.getEntityNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LiveEntityPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const PduSuperclass&>( r ) , static_cast<const PduSuperclass&>( others )... );
+      v.Field( "subprotocolNumber" , r.getSubprotocolNumber() , others.getSubprotocolNumber()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LiveSimulationAddress& r, const Others&... others)
+   {
+      v.Field( "liveSiteNumber" , r.getLiveSiteNumber() , others.getLiveSiteNumber()... );
+      v.Field( "liveApplicationNumber" , r.getLiveApplicationNumber() , others.getLiveApplicationNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const LogisticsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MineEntityIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "mineEntityNumber" , r.getMineEntityNumber() , others.getMineEntityNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "minefieldNumber" , r.getMinefieldNumber() , others.getMinefieldNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldResponseNackPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Count( "numberOfMissingPdus" , "missingPduSequenceNumbers" , static_cast<unsigned char>( r.getMissingPduSequenceNumbers().size() ) , static_cast<unsigned char>( others.getMissingPduSequenceNumbers().size() )... );
+      v.List( "missingPduSequenceNumbers" , r.getMissingPduSequenceNumbers() , others.getMissingPduSequenceNumbers()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MinefieldStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const MinefieldFamilyPdu&>( r ) , static_cast<const MinefieldFamilyPdu&>( others )... );
+      v.Field( "minefieldID" , r.getMinefieldID() , others.getMinefieldID()... );
+      v.Field( "minefieldSequence" , r.getMinefieldSequence() , others.getMinefieldSequence()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Count( "numberOfPerimeterPoints" , "perimeterPoints" , static_cast<unsigned char>( r.getPerimeterPoints().size() ) , static_cast<unsigned char>( others.getPerimeterPoints().size() )... );
+      v.Field( "minefieldType" , r.getMinefieldType() , others.getMinefieldType()... );
+      v.Count( "numberOfMineTypes" , "mineType" , static_cast<unsigned short>( r.getMineType().size() ) , static_cast<unsigned short>( others.getMineType().size() )... );
+      v.Field( "minefieldLocation" , r.getMinefieldLocation() , others.getMinefieldLocation()... );
+      v.Field( "minefieldOrientation" , r.getMinefieldOrientation() , others.getMinefieldOrientation()... );
+      v.Field( "appearance" , r.getAppearance() , others.getAppearance()... );
+      v.Field( "protocolMode" , r.getProtocolMode() , others.getProtocolMode()... );
+      v.List( "perimeterPoints" , r.getPerimeterPoints() , others.getPerimeterPoints()... );
+      v.List( "mineType" , r.getMineType() , others.getMineType()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& /*v*/, const ModulationParameters& /*r*/, const Others&... /*others*/)
+   {
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ModulationType& r, const Others&... others)
+   {
+      v.Field( "spreadSpectrum" , r.getSpreadSpectrum() , others.getSpreadSpectrum()... );
+      v.Field( "majorModulation" , r.getMajorModulation() , others.getMajorModulation()... );
+      v.Field( "detail" , r.getDetail() , others.getDetail()... );
+      v.Field( "radioSystem" , r.getRadioSystem() , others.getRadioSystem()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Munition& r, const Others&... others)
+   {
+      v.Field( "munitionType" , r.getMunitionType() , others.getMunitionType()... );
+      v.Field( "station" , r.getStation() , others.getStation()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+      v.Field( "munitionStatus" , r.getMunitionStatus() , others.getMunitionStatus()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MunitionDescriptor& r, const Others&... others)
+   {
+      v.Field( "munitionType" , r.getMunitionType() , others.getMunitionType()... );
+      v.Field( "warhead" , r.getWarhead() , others.getWarhead()... );
+      v.Field( "fuse" , r.getFuse() , others.getFuse()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+      v.Field( "rate" , r.getRate() , others.getRate()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const MunitionReload& r, const Others&... others)
+   {
+      v.Field( "munitionType" , r.getMunitionType() , others.getMunitionType()... );
+      v.Field( "station" , r.getStation() , others.getStation()... );
+      v.Field( "standardQuantity" , r.getStandardQuantity() , others.getStandardQuantity()... );
+      v.Field( "maximumQuantity" , r.getMaximumQuantity() , others.getMaximumQuantity()... );
+      v.Field( "stationName" , r.getStationName() , others.getStationName()... );
+      v.Field( "stationNumber" , r.getStationNumber() , others.getStationNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const NamedLocationIdentification& r, const Others&... others)
+   {
+      v.Field( "stationName" , r.getStationName() , others.getStationName()... );
+      v.Field( "stationNumber" , r.getStationNumber() , others.getStationNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ObjectIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "objectNumber" , r.getObjectNumber() , others.getObjectNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ObjectType& r, const Others&... others)
+   {
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "objectKind" , r.getObjectKind() , others.getObjectKind()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const OneByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 1 ) , MakeFieldArray( others.getOtherParameters() , 1 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const OwnershipStatus& r, const Others&... others)
+   {
+      v.Field( "entityId" , r.getEntityId() , others.getEntityId()... );
+      v.Field( "ownershipStatus" , r.getOwnershipStatus() , others.getOwnershipStatus()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Pdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const PduSuperclass&>( r ) , static_cast<const PduSuperclass&>( others )... );
+      v.Field( "pduStatus" , r.getPduStatus() , others.getPduStatus()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PduContainer& r, const Others&... others)
+   {
+      v.Count( "numberOfPdus" , "pdus" , static_cast<int>( r.getPdus().size() ) , static_cast<int>( others.getPdus().size() )... );
+      v.List( "pdus" , r.getPdus() , others.getPdus()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PduHeader& r, const Others&... others)
+   {
+      v.Field( "protocolVersion" , r.getProtocolVersion() , others.getProtocolVersion()... );
+      v.Field( "exerciseID" , r.getExerciseID() , others.getExerciseID()... );
+      v.Field( "pduType" , r.getPduType() , others.getPduType()... );
+      v.Field( "protocolFamily" , r.getProtocolFamily() , others.getProtocolFamily()... );
+      v.Field( "timestamp" , r.getTimestamp() , others.getTimestamp()... );
+      v.Field( "pduLength" , r.getPduLength() , others.getPduLength()... );
+      v.Field( "pduStatus" , r.getPduStatus() , others.getPduStatus()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PduStatus& r, const Others&... others)
+   {
+      v.Field( "pduStatus" , r.getPduStatus() , others.getPduStatus()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PduSuperclass& r, const Others&... others)
+   {
+      v.Field( "protocolVersion" , r.getProtocolVersion() , others.getProtocolVersion()... );
+      v.Field( "exerciseID" , r.getExerciseID() , others.getExerciseID()... );
+      v.Field( "pduType" , r.getPduType() , others.getPduType()... );
+      v.Field( "protocolFamily" , r.getProtocolFamily() , others.getProtocolFamily()... );
+      v.Field( "timestamp" , r.getTimestamp() , others.getTimestamp()... );
+      v.Field( "length" , r.getLength() , others.getLength()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PointObjectStatePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SyntheticEnvironmentFamilyPdu&>( r ) , static_cast<const SyntheticEnvironmentFamilyPdu&>( others )... );
+      v.Field( "objectID" , r.getObjectID() , others.getObjectID()... );
+      v.Field( "referencedObjectID" , r.getReferencedObjectID() , others.getReferencedObjectID()... );
+      v.Field( "updateNumber" , r.getUpdateNumber() , others.getUpdateNumber()... );
+      v.Field( "forceID" , r.getForceID() , others.getForceID()... );
+      v.Field( "modifications" , r.getModifications() , others.getModifications()... );
+      v.Field( "objectType" , r.getObjectType() , others.getObjectType()... );
+      v.Field( "objectLocation" , r.getObjectLocation() , others.getObjectLocation()... );
+      v.Field( "objectOrientation" , r.getObjectOrientation() , others.getObjectOrientation()... );
+      v.Field( "objectAppearance" , r.getObjectAppearance() , others.getObjectAppearance()... );
+      v.Field( "requesterID" , r.getRequesterID() , others.getRequesterID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const PropulsionSystemData& r, const Others&... others)
+   {
+      v.Field( "powerSetting" , r.getPowerSetting() , others.getPowerSetting()... );
+      v.Field( "engineRpm" , r.getEngineRpm() , others.getEngineRpm()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RadioCommunicationsFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "entityId" , r.getEntityId() , others.getEntityId()... );
+      v.Field( "radioId" , r.getRadioId() , others.getRadioId()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RadioIdentifier& r, const Others&... others)
+   {
+      v.Field( "siteNumber" , r.getSiteNumber() , others.getSiteNumber()... );
+      v.Field( "applicationNumber" , r.getApplicationNumber() , others.getApplicationNumber()... );
+      v.Field( "referenceNumber" , r.getReferenceNumber() , others.getReferenceNumber()... );
+      v.Field( "radioNumber" , r.getRadioNumber() , others.getRadioNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RadioType& r, const Others&... others)
+   {
+      v.Field( "entityKind" , r.getEntityKind() , others.getEntityKind()... );
+      v.Field( "domain" , r.getDomain() , others.getDomain()... );
+      v.Field( "country" , r.getCountry() , others.getCountry()... );
+      v.Field( "category" , r.getCategory() , others.getCategory()... );
+      v.Field( "subcategory" , r.getSubcategory() , others.getSubcategory()... );
+      v.Field( "specific" , r.getSpecific() , others.getSpecific()... );
+      v.Field( "extra" , r.getExtra() , others.getExtra()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ReceiverPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const RadioCommunicationsFamilyPdu&>( r ) , static_cast<const RadioCommunicationsFamilyPdu&>( others )... );
+      v.Field( "receiverState" , r.getReceiverState() , others.getReceiverState()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "receivedPower" , r.getReceivedPower() , others.getReceivedPower()... );
+      v.Field( "transmitterEntityId" , r.getTransmitterEntityId() , others.getTransmitterEntityId()... );
+      v.Field( "transmitterRadioId" , r.getTransmitterRadioId() , others.getTransmitterRadioId()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordQueryReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "eventType" , r.getEventType() , others.getEventType()... );
+      v.Field( "time" , r.getTime() , others.getTime()... );
+      v.Count( "numberOfRecords" , "recordIDs" , static_cast<unsigned int>( r.getRecordIDs().size() ) , static_cast<unsigned int>( others.getRecordIDs().size() )... );
+      v.List( "recordIDs" , r.getRecordIDs() , others.getRecordIDs()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordQuerySpecification& r, const Others&... others)
+   {
+      v.Count( "numberOfRecords" , "records" , static_cast<unsigned int>( r.getRecords().size() ) , static_cast<unsigned int>( others.getRecords().size() )... );
+      v.List( "records" , r.getRecords() , others.getRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordSpecification& r, const Others&... others)
+   {
+      v.Count( "numberOfRecordSets" , "recordSets" , static_cast<unsigned int>( r.getRecordSets().size() ) , static_cast<unsigned int>( others.getRecordSets().size() )... );
+      v.List( "recordSets" , r.getRecordSets() , others.getRecordSets()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RecordSpecificationElement& r, const Others&... others)
+   {
+      v.Field( "recordID" , r.getRecordID() , others.getRecordID()... );
+      v.Field( "recordSetSerialNumber" , r.getRecordSetSerialNumber() , others.getRecordSetSerialNumber()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+      v.Field( "recordCount" , r.getRecordCount() , others.getRecordCount()... );
+      v.Field( "recordValues" , r.getRecordValues() , others.getRecordValues()... );
+      v.Field( "pad4" , r.getPad4() , others.getPad4()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Relationship& r, const Others&... others)
+   {
+      v.Field( "nature" , r.getNature() , others.getNature()... );
+      v.Field( "position" , r.getPosition() , others.getPosition()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RemoveEntityPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RemoveEntityReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RepairCompletePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "repairingEntityID" , r.getRepairingEntityID() , others.getRepairingEntityID()... );
+      v.Field( "repair" , r.getRepair() , others.getRepair()... );
+      v.Field( "padding4" , r.getPadding4() , others.getPadding4()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const RepairResponsePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "repairingEntityID" , r.getRepairingEntityID() , others.getRepairingEntityID()... );
+      v.Field( "repairResult" , r.getRepairResult() , others.getRepairResult()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ResupplyOfferPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "supplyingEntityID" , r.getSupplyingEntityID() , others.getSupplyingEntityID()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ResupplyReceivedPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+      v.Field( "supplyingEntityID" , r.getSupplyingEntityID() , others.getSupplyingEntityID()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SecondaryOperationalData& r, const Others&... others)
+   {
+      v.Field( "operationalData1" , r.getOperationalData1() , others.getOperationalData1()... );
+      v.Field( "operationalData2" , r.getOperationalData2() , others.getOperationalData2()... );
+      v.Field( "numberOfIFFFundamentalParameterRecords" , r.getNumberOfIFFFundamentalParameterRecords() , others.getNumberOfIFFFundamentalParameterRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SeesPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "orginatingEntityID" , r.getOrginatingEntityID() , others.getOrginatingEntityID()... );
+      v.Field( "infraredSignatureRepresentationIndex" , r.getInfraredSignatureRepresentationIndex() , others.getInfraredSignatureRepresentationIndex()... );
+      v.Field( "acousticSignatureRepresentationIndex" , r.getAcousticSignatureRepresentationIndex() , others.getAcousticSignatureRepresentationIndex()... );
+      v.Field( "radarCrossSectionSignatureRepresentationIndex" , r.getRadarCrossSectionSignatureRepresentationIndex() , others.getRadarCrossSectionSignatureRepresentationIndex()... );
+      v.Count( "numberOfPropulsionSystems" , "propulsionSystemData" , static_cast<unsigned short>( r.getPropulsionSystemData().size() ) , static_cast<unsigned short>( others.getPropulsionSystemData().size() )... );
+      v.Count( "numberOfVectoringNozzleSystems" , "vectoringSystemData" , static_cast<unsigned short>( r.getVectoringSystemData().size() ) , static_cast<unsigned short>( others.getVectoringSystemData().size() )... );
+      v.List( "propulsionSystemData" , r.getPropulsionSystemData() , others.getPropulsionSystemData()... );
+      v.List( "vectoringSystemData" , r.getVectoringSystemData() , others.getVectoringSystemData()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Sensor& r, const Others&... others)
+   {
+      v.Field( "sensorTypeSource" , r.getSensorTypeSource() , others.getSensorTypeSource()... );
+      v.Field( "sensorOnOffStatus" , r.getSensorOnOffStatus() , others.getSensorOnOffStatus()... );
+      v.Field( "sensorType" , r.getSensorType() , others.getSensorType()... );
+      v.Field( "station" , r.getStation() , others.getStation()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SeparationVP& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "reasonForSeparation" , r.getReasonForSeparation() , others.getReasonForSeparation()... );
+      v.Field( "preEntityIndicator" , r.getPreEntityIndicator() , others.getPreEntityIndicator()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "parentEntityID" , r.getParentEntityID() , others.getParentEntityID()... );
+      v.Field( "padding2" , r.getPadding2() , others.getPadding2()... );
+      v.Field( "stationLocation" , r.getStationLocation() , others.getStationLocation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const ServiceRequestPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const LogisticsFamilyPdu&>( r ) , static_cast<const LogisticsFamilyPdu&>( others )... );
+      v.Field( "requestingEntityID" , r.getRequestingEntityID() , others.getRequestingEntityID()... );
+      v.Field( "servicingEntityID" , r.getServicingEntityID() , others.getServicingEntityID()... );
+      v.Field( "serviceTypeRequested" , r.getServiceTypeRequested() , others.getServiceTypeRequested()... );
+      v.Count( "numberOfSupplyTypes" , "supplies" , static_cast<unsigned char>( r.getSupplies().size() ) , static_cast<unsigned char>( others.getSupplies().size() )... );
+      v.Field( "serviceRequestPadding" , r.getServiceRequestPadding() , others.getServiceRequestPadding()... );
+      v.List( "supplies" , r.getSupplies() , others.getSupplies()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SetDataPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatums" , static_cast<unsigned int>( r.getFixedDatums().size() ) , static_cast<unsigned int>( others.getFixedDatums().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() ) , static_cast<unsigned int>( others.getVariableDatums().size() )... );
+      v.List( "fixedDatums" , r.getFixedDatums() , others.getFixedDatums()... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SetDataReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+      v.Count( "numberOfFixedDatumRecords" , "fixedDatumRecords" , static_cast<unsigned int>( r.getFixedDatumRecords().size() ) , static_cast<unsigned int>( others.getFixedDatumRecords().size() )... );
+      v.Count( "numberOfVariableDatumRecords" , "variableDatumRecords" , static_cast<unsigned int>( r.getVariableDatumRecords().size() ) , static_cast<unsigned int>( others.getVariableDatumRecords().size() )... );
+      v.List( "fixedDatumRecords" , r.getFixedDatumRecords() , others.getFixedDatumRecords()... );
+      v.List( "variableDatumRecords" , r.getVariableDatumRecords() , others.getVariableDatumRecords()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationAddress& r, const Others&... others)
+   {
+      v.Field( "site" , r.getSite() , others.getSite()... );
+      v.Field( "application" , r.getApplication() , others.getApplication()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "referenceNumber" , r.getReferenceNumber() , others.getReferenceNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationManagementFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "originatingEntityID" , r.getOriginatingEntityID() , others.getOriginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationManagementPduHeader& r, const Others&... others)
+   {
+      v.Field( "pduHeader" , r.getPduHeader() , others.getPduHeader()... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "recevingID" , r.getRecevingID() , others.getRecevingID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SimulationManagementWithReliabilityFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "originatingEntityID" , r.getOriginatingEntityID() , others.getOriginatingEntityID()... );
+      v.Field( "receivingEntityID" , r.getReceivingEntityID() , others.getReceivingEntityID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StandardVariableSpecification& r, const Others&... others)
+   {
+      v.Count( "numberOfStandardVariableRecords" , "standardVariables" , static_cast<unsigned short>( r.getStandardVariables().size() ) , static_cast<unsigned short>( others.getStandardVariables().size() )... );
+      v.List( "standardVariables" , r.getStandardVariables() , others.getStandardVariables()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StartResumePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "simulationTime" , r.getSimulationTime() , others.getSimulationTime()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StartResumeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "simulationTime" , r.getSimulationTime() , others.getSimulationTime()... );
+      v.Field( "requiredReliabilityService" , r.getRequiredReliabilityService() , others.getRequiredReliabilityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "pad2" , r.getPad2() , others.getPad2()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StopFreezePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementFamilyPdu&>( r ) , static_cast<const SimulationManagementFamilyPdu&>( others )... );
+      v.Field( "originatingID" , r.getOriginatingID() , others.getOriginatingID()... );
+      v.Field( "receivingID" , r.getReceivingID() , others.getReceivingID()... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "reason" , r.getReason() , others.getReason()... );
+      v.Field( "frozenBehavior" , r.getFrozenBehavior() , others.getFrozenBehavior()... );
+      v.Field( "padding1" , r.getPadding1() , others.getPadding1()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StopFreezeReliablePdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( r ) , static_cast<const SimulationManagementWithReliabilityFamilyPdu&>( others )... );
+      v.Field( "realWorldTime" , r.getRealWorldTime() , others.getRealWorldTime()... );
+      v.Field( "reason" , r.getReason() , others.getReason()... );
+      v.Field( "frozenBehavior" , r.getFrozenBehavior() , others.getFrozenBehavior()... );
+      v.Field( "requiredReliablityService" , r.getRequiredReliablityService() , others.getRequiredReliablityService()... );
+      v.Field( "pad1" , r.getPad1() , others.getPad1()... );
+      v.Field( "requestID" , r.getRequestID() , others.getRequestID()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StorageFuel& r, const Others&... others)
+   {
+      v.Field( "fuelQuantity" , r.getFuelQuantity() , others.getFuelQuantity()... );
+      v.Field( "fuelMeasurementUnits" , r.getFuelMeasurementUnits() , others.getFuelMeasurementUnits()... );
+      v.Field( "fuelType" , r.getFuelType() , others.getFuelType()... );
+      v.Field( "fuelLocation" , r.getFuelLocation() , others.getFuelLocation()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const StorageFuelReload& r, const Others&... others)
+   {
+      v.Field( "standardQuantity" , r.getStandardQuantity() , others.getStandardQuantity()... );
+      v.Field( "maximumQuantity" , r.getMaximumQuantity() , others.getMaximumQuantity()... );
+      v.Field( "standardQuantityReloadTime" , r.getStandardQuantityReloadTime() , others.getStandardQuantityReloadTime()... );
+      v.Field( "maximumQuantityReloadTime" , r.getMaximumQuantityReloadTime() , others.getMaximumQuantityReloadTime()... );
+      v.Field( "fuelMeasurementUnits" , r.getFuelMeasurementUnits() , others.getFuelMeasurementUnits()... );
+      v.Field( "fuelType" , r.getFuelType() , others.getFuelType()... );
+      v.Field( "fuelLocation" , r.getFuelLocation() , others.getFuelLocation()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SupplyQuantity& r, const Others&... others)
+   {
+      v.Field( "supplyType" , r.getSupplyType() , others.getSupplyType()... );
+      v.Field( "quantity" , r.getQuantity() , others.getQuantity()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SyntheticEnvironmentFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const SystemIdentifier& r, const Others&... others)
+   {
+      v.Field( "systemType" , r.getSystemType() , others.getSystemType()... );
+      v.Field( "systemName" , r.getSystemName() , others.getSystemName()... );
+      v.Field( "systemMode" , r.getSystemMode() , others.getSystemMode()... );
+      v.Field( "changeOptions" , r.getChangeOptions() , others.getChangeOptions()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TotalRecordSets& r, const Others&... others)
+   {
+      v.Field( "totalRecordSets" , r.getTotalRecordSets() , others.getTotalRecordSets()... );
+      v.Field( "padding" , r.getPadding() , others.getPadding()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TrackJamData& r, const Others&... others)
+   {
+      v.Field( "entityID" , r.getEntityID() , others.getEntityID()... );
+      v.Field( "emitterNumber" , r.getEmitterNumber() , others.getEmitterNumber()... );
+      v.Field( "beamNumber" , r.getBeamNumber() , others.getBeamNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const TwoByteChunk& r, const Others&... others)
+   {
+      v.Array( "otherParameters" , MakeFieldArray( r.getOtherParameters() , 2 ) , MakeFieldArray( others.getOtherParameters() , 2 )... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const UAFundamentalParameter& r, const Others&... others)
+   {
+      v.Field( "activeEmissionParameterIndex" , r.getActiveEmissionParameterIndex() , others.getActiveEmissionParameterIndex()... );
+      v.Field( "scanPattern" , r.getScanPattern() , others.getScanPattern()... );
+      v.Field( "beamCenterAzimuthHorizontal" , r.getBeamCenterAzimuthHorizontal() , others.getBeamCenterAzimuthHorizontal()... );
+      v.Field( "azimuthalBeamwidthHorizontal" , r.getAzimuthalBeamwidthHorizontal() , others.getAzimuthalBeamwidthHorizontal()... );
+      v.Field( "beamCenterDepressionElevation" , r.getBeamCenterDepressionElevation() , others.getBeamCenterDepressionElevation()... );
+      v.Field( "beamwidthDownElevation" , r.getBeamwidthDownElevation() , others.getBeamwidthDownElevation()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const UaPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const DistributedEmissionsFamilyPdu&>( r ) , static_cast<const DistributedEmissionsFamilyPdu&>( others )... );
+      v.Field( "emittingEntityID" , r.getEmittingEntityID() , others.getEmittingEntityID()... );
+      v.Field( "eventID" , r.getEventID() , others.getEventID()... );
+      v.Field( "stateChangeIndicator" , r.getStateChangeIndicator() , others.getStateChangeIndicator()... );
+      v.Field( "pad" , r.getPad() , others.getPad()... );
+      v.Field( "passiveParameterIndex" , r.getPassiveParameterIndex() , others.getPassiveParameterIndex()... );
+      v.Field( "propulsionPlantConfiguration" , r.getPropulsionPlantConfiguration() , others.getPropulsionPlantConfiguration()... );
+      v.Count( "numberOfShafts" , "shaftRPMs" , static_cast<unsigned char>( r.getShaftRPMs().size() ) , static_cast<unsigned char>( others.getShaftRPMs().size() )... );
+      v.Count( "numberOfAPAs" , "apaData" , static_cast<unsigned char>( r.getApaData().size() ) , static_cast<unsigned char>( others.getApaData().size() )... );
+      v.Count( "numberOfUAEmitterSystems" , "emitterSystems" , static_cast<unsigned char>( r.getEmitterSystems().size() ) , static_cast<unsigned char>( others.getEmitterSystems().size() )... );
+      v.List( "shaftRPMs" , r.getShaftRPMs() , others.getShaftRPMs()... );
+      v.List( "apaData" , r.getApaData() , others.getApaData()... );
+      v.List( "emitterSystems" , r.getEmitterSystems() , others.getEmitterSystems()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const UnattachedIdentifier& r, const Others&... others)
+   {
+      v.Field( "simulationAddress" , r.getSimulationAddress() , others.getSimulationAddress()... );
+      v.Field( "referenceNumber" , r.getReferenceNumber() , others.getReferenceNumber()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const UnsignedDISInteger& r, const Others&... others)
+   {
+      v.Field( "val" , r.getVal() , others.getVal()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VariableDatum& r, const Others&... others)
+   {
+      v.Field( "variableDatumID" , r.getVariableDatumID() , others.getVariableDatumID()... );
+      v.Count( "variableDatumLength" , "variableDatums" , static_cast<unsigned int>( r.getVariableDatums().size() * 64 ) , static_cast<unsigned int>( others.getVariableDatums().size() * 64 )... );
+      v.List( "variableDatums" , r.getVariableDatums() , others.getVariableDatums()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VariableParameter& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "variableParameterFields1" , r.getVariableParameterFields1() , others.getVariableParameterFields1()... );
+      v.Field( "variableParameterFields2" , r.getVariableParameterFields2() , others.getVariableParameterFields2()... );
+      v.Field( "variableParameterFields3" , r.getVariableParameterFields3() , others.getVariableParameterFields3()... );
+      v.Field( "variableParameterFields4" , r.getVariableParameterFields4() , others.getVariableParameterFields4()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VariableTransmitterParameters& r, const Others&... others)
+   {
+      v.Field( "recordType" , r.getRecordType() , others.getRecordType()... );
+      v.Field( "recordLength" , r.getRecordLength() , others.getRecordLength()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Vector2Float& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Vector3Double& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const Vector3Float& r, const Others&... others)
+   {
+      v.Field( "x" , r.getX() , others.getX()... );
+      v.Field( "y" , r.getY() , others.getY()... );
+      v.Field( "z" , r.getZ() , others.getZ()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const VectoringNozzleSystem& r, const Others&... others)
+   {
+      v.Field( "horizontalDeflectionAngle" , r.getHorizontalDeflectionAngle() , others.getHorizontalDeflectionAngle()... );
+      v.Field( "verticalDeflectionAngle" , r.getVerticalDeflectionAngle() , others.getVerticalDeflectionAngle()... );
+   }
+
+   template<typename Visitor, typename... Others>
+   void VisitFields(Visitor& v, const WarfareFamilyPdu& r, const Others&... others)
+   {
+      VisitFields( v , static_cast<const Pdu&>( r ) , static_cast<const Pdu&>( others )... );
+      v.Field( "firingEntityID" , r.getFiringEntityID() , others.getFiringEntityID()... );
+      v.Field( "targetEntityID" , r.getTargetEntityID() , others.getTargetEntityID()... );
+   }
+}
+
+#endif  // _dcl_dis7_fields_h_
@@ -0,0 +1,122 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis7_pdu_registry_h_
+#define _dcl_dis7_pdu_registry_h_
+
+#include <utils/PduTypeList.h>        // for PduTypeList
+#include <utils/PDUType.h>            // for enum
+#include <dis7/AcknowledgePdu.h>
+#include <dis7/AcknowledgeReliablePdu.h>
+#include <dis7/ActionRequestPdu.h>
+#include <dis7/ActionRequestReliablePdu.h>
+#include <dis7/ActionResponsePdu.h>
+#include <dis7/ActionResponseReliablePdu.h>
+#include <dis7/ArealObjectStatePdu.h>
+#include <dis7/CollisionElasticPdu.h>
+#include <dis7/CollisionPdu.h>
+#include <dis7/CommentPdu.h>
+#include <dis7/CommentReliablePdu.h>
+#include <dis7/CreateEntityPdu.h>
+#include <dis7/CreateEntityReliablePdu.h>
+#include <dis7/DataPdu.h>
+#include <dis7/DataQueryPdu.h>
+#include <dis7/DataQueryReliablePdu.h>
+#include <dis7/DataReliablePdu.h>
+#include <dis7/DesignatorPdu.h>
+#include <dis7/DetonationPdu.h>
+#include <dis7/DirectedEnergyFirePdu.h>
+#include <dis7/ElectromagneticEmissionsPdu.h>
+#include <dis7/EntityDamageStatusPdu.h>
+#include <dis7/EntityStatePdu.h>
+#include <dis7/EntityStateUpdatePdu.h>
+#include <dis7/EventReportPdu.h>
+#include <dis7/EventReportReliablePdu.h>
+#include <dis7/FirePdu.h>
+#include <dis7/IFFPdu.h>
+#include <dis7/IntercomSignalPdu.h>
+#include <dis7/IsPartOfPdu.h>
+#include <dis7/LinearObjectStatePdu.h>
+#include <dis7/MinefieldResponseNackPdu.h>
+#include <dis7/MinefieldStatePdu.h>
+#include <dis7/PointObjectStatePdu.h>
+#include <dis7/ReceiverPdu.h>
+#include <dis7/RecordQueryReliablePdu.h>
+#include <dis7/RemoveEntityPdu.h>
+#include <dis7/RemoveEntityReliablePdu.h>
+#include <dis7/RepairCompletePdu.h>
+#include <dis7/RepairResponsePdu.h>
+#include <dis7/ResupplyOfferPdu.h>
+#include <dis7/ResupplyReceivedPdu.h>
+#include <dis7/SeesPdu.h>
+#include <dis7/ServiceRequestPdu.h>
+#include <dis7/SetDataPdu.h>
+#include <dis7/SetDataReliablePdu.h>
+#include <dis7/StartResumePdu.h>
+#include <dis7/StartResumeReliablePdu.h>
+#include <dis7/StopFreezePdu.h>
+#include <dis7/StopFreezeReliablePdu.h>
+#include <dis7/UaPdu.h>
+
+namespace DIS
+{
+   /// every DIS 7 PDU class, by the value of the PDU type field it marshals.  the banks, factories
+   /// and dispatch tables of the library are generated from this list, see utils/PduTypeList.h.
+   /// the types without a name in PDUType are written as numbers.  FastEntityStatePdu has the type of
+   /// EntityStatePdu, which is the class registered for it.
+   typedef PduTypeList<
+      PduRegistryEntry< PDU_ENTITY_STATE                 , EntityStatePdu              >,
+      PduRegistryEntry< PDU_FIRE                         , FirePdu                     >,
+      PduRegistryEntry< PDU_DETONATION                   , DetonationPdu               >,
+      PduRegistryEntry< PDU_COLLISION                    , CollisionPdu                >,
+      PduRegistryEntry< PDU_SERVICE_REQUEST              , ServiceRequestPdu           >,
+      PduRegistryEntry< PDU_RESUPPLY_OFFER               , ResupplyOfferPdu            >,
+      PduRegistryEntry< PDU_RESUPPLY_RECEIVED            , ResupplyReceivedPdu         >,
+      PduRegistryEntry< PDU_REPAIR_COMPLETE              , RepairCompletePdu           >,
+      PduRegistryEntry< PDU_REPAIR_RESPONSE              , RepairResponsePdu           >,
+      PduRegistryEntry< PDU_CREATE_ENTITY                , CreateEntityPdu             >,
+      PduRegistryEntry< PDU_REMOVE_ENTITY                , RemoveEntityPdu             >,
+      PduRegistryEntry< PDU_START_RESUME                 , StartResumePdu              >,
+      PduRegistryEntry< PDU_STOP_FREEZE                  , StopFreezePdu               >,
+      PduRegistryEntry< PDU_ACKNOWLEDGE                  , AcknowledgePdu              >,
+      PduRegistryEntry< PDU_ACTION_REQUEST               , ActionRequestPdu            >,
+      PduRegistryEntry< PDU_ACTION_RESPONSE              , ActionResponsePdu           >,
+      PduRegistryEntry< PDU_DATA_QUERY                   , DataQueryPdu                >,
+      PduRegistryEntry< PDU_SET_DATA                     , SetDataPdu                  >,
+      PduRegistryEntry< PDU_DATA                         , DataPdu                     >,
+      PduRegistryEntry< PDU_EVENT_REPORT                 , EventReportPdu              >,
+      PduRegistryEntry< PDU_COMMENT                      , CommentPdu                  >,
+      PduRegistryEntry< PDU_ELECTRONIC_EMMISIONS         , ElectromagneticEmissionsPdu >,
+      PduRegistryEntry< PDU_DESIGNATOR                   , DesignatorPdu               >,
+      PduRegistryEntry< PDU_RECEIVER                     , ReceiverPdu                 >,
+      PduRegistryEntry< PDU_IFF                          , IFFPdu                      >,
+      PduRegistryEntry< PDU_UNDERWATER_ACOUSTIC          , UaPdu                       >,
+      PduRegistryEntry< PDU_SUPPLEMENTAL_EMISSION_ENTITY , SeesPdu                     >,
+      PduRegistryEntry< PDU_INTERCOM_SIGNAL              , IntercomSignalPdu           >,
+      PduRegistryEntry< PDU_ISPARTOF                     , IsPartOfPdu                 >,
+      PduRegistryEntry< PDU_MINEFIELD_STATE              , MinefieldStatePdu           >,
+      PduRegistryEntry< PDU_MINEFIELD_RESPONSE_NACK      , MinefieldResponseNackPdu    >,
+      PduRegistryEntry< PDU_POINT_OBJECT_STATE           , PointObjectStatePdu         >,
+      PduRegistryEntry< PDU_LINEAR_OBJECT_STATE          , LinearObjectStatePdu        >,
+      PduRegistryEntry< PDU_AREAL_OBJECT_STATE           , ArealObjectStatePdu         >,
+      PduRegistryEntry< 51                               , CreateEntityReliablePdu     >,
+      PduRegistryEntry< 52                               , RemoveEntityReliablePdu     >,
+      PduRegistryEntry< 53                               , StartResumeReliablePdu      >,
+      PduRegistryEntry< 54                               , StopFreezeReliablePdu       >,
+      PduRegistryEntry< 55                               , AcknowledgeReliablePdu      >,
+      PduRegistryEntry< 56                               , ActionRequestReliablePdu    >,
+      PduRegistryEntry< 57                               , ActionResponseReliablePdu   >,
+      PduRegistryEntry< 58                               , DataQueryReliablePdu        >,
+      PduRegistryEntry< 59                               , SetDataReliablePdu          >,
+      PduRegistryEntry< 60                               , DataReliablePdu             >,
+      PduRegistryEntry< 61                               , EventReportReliablePdu      >,
+      PduRegistryEntry< 62                               , CommentReliablePdu          >,
+      PduRegistryEntry< 63                               , RecordQueryReliablePdu      >,
+      PduRegistryEntry< 66                               , CollisionElasticPdu         >,
+      PduRegistryEntry< 67                               , EntityStateUpdatePdu        >,
+      PduRegistryEntry< 68                               , DirectedEnergyFirePdu       >,
+      PduRegistryEntry< 69                               , EntityDamageStatusPdu       >
+   > PduRegistry;
+}
+
+#endif  // _dcl_dis7_pdu_registry_h_
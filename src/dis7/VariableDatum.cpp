@@ -55,6 +55,16 @@ void VariableDatum::setPadding(unsigned int pX)
     _padding = pX;
 }
 
+std::vector<EightByteChunk>& VariableDatum::getVariableDatums() 
+{
+    return _variableDatums;
+}
+
+const std::vector<EightByteChunk>& VariableDatum::getVariableDatums() const
+{
+    return _variableDatums;
+}
+
 void VariableDatum::marshal(DataStream& dataStream) const
 {
     dataStream << _variableDatumID;
@@ -102,8 +112,13 @@ int VariableDatum::getMarshalledSize() const
 
    marshalSize = marshalSize + 4;  // _variableDatumID
    marshalSize = marshalSize + 4;  // _variableDatumLength
-   marshalSize = marshalSize + 4;  // _variableDatumBits
-   marshalSize = marshalSize + 4;  // _padding
+
+   for(unsigned long long idx=0; idx < _variableDatums.size(); idx++)
+   {
+        EightByteChunk listElement = _variableDatums[idx];
+        marshalSize = marshalSize + listElement.getMarshalledSize();
+    }
+
     return marshalSize;
 }
 
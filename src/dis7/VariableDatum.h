@@ -52,6 +52,9 @@ protected:
     unsigned int getPadding() const; 
     void setPadding(unsigned int pX); 
 
+    std::vector<EightByteChunk>& getVariableDatums(); 
+    const std::vector<EightByteChunk>& getVariableDatums() const; 
+
 
 virtual int getMarshalledSize() const;
 
@@ -0,0 +1,393 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_any_pdu_h_
+#define _dcl_dis_any_pdu_h_
+
+#include <utils/PduTypeList.h>        // for PduJumpTable
+#include <utils/DataStream.h>         // for parameter
+
+#include <cstddef>                  // for size_t definition
+#include <exception>                // for std::exception
+#include <new>                      // for placement new
+#include <type_traits>              // for std::aligned_storage
+#include <utility>                  // for std::move
+
+namespace DIS
+{
+   /// the size and alignment of the largest class of a list.
+   template<typename List>
+   struct PduStorageOf;
+
+   template<>
+   struct PduStorageOf< PduTypeList<> >
+   {
+      static const size_t SIZE = 1;
+      static const size_t ALIGN = 1;
+   };
+
+   template<typename Entry, typename... Rest>
+   struct PduStorageOf< PduTypeList<Entry, Rest...> >
+   {
+      typedef typename Entry::PduClass PduClass;
+      typedef PduStorageOf< PduTypeList<Rest...> > Others;
+
+      static const size_t SIZE = sizeof(PduClass) > Others::SIZE ? sizeof(PduClass) : Others::SIZE;
+      static const size_t ALIGN = alignof(PduClass) > Others::ALIGN ? alignof(PduClass) : Others::ALIGN;
+   };
+
+   /// a value holding one PDU of any class of the list, or nothing.
+   /// the PDU is constructed inside the value rather than on the heap, so that PDUs can be
+   /// copied into an SpscRing or a std::vector and handed between threads without new, delete,
+   /// or a question of who owns a Pdu pointer.  the lists inside a PDU, such as the articulation
+   /// parameters, are still std::vector members and allocate as they do in any other PDU.
+   ///
+   /// the class is found from the PDU type with the jump tables of the list, and is then used
+   /// directly, so that neither Visit() nor the copies make virtual calls:
+   ///
+   ///    struct Handler
+   ///    {
+   ///       void operator()(const EntityStatePdu& pdu);
+   ///       template<typename T> void operator()(const T& pdu);
+   ///    };
+   ///
+   ///    AnyPdu any;
+   ///    if( any.Decode( buf , length , BIG ) )
+   ///    {
+   ///       any.Visit( handler );
+   ///    }
+   ///
+   /// dis6/AnyPdu.h and dis7/AnyPdu.h define AnyPdu for the classes of each library.
+   template<typename List, typename Base>
+   class BasicAnyPdu
+   {
+   public:
+      BasicAnyPdu()
+         : _storage()
+         , _type(NO_PDU)
+      {
+      }
+
+      BasicAnyPdu(const BasicAnyPdu& other)
+         : _storage()
+         , _type(NO_PDU)
+      {
+         CopyFrom( other );
+      }
+
+      /// the other value is left empty.
+      BasicAnyPdu(BasicAnyPdu&& other)
+         : _storage()
+         , _type(NO_PDU)
+      {
+         MoveFrom( other );
+      }
+
+      /// hold a copy of the PDU.
+      template<typename T>
+      explicit BasicAnyPdu(const T& pdu)
+         : _storage()
+         , _type(NO_PDU)
+      {
+         Set( pdu );
+      }
+
+      ~BasicAnyPdu()
+      {
+         Reset();
+      }
+
+      BasicAnyPdu& operator=(const BasicAnyPdu& other)
+      {
+         if( this != &other )
+         {
+            Reset();
+            CopyFrom( other );
+         }
+         return *this;
+      }
+
+      /// the other value is left empty.
+      BasicAnyPdu& operator=(BasicAnyPdu&& other)
+      {
+         if( this != &other )
+         {
+            Reset();
+            MoveFrom( other );
+         }
+         return *this;
+      }
+
+      /// replace the held PDU with a default constructed PDU of the class.
+      template<typename T>
+      T& Emplace()
+      {
+         static_assert( PduTypeOf<List, T>::FOUND , "the class is not in the PDU type list" );
+         Reset();
+         T* pdu = new (&_storage) T();
+         _type = PduTypeOf<List, T>::value;
+         return *pdu;
+      }
+
+      /// replace the held PDU with a copy of the PDU.
+      template<typename T>
+      T& Set(const T& pdu)
+      {
+         static_assert( PduTypeOf<List, T>::FOUND , "the class is not in the PDU type list" );
+         Reset();
+         T* copy = new (&_storage) T( pdu );
+         _type = PduTypeOf<List, T>::value;
+         return *copy;
+      }
+
+      /// replace the held PDU with a default constructed PDU of the class registered for the type.
+      /// @return 'false' when no class is registered for the type, leaving the value empty.
+      bool Create(unsigned char type)
+      {
+         Reset();
+         typename Construct::Function construct = PduJumpTable<List, Construct>::Get( type );
+         if( construct == NULL )
+         {
+            return false;
+         }
+         construct( &_storage );
+         _type = type;
+         return true;
+      }
+
+      /// replace the held PDU with the PDU unmarshalled from the read position of the stream.
+      /// @return 'false' when the type is unknown or the stream is too short, leaving the value empty.
+      bool Decode(DataStream& ds)
+      {
+         if( ds.size() - ds.GetReadPos() < HEADER_SIZE ||
+             !Create( static_cast<unsigned char>( ds[TYPE_POSITION] ) ) )
+         {
+            Reset();
+            return false;
+         }
+
+         try
+         {
+            PduJumpTable<List, Unmarshal>::Get( static_cast<unsigned char>( _type ) )( &_storage , ds );
+         }
+         catch( const std::exception& )
+         {
+            // the stream throws when a field is read past the end of the buffer.
+            Reset();
+            return false;
+         }
+         return true;
+      }
+
+      /// replace the held PDU with the PDU marshalled in the buffer.
+      bool Decode(const char* buf, unsigned int length, Endian e)
+      {
+         DataStream ds( buf , length , e );
+         return Decode( ds );
+      }
+
+      /// destroy the held PDU.
+      void Reset()
+      {
+         if( _type != NO_PDU )
+         {
+            PduJumpTable<List, Destroy>::Get( static_cast<unsigned char>( _type ) )( &_storage );
+            _type = NO_PDU;
+         }
+      }
+
+      bool IsEmpty() const
+      {
+         return( _type == NO_PDU );
+      }
+
+      /// @return the type of the held PDU, which is only meaningful when the value is not empty.
+      unsigned char GetPduType() const
+      {
+         return static_cast<unsigned char>( _type );
+      }
+
+      /// @return the held PDU, NULL when the value holds a PDU of another class or is empty.
+      template<typename T>
+      T* Get()
+      {
+         return Holds<T>() ? reinterpret_cast<T*>( &_storage ) : NULL;
+      }
+
+      template<typename T>
+      const T* Get() const
+      {
+         return Holds<T>() ? reinterpret_cast<const T*>( &_storage ) : NULL;
+      }
+
+      /// @return the held PDU through its base class, NULL when the value is empty.
+      Base* GetPdu()
+      {
+         return IsEmpty() ? NULL : PduJumpTable<List, ToBase>::Get( static_cast<unsigned char>( _type ) )( &_storage );
+      }
+
+      const Base* GetPdu() const
+      {
+         return const_cast<BasicAnyPdu*>( this )->GetPdu();
+      }
+
+      /// call the visitor with the held PDU, as its own class.
+      /// @return 'false' when the value is empty.
+      template<typename Visitor>
+      bool Visit(Visitor& visitor)
+      {
+         if( IsEmpty() )
+         {
+            return false;
+         }
+         PduJumpTable< List , VisitWith<Visitor> >::Get( static_cast<unsigned char>( _type ) )( &_storage , visitor );
+         return true;
+      }
+
+      template<typename Visitor>
+      bool Visit(Visitor& visitor) const
+      {
+         if( IsEmpty() )
+         {
+            return false;
+         }
+         PduJumpTable< List , VisitConstWith<Visitor> >::Get( static_cast<unsigned char>( _type ) )( &_storage , visitor );
+         return true;
+      }
+
+      /// the number of bytes held inline, that of the largest class of the list.
+      static const size_t STORAGE_SIZE = PduStorageOf<List>::SIZE;
+
+   private:
+      /// the type of an empty value, outside of the range of the PDU type field.
+      static const unsigned int NO_PDU = PDU_TYPE_TABLE_SIZE;
+
+      /// the size of the PDU header and the position of its type field.
+      /// they are not taken from utils/PduHeader.h, whose PduHeader clashes with that of dis7.
+      static const size_t HEADER_SIZE = 12;
+      static const unsigned int TYPE_POSITION = 2;
+
+      template<typename T>
+      bool Holds() const
+      {
+         static_assert( PduTypeOf<List, T>::FOUND , "the class is not in the PDU type list" );
+         return( _type == PduTypeOf<List, T>::value );
+      }
+
+      void CopyFrom(const BasicAnyPdu& other)
+      {
+         if( !other.IsEmpty() )
+         {
+            PduJumpTable<List, Copy>::Get( static_cast<unsigned char>( other._type ) )( &_storage , &other._storage );
+            _type = other._type;
+         }
+      }
+
+      void MoveFrom(BasicAnyPdu& other)
+      {
+         if( !other.IsEmpty() )
+         {
+            PduJumpTable<List, Move>::Get( static_cast<unsigned char>( other._type ) )( &_storage , &other._storage );
+            _type = other._type;
+            other.Reset();
+         }
+      }
+
+      /// the operations of the jump tables.  the calls are qualified with the class,
+      /// so that they are bound at compile time rather than through the virtual table.
+      struct Construct
+      {
+         typedef void (*Function)(void* storage);
+
+         template<typename T>
+         static void Call(void* storage)
+         {
+            new (storage) T();
+         }
+      };
+
+      struct Copy
+      {
+         typedef void (*Function)(void* storage, const void* other);
+
+         template<typename T>
+         static void Call(void* storage, const void* other)
+         {
+            new (storage) T( *static_cast<const T*>( other ) );
+         }
+      };
+
+      struct Move
+      {
+         typedef void (*Function)(void* storage, void* other);
+
+         template<typename T>
+         static void Call(void* storage, void* other)
+         {
+            new (storage) T( std::move( *static_cast<T*>( other ) ) );
+         }
+      };
+
+      struct Destroy
+      {
+         typedef void (*Function)(void* storage);
+
+         template<typename T>
+         static void Call(void* storage)
+         {
+            static_cast<T*>( storage )->T::~T();
+         }
+      };
+
+      struct Unmarshal
+      {
+         typedef void (*Function)(void* storage, DataStream& ds);
+
+         template<typename T>
+         static void Call(void* storage, DataStream& ds)
+         {
+            static_cast<T*>( storage )->T::unmarshal( ds );
+         }
+      };
+
+      struct ToBase
+      {
+         typedef Base* (*Function)(void* storage);
+
+         template<typename T>
+         static Base* Call(void* storage)
+         {
+            return static_cast<T*>( storage );
+         }
+      };
+
+      template<typename Visitor>
+      struct VisitWith
+      {
+         typedef void (*Function)(void* storage, Visitor& visitor);
+
+         template<typename T>
+         static void Call(void* storage, Visitor& visitor)
+         {
+            visitor( *static_cast<T*>( storage ) );
+         }
+      };
+
+      template<typename Visitor>
+      struct VisitConstWith
+      {
+         typedef void (*Function)(const void* storage, Visitor& visitor);
+
+         template<typename T>
+         static void Call(const void* storage, Visitor& visitor)
+         {
+            visitor( *static_cast<const T*>( storage ) );
+         }
+      };
+
+      typename std::aligned_storage< PduStorageOf<List>::SIZE , PduStorageOf<List>::ALIGN >::type _storage;
+      unsigned int _type;
+   };
+}
+
+#endif  // _dcl_dis_any_pdu_h_
@@ -0,0 +1,54 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_cache_aligned_h_
+#define _dcl_dis_cache_aligned_h_
+
+#include <cstddef>                  // for size_t definition
+#include <cstdlib>                  // for posix_memalign
+#include <new>                      // for std::bad_alloc
+
+#if defined(_WIN32)
+#include <malloc.h>                 // for _aligned_malloc
+#endif
+
+namespace DIS
+{
+   /// the assumed size of a cache line, used to keep data written by different threads apart.
+   const size_t CACHE_LINE_SIZE = 64;
+
+   /// a base class whose objects are allocated on cache line boundaries.
+   /// before C++17, new only aligns for the fundamental types, so the members of a class
+   /// declared alignas(CACHE_LINE_SIZE) would be misaligned in an object made with new.
+   struct CacheAligned
+   {
+      static void* operator new(size_t size)
+      {
+         void* memory = NULL;
+#if defined(_WIN32)
+         memory = _aligned_malloc( size , CACHE_LINE_SIZE );
+#else
+         if( posix_memalign( &memory , CACHE_LINE_SIZE , size ) != 0 )
+         {
+            memory = NULL;
+         }
+#endif
+         if( memory == NULL )
+         {
+            throw std::bad_alloc();
+         }
+         return memory;
+      }
+
+      static void operator delete(void* memory)
+      {
+#if defined(_WIN32)
+         _aligned_free( memory );
+#else
+         free( memory );
+#endif
+      }
+   };
+}
+
+#endif  // _dcl_dis_cache_aligned_h_
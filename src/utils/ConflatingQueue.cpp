@@ -0,0 +1,266 @@
+#include <utils/ConflatingQueue.h>
+#include <utils/PduHeader.h>
+#include <utils/PDUType.h>
+
+#include <cstring>
+#include <thread>
+
+using namespace DIS;
+
+ConflatingQueueSettings::ConflatingQueueSettings()
+   : maxEntities(4096)
+   , eventCapacity(1024)
+   , slotSize(1500)
+{
+}
+
+ConflatingQueue::EntitySlot::EntitySlot()
+   : sequence(0)
+   , queued(false)
+   , context()
+   , endian(BIG)
+   , length(0)
+   , data()
+   , consumed(0)
+{
+}
+
+namespace
+{
+   /// a slot holding a buffer of 'size' bytes.
+   template<typename SlotT>
+   SlotT MakeSlot(unsigned int size)
+   {
+      SlotT slot;
+      slot.endian = BIG;
+      slot.length = 0;
+      slot.data.resize( size );
+      return slot;
+   }
+
+   /// the smallest power of 2 holding twice the entries, to keep the probe sequences short.
+   size_t TableSize(unsigned int entries)
+   {
+      size_t size = 2;
+      while( size < 2 * static_cast<size_t>( entries ) )
+      {
+         size <<= 1;
+      }
+      return size;
+   }
+}
+
+ConflatingQueue::ConflatingQueue(const ConflatingQueueSettings& settings)
+   : _settings(settings)
+   , _events(settings.eventCapacity, MakeSlot<EventSlot>(settings.slotSize))
+   , _dirty(settings.maxEntities)
+   , _entities(settings.maxEntities, NULL)
+   , _keys(TableSize(settings.maxEntities), 0)
+   , _indices(TableSize(settings.maxEntities), -1)
+   , _entityCount(0)
+   , _scratch(MakeSlot<EventSlot>(settings.slotSize))
+   , _conflated(0)
+   , _dropped(0)
+{
+}
+
+ConflatingQueue::~ConflatingQueue()
+{
+   for(unsigned int i=0; i<_entities.size(); ++i)
+   {
+      delete _entities[i];
+   }
+}
+
+void ConflatingQueue::Process(const char* buf, unsigned int size, Endian e)
+{
+   Process( buf , size , e , ReceiveContext() );
+}
+
+void ConflatingQueue::Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context)
+{
+   ReceiveContext pduContext( context );
+
+   ForEachBundledPdu( buf , size , e , [&](const char* pdu, unsigned int length, unsigned int offset)
+   {
+      pduContext.pduOffset = context.pduOffset + offset;
+      if( PduHeader::GetPduType( pdu ) == PDU_ENTITY_STATE &&
+          length >= PDU_ENTITY_ID_POSITION + ENTITY_ID_SIZE )
+      {
+         QueueState( PduHeader::GetEntityKey( pdu , length ) , pdu , length , e , pduContext );
+      }
+      else
+      {
+         QueueEvent( pdu , length , e , pduContext );
+      }
+
+      ++pduContext.pduIndex;
+   } );
+}
+
+void ConflatingQueue::QueueEvent(const char* pdu, unsigned int length, Endian e, const ReceiveContext& context)
+{
+   EventSlot* slot = _events.Reserve();
+   if( slot == NULL || length > slot->data.size() )
+   {
+      _dropped.fetch_add( 1 , std::memory_order_relaxed );
+      return;
+   }
+
+   memcpy( &slot->data[0] , pdu , length );
+   slot->length = length;
+   slot->endian = e;
+   slot->context = context;
+   _events.Publish();
+}
+
+void ConflatingQueue::QueueState(unsigned long long entityKey, const char* pdu, unsigned int length, Endian e, const ReceiveContext& context)
+{
+   const int index = FindEntity( entityKey );
+   if( index < 0 || length > _settings.slotSize )
+   {
+      _dropped.fetch_add( 1 , std::memory_order_relaxed );
+      return;
+   }
+
+   EntitySlot& slot = *_entities[index];
+
+   // an odd sequence tells the consumer the slot is being written.
+   const unsigned int sequence = slot.sequence.load( std::memory_order_relaxed );
+   slot.sequence.store( sequence + 1 , std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_release );
+
+   memcpy( &slot.data[0] , pdu , length );
+   slot.length = length;
+   slot.endian = e;
+   slot.context = context;
+
+   slot.sequence.store( sequence + 2 , std::memory_order_release );
+
+   if( slot.queued.exchange( true ) )
+   {
+      // the consumer has not taken the previous state yet, and will find this one instead.
+      _conflated.fetch_add( 1 , std::memory_order_relaxed );
+   }
+   else
+   {
+      _dirty.Push( static_cast<unsigned int>( index ) );
+   }
+}
+
+int ConflatingQueue::FindEntity(unsigned long long entityKey)
+{
+   const size_t mask = _keys.size() - 1;
+   size_t position = static_cast<size_t>( PduHeader::HashEntityKey( entityKey ) ) & mask;
+
+   while( _indices[position] >= 0 )
+   {
+      if( _keys[position] == entityKey )
+      {
+         return _indices[position];
+      }
+      position = (position + 1) & mask;
+   }
+
+   const unsigned int count = _entityCount.load( std::memory_order_relaxed );
+   if( count >= _entities.size() )
+   {
+      return -1;
+   }
+
+   // the slot is published to the consumer by the dirty lane.
+   EntitySlot* slot = new EntitySlot();
+   slot->data.resize( _settings.slotSize );
+   _entities[count] = slot;
+
+   _keys[position] = entityKey;
+   _indices[position] = static_cast<int>( count );
+   _entityCount.store( count + 1 , std::memory_order_relaxed );
+   return static_cast<int>( count );
+}
+
+unsigned int ConflatingQueue::Consume(IBufferProcessor& processor, unsigned int max)
+{
+   unsigned int consumed = 0;
+
+   while( consumed < max )
+   {
+      EventSlot* slot = _events.Front();
+      if( slot == NULL )
+      {
+         break;
+      }
+      processor.Process( &slot->data[0] , slot->length , slot->endian , slot->context );
+      _events.Pop();
+      ++consumed;
+   }
+
+   while( consumed < max )
+   {
+      unsigned int* index = _dirty.Front();
+      if( index == NULL )
+      {
+         break;
+      }
+      EntitySlot& slot = *_entities[*index];
+      _dirty.Pop();
+
+      // cleared before reading, so that a state written from now on queues the slot again.
+      slot.queued.store( false );
+      if( ReadState( slot ) )
+      {
+         processor.Process( &_scratch.data[0] , _scratch.length , _scratch.endian , _scratch.context );
+         ++consumed;
+      }
+   }
+
+   return consumed;
+}
+
+bool ConflatingQueue::ReadState(EntitySlot& slot)
+{
+   while( true )
+   {
+      const unsigned int before = slot.sequence.load( std::memory_order_acquire );
+      if( before & 1 )
+      {
+         std::this_thread::yield();
+         continue;
+      }
+
+      // a state written just after the slot was taken off the dirty lane queues it again,
+      // but was read on that pass in place of the state it overwrote.
+      if( before == slot.consumed )
+      {
+         _conflated.fetch_add( 1 , std::memory_order_relaxed );
+         return false;
+      }
+
+      memcpy( &_scratch.data[0] , &slot.data[0] , slot.length );
+      _scratch.length = slot.length;
+      _scratch.endian = slot.endian;
+      _scratch.context = slot.context;
+
+      std::atomic_thread_fence( std::memory_order_acquire );
+      if( slot.sequence.load( std::memory_order_relaxed ) == before )
+      {
+         slot.consumed = before;
+         return true;
+      }
+   }
+}
+
+unsigned long long ConflatingQueue::GetConflatedCount() const
+{
+   return _conflated.load();
+}
+
+unsigned long long ConflatingQueue::GetDroppedCount() const
+{
+   return _dropped.load();
+}
+
+unsigned int ConflatingQueue::GetEntityCount() const
+{
+   return _entityCount.load();
+}
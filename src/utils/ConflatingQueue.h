@@ -0,0 +1,135 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_conflating_queue_h_
+#define _dcl_dis_conflating_queue_h_
+
+#include <utils/IBufferProcessor.h>   // for base class
+#include <utils/ReceiveContext.h>     // for member
+#include <utils/SpscRing.h>           // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <vector>                   // for member
+#include <atomic>                   // for member
+
+namespace DIS
+{
+   /// the parameters used to create a ConflatingQueue.
+   struct EXPORT_MACRO ConflatingQueueSettings
+   {
+      ConflatingQueueSettings();
+
+      /// the number of entities whose latest state can be held.
+      /// state updates for entities beyond this are dropped.
+      unsigned int maxEntities;
+
+      /// the number of PDUs the FIFO lane holds.
+      unsigned int eventCapacity;
+
+      /// the largest PDU, in bytes, that fits a slot.  larger PDUs are dropped.
+      unsigned int slotSize;
+   };
+
+   /// hands PDUs from one receiving thread to one consuming thread without locks,
+   /// keeping only the latest unconsumed Entity State PDU of each entity.
+   /// a newer Entity State PDU overwrites the older one in place, so a consumer that falls
+   /// behind gets the current state of each entity rather than a backlog of stale updates.
+   /// all other PDUs, such as the Fire, Detonation and Collision events, are never conflated
+   /// and are queued in arrival order on a separate FIFO lane.
+   /// the memory is allocated when the queue is created, and bounds both lanes.
+   ///
+   /// the producer passes datagrams to Process(), so the queue can be given straight to a transport.
+   /// the consumer calls Consume() with the IBufferProcessor, such as an IncomingMessage, that decodes the PDUs.
+   class EXPORT_MACRO ConflatingQueue : public IBufferProcessor
+   {
+   public:
+      explicit ConflatingQueue(const ConflatingQueueSettings& settings=ConflatingQueueSettings());
+      ~ConflatingQueue();
+
+      /// producer side.  split the buffer into PDUs and queue each of them.
+      void Process(const char* buf, unsigned int size, Endian e);
+      void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context);
+
+      /// consumer side.  pass up to 'max' queued PDUs, one at a time, to the processor.
+      /// the FIFO lane is emptied first, then the entities with a new state.
+      /// @return the number of PDUs passed to the processor.
+      unsigned int Consume(IBufferProcessor& processor, unsigned int max=~0u);
+
+      /// @return the number of Entity State PDUs overwritten before they were consumed.
+      unsigned long long GetConflatedCount() const;
+
+      /// @return the number of PDUs dropped because a lane was full or the PDU was too large.
+      unsigned long long GetDroppedCount() const;
+
+      /// @return the number of entities tracked so far.
+      unsigned int GetEntityCount() const;
+
+   private:
+      ConflatingQueue(const ConflatingQueue&);              ///< not implemented by design
+      ConflatingQueue& operator=(const ConflatingQueue&);   ///< not implemented by design
+
+      /// one PDU on the FIFO lane.
+      struct EventSlot
+      {
+         ReceiveContext context;
+         Endian endian;
+         unsigned int length;
+         std::vector<char> data;
+      };
+
+      /// the latest state of one entity, guarded by a sequence lock.
+      /// the producer makes the sequence odd while it writes, and the consumer
+      /// reads again if the sequence changed while it was copying.
+      struct EntitySlot
+      {
+         EntitySlot();
+
+         std::atomic<unsigned int> sequence;
+
+         /// set while the slot's index is on the dirty lane.
+         std::atomic<bool> queued;
+
+         ReceiveContext context;
+         Endian endian;
+         unsigned int length;
+         std::vector<char> data;
+
+         /// consumer only.  the sequence last passed to a processor.
+         unsigned int consumed;
+      };
+
+      void QueueEvent(const char* pdu, unsigned int length, Endian e, const ReceiveContext& context);
+      void QueueState(unsigned long long entityKey, const char* pdu, unsigned int length, Endian e, const ReceiveContext& context);
+
+      /// producer only.  find or add the slot of the entity.
+      /// @return -1 when the entity is new and the table is full.
+      int FindEntity(unsigned long long entityKey);
+
+      /// consumer only.  copy a consistent state of the slot into the scratch buffer.
+      /// @return 'false' if the state was already consumed.
+      bool ReadState(EntitySlot& slot);
+
+      ConflatingQueueSettings _settings;
+
+      SpscRing<EventSlot> _events;
+
+      /// the indices of the entity slots holding an unconsumed state.
+      /// each index is on the lane at most once, so the lane can not overflow.
+      SpscRing<unsigned int> _dirty;
+
+      std::vector<EntitySlot*> _entities;
+
+      /// producer only.  an open addressing table from entity key to entity slot index, -1 when empty.
+      std::vector<unsigned long long> _keys;
+      std::vector<int> _indices;
+      std::atomic<unsigned int> _entityCount;
+
+      /// consumer only.  receives the copy of an entity state.
+      EventSlot _scratch;
+
+      std::atomic<unsigned long long> _conflated;
+      std::atomic<unsigned long long> _dropped;
+   };
+}
+
+#endif  // _dcl_dis_conflating_queue_h_
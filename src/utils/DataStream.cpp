@@ -1,3 +1,5 @@
+// the primitive operators are defined in the header, and compiled here unless they are inline.
+#define DIS_DATA_STREAM_DEFINITIONS
 #include <utils/DataStream.h>
 
 #include <iostream>   // for debug output
@@ -79,6 +81,15 @@ size_t DataStream::size() const
    return _buffer.size();
 }
 
+void DataStream::Skip(size_t bytes)
+{
+   _read_pos += bytes;
+   if( _read_pos > _buffer.size() )
+   {
+      _read_pos = _buffer.size();
+   }
+}
+
 void DataStream::clear()
 {
    _write_pos = 0;
@@ -118,167 +129,3 @@ void DataStream::SetStream(const char* buffer, size_t length, Endian stream)
       _buffer[i] = buffer[i];
    }
 }
-
-void DataStream::DoFlip(char* buf, size_t bufsize)
-{
-   if( _machine_endian == _stream_endian || bufsize<2 )
-   {
-      return;
-   }
-
-   // flip it, this fills back to front
-   char* start = &buf[0];
-   char* end = &buf[bufsize-1];
-   while( start < end )
-   {
-      /// save the beginning of the buffer
-      char temp = *start;
-
-      /// overwrite the beginning of the buffer
-      *start = *end;
-      *end = temp;
-
-      ++start;
-      --end;
-   }
-}
-
-void DataStream::DoWrite(const char* buf, size_t bufsize)
-{
-   for(unsigned int i=0; i<bufsize; ++i)
-   {
-      // ignores the _write_pos value currently,
-      // this should allow for values to always be appended to the end of the buffer.
-      _buffer.push_back( buf[i] );
-   }
-}
-
-void DataStream::DoRead(char* ch, size_t bufsize)
-{
-   for(unsigned int i=0; i<bufsize; i++)
-   {
-      ch[i] = _buffer.at(_read_pos+i);
-   }
-}
-
-// write stuff
-DataStream& DataStream::operator <<(char c)
-{
-   WriteAlgorithm( c );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(unsigned char c)
-{
-   WriteAlgorithm( c );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(float f) 
-{
-   WriteAlgorithm( f );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(double d) 
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(int d) 
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(unsigned int d) 
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(long long d)
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(unsigned long long d)
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(unsigned short d)
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator <<(short d)
-{
-   WriteAlgorithm( d );
-   return *this;
-}
-
-// read stuff
-DataStream& DataStream::operator >>(char& c)
-{
-   ReadAlgorithm( c );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(unsigned char& c)
-{
-   ReadAlgorithm( c );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(float& f)
-{
-   ReadAlgorithm( f );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(double& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(int& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(unsigned int& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(long long& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(unsigned long long& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(unsigned short& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
-
-DataStream& DataStream::operator >>(short& d)
-{
-   ReadAlgorithm( d );
-   return *this;
-}
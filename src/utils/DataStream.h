@@ -81,6 +81,10 @@ namespace DIS
 
       size_t size() const;
 
+      /// move the read position past bytes that will not be extracted.
+      /// @param bytes the number of bytes to skip, limited by the end of the buffer.
+      void Skip(size_t bytes);
+
       void clear();
 
       bool empty() const;
@@ -146,6 +150,185 @@ namespace DIS
    };
 }
 
+// the definitions of the primitive operators, which encode and decode every field of the records.
+// they are inline when the library is built with OPENDIS_INLINE_RECORDS, see dis6/RecordCodecs.h.
+#if defined(DIS_INLINE_RECORDS) || defined(DIS_DATA_STREAM_DEFINITIONS)
+
+#if defined(DIS_INLINE_RECORDS)
+#define DIS_DATA_STREAM_INLINE inline
+#else
+#define DIS_DATA_STREAM_INLINE
+#endif
+
+namespace DIS
+{
+   DIS_DATA_STREAM_INLINE void DataStream::DoFlip(char* buf, size_t bufsize)
+   {
+      if( _machine_endian == _stream_endian || bufsize<2 )
+      {
+         return;
+      }
+
+      // flip it, this fills back to front
+      char* start = &buf[0];
+      char* end = &buf[bufsize-1];
+      while( start < end )
+      {
+         /// save the beginning of the buffer
+         char temp = *start;
+
+         /// overwrite the beginning of the buffer
+         *start = *end;
+         *end = temp;
+
+         ++start;
+         --end;
+      }
+   }
+
+   DIS_DATA_STREAM_INLINE void DataStream::DoWrite(const char* buf, size_t bufsize)
+   {
+      for(unsigned int i=0; i<bufsize; ++i)
+      {
+         // ignores the _write_pos value currently,
+         // this should allow for values to always be appended to the end of the buffer.
+         _buffer.push_back( buf[i] );
+      }
+   }
+
+   DIS_DATA_STREAM_INLINE void DataStream::DoRead(char* ch, size_t bufsize)
+   {
+      for(unsigned int i=0; i<bufsize; i++)
+      {
+         ch[i] = _buffer.at(_read_pos+i);
+      }
+   }
+
+   // write stuff
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(char c)
+   {
+      WriteAlgorithm( c );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(unsigned char c)
+   {
+      WriteAlgorithm( c );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(float f)
+   {
+      WriteAlgorithm( f );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(double d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(int d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(unsigned int d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(long long d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(unsigned long long d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(unsigned short d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator <<(short d)
+   {
+      WriteAlgorithm( d );
+      return *this;
+   }
+
+   // read stuff
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(char& c)
+   {
+      ReadAlgorithm( c );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(unsigned char& c)
+   {
+      ReadAlgorithm( c );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(float& f)
+   {
+      ReadAlgorithm( f );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(double& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(int& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(unsigned int& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(long long& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(unsigned long long& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(unsigned short& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+
+   DIS_DATA_STREAM_INLINE DataStream& DataStream::operator >>(short& d)
+   {
+      ReadAlgorithm( d );
+      return *this;
+   }
+}
+
+#endif  // DIS_INLINE_RECORDS || DIS_DATA_STREAM_DEFINITIONS
+
 #if _MSC_VER
 #pragma warning( pop ) 
 #endif
@@ -0,0 +1,189 @@
+#include <utils/DeadReckoning.h>
+#include <utils/PDUType.h>
+
+#include <cmath>
+#include <cstring>
+
+using namespace DIS;
+
+namespace
+{
+   /// the dead reckoning algorithms: fixed or rotating, position or velocity, world or body coordinates.
+   enum Algorithm
+   {
+      ALGORITHM_STATIC = 1,
+      ALGORITHM_FPW = 2,
+      ALGORITHM_RPW = 3,
+      ALGORITHM_RVW = 4,
+      ALGORITHM_FVW = 5,
+      ALGORITHM_FPB = 6,
+      ALGORITHM_RPB = 7,
+      ALGORITHM_RVB = 8,
+      ALGORITHM_FVB = 9
+   };
+
+   unsigned long long ReadBig(const char* buf, unsigned int size)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>( buf );
+      unsigned long long value = 0;
+      for(unsigned int i=0; i<size; ++i)
+      {
+         value = (value << 8) | bytes[i];
+      }
+      return value;
+   }
+
+   float ReadFloat(const char* buf)
+   {
+      const unsigned int bits = static_cast<unsigned int>( ReadBig( buf , 4 ) );
+      float value = 0;
+      memcpy( &value , &bits , sizeof(value) );
+      return value;
+   }
+
+   double ReadDouble(const char* buf)
+   {
+      const unsigned long long bits = ReadBig( buf , 8 );
+      double value = 0;
+      memcpy( &value , &bits , sizeof(value) );
+      return value;
+   }
+
+   void ReadFloats(const char* buf, float values[3])
+   {
+      for(unsigned int i=0; i<3; ++i)
+      {
+         values[i] = ReadFloat( buf + 4 * i );
+      }
+   }
+
+   /// rotate a vector from body to world coordinates, with the orientation psi, theta, phi.
+   void BodyToWorld(const float orientation[3], const double body[3], double world[3])
+   {
+      const double cpsi = cos( orientation[0] ), spsi = sin( orientation[0] );
+      const double ctheta = cos( orientation[1] ), stheta = sin( orientation[1] );
+      const double cphi = cos( orientation[2] ), sphi = sin( orientation[2] );
+
+      world[0] = ctheta * cpsi * body[0] + ( sphi * stheta * cpsi - cphi * spsi ) * body[1] + ( cphi * stheta * cpsi + sphi * spsi ) * body[2];
+      world[1] = ctheta * spsi * body[0] + ( sphi * stheta * spsi + cphi * cpsi ) * body[1] + ( cphi * stheta * spsi - sphi * cpsi ) * body[2];
+      world[2] = -stheta * body[0] + sphi * ctheta * body[1] + cphi * ctheta * body[2];
+   }
+
+   /// turn the orientation by the body angular velocity over the time.
+   void Rotate(EntitySnapshot& snapshot, double seconds)
+   {
+      const double p = snapshot.angularVelocity[0];
+      const double q = snapshot.angularVelocity[1];
+      const double r = snapshot.angularVelocity[2];
+      const double phi = snapshot.orientation[2];
+      const double theta = snapshot.orientation[1];
+      const double ctheta = cos( theta );
+
+      // the Euler angle rates are undefined when pointing straight up or down.
+      if( fabs( ctheta ) < 1e-6 )
+      {
+         return;
+      }
+
+      const double psiRate = ( q * sin( phi ) + r * cos( phi ) ) / ctheta;
+      const double thetaRate = q * cos( phi ) - r * sin( phi );
+      const double phiRate = p + ( q * sin( phi ) + r * cos( phi ) ) * tan( theta );
+
+      snapshot.orientation[0] = static_cast<float>( snapshot.orientation[0] + psiRate * seconds );
+      snapshot.orientation[1] = static_cast<float>( snapshot.orientation[1] + thetaRate * seconds );
+      snapshot.orientation[2] = static_cast<float>( snapshot.orientation[2] + phiRate * seconds );
+   }
+}
+
+EntitySnapshot::EntitySnapshot()
+   : view()
+   , entityKey(0)
+   , appearance(0)
+   , deadReckoningAlgorithm(0)
+{
+   for(unsigned int i=0; i<3; ++i)
+   {
+      location[i] = 0;
+      velocity[i] = 0;
+      acceleration[i] = 0;
+      angularVelocity[i] = 0;
+      orientation[i] = 0;
+   }
+}
+
+bool DeadReckoning::Read(const PduView& view, EntitySnapshot& snapshot)
+{
+   if( view.pdu == NULL || view.length < ENTITY_STATE_MIN_SIZE || view.GetPduType() != PDU_ENTITY_STATE )
+   {
+      return false;
+   }
+
+   const char* pdu = view.pdu;
+   snapshot.view = view;
+   snapshot.entityKey = view.GetEntityKey();
+   for(unsigned int i=0; i<3; ++i)
+   {
+      snapshot.location[i] = ReadDouble( pdu + ENTITY_STATE_LOCATION_POSITION + 8 * i );
+   }
+   ReadFloats( pdu + ENTITY_STATE_VELOCITY_POSITION , snapshot.velocity );
+   ReadFloats( pdu + ENTITY_STATE_ACCELERATION_POSITION , snapshot.acceleration );
+   ReadFloats( pdu + ENTITY_STATE_ANGULAR_VELOCITY_POSITION , snapshot.angularVelocity );
+   ReadFloats( pdu + ENTITY_STATE_ORIENTATION_POSITION , snapshot.orientation );
+   snapshot.appearance = static_cast<unsigned int>( ReadBig( pdu + ENTITY_STATE_APPEARANCE_POSITION , 4 ) );
+   snapshot.deadReckoningAlgorithm = static_cast<unsigned char>( pdu[ENTITY_STATE_ALGORITHM_POSITION] );
+   return true;
+}
+
+void DeadReckoning::Extrapolate(EntitySnapshot& snapshot, double seconds)
+{
+   const unsigned char algorithm = snapshot.deadReckoningAlgorithm;
+   if( algorithm < ALGORITHM_FPW || algorithm > ALGORITHM_FVB || seconds == 0 )
+   {
+      return;
+   }
+
+   // the velocity terms, and the acceleration terms for the velocity algorithms.
+   const bool accelerated = ( algorithm == ALGORITHM_RVW || algorithm == ALGORITHM_FVW ||
+                              algorithm == ALGORITHM_RVB || algorithm == ALGORITHM_FVB );
+   double moved[3];
+   for(unsigned int i=0; i<3; ++i)
+   {
+      moved[i] = snapshot.velocity[i] * seconds;
+      if( accelerated )
+      {
+         moved[i] += 0.5 * snapshot.acceleration[i] * seconds * seconds;
+      }
+   }
+
+   const bool body = ( algorithm >= ALGORITHM_FPB );
+   if( body )
+   {
+      double world[3];
+      BodyToWorld( snapshot.orientation , moved , world );
+      for(unsigned int i=0; i<3; ++i)
+      {
+         moved[i] = world[i];
+      }
+   }
+
+   for(unsigned int i=0; i<3; ++i)
+   {
+      snapshot.location[i] += moved[i];
+   }
+
+   const bool rotating = ( algorithm == ALGORITHM_RPW || algorithm == ALGORITHM_RVW ||
+                           algorithm == ALGORITHM_RPB || algorithm == ALGORITHM_RVB );
+   if( rotating )
+   {
+      Rotate( snapshot , seconds );
+   }
+
+   // the world velocity changes with the acceleration, so that a later extrapolation continues from here.
+   if( accelerated && !body )
+   {
+      for(unsigned int i=0; i<3; ++i)
+      {
+         snapshot.velocity[i] = static_cast<float>( snapshot.velocity[i] + snapshot.acceleration[i] * seconds );
+      }
+   }
+}
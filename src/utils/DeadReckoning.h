@@ -0,0 +1,68 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_dead_reckoning_h_
+#define _dcl_dis_dead_reckoning_h_
+
+#include <utils/PduView.h>            // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+namespace DIS
+{
+   /// the size of an Entity State PDU without articulation parameters.
+   /// the fields used for dead reckoning are at the same positions in DIS 6 and DIS 7.
+   const unsigned int ENTITY_STATE_MIN_SIZE = 144;
+
+   /// the byte positions of the Entity State PDU fields, as defined by IEEE Std 1278.1.
+   const unsigned int ENTITY_STATE_VELOCITY_POSITION = 36;
+   const unsigned int ENTITY_STATE_LOCATION_POSITION = 48;
+   const unsigned int ENTITY_STATE_ORIENTATION_POSITION = 72;
+   const unsigned int ENTITY_STATE_APPEARANCE_POSITION = 84;
+   const unsigned int ENTITY_STATE_ALGORITHM_POSITION = 88;
+   const unsigned int ENTITY_STATE_ACCELERATION_POSITION = 104;
+   const unsigned int ENTITY_STATE_ANGULAR_VELOCITY_POSITION = 116;
+
+   /// the kinematic state of one entity, read from the raw bytes of its Entity State PDU.
+   struct EXPORT_MACRO EntitySnapshot
+   {
+      EntitySnapshot();
+
+      /// the PDU the state was read from.
+      PduView view;
+      unsigned long long entityKey;
+
+      /// the location in world coordinates, in meters.
+      double location[3];
+
+      /// the linear velocity and acceleration, in world or body coordinates depending on the algorithm.
+      float velocity[3];
+      float acceleration[3];
+
+      /// the angular velocity in body coordinates, in radians per second.
+      float angularVelocity[3];
+
+      /// psi, theta and phi, in radians.
+      float orientation[3];
+
+      unsigned int appearance;
+      unsigned char deadReckoningAlgorithm;
+   };
+
+   /// reads the kinematic state of Entity State PDUs and extrapolates it with the DIS dead reckoning algorithms.
+   struct EXPORT_MACRO DeadReckoning
+   {
+      /// read the state of an Entity State PDU, in network byte order.
+      /// @return 'false' if the view is not a complete Entity State PDU.
+      static bool Read(const PduView& view, EntitySnapshot& snapshot);
+
+      /// move the state forward by the time, according to its dead reckoning algorithm.
+      /// the world coordinate algorithms (FPW, RPW, RVW, FVW) are exact.  the body coordinate algorithms
+      /// (FPB, RPB, RVB, FVB) rotate the body rates with the orientation at the start of the interval,
+      /// and the rotating algorithms integrate the angular velocity to first order.
+      /// static entities, and unknown algorithms, do not move.
+      /// @param seconds the time since the PDU was received.
+      static void Extrapolate(EntitySnapshot& snapshot, double seconds);
+   };
+}
+
+#endif  // _dcl_dis_dead_reckoning_h_
@@ -0,0 +1,339 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_entity_archive_format_h_
+#define _dcl_dis_entity_archive_format_h_
+
+#include <utils/DeadReckoning.h>    // for usage
+#include <utils/PduHeader.h>        // for usage
+
+#include <stdint.h>                 // for fixed size fields
+#include <vector>                   // for parameter
+
+namespace DIS
+{
+   /// the layout of an entity archive, as written by EntityArchiveWriter.
+   ///
+   /// an archive stores the Entity State PDUs of a recording as one track per entity.
+   /// a track keeps the fields that change every heartbeat as columns, each encoded against the previous
+   /// sample of the entity, and the rest of the PDU once, as a template.  when anything outside the columns
+   /// changes, such as the marking or the articulation parameters, the track starts a new template.
+   /// every other PDU is kept as it was received, in a row section.  a sequence column and the sequence
+   /// of the rows give the position of every PDU in the recording, so that it can be rebuilt exactly.
+   ///
+   /// the file is an EntityArchiveHeader, an EntityArchiveTrack for every track sorted by entity key,
+   /// then the tracks and the row section.  a track is its templates, then its columns one after another,
+   /// each EntityArchiveTemplate followed by the PDU bytes with the column fields set to 0.
+   /// a row is the sequence and time deltas as varints, then an EntityArchiveTemplate and the PDU bytes.
+   ///
+   /// every field is little-endian.
+
+   /// identifies an entity archive, and the layout version.
+   const char ENTITY_ARCHIVE_MAGIC[8] = { 'D','I','S','A','R','C','0','1' };
+
+   /// the columns of a track.
+   enum EntityArchiveColumn
+   {
+      /// the receive time, in nanoseconds since the epoch.
+      ARCHIVE_TIME = 0,
+
+      /// the position of the PDU in the recording, counting from 0.
+      ARCHIVE_SEQUENCE,
+
+      /// the template of the PDU, counting from 0.
+      ARCHIVE_TEMPLATE,
+
+      /// the timestamp field of the PDU header.
+      ARCHIVE_PDU_TIME,
+
+      ARCHIVE_LOCATION_X,
+      ARCHIVE_LOCATION_Y,
+      ARCHIVE_LOCATION_Z,
+      ARCHIVE_VELOCITY_X,
+      ARCHIVE_VELOCITY_Y,
+      ARCHIVE_VELOCITY_Z,
+      ARCHIVE_PSI,
+      ARCHIVE_THETA,
+      ARCHIVE_PHI,
+      ARCHIVE_APPEARANCE,
+
+      ARCHIVE_COLUMN_COUNT
+   };
+
+   /// how the values of a column are encoded against the previous value.
+   enum EntityArchiveEncoding
+   {
+      /// a zigzag varint of the change of the difference, which is 0 for a steady heartbeat.
+      ARCHIVE_DELTA_OF_DELTA,
+
+      /// a zigzag varint of the difference.
+      ARCHIVE_DELTA,
+
+      /// a varint of the bits that changed.
+      ARCHIVE_XOR,
+
+      /// the bits that changed, as a byte holding the number of leading zero bytes in the high half
+      /// and of trailing zero bytes in the low half, followed by the bytes between them.
+      /// an unchanged value is the one byte holding the width as the leading zero bytes.
+      ARCHIVE_XOR_FLOAT,
+      ARCHIVE_XOR_DOUBLE
+   };
+
+   /// the start of the file.
+   struct EntityArchiveHeader
+   {
+      char magic[8];
+
+      uint32_t trackCount;
+      uint32_t reserved;
+
+      /// the number of PDUs, in the tracks and in the row section.
+      uint64_t recordCount;
+
+      /// the position of the row section from the start of the file, its size and its number of rows.
+      uint64_t rowsOffset;
+      uint64_t rowsLength;
+      uint64_t rowCount;
+
+      /// the receive times of the first and last PDUs, in nanoseconds since the epoch.
+      int64_t firstTimestamp;
+      int64_t lastTimestamp;
+   };
+
+   /// describes one track.
+   struct EntityArchiveTrack
+   {
+      /// the site, application and entity numbers, as packed by PduHeader::MakeEntityKey.
+      uint64_t entityKey;
+
+      /// the position of the track from the start of the file.
+      uint64_t offset;
+
+      uint32_t sampleCount;
+      uint32_t templateCount;
+
+      /// the receive times of the first and last samples.
+      int64_t firstTimestamp;
+      int64_t lastTimestamp;
+
+      /// the offset of each column from the start of the track, then the size of the track.
+      /// the templates are before the first column.
+      uint32_t columns[ARCHIVE_COLUMN_COUNT + 1];
+   };
+
+   /// the reception details and size of a PDU, which follows.
+   struct EntityArchiveTemplate
+   {
+      /// the sender and the destination, IPv4 in host byte order.
+      uint32_t sourceAddress;
+      uint32_t destinationAddress;
+      uint16_t sourcePort;
+
+      /// the number of PDU bytes following.
+      uint16_t length;
+   };
+
+   /// @return how the column is encoded.
+   inline EntityArchiveEncoding GetArchiveEncoding(EntityArchiveColumn column)
+   {
+      switch( column )
+      {
+      case ARCHIVE_TIME:
+      case ARCHIVE_PDU_TIME:
+         return ARCHIVE_DELTA_OF_DELTA;
+      case ARCHIVE_SEQUENCE:
+      case ARCHIVE_TEMPLATE:
+         return ARCHIVE_DELTA;
+      case ARCHIVE_APPEARANCE:
+         return ARCHIVE_XOR;
+      case ARCHIVE_LOCATION_X:
+      case ARCHIVE_LOCATION_Y:
+      case ARCHIVE_LOCATION_Z:
+         return ARCHIVE_XOR_DOUBLE;
+      default:
+         return ARCHIVE_XOR_FLOAT;
+      }
+   }
+
+   /// @return the position of the column's field in the Entity State PDU, 0 for the columns that are not PDU fields.
+   inline unsigned int GetArchiveFieldPosition(EntityArchiveColumn column)
+   {
+      switch( column )
+      {
+      case ARCHIVE_PDU_TIME:
+         return PDU_TIMESTAMP_POSITION;
+      case ARCHIVE_LOCATION_X:
+      case ARCHIVE_LOCATION_Y:
+      case ARCHIVE_LOCATION_Z:
+         return ENTITY_STATE_LOCATION_POSITION + 8 * ( column - ARCHIVE_LOCATION_X );
+      case ARCHIVE_VELOCITY_X:
+      case ARCHIVE_VELOCITY_Y:
+      case ARCHIVE_VELOCITY_Z:
+         return ENTITY_STATE_VELOCITY_POSITION + 4 * ( column - ARCHIVE_VELOCITY_X );
+      case ARCHIVE_PSI:
+      case ARCHIVE_THETA:
+      case ARCHIVE_PHI:
+         return ENTITY_STATE_ORIENTATION_POSITION + 4 * ( column - ARCHIVE_PSI );
+      case ARCHIVE_APPEARANCE:
+         return ENTITY_STATE_APPEARANCE_POSITION;
+      default:
+         return 0;
+      }
+   }
+
+   /// @return the size of the column's field in the Entity State PDU, 0 for the columns that are not PDU fields.
+   inline unsigned int GetArchiveFieldSize(EntityArchiveColumn column)
+   {
+      if( GetArchiveFieldPosition( column ) == 0 )
+      {
+         return 0;
+      }
+      return ( GetArchiveEncoding( column ) == ARCHIVE_XOR_DOUBLE ) ? 8 : 4;
+   }
+
+   /// what a column's encoder and decoder remember of the previous value.
+   struct EntityArchiveCodec
+   {
+      EntityArchiveCodec()
+         : previous(0)
+         , difference(0)
+      {
+      }
+
+      /// the previous value, as bits.
+      uint64_t previous;
+
+      /// the previous difference, for ARCHIVE_DELTA_OF_DELTA.
+      uint64_t difference;
+   };
+
+   inline void PutArchiveVarint(std::vector<char>& out, uint64_t value)
+   {
+      while( value >= 0x80 )
+      {
+         out.push_back( static_cast<char>( ( value & 0x7f ) | 0x80 ) );
+         value >>= 7;
+      }
+      out.push_back( static_cast<char>( value ) );
+   }
+
+   /// @return 'false' if the varint runs past the end.
+   inline bool GetArchiveVarint(const char*& in, const char* end, uint64_t& value)
+   {
+      value = 0;
+      for(unsigned int shift=0; shift<64 && in<end; shift+=7)
+      {
+         const unsigned char byte = static_cast<unsigned char>( *in++ );
+         value |= static_cast<uint64_t>( byte & 0x7f ) << shift;
+         if( ( byte & 0x80 ) == 0 )
+         {
+            return true;
+         }
+      }
+      return false;
+   }
+
+   /// append a value to a column, given as the bits of the integer, float or double.
+   inline void PutArchiveValue(std::vector<char>& out, EntityArchiveEncoding encoding, EntityArchiveCodec& codec, uint64_t value)
+   {
+      const uint64_t difference = value - codec.previous;
+      const uint64_t changed = value ^ codec.previous;
+      switch( encoding )
+      {
+      case ARCHIVE_DELTA_OF_DELTA:
+         {
+            const int64_t change = static_cast<int64_t>( difference - codec.difference );
+            PutArchiveVarint( out , ( static_cast<uint64_t>( change ) << 1 ) ^ static_cast<uint64_t>( change >> 63 ) );
+            codec.difference = difference;
+         }
+         break;
+      case ARCHIVE_DELTA:
+         {
+            const int64_t change = static_cast<int64_t>( difference );
+            PutArchiveVarint( out , ( static_cast<uint64_t>( change ) << 1 ) ^ static_cast<uint64_t>( change >> 63 ) );
+         }
+         break;
+      case ARCHIVE_XOR:
+         PutArchiveVarint( out , changed );
+         break;
+      default:
+         {
+            const unsigned int width = ( encoding == ARCHIVE_XOR_DOUBLE ) ? 8 : 4;
+            unsigned int leading = 0;
+            while( leading < width && ( ( changed >> ( 8 * ( width - 1 - leading ) ) ) & 0xff ) == 0 )
+            {
+               ++leading;
+            }
+            unsigned int trailing = 0;
+            while( leading + trailing < width && ( ( changed >> ( 8 * trailing ) ) & 0xff ) == 0 )
+            {
+               ++trailing;
+            }
+            out.push_back( static_cast<char>( ( leading << 4 ) | trailing ) );
+            for(unsigned int i=leading; i<width-trailing; ++i)
+            {
+               out.push_back( static_cast<char>( changed >> ( 8 * ( width - 1 - i ) ) ) );
+            }
+         }
+         break;
+      }
+      codec.previous = value;
+   }
+
+   /// read the next value of a column.
+   /// @return 'false' if the value runs past the end.
+   inline bool GetArchiveValue(const char*& in, const char* end, EntityArchiveEncoding encoding, EntityArchiveCodec& codec, uint64_t& value)
+   {
+      uint64_t encoded = 0;
+      switch( encoding )
+      {
+      case ARCHIVE_DELTA_OF_DELTA:
+         if( !GetArchiveVarint( in , end , encoded ) )
+         {
+            return false;
+         }
+         codec.difference += ( encoded >> 1 ) ^ ( ~( encoded & 1 ) + 1 );
+         value = codec.previous + codec.difference;
+         break;
+      case ARCHIVE_DELTA:
+         if( !GetArchiveVarint( in , end , encoded ) )
+         {
+            return false;
+         }
+         value = codec.previous + ( ( encoded >> 1 ) ^ ( ~( encoded & 1 ) + 1 ) );
+         break;
+      case ARCHIVE_XOR:
+         if( !GetArchiveVarint( in , end , encoded ) )
+         {
+            return false;
+         }
+         value = codec.previous ^ encoded;
+         break;
+      default:
+         {
+            if( in >= end )
+            {
+               return false;
+            }
+            const unsigned int width = ( encoding == ARCHIVE_XOR_DOUBLE ) ? 8 : 4;
+            const unsigned char counts = static_cast<unsigned char>( *in++ );
+            const unsigned int leading = counts >> 4;
+            const unsigned int trailing = counts & 0x0f;
+            if( leading + trailing > width || end - in < static_cast<long>( width - leading - trailing ) )
+            {
+               return false;
+            }
+            for(unsigned int i=leading; i<width-trailing; ++i)
+            {
+               encoded |= static_cast<uint64_t>( static_cast<unsigned char>( *in++ ) ) << ( 8 * ( width - 1 - i ) );
+            }
+            value = codec.previous ^ encoded;
+         }
+         break;
+      }
+      codec.previous = value;
+      return true;
+   }
+}
+
+#endif  // _dcl_dis_entity_archive_format_h_
@@ -0,0 +1,500 @@
+#include <utils/EntityArchiveReader.h>
+#include <utils/IPduViewProcessor.h>
+#include <utils/RecordingWriter.h>
+#include <utils/ReceiveContext.h>
+#include <utils/PDUType.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <utility>
+
+using namespace DIS;
+
+namespace
+{
+   void WriteBig(char* buf, unsigned int size, uint64_t value)
+   {
+      for(unsigned int i=0; i<size; ++i)
+      {
+         buf[size - 1 - i] = static_cast<char>( value );
+         value >>= 8;
+      }
+   }
+
+   bool IsInteger(EntityArchiveColumn column)
+   {
+      const EntityArchiveEncoding encoding = GetArchiveEncoding( column );
+      return( encoding != ARCHIVE_XOR_FLOAT && encoding != ARCHIVE_XOR_DOUBLE );
+   }
+
+#if defined(__linux__)
+   /// records every PDU it is given.
+   class RestoreProcessor : public IPduViewProcessor
+   {
+   public:
+      RestoreProcessor(RecordingWriter& writer)
+         : _writer(writer)
+      {
+      }
+
+      void Process(const PduView& view, unsigned int /*worker*/)
+      {
+         ReceiveContext context;
+         context.timestamp = view.timestamp;
+         context.sourceAddress = view.sourceAddress;
+         context.sourcePort = view.sourcePort;
+         context.destinationAddress = view.destinationAddress;
+         _writer.Record( view.pdu , view.length , context );
+      }
+
+   private:
+      RestoreProcessor& operator=(const RestoreProcessor&);   ///< not implemented by design
+
+      RecordingWriter& _writer;
+   };
+#endif
+}
+
+struct EntityArchiveReader::Cursor
+{
+   Cursor()
+      : remaining(0)
+      , templates()
+      , pdu()
+      , view()
+      , sequence(0)
+   {
+   }
+
+   /// prepare to read the track.
+   /// @return 'false' if the templates do not fit the track, or are not whole Entity State PDUs.
+   bool Start(const char* data, const EntityArchiveTrack& track)
+   {
+      const char* base = data + track.offset;
+      const char* in = base;
+      const char* end = base + track.columns[0];
+      for(uint32_t i=0; i<track.templateCount; ++i)
+      {
+         EntityArchiveTemplate header;
+         if( end - in < static_cast<long>( sizeof(header) ) )
+         {
+            return false;
+         }
+         memcpy( &header , in , sizeof(header) );
+         if( end - in - sizeof(header) < header.length )
+         {
+            return false;
+         }
+
+         // the samples are written into a copy of the template, up to the appearance.
+         if( header.length < ENTITY_STATE_MIN_SIZE ||
+             PduHeader::GetPduType( in + sizeof(header) ) != PDU_ENTITY_STATE )
+         {
+            return false;
+         }
+         templates.push_back( in );
+         in += sizeof(header) + header.length;
+      }
+
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         positions[column] = base + track.columns[column];
+         ends[column] = base + track.columns[column + 1];
+      }
+      remaining = track.sampleCount;
+      return true;
+   }
+
+   /// rebuild the next sample of the track.
+   /// @return 'false' after the last sample, or if the track is damaged.
+   bool Next()
+   {
+      if( remaining == 0 )
+      {
+         return false;
+      }
+
+      uint64_t values[ARCHIVE_COLUMN_COUNT];
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         const EntityArchiveColumn field = static_cast<EntityArchiveColumn>( column );
+         if( !GetArchiveValue( positions[column] , ends[column] , GetArchiveEncoding( field ) , codecs[column] , values[column] ) )
+         {
+            return false;
+         }
+      }
+
+      if( values[ARCHIVE_TEMPLATE] >= templates.size() )
+      {
+         return false;
+      }
+      EntityArchiveTemplate header;
+      memcpy( &header , templates[values[ARCHIVE_TEMPLATE]] , sizeof(header) );
+      const char* bytes = templates[values[ARCHIVE_TEMPLATE]] + sizeof(header);
+      pdu.assign( bytes , bytes + header.length );
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         const EntityArchiveColumn field = static_cast<EntityArchiveColumn>( column );
+         const unsigned int size = GetArchiveFieldSize( field );
+         if( size > 0 )
+         {
+            WriteBig( &pdu[GetArchiveFieldPosition( field )] , size , values[column] );
+         }
+      }
+
+      view.pdu = &pdu[0];
+      view.length = header.length;
+      view.timestamp = static_cast<long long>( values[ARCHIVE_TIME] );
+      view.sourceAddress = header.sourceAddress;
+      view.sourcePort = header.sourcePort;
+      view.destinationAddress = header.destinationAddress;
+      sequence = values[ARCHIVE_SEQUENCE];
+      --remaining;
+      return true;
+   }
+
+   const char* positions[ARCHIVE_COLUMN_COUNT];
+   const char* ends[ARCHIVE_COLUMN_COUNT];
+   EntityArchiveCodec codecs[ARCHIVE_COLUMN_COUNT];
+   uint32_t remaining;
+
+   /// the start of every template of the track.
+   std::vector<const char*> templates;
+
+   /// the current sample.
+   std::vector<char> pdu;
+   PduView view;
+   uint64_t sequence;
+};
+
+EntityArchiveReader::EntityArchiveReader()
+   : _file()
+   , _data(NULL)
+   , _size(0)
+   , _header()
+   , _tracks()
+   , _error(0)
+{
+}
+
+EntityArchiveReader::~EntityArchiveReader()
+{
+   Close();
+}
+
+bool EntityArchiveReader::Open(const std::string& path)
+{
+   Close();
+
+   if( !_file.Open( path ) )
+   {
+      _error = _file.GetLastError();
+      return false;
+   }
+   _data = _file.GetData();
+   _size = _file.GetSize();
+
+   if( !ReadHeaders() )
+   {
+      _error = EINVAL;
+      Close();
+      return false;
+   }
+
+   return true;
+}
+
+void EntityArchiveReader::Close()
+{
+   _file.Close();
+   _data = NULL;
+   _size = 0;
+   memset( &_header , 0 , sizeof(_header) );
+   _tracks.clear();
+}
+
+bool EntityArchiveReader::IsOpen() const
+{
+   return( _data != NULL );
+}
+
+bool EntityArchiveReader::ReadHeaders()
+{
+   if( _size < sizeof(EntityArchiveHeader) )
+   {
+      return false;
+   }
+
+   memcpy( &_header , _data , sizeof(_header) );
+   const uint64_t directory = static_cast<uint64_t>( _header.trackCount ) * sizeof(EntityArchiveTrack);
+   if( memcmp( _header.magic , ENTITY_ARCHIVE_MAGIC , sizeof(_header.magic) ) != 0 ||
+       directory > _size - sizeof(_header) ||
+       _header.rowsOffset > _size || _header.rowsLength > _size - _header.rowsOffset )
+   {
+      return false;
+   }
+
+   _tracks.resize( _header.trackCount );
+   if( !_tracks.empty() )
+   {
+      memcpy( &_tracks[0] , _data + sizeof(_header) , directory );
+   }
+
+   for(size_t i=0; i<_tracks.size(); ++i)
+   {
+      const EntityArchiveTrack& track = _tracks[i];
+      if( track.offset > _size || track.columns[ARCHIVE_COLUMN_COUNT] > _size - track.offset )
+      {
+         return false;
+      }
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         if( track.columns[column] > track.columns[column + 1] )
+         {
+            return false;
+         }
+      }
+   }
+
+   return true;
+}
+
+size_t EntityArchiveReader::GetTrackCount() const
+{
+   return _tracks.size();
+}
+
+size_t EntityArchiveReader::FindTrack(unsigned long long entityKey) const
+{
+   size_t low = 0;
+   size_t high = _tracks.size();
+   while( low < high )
+   {
+      const size_t middle = low + ( high - low ) / 2;
+      if( _tracks[middle].entityKey < entityKey )
+      {
+         low = middle + 1;
+      }
+      else
+      {
+         high = middle;
+      }
+   }
+
+   return( low < _tracks.size() && _tracks[low].entityKey == entityKey ) ? low : _tracks.size();
+}
+
+const EntityArchiveTrack& EntityArchiveReader::GetTrack(size_t track) const
+{
+   return _tracks[track];
+}
+
+bool EntityArchiveReader::DecodeColumn(size_t track, EntityArchiveColumn column, std::vector<uint64_t>& values) const
+{
+   values.clear();
+   if( track >= _tracks.size() || column >= ARCHIVE_COLUMN_COUNT )
+   {
+      return false;
+   }
+
+   const EntityArchiveTrack& entry = _tracks[track];
+   const char* in = _data + entry.offset + entry.columns[column];
+   const char* end = _data + entry.offset + entry.columns[column + 1];
+   const EntityArchiveEncoding encoding = GetArchiveEncoding( column );
+   EntityArchiveCodec codec;
+   values.resize( entry.sampleCount );
+   for(uint32_t i=0; i<entry.sampleCount; ++i)
+   {
+      if( !GetArchiveValue( in , end , encoding , codec , values[i] ) )
+      {
+         values.clear();
+         return false;
+      }
+   }
+   return true;
+}
+
+bool EntityArchiveReader::ReadColumn(size_t track, EntityArchiveColumn column, std::vector<long long>& values) const
+{
+   values.clear();
+   std::vector<uint64_t> bits;
+   if( !IsInteger( column ) || !DecodeColumn( track , column , bits ) )
+   {
+      return false;
+   }
+
+   values.assign( bits.begin() , bits.end() );
+   return true;
+}
+
+bool EntityArchiveReader::ReadColumn(size_t track, EntityArchiveColumn column, std::vector<double>& values) const
+{
+   values.clear();
+   std::vector<uint64_t> bits;
+   if( IsInteger( column ) || !DecodeColumn( track , column , bits ) )
+   {
+      return false;
+   }
+
+   values.resize( bits.size() );
+   const bool wide = ( GetArchiveEncoding( column ) == ARCHIVE_XOR_DOUBLE );
+   for(size_t i=0; i<bits.size(); ++i)
+   {
+      if( wide )
+      {
+         memcpy( &values[i] , &bits[i] , sizeof(double) );
+      }
+      else
+      {
+         const uint32_t narrow = static_cast<uint32_t>( bits[i] );
+         float value = 0;
+         memcpy( &value , &narrow , sizeof(value) );
+         values[i] = value;
+      }
+   }
+   return true;
+}
+
+unsigned long long EntityArchiveReader::Process(IPduViewProcessor& processor) const
+{
+   if( _data == NULL )
+   {
+      return 0;
+   }
+
+   // the tracks and the rows are merged by the position of their PDUs in the recording.
+   typedef std::pair<uint64_t, size_t> Pending;
+   std::priority_queue< Pending, std::vector<Pending>, std::greater<Pending> > pending;
+
+   std::vector<Cursor> cursors( _tracks.size() );
+   for(size_t i=0; i<_tracks.size(); ++i)
+   {
+      if( cursors[i].Start( _data , _tracks[i] ) && cursors[i].Next() )
+      {
+         pending.push( Pending( cursors[i].sequence , i ) );
+      }
+   }
+
+   const char* rows = _data + _header.rowsOffset;
+   const char* rowsEnd = rows + _header.rowsLength;
+   EntityArchiveCodec rowSequence;
+   EntityArchiveCodec rowTime;
+   uint64_t rowsLeft = _header.rowCount;
+   PduView row;
+
+   const size_t ROWS = _tracks.size();
+   uint64_t sequence = 0;
+   bool rowPending = false;
+   unsigned long long count = 0;
+   while( true )
+   {
+      // the next row is read as soon as the previous one is passed on.
+      if( !rowPending && rowsLeft > 0 )
+      {
+         uint64_t timestamp = 0;
+         EntityArchiveTemplate header;
+         if( GetArchiveValue( rows , rowsEnd , ARCHIVE_DELTA , rowSequence , sequence ) &&
+             GetArchiveValue( rows , rowsEnd , ARCHIVE_DELTA , rowTime , timestamp ) &&
+             rowsEnd - rows >= static_cast<long>( sizeof(header) ) )
+         {
+            memcpy( &header , rows , sizeof(header) );
+            rows += sizeof(header);
+            if( rowsEnd - rows >= header.length )
+            {
+               row.pdu = rows;
+               row.length = header.length;
+               row.timestamp = static_cast<long long>( timestamp );
+               row.sourceAddress = header.sourceAddress;
+               row.sourcePort = header.sourcePort;
+               row.destinationAddress = header.destinationAddress;
+               rows += header.length;
+               pending.push( Pending( sequence , ROWS ) );
+               rowPending = true;
+            }
+         }
+         --rowsLeft;
+         if( !rowPending )
+         {
+            rowsLeft = 0;
+         }
+      }
+
+      if( pending.empty() )
+      {
+         break;
+      }
+
+      const size_t source = pending.top().second;
+      pending.pop();
+      if( source == ROWS )
+      {
+         processor.Process( row , 0 );
+         rowPending = false;
+      }
+      else
+      {
+         processor.Process( cursors[source].view , 0 );
+         if( cursors[source].Next() )
+         {
+            pending.push( Pending( cursors[source].sequence , source ) );
+         }
+      }
+      ++count;
+   }
+
+   return count;
+}
+
+#if defined(__linux__)
+bool EntityArchiveReader::Restore(const std::string& path, const RecordingWriterSettings& settings)
+{
+   RecordingWriterSettings restore = settings;
+   restore.waitForChunks = true;
+
+   RecordingWriter writer;
+   if( !writer.Open( path , restore ) )
+   {
+      _error = writer.GetLastError();
+      return false;
+   }
+
+   RestoreProcessor processor( writer );
+   Process( processor );
+   writer.Close();
+
+   if( writer.GetLastError() != 0 || writer.GetDroppedCount() > 0 )
+   {
+      _error = ( writer.GetLastError() != 0 ) ? writer.GetLastError() : EIO;
+      return false;
+   }
+   return true;
+}
+#endif
+
+unsigned long long EntityArchiveReader::GetRecordCount() const
+{
+   return _header.recordCount;
+}
+
+long long EntityArchiveReader::GetFirstTimestamp() const
+{
+   return _header.firstTimestamp;
+}
+
+long long EntityArchiveReader::GetLastTimestamp() const
+{
+   return _header.lastTimestamp;
+}
+
+size_t EntityArchiveReader::GetSize() const
+{
+   return _size;
+}
+
+int EntityArchiveReader::GetLastError() const
+{
+   return _error;
+}
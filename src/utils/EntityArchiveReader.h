@@ -0,0 +1,104 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_entity_archive_reader_h_
+#define _dcl_dis_entity_archive_reader_h_
+
+#include <utils/EntityArchiveFormat.h>   // for member
+#include <utils/PduView.h>               // for parameter
+#include <utils/MappedFile.h>            // for member
+#include <dis6/msLibMacro.h>            // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <cstddef>                  // for size_t definition
+
+namespace DIS
+{
+   class IPduViewProcessor;
+
+   struct RecordingWriterSettings;
+
+   /// reads a file written by EntityArchiveWriter.
+   /// the columns of a track can be decoded on their own, so that an analysis of the entities' movement
+   /// only reads the bytes of the columns it needs.  Process() rebuilds every PDU, in the recorded order,
+   /// and Restore() writes them back to a recording.
+   /// the file is memory mapped where possible.
+   class EXPORT_MACRO EntityArchiveReader
+   {
+   public:
+      EntityArchiveReader();
+      ~EntityArchiveReader();
+
+      /// map the file and read its header and track directory.
+      /// @return 'false' if the file could not be read or is not an entity archive.  GetLastError() has the errno value.
+      bool Open(const std::string& path);
+
+      void Close();
+      bool IsOpen() const;
+
+      /// @return the number of entity tracks, sorted by entity key.
+      size_t GetTrackCount() const;
+
+      /// @return the index of the entity's track, or GetTrackCount() if it has none.
+      size_t FindTrack(unsigned long long entityKey) const;
+
+      /// @return the description of a track, which must exist.
+      const EntityArchiveTrack& GetTrack(size_t track) const;
+
+      /// decode one column of a track.  the integer columns are the times, the sequence, the template and the appearance.
+      /// @return 'false' if the column is not an integer column, or the track is damaged.
+      bool ReadColumn(size_t track, EntityArchiveColumn column, std::vector<long long>& values) const;
+
+      /// decode one column of a track.  the floating point columns are the location, velocity and orientation.
+      /// @return 'false' if the column is not a floating point column, or the track is damaged.
+      bool ReadColumn(size_t track, EntityArchiveColumn column, std::vector<double>& values) const;
+
+      /// rebuild every PDU and pass it to the processor as worker 0, in the order the PDUs were received.
+      /// @return the number of PDUs passed to the processor.
+      unsigned long long Process(IPduViewProcessor& processor) const;
+
+#if defined(__linux__)
+      /// write every PDU to a recording, waiting for the disk rather than dropping PDUs.
+      /// @return 'false' if the recording could not be written.  GetLastError() has the errno value.
+      bool Restore(const std::string& path, const RecordingWriterSettings& settings);
+#endif
+
+      /// @return the number of PDUs in the archive.
+      unsigned long long GetRecordCount() const;
+
+      /// @return the receive times of the first and last PDUs, in nanoseconds since the epoch.
+      long long GetFirstTimestamp() const;
+      long long GetLastTimestamp() const;
+
+      /// @return the size of the mapped file.
+      size_t GetSize() const;
+
+      int GetLastError() const;
+
+   private:
+      EntityArchiveReader(const EntityArchiveReader&);              ///< not implemented by design
+      EntityArchiveReader& operator=(const EntityArchiveReader&);   ///< not implemented by design
+
+      /// check the header and the directory against the size of the file.
+      bool ReadHeaders();
+
+      /// decode a column into the bits of its values.
+      bool DecodeColumn(size_t track, EntityArchiveColumn column, std::vector<uint64_t>& values) const;
+
+      /// rebuilds the samples of one track, one after another.
+      struct Cursor;
+
+      /// the file, and its contents.
+      MappedFile _file;
+      const char* _data;
+      size_t _size;
+
+      EntityArchiveHeader _header;
+      std::vector<EntityArchiveTrack> _tracks;
+
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_entity_archive_reader_h_
@@ -0,0 +1,300 @@
+#include <utils/EntityArchiveWriter.h>
+#include <utils/RecordingReader.h>
+#include <utils/DeadReckoning.h>
+#include <utils/PDUType.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+using namespace DIS;
+
+namespace
+{
+   uint64_t ReadBig(const char* buf, unsigned int size)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>( buf );
+      uint64_t value = 0;
+      for(unsigned int i=0; i<size; ++i)
+      {
+         value = (value << 8) | bytes[i];
+      }
+      return value;
+   }
+
+   void Append(std::vector<char>& out, const void* data, size_t size)
+   {
+      const char* bytes = static_cast<const char*>( data );
+      out.insert( out.end() , bytes , bytes + size );
+   }
+
+   /// @return 'true' for a single, complete Entity State PDU, which can be split into a template and columns.
+   bool IsSample(const PduView& record)
+   {
+      return( record.length >= ENTITY_STATE_MIN_SIZE && record.length <= 0xffff &&
+              record.GetPduType() == PDU_ENTITY_STATE &&
+              PduHeader::GetLength( record.pdu ) == record.length );
+   }
+}
+
+EntityArchiveWriter::Track::Track()
+   : templates()
+   , current()
+   , pdu()
+   , sampleCount(0)
+   , templateCount(0)
+   , firstTimestamp(0)
+   , lastTimestamp(0)
+{
+}
+
+EntityArchiveWriter::EntityArchiveWriter()
+   : _tracks()
+   , _rows()
+   , _rowCount(0)
+   , _rowSequence()
+   , _rowTime()
+   , _scratch()
+   , _records(0)
+   , _firstTimestamp(0)
+   , _lastTimestamp(0)
+   , _error(0)
+{
+}
+
+void EntityArchiveWriter::Add(const PduView& record)
+{
+   if( record.pdu == NULL )
+   {
+      return;
+   }
+
+   if( IsSample( record ) )
+   {
+      AddSample( record );
+   }
+   else
+   {
+      AddRow( record );
+   }
+
+   if( _records == 0 )
+   {
+      _firstTimestamp = record.timestamp;
+   }
+   _lastTimestamp = record.timestamp;
+   ++_records;
+}
+
+unsigned long long EntityArchiveWriter::Add(RecordingReader& reader)
+{
+   reader.Rewind();
+
+   unsigned long long count = 0;
+   PduView record;
+   while( reader.Next( record ) )
+   {
+      Add( record );
+      ++count;
+   }
+   return count;
+}
+
+void EntityArchiveWriter::AddSample(const PduView& record)
+{
+   Track& track = _tracks[record.GetEntityKey()];
+
+   // everything but the columns goes to the template.
+   _scratch.assign( record.pdu , record.pdu + record.length );
+   for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+   {
+      const EntityArchiveColumn field = static_cast<EntityArchiveColumn>( column );
+      const unsigned int size = GetArchiveFieldSize( field );
+      if( size > 0 )
+      {
+         memset( &_scratch[GetArchiveFieldPosition( field )] , 0 , size );
+      }
+   }
+
+   const bool changed = ( track.templateCount == 0 ||
+                          track.current.sourceAddress != record.sourceAddress ||
+                          track.current.destinationAddress != record.destinationAddress ||
+                          track.current.sourcePort != record.sourcePort ||
+                          track.pdu != _scratch );
+   if( changed )
+   {
+      track.current.sourceAddress = record.sourceAddress;
+      track.current.destinationAddress = record.destinationAddress;
+      track.current.sourcePort = record.sourcePort;
+      track.current.length = static_cast<uint16_t>( record.length );
+      track.pdu.swap( _scratch );
+      Append( track.templates , &track.current , sizeof(track.current) );
+      Append( track.templates , &track.pdu[0] , track.pdu.size() );
+      ++track.templateCount;
+   }
+
+   for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+   {
+      const EntityArchiveColumn field = static_cast<EntityArchiveColumn>( column );
+      uint64_t value = 0;
+      switch( field )
+      {
+      case ARCHIVE_TIME:
+         value = static_cast<uint64_t>( record.timestamp );
+         break;
+      case ARCHIVE_SEQUENCE:
+         value = _records;
+         break;
+      case ARCHIVE_TEMPLATE:
+         value = track.templateCount - 1;
+         break;
+      default:
+         value = ReadBig( record.pdu + GetArchiveFieldPosition( field ) , GetArchiveFieldSize( field ) );
+         break;
+      }
+      PutArchiveValue( track.columns[column] , GetArchiveEncoding( field ) , track.codecs[column] , value );
+   }
+
+   if( track.sampleCount == 0 )
+   {
+      track.firstTimestamp = record.timestamp;
+   }
+   track.lastTimestamp = record.timestamp;
+   ++track.sampleCount;
+}
+
+void EntityArchiveWriter::AddRow(const PduView& record)
+{
+   PutArchiveValue( _rows , ARCHIVE_DELTA , _rowSequence , _records );
+   PutArchiveValue( _rows , ARCHIVE_DELTA , _rowTime , static_cast<uint64_t>( record.timestamp ) );
+
+   EntityArchiveTemplate row;
+   row.sourceAddress = record.sourceAddress;
+   row.destinationAddress = record.destinationAddress;
+   row.sourcePort = record.sourcePort;
+   row.length = static_cast<uint16_t>( record.length > 0xffff ? 0xffff : record.length );
+   Append( _rows , &row , sizeof(row) );
+   Append( _rows , record.pdu , row.length );
+   ++_rowCount;
+}
+
+bool EntityArchiveWriter::Write(const std::string& path)
+{
+   FILE* file = fopen( path.c_str() , "wb" );
+   if( file == NULL )
+   {
+      _error = errno;
+      return false;
+   }
+
+   EntityArchiveHeader header;
+   memset( &header , 0 , sizeof(header) );
+   memcpy( header.magic , ENTITY_ARCHIVE_MAGIC , sizeof(header.magic) );
+   header.trackCount = static_cast<uint32_t>( _tracks.size() );
+   header.recordCount = _records;
+   header.rowCount = _rowCount;
+   header.rowsLength = _rows.size();
+   header.firstTimestamp = _firstTimestamp;
+   header.lastTimestamp = _lastTimestamp;
+
+   // the tracks follow the directory, and the rows follow the tracks.
+   std::vector<EntityArchiveTrack> directory;
+   directory.reserve( _tracks.size() );
+   uint64_t offset = sizeof(header) + _tracks.size() * sizeof(EntityArchiveTrack);
+   for(std::map<unsigned long long, Track>::const_iterator iter=_tracks.begin(); iter!=_tracks.end(); ++iter)
+   {
+      const Track& track = iter->second;
+      EntityArchiveTrack entry;
+      memset( &entry , 0 , sizeof(entry) );
+      entry.entityKey = iter->first;
+      entry.offset = offset;
+      entry.sampleCount = track.sampleCount;
+      entry.templateCount = track.templateCount;
+      entry.firstTimestamp = track.firstTimestamp;
+      entry.lastTimestamp = track.lastTimestamp;
+
+      uint32_t length = static_cast<uint32_t>( track.templates.size() );
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         entry.columns[column] = length;
+         length += static_cast<uint32_t>( track.columns[column].size() );
+      }
+      entry.columns[ARCHIVE_COLUMN_COUNT] = length;
+
+      directory.push_back( entry );
+      offset += length;
+   }
+   header.rowsOffset = offset;
+
+   bool written = ( fwrite( &header , sizeof(header) , 1 , file ) == 1 );
+   if( written && !directory.empty() )
+   {
+      written = ( fwrite( &directory[0] , sizeof(EntityArchiveTrack) , directory.size() , file ) == directory.size() );
+   }
+   for(std::map<unsigned long long, Track>::const_iterator iter=_tracks.begin(); written && iter!=_tracks.end(); ++iter)
+   {
+      const Track& track = iter->second;
+      written = ( fwrite( &track.templates[0] , 1 , track.templates.size() , file ) == track.templates.size() );
+      for(unsigned int column=0; written && column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         const std::vector<char>& values = track.columns[column];
+         written = ( fwrite( &values[0] , 1 , values.size() , file ) == values.size() );
+      }
+   }
+   if( written && !_rows.empty() )
+   {
+      written = ( fwrite( &_rows[0] , 1 , _rows.size() , file ) == _rows.size() );
+   }
+
+   if( !written )
+   {
+      _error = errno;
+   }
+   if( fclose( file ) != 0 && written )
+   {
+      _error = errno;
+      written = false;
+   }
+   return written;
+}
+
+void EntityArchiveWriter::Clear()
+{
+   _tracks.clear();
+   _rows.clear();
+   _rowCount = 0;
+   _rowSequence = EntityArchiveCodec();
+   _rowTime = EntityArchiveCodec();
+   _records = 0;
+   _firstTimestamp = 0;
+   _lastTimestamp = 0;
+}
+
+unsigned long long EntityArchiveWriter::GetRecordCount() const
+{
+   return _records;
+}
+
+size_t EntityArchiveWriter::GetTrackCount() const
+{
+   return _tracks.size();
+}
+
+unsigned long long EntityArchiveWriter::GetArchiveSize() const
+{
+   unsigned long long size = sizeof(EntityArchiveHeader) + _tracks.size() * sizeof(EntityArchiveTrack) + _rows.size();
+   for(std::map<unsigned long long, Track>::const_iterator iter=_tracks.begin(); iter!=_tracks.end(); ++iter)
+   {
+      size += iter->second.templates.size();
+      for(unsigned int column=0; column<ARCHIVE_COLUMN_COUNT; ++column)
+      {
+         size += iter->second.columns[column].size();
+      }
+   }
+   return size;
+}
+
+int EntityArchiveWriter::GetLastError() const
+{
+   return _error;
+}
@@ -0,0 +1,99 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_entity_archive_writer_h_
+#define _dcl_dis_entity_archive_writer_h_
+
+#include <utils/EntityArchiveFormat.h>   // for member
+#include <utils/PduView.h>               // for parameter
+#include <dis6/msLibMacro.h>            // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <map>                      // for member
+
+namespace DIS
+{
+   class RecordingReader;
+
+   /// converts a stream of PDUs, such as a recording, to the columnar entity archive described by EntityArchiveFormat.h.
+   /// the Entity State PDUs are split into one track per entity, which keeps the location, velocity, orientation,
+   /// appearance and times as delta and XOR encoded columns, and the rest of the PDU once.
+   /// a steady heartbeat of an entity then costs a few bytes per PDU rather than the whole PDU.
+   /// the archive is built in memory, already encoded, and written by Write().
+   class EXPORT_MACRO EntityArchiveWriter
+   {
+   public:
+      EntityArchiveWriter();
+
+      /// add the next PDU, in the order the PDUs were received.
+      void Add(const PduView& record);
+
+      /// add every PDU of the recording, from its start.
+      /// @return the number of PDUs added.
+      unsigned long long Add(RecordingReader& reader);
+
+      /// write the archive of every PDU added so far.
+      /// @return 'false' if the file could not be written.  GetLastError() has the errno value.
+      bool Write(const std::string& path);
+
+      /// forget every PDU added.
+      void Clear();
+
+      /// @return the number of PDUs added.
+      unsigned long long GetRecordCount() const;
+
+      /// @return the number of entity tracks.
+      size_t GetTrackCount() const;
+
+      /// @return the size of the archive Write() would write.
+      unsigned long long GetArchiveSize() const;
+
+      int GetLastError() const;
+
+   private:
+      EntityArchiveWriter(const EntityArchiveWriter&);              ///< not implemented by design
+      EntityArchiveWriter& operator=(const EntityArchiveWriter&);   ///< not implemented by design
+
+      /// the encoded columns and templates of one entity.
+      struct Track
+      {
+         Track();
+
+         std::vector<char> templates;
+         std::vector<char> columns[ARCHIVE_COLUMN_COUNT];
+         EntityArchiveCodec codecs[ARCHIVE_COLUMN_COUNT];
+
+         /// the current template, with the column fields set to 0.
+         EntityArchiveTemplate current;
+         std::vector<char> pdu;
+
+         uint32_t sampleCount;
+         uint32_t templateCount;
+         long long firstTimestamp;
+         long long lastTimestamp;
+      };
+
+      /// add an Entity State PDU to the track of its entity.
+      void AddSample(const PduView& record);
+
+      /// add any other PDU to the row section.
+      void AddRow(const PduView& record);
+
+      std::map<unsigned long long, Track> _tracks;
+      std::vector<char> _rows;
+      unsigned long long _rowCount;
+      EntityArchiveCodec _rowSequence;
+      EntityArchiveCodec _rowTime;
+
+      /// the template of the PDU being added, reused for every PDU.
+      std::vector<char> _scratch;
+
+      unsigned long long _records;
+      long long _firstTimestamp;
+      long long _lastTimestamp;
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_entity_archive_writer_h_
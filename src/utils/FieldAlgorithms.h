@@ -0,0 +1,558 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_field_algorithms_h_
+#define _dcl_dis_field_algorithms_h_
+
+#include <utils/FieldVisitor.h>   // for FieldArray
+#include <cmath>                  // for std::isfinite
+#include <cstring>                // for memcmp
+#include <ostream>                // for parameter
+#include <string>                 // for member
+#include <type_traits>            // for std::is_class
+#include <vector>                 // for parameter
+
+/// algorithms written once for every PDU and record, on the VisitFields() templates of dis6/Fields.h or
+/// dis7/Fields.h, which must be included before these algorithms are called.
+/// the primitive fields are compared and hashed bit for bit, as they are marshalled,
+/// so two records are equal when they marshal to the same bytes.
+namespace DIS
+{
+   /// a primitive field of the marshalled layout of a record, as listed by GetFieldOffsets().
+   struct FieldOffset
+   {
+      /// the names of the records leading to the field, and of the field, such as
+      /// "entityLocation.x" or "articulationParameters[1].parameterValue".
+      std::string path;
+
+      /// the position of the field from the start of the record, and its bytes.
+      unsigned int offset;
+      unsigned int size;
+   };
+
+   /// @return 'true' if the primitive values have different bits.
+   template<typename T>
+   bool FieldBitsDiffer(const T& a, const T& b)
+   {
+      return memcmp( &a , &b , sizeof(T) ) != 0;
+   }
+
+   /// compares two records of a class, the lists and arrays element by element.
+   class FieldsEqualVisitor
+   {
+   public:
+      FieldsEqualVisitor()
+         : _equal(true)
+      {
+      }
+
+      bool IsEqual() const
+      {
+         return _equal;
+      }
+
+      template<typename T>
+      void Field(const char* /*name*/, const T& a, const T& b)
+      {
+         Compare( a , b , std::is_class<T>() );
+      }
+
+      template<typename T>
+      void Count(const char* /*name*/, const char* /*list*/, const T& a, const T& b)
+      {
+         Compare( a , b , std::false_type() );
+      }
+
+      template<typename T>
+      void List(const char* /*name*/, const std::vector<T>& a, const std::vector<T>& b)
+      {
+         if( a.size() != b.size() )
+         {
+            _equal = false;
+         }
+         for(size_t i=0; _equal && i<a.size(); ++i)
+         {
+            VisitFields( *this , a[i] , b[i] );
+         }
+      }
+
+      template<typename T>
+      void Array(const char* /*name*/, const FieldArray<T>& a, const FieldArray<T>& b)
+      {
+         if( a.count != b.count || ( a.count > 0 && memcmp( a.elements , b.elements , a.count * sizeof(T) ) != 0 ) )
+         {
+            _equal = false;
+         }
+      }
+
+   private:
+      template<typename T>
+      void Compare(const T& a, const T& b, std::true_type /*record*/)
+      {
+         if( _equal )
+         {
+            VisitFields( *this , a , b );
+         }
+      }
+
+      template<typename T>
+      void Compare(const T& a, const T& b, std::false_type /*primitive*/)
+      {
+         if( FieldBitsDiffer( a , b ) )
+         {
+            _equal = false;
+         }
+      }
+
+      bool _equal;
+   };
+
+   /// hashes the bytes of the fields with 64 bit FNV-1a, and the sizes of the lists.
+   class FieldsHashVisitor
+   {
+   public:
+      FieldsHashVisitor()
+         : _hash(14695981039346656037ull)
+      {
+      }
+
+      unsigned long long GetHash() const
+      {
+         return _hash;
+      }
+
+      template<typename T>
+      void Field(const char* /*name*/, const T& value)
+      {
+         Add( value , std::is_class<T>() );
+      }
+
+      template<typename T>
+      void Count(const char* /*name*/, const char* /*list*/, const T& value)
+      {
+         Add( value , std::false_type() );
+      }
+
+      template<typename T>
+      void List(const char* /*name*/, const std::vector<T>& elements)
+      {
+         AddBytes( elements.size() );
+         for(size_t i=0; i<elements.size(); ++i)
+         {
+            VisitFields( *this , elements[i] );
+         }
+      }
+
+      template<typename T>
+      void Array(const char* /*name*/, const FieldArray<T>& array)
+      {
+         for(unsigned int i=0; i<array.count; ++i)
+         {
+            AddBytes( array.elements[i] );
+         }
+      }
+
+   private:
+      template<typename T>
+      void Add(const T& value, std::true_type /*record*/)
+      {
+         VisitFields( *this , value );
+      }
+
+      template<typename T>
+      void Add(const T& value, std::false_type /*primitive*/)
+      {
+         AddBytes( value );
+      }
+
+      template<typename T>
+      void AddBytes(const T& value)
+      {
+         const unsigned char* bytes = reinterpret_cast<const unsigned char*>( &value );
+         for(size_t i=0; i<sizeof(T); ++i)
+         {
+            _hash ^= bytes[i];
+            _hash *= 1099511628211ull;
+         }
+      }
+
+      unsigned long long _hash;
+   };
+
+   /// the base of the visitors naming the fields with their path from the visited record.
+   class FieldPathVisitor
+   {
+   protected:
+      /// append the name to the path of the records entered, for the duration of the scope.
+      class Enter
+      {
+      public:
+         Enter(std::string& path, const char* name)
+            : _path(path)
+            , _length(path.size())
+         {
+            _path += name;
+            _path += '.';
+         }
+
+         Enter(std::string& path, const char* name, size_t index)
+            : _path(path)
+            , _length(path.size())
+         {
+            _path += name;
+            _path += '[';
+            _path += std::to_string( index );
+            _path += "].";
+         }
+
+         ~Enter()
+         {
+            _path.resize( _length );
+         }
+
+      private:
+         Enter(const Enter&);              ///< not implemented by design
+         Enter& operator=(const Enter&);   ///< not implemented by design
+
+         std::string& _path;
+         size_t _length;
+      };
+
+      std::string GetPath(const char* name) const
+      {
+         return _path + name;
+      }
+
+      /// the names of the records entered, each followed by a dot.
+      std::string _path;
+   };
+
+   /// lists the paths of the fields that differ between two records of a class.
+   /// a list of a different size is listed once, by its name, rather than by its elements.
+   class FieldsDiffVisitor : public FieldPathVisitor
+   {
+   public:
+      FieldsDiffVisitor(std::vector<std::string>& paths)
+         : _paths(paths)
+      {
+      }
+
+      template<typename T>
+      void Field(const char* name, const T& a, const T& b)
+      {
+         Compare( name , a , b , std::is_class<T>() );
+      }
+
+      template<typename T>
+      void Count(const char* name, const char* /*list*/, const T& a, const T& b)
+      {
+         Compare( name , a , b , std::false_type() );
+      }
+
+      template<typename T>
+      void List(const char* name, const std::vector<T>& a, const std::vector<T>& b)
+      {
+         if( a.size() != b.size() )
+         {
+            _paths.push_back( GetPath( name ) );
+            return;
+         }
+         for(size_t i=0; i<a.size(); ++i)
+         {
+            Enter element( _path , name , i );
+            VisitFields( *this , a[i] , b[i] );
+         }
+      }
+
+      template<typename T>
+      void Array(const char* name, const FieldArray<T>& a, const FieldArray<T>& b)
+      {
+         if( a.count != b.count || ( a.count > 0 && memcmp( a.elements , b.elements , a.count * sizeof(T) ) != 0 ) )
+         {
+            _paths.push_back( GetPath( name ) );
+         }
+      }
+
+   private:
+      FieldsDiffVisitor(const FieldsDiffVisitor&);              ///< not implemented by design
+      FieldsDiffVisitor& operator=(const FieldsDiffVisitor&);   ///< not implemented by design
+
+      template<typename T>
+      void Compare(const char* name, const T& a, const T& b, std::true_type /*record*/)
+      {
+         Enter record( _path , name );
+         VisitFields( *this , a , b );
+      }
+
+      template<typename T>
+      void Compare(const char* name, const T& a, const T& b, std::false_type /*primitive*/)
+      {
+         if( FieldBitsDiffer( a , b ) )
+         {
+            _paths.push_back( GetPath( name ) );
+         }
+      }
+
+      std::vector<std::string>& _paths;
+   };
+
+   /// lists the offset and size of each primitive field, from the start of the record, as it is marshalled.
+   class FieldOffsetsVisitor : public FieldPathVisitor
+   {
+   public:
+      FieldOffsetsVisitor(std::vector<FieldOffset>& offsets)
+         : _offsets(offsets)
+         , _offset(0)
+      {
+      }
+
+      /// @return the bytes of the fields visited, which is the marshalled size of the record.
+      unsigned int GetSize() const
+      {
+         return _offset;
+      }
+
+      template<typename T>
+      void Field(const char* name, const T& value)
+      {
+         Add( name , value , std::is_class<T>() );
+      }
+
+      template<typename T>
+      void Count(const char* name, const char* /*list*/, const T& value)
+      {
+         Add( name , value , std::false_type() );
+      }
+
+      template<typename T>
+      void List(const char* name, const std::vector<T>& elements)
+      {
+         for(size_t i=0; i<elements.size(); ++i)
+         {
+            Enter element( _path , name , i );
+            VisitFields( *this , elements[i] );
+         }
+      }
+
+      template<typename T>
+      void Array(const char* name, const FieldArray<T>& array)
+      {
+         Push( name , array.count * sizeof(T) );
+      }
+
+   private:
+      FieldOffsetsVisitor(const FieldOffsetsVisitor&);              ///< not implemented by design
+      FieldOffsetsVisitor& operator=(const FieldOffsetsVisitor&);   ///< not implemented by design
+
+      template<typename T>
+      void Add(const char* name, const T& value, std::true_type /*record*/)
+      {
+         Enter record( _path , name );
+         VisitFields( *this , value );
+      }
+
+      template<typename T>
+      void Add(const char* name, const T& /*value*/, std::false_type /*primitive*/)
+      {
+         Push( name , sizeof(T) );
+      }
+
+      void Push(const char* name, size_t size)
+      {
+         FieldOffset field;
+         field.path = GetPath( name );
+         field.offset = _offset;
+         field.size = static_cast<unsigned int>( size );
+         _offsets.push_back( field );
+         _offset += field.size;
+      }
+
+      std::vector<FieldOffset>& _offsets;
+      unsigned int _offset;
+   };
+
+   /// writes a record as a JSON object, its records as nested objects, and its lists and arrays as JSON arrays.
+   /// the characters are written as numbers, and the floating point values that are not finite as null.
+   class FieldsJsonVisitor
+   {
+   public:
+      FieldsJsonVisitor(std::ostream& os)
+         : _os(os)
+         , _first(true)
+      {
+      }
+
+      template<typename T>
+      void Field(const char* name, const T& value)
+      {
+         Name( name );
+         Write( value , std::is_class<T>() );
+      }
+
+      template<typename T>
+      void Count(const char* name, const char* /*list*/, const T& value)
+      {
+         Name( name );
+         Write( value , std::false_type() );
+      }
+
+      template<typename T>
+      void List(const char* name, const std::vector<T>& elements)
+      {
+         Name( name );
+         _os << '[';
+         for(size_t i=0; i<elements.size(); ++i)
+         {
+            if( i > 0 )
+            {
+               _os << ',';
+            }
+            Write( elements[i] , std::true_type() );
+         }
+         _os << ']';
+      }
+
+      template<typename T>
+      void Array(const char* name, const FieldArray<T>& array)
+      {
+         Name( name );
+         _os << '[';
+         for(unsigned int i=0; i<array.count; ++i)
+         {
+            if( i > 0 )
+            {
+               _os << ',';
+            }
+            WriteNumber( array.elements[i] );
+         }
+         _os << ']';
+      }
+
+      /// write the record as an object.
+      template<typename T>
+      void Write(const T& record, std::true_type /*record*/)
+      {
+         _os << '{';
+         _first = true;
+         VisitFields( *this , record );
+         _os << '}';
+         _first = false;
+      }
+
+   private:
+      FieldsJsonVisitor(const FieldsJsonVisitor&);              ///< not implemented by design
+      FieldsJsonVisitor& operator=(const FieldsJsonVisitor&);   ///< not implemented by design
+
+      void Name(const char* name)
+      {
+         if( !_first )
+         {
+            _os << ',';
+         }
+         _first = false;
+         _os << '"' << name << "\":";
+      }
+
+      template<typename T>
+      void Write(const T& value, std::false_type /*primitive*/)
+      {
+         WriteNumber( value );
+      }
+
+      template<typename T>
+      void WriteNumber(T value)
+      {
+         _os << value;
+      }
+
+      void WriteNumber(char value)
+      {
+         _os << static_cast<int>( value );
+      }
+
+      void WriteNumber(signed char value)
+      {
+         _os << static_cast<int>( value );
+      }
+
+      void WriteNumber(unsigned char value)
+      {
+         _os << static_cast<unsigned int>( value );
+      }
+
+      void WriteNumber(float value)
+      {
+         WriteFloatingPoint( value , 9 );
+      }
+
+      void WriteNumber(double value)
+      {
+         WriteFloatingPoint( value , 17 );
+      }
+
+      /// @param precision the significant digits that read back the same value.
+      void WriteFloatingPoint(double value, std::streamsize precision)
+      {
+         if( !std::isfinite( value ) )
+         {
+            _os << "null";
+            return;
+         }
+         const std::streamsize previous = _os.precision( precision );
+         _os << value;
+         _os.precision( previous );
+      }
+
+      std::ostream& _os;
+
+      /// 'true' until the first field of the object being written.
+      bool _first;
+   };
+
+   /// @return 'true' if the records marshal to the same bytes.
+   /// unlike the generated operator==, the lists of different sizes are never equal.
+   template<typename T>
+   bool FieldsEqual(const T& a, const T& b)
+   {
+      FieldsEqualVisitor visitor;
+      VisitFields( visitor , a , b );
+      return visitor.IsEqual();
+   }
+
+   /// @return a hash of the marshalled fields, the same for records that are FieldsEqual().
+   template<typename T>
+   unsigned long long HashFields(const T& r)
+   {
+      FieldsHashVisitor visitor;
+      VisitFields( visitor , r );
+      return visitor.GetHash();
+   }
+
+   /// append the paths of the fields that differ between the records to the container.
+   template<typename T>
+   void DiffFields(const T& a, const T& b, std::vector<std::string>& paths)
+   {
+      FieldsDiffVisitor visitor( paths );
+      VisitFields( visitor , a , b );
+   }
+
+   /// append the primitive fields of the record, as they are marshalled, to the container.
+   /// @return the marshalled size of the record.
+   template<typename T>
+   unsigned int GetFieldOffsets(const T& r, std::vector<FieldOffset>& offsets)
+   {
+      FieldOffsetsVisitor visitor( offsets );
+      VisitFields( visitor , r );
+      return visitor.GetSize();
+   }
+
+   /// write the record as a JSON object.
+   template<typename T>
+   void WriteFieldsJson(std::ostream& os, const T& r)
+   {
+      FieldsJsonVisitor visitor( os );
+      visitor.Write( r , std::true_type() );
+   }
+}
+
+#endif  // _dcl_dis_field_algorithms_h_
@@ -0,0 +1,44 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_field_visitor_h_
+#define _dcl_dis_field_visitor_h_
+
+namespace DIS
+{
+   /// the fields of the PDUs and records are described by the VisitFields() templates generated in
+   /// dis6/Fields.h and dis7/Fields.h, in the order they are marshalled.  VisitFields(v, r, others...)
+   /// visits the fields of the base class first, then calls the visitor once for each field of r,
+   /// passing the same field of each of the other records of the class, so that records can be compared
+   /// without copying their fields:
+   ///
+   ///    v.Field(name, value, values...)       a field of a primitive type, or a record to visit in turn
+   ///    v.Count(name, list, value, values...)  the number of elements of the list, as it is marshalled
+   ///    v.List(name, elements, elements...)   a variable length list of records, as a std::vector
+   ///    v.Array(name, array, arrays...)       a fixed length array of a primitive type, as a FieldArray
+   ///
+   /// the names are those of the members, without the underscore.  generic algorithms on the visitors
+   /// are written once, in utils/FieldAlgorithms.h.
+
+   /// the elements of an array field, which belong to the record.
+   template<typename T>
+   struct FieldArray
+   {
+      FieldArray(const T* e, unsigned int c)
+         : elements(e)
+         , count(c)
+      {
+      }
+
+      const T* elements;
+      unsigned int count;
+   };
+
+   template<typename T>
+   FieldArray<T> MakeFieldArray(const T* elements, unsigned int count)
+   {
+      return FieldArray<T>( elements , count );
+   }
+}
+
+#endif  // _dcl_dis_field_visitor_h_
@@ -0,0 +1,227 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_histogram_h_
+#define _dcl_dis_histogram_h_
+
+#include <vector>                   // for member
+#include <cstddef>                  // for size_t definition
+
+namespace DIS
+{
+   /// a log-linear histogram of unsigned values, such as latencies in nanoseconds.
+   /// every power of 2 is split into SUB_BUCKETS equal buckets, so that any value is
+   /// counted in a bucket no wider than 1/SUB_BUCKETS of the value, about 1.6%, whatever
+   /// its magnitude.  values below SUB_BUCKETS are counted exactly.
+   /// recording is a few instructions and never allocates, so it can be done on a hot path.
+   /// it is not thread safe: keep one histogram per thread, and Merge() them to report.
+   class Histogram
+   {
+   public:
+      /// the number of buckets of each power of 2, a power of 2 itself.
+      static const unsigned int SUB_BUCKET_BITS = 6;
+      static const unsigned int SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+
+      /// enough buckets for every 64 bit value.
+      static const size_t BUCKET_COUNT = SUB_BUCKETS + ( 64 - SUB_BUCKET_BITS ) * SUB_BUCKETS;
+
+      Histogram()
+         : _counts(BUCKET_COUNT, 0)
+         , _count(0)
+         , _min(0)
+         , _max(0)
+         , _sum(0)
+      {
+      }
+
+      void Record(unsigned long long value)
+      {
+         Record( value , 1 );
+      }
+
+      /// count the value a number of times.
+      void Record(unsigned long long value, unsigned long long count)
+      {
+         if( count == 0 )
+         {
+            return;
+         }
+
+         _counts[GetBucket( value )] += count;
+         if( _count == 0 || value < _min )
+         {
+            _min = value;
+         }
+         if( value > _max )
+         {
+            _max = value;
+         }
+         _count += count;
+         _sum += static_cast<double>( value ) * count;
+      }
+
+      /// add the counts of another histogram.
+      void Merge(const Histogram& other)
+      {
+         if( other._count == 0 )
+         {
+            return;
+         }
+
+         for(size_t i=0; i<BUCKET_COUNT; ++i)
+         {
+            _counts[i] += other._counts[i];
+         }
+         if( _count == 0 || other._min < _min )
+         {
+            _min = other._min;
+         }
+         if( other._max > _max )
+         {
+            _max = other._max;
+         }
+         _count += other._count;
+         _sum += other._sum;
+      }
+
+      void Reset()
+      {
+         _counts.assign( BUCKET_COUNT , 0 );
+         _count = 0;
+         _min = 0;
+         _max = 0;
+         _sum = 0;
+      }
+
+      /// @return the number of values recorded.
+      unsigned long long GetCount() const
+      {
+         return _count;
+      }
+
+      /// @return the smallest and largest values recorded, exactly.  0 when empty.
+      unsigned long long GetMin() const
+      {
+         return _min;
+      }
+
+      unsigned long long GetMax() const
+      {
+         return _max;
+      }
+
+      /// @return the average of the values recorded.  0 when empty.
+      double GetMean() const
+      {
+         return( _count == 0 ) ? 0.0 : _sum / _count;
+      }
+
+      /// @param percentile from 0 to 100, such as 99.9.
+      /// @return the value below or at which the percentile of the values fall, to the width of a bucket.
+      /// the largest value of the bucket is reported, never more than the largest value recorded.  0 when empty.
+      unsigned long long GetPercentile(double percentile) const
+      {
+         if( _count == 0 )
+         {
+            return 0;
+         }
+
+         // the rank of the value, counting from 1.  a percentile such as 99.9 is not exact
+         // in binary, so a rank within rounding of a whole number is taken as that number.
+         const double wanted = percentile * _count / 100.0;
+         unsigned long long rank = static_cast<unsigned long long>( wanted + 0.5 );
+         if( wanted - rank > 1e-9 * _count || rank == 0 )
+         {
+            ++rank;
+         }
+         if( rank > _count )
+         {
+            rank = _count;
+         }
+
+         unsigned long long seen = 0;
+         for(size_t i=0; i<BUCKET_COUNT; ++i)
+         {
+            seen += _counts[i];
+            if( seen >= rank )
+            {
+               const unsigned long long highest = GetBucketHighest( i );
+               if( highest < _min )
+               {
+                  return _min;
+               }
+               return( highest < _max ) ? highest : _max;
+            }
+         }
+         return _max;
+      }
+
+      /// @return the bucket counting the value.
+      static size_t GetBucket(unsigned long long value)
+      {
+         if( value < SUB_BUCKETS )
+         {
+            return static_cast<size_t>( value );
+         }
+
+         // the power of 2 of the value selects the group of buckets, the bits below the top bit the bucket.
+         const unsigned int magnitude = HighestBit( value );
+         const unsigned int shift = magnitude - SUB_BUCKET_BITS;
+         const size_t sub = static_cast<size_t>( ( value >> shift ) - SUB_BUCKETS );
+         return SUB_BUCKETS + static_cast<size_t>( shift ) * SUB_BUCKETS + sub;
+      }
+
+      /// @return the smallest value counted by the bucket.
+      static unsigned long long GetBucketLowest(size_t bucket)
+      {
+         if( bucket < SUB_BUCKETS )
+         {
+            return bucket;
+         }
+
+         const unsigned int shift = static_cast<unsigned int>( ( bucket - SUB_BUCKETS ) / SUB_BUCKETS );
+         const unsigned long long sub = ( bucket - SUB_BUCKETS ) % SUB_BUCKETS;
+         return ( SUB_BUCKETS + sub ) << shift;
+      }
+
+      /// @return the largest value counted by the bucket.
+      static unsigned long long GetBucketHighest(size_t bucket)
+      {
+         if( bucket + 1 >= BUCKET_COUNT )
+         {
+            return ~0ull;
+         }
+         return GetBucketLowest( bucket + 1 ) - 1;
+      }
+
+      /// @return the number of values counted by the bucket.
+      unsigned long long GetBucketCount(size_t bucket) const
+      {
+         return _counts[bucket];
+      }
+
+   private:
+      /// @return the position of the highest set bit, of a value that is not 0.
+      static unsigned int HighestBit(unsigned long long value)
+      {
+#if defined(__GNUC__)
+         return 63 - static_cast<unsigned int>( __builtin_clzll( value ) );
+#else
+         unsigned int bit = 0;
+         while( value >>= 1 )
+         {
+            ++bit;
+         }
+         return bit;
+#endif
+      }
+
+      std::vector<unsigned long long> _counts;
+      unsigned long long _count;
+      unsigned long long _min;
+      unsigned long long _max;
+      double _sum;
+   };
+}
+
+#endif  // _dcl_dis_histogram_h_
@@ -6,6 +6,7 @@
 #define _dcl_dis_i_buffer_processor_h_
 
 #include <utils/Endian.h>
+#include <utils/ReceiveContext.h>
 
 namespace DIS
 {
@@ -15,6 +16,19 @@ namespace DIS
    public:
       virtual ~IBufferProcessor() {}
       virtual void Process(const char* buf, unsigned int size, Endian e)=0;
+
+      /// override to also receive the details of the datagram.
+      /// the default ignores the context.
+      virtual void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& /*context*/)
+      {
+         Process( buf , size , e );
+      }
+
+      /// called by a transport after each batch of datagrams read from the socket,
+      /// such as to hand the batch on to other threads.  the default does nothing.
+      virtual void EndBatch()
+      {
+      }
    };
 }
 
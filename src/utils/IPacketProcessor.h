@@ -5,6 +5,8 @@
 #ifndef _dcl_dis_i_packet_processor_h_
 #define _dcl_dis_i_packet_processor_h_
 
+#include <utils/ReceiveContext.h>
+
 namespace DIS
 {
    class Pdu;
@@ -16,6 +18,13 @@ namespace DIS
    public:
       virtual ~IPacketProcessor() {}
       virtual void Process(const Pdu& p)=0;
+
+      /// override to also receive the details of the datagram holding the PDU.
+      /// the default ignores the context.
+      virtual void Process(const Pdu& p, const ReceiveContext& /*context*/)
+      {
+         Process( p );
+      }
    };
 
 }
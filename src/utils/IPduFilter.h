@@ -0,0 +1,26 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_i_pdu_filter_h_
+#define _dcl_dis_i_pdu_filter_h_
+
+#include <utils/ReceiveContext.h>
+
+namespace DIS
+{
+   /// decides whether a PDU will be decoded and processed.
+   /// filters run before the PDU is unmarshalled, so rejecting a PDU only costs the inspection.
+   class IPduFilter
+   {
+   public:
+      virtual ~IPduFilter() {}
+
+      /// @param buf the PDU bytes, starting with the PDU header.
+      /// @param length the number of bytes in the PDU, as stated by its header.
+      /// @param context the details of the datagram holding the PDU.
+      /// @return 'false' to skip the PDU.
+      virtual bool Accept(const char* buf, unsigned int length, const ReceiveContext& context)=0;
+   };
+}
+
+#endif  // _dcl_dis_i_pdu_filter_h_
@@ -0,0 +1,25 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_i_pdu_view_processor_h_
+#define _dcl_dis_i_pdu_view_processor_h_
+
+#include <utils/PduView.h>
+
+namespace DIS
+{
+   /// the interface class for handling PDU views, such as those of a recording scan.
+   /// a parallel scan calls Process from several threads at once, each with its own worker number,
+   /// so that implementations can keep one accumulator per worker instead of locking.
+   class IPduViewProcessor
+   {
+   public:
+      virtual ~IPduViewProcessor() {}
+
+      /// @param view the PDU, valid only during the call.
+      /// @param worker the number of the calling worker, from 0 to the worker count - 1.
+      virtual void Process(const PduView& view, unsigned int worker)=0;
+   };
+}
+
+#endif  // _dcl_dis_i_pdu_view_processor_h_
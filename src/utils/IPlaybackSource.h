@@ -0,0 +1,30 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_i_playback_source_h_
+#define _dcl_dis_i_playback_source_h_
+
+#include <utils/ReceiveContext.h>
+
+namespace DIS
+{
+   /// the interface class for reading recorded traffic in the order it was received,
+   /// such as a recording or a packet capture, so that it can be played back.
+   class IPlaybackSource
+   {
+   public:
+      virtual ~IPlaybackSource() {}
+
+      /// read the next buffer.  the buffer remains valid until the source is closed.
+      /// @param context is given the addresses and the receive time of the buffer.
+      /// @return 'false' at the end of the source.
+      virtual bool Read(const char*& buf, unsigned int& size, ReceiveContext& context)=0;
+
+      /// go to the first buffer received at or after the time.
+      /// @param timestamp the receive time, in nanoseconds since the epoch.
+      /// @return 'false' if every buffer was received before the time.
+      virtual bool Seek(long long timestamp)=0;
+   };
+}
+
+#endif  // _dcl_dis_i_playback_source_h_
@@ -1,45 +1,178 @@
 #include <utils/IncomingMessage.h>
 #include <utils/IPacketProcessor.h>
+#include <utils/IPduFilter.h>
 #include <dis6/Pdu.h>
 #include <utils/DataStream.h>
 #include <utils/PDUBank.h>
+#include <utils/PduHeader.h>
+#include <utils/ProcessorExecutor.h>
+#include <utils/Profiler.h>
+#include <utils/Tracepoints.h>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <exception>
 
 #include <dis6/EntityStatePdu.h>
 
-#include <iostream>
-
 using namespace DIS;
 
-// the DIS specification says the type is known for all PDUs at the 3rd byte of the PDU buffer.
-const unsigned int PDU_TYPE_POSITION = 2;
+/// the tracepoints of the receive path:
+///   datagram(size, source address, source port), on each buffer processed.
+///   header(pdu type, length, entity key, offset), on each PDU header read.
+///   unmarshal_begin(pdu type, length, entity key) and
+///   unmarshal_end(pdu type, bytes read, entity key, 1 if decoded or 0), around each decoding.
+///   dispatch(pdu type, length, entity key, processor), before each processor call.
+/// the entity key packs the site, application and entity numbers as PduHeader::GetEntityKey does.
+DIS_TRACEPOINT_SEMAPHORE(datagram)
+DIS_TRACEPOINT_SEMAPHORE(header)
+DIS_TRACEPOINT_SEMAPHORE(unmarshal_begin)
+DIS_TRACEPOINT_SEMAPHORE(unmarshal_end)
+DIS_TRACEPOINT_SEMAPHORE(dispatch)
+
+namespace
+{
+   long long Now()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+   }
+
+   /// @return 'true' when a tool is attached to a tracepoint carrying the entity key.
+   bool TracingEntities()
+   {
+      return DIS_TRACEPOINT_ENABLED(header) || DIS_TRACEPOINT_ENABLED(unmarshal_begin) ||
+             DIS_TRACEPOINT_ENABLED(unmarshal_end) || DIS_TRACEPOINT_ENABLED(dispatch);
+   }
+}
+
+IncomingStatistics::IncomingStatistics()
+   : buffers(0)
+   , bytes(0)
+   , types(PDU_TYPE_COUNT)
+   , processors()
+{
+}
 
 IncomingMessage::IncomingMessage()
-: _processors(), _pduBanks()
+: _processors(), _pduBanks(), _filters(), _executor(NULL), _timing(false), _buffers(), _bytes()
 {
 }
 
 IncomingMessage::~IncomingMessage()
 {
+   for(unsigned int type=0; type<PDU_TYPE_COUNT; ++type)
+   {
+      for(size_t i=0; i<_processorCounters[type].size(); ++i)
+      {
+         delete _processorCounters[type][i];
+      }
+   }
 }
 
 void IncomingMessage::Process(const char* buf, unsigned int size, Endian e)
+{
+   Process( buf , size , e , ReceiveContext() );
+}
+
+void IncomingMessage::Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context)
 {
    if( size < 1 )
    {
       return;
    }
 
+   DIS_TRACEPOINT3( datagram , size , context.sourceAddress , context.sourcePort );
+
    DataStream ds( buf , size , e );
+   _buffers.Add( 1 );
+   _bytes.Add( size );
+
+   // the buffer may itself be part of a datagram, so the positions are relative to the context's.
+   ReceiveContext pduContext( context );
+   const unsigned int base_offset = context.pduOffset;
 
    while( ds.GetReadPos() < ds.size() )
    {  
+      const unsigned int offset = static_cast<unsigned int>( ds.GetReadPos() );
+      const unsigned int remaining = size - offset;
+      pduContext.pduOffset = base_offset + offset;
+
+      // a truncated header can not be decoded, and ends the buffer.
+      if( remaining < PDU_HEADER_SIZE )
+      {
+         TypeCounters& truncated = _typeCounters[remaining > PDU_TYPE_POSITION ? static_cast<unsigned char>( ds[PDU_TYPE_POSITION] ) : 0];
+         truncated.pdus.Add( 1 );
+         truncated.bytes.Add( remaining );
+         truncated.decodeFailures.Add( 1 );
+         ds.clear();
+         break;
+      }
+
+      // a PDU that is not decoded is skipped by its length, when the length can be trusted.
       unsigned char pdu_type = ds[PDU_TYPE_POSITION];
-      SwitchOnType( static_cast<DIS::PDUType>(pdu_type), ds );
+      const unsigned int skip_length = PduHeader::GetBundledLength( buf + offset , remaining , e );
+      const unsigned int length = skip_length != 0 ? skip_length : remaining;
+
+      TypeCounters& counters = _typeCounters[pdu_type];
+      counters.pdus.Add( 1 );
+      counters.bytes.Add( length );
+
+      // the executor keeps the updates of each entity in order.
+      unsigned long long entity_key = 0;
+      if( _executor != NULL || TracingEntities() )
+      {
+         entity_key = PduHeader::GetEntityKey( buf + offset , length );
+      }
+      DIS_TRACEPOINT4( header , pdu_type , length , entity_key , pduContext.pduOffset );
+
+      if( _filters.empty() || ApplyFilters( buf + offset , remaining , e , ds , pduContext ) )
+      {
+         SwitchOnType( static_cast<DIS::PDUType>(pdu_type), ds, pduContext, entity_key, skip_length );
+      }
+      else
+      {
+         counters.filtered.Add( 1 );
+      }
+      ++pduContext.pduIndex;
    }
 }
 
-void IncomingMessage::SwitchOnType(DIS::PDUType pdu_type, DataStream& ds)
+bool IncomingMessage::ApplyFilters(const char* pdu, unsigned int remaining, Endian e, DataStream& ds, const ReceiveContext& context)
+{
+   if( remaining < PDU_HEADER_SIZE )
+   {
+      ds.clear();
+      return false;
+   }
+
+   // a malformed length can not be skipped reliably, so the filter sees the rest of the buffer.
+   unsigned int length = PduHeader::GetBundledLength( pdu , remaining , e );
+   const bool valid_length = length != 0;
+   if( !valid_length )
+   {
+      length = remaining;
+   }
+
+   for(PduFilterContainer::iterator iter = _filters.begin(); iter != _filters.end(); ++iter)
+   {
+      if( !(*iter)->Accept( pdu , length , context ) )
+      {
+         if( valid_length )
+         {
+            ds.Skip( length );
+         }
+         else
+         {
+            ds.clear();
+         }
+         return false;
+      }
+   }
+
+   return true;
+}
+
+void IncomingMessage::SwitchOnType(DIS::PDUType pdu_type, DataStream& ds, const ReceiveContext& context, unsigned long long entity_key, unsigned int skip_length)
 {
    Pdu *pdu = NULL;
 
@@ -47,6 +180,12 @@ void IncomingMessage::SwitchOnType(DIS::PDUType pdu_type, DataStream& ds)
 
    // first, check if any custom PDU bank registered
    PduBankContainer::iterator pduBankIt = _pduBanks.find(pdu_type);
+   if (_executor && pduBankIt == _pduBanks.end())
+   {
+      Execute( pdu_type, ds, context, entity_key, skip_length );
+      return;
+   }
+
    if (pduBankIt != _pduBanks.end())
    {
       pdu = pduBankIt->second->GetStaticPDU(pdu_type, ds);
@@ -58,25 +197,176 @@ void IncomingMessage::SwitchOnType(DIS::PDUType pdu_type, DataStream& ds)
    // if valid pdu point, and at least 1 processor
    if (pdu && (_processors.count(pdu_type) > 0))
    {
-      pdu->unmarshal( ds );
+      if( !Decode( *pdu , ds , _typeCounters[pdu_type] , entity_key , skip_length ) )
+      {
+         return;
+      }
 
       // assumes the location in the buffer is the packet id.
       typedef std::pair<PacketProcessorContainer::iterator,PacketProcessorContainer::iterator> RangePair;
       RangePair rangepair = _processors.equal_range( pdu_type );
       PacketProcessorContainer::iterator processor_iter = rangepair.first;
       PacketProcessorContainer::iterator processor_end = rangepair.second;
+      size_t next = 0;
       while( processor_iter != processor_end )
       {
-        (processor_iter->second)->Process( *pdu );
+        ProcessorCounters* counters = NextProcessorCounters( pdu_type , processor_iter->second , next );
+        CallProcessor( pdu_type , processor_iter->second , counters , *pdu , context , entity_key );
         ++processor_iter;
       }
    }
    else
    {
-      ds.clear();
+      if( pdu == NULL )
+      {
+         _typeCounters[pdu_type].unknown.Add( 1 );
+      }
+      else
+      {
+         _typeCounters[pdu_type].unhandled.Add( 1 );
+      }
+      Skip( ds , skip_length );
    }   
 }
 
+void IncomingMessage::Execute(DIS::PDUType pdu_type, DataStream& ds, const ReceiveContext& context, unsigned long long entity_key, unsigned int skip_length)
+{
+   typedef std::pair<PacketProcessorContainer::iterator,PacketProcessorContainer::iterator> RangePair;
+   RangePair rangepair = _processors.equal_range( pdu_type );
+
+   Pdu* created = NULL;
+   if( rangepair.first != rangepair.second )
+   {
+      created = PduBank::CreatePDU( pdu_type );
+      if( created == NULL )
+      {
+         _typeCounters[pdu_type].unknown.Add( 1 );
+      }
+   }
+   else
+   {
+      _typeCounters[pdu_type].unhandled.Add( 1 );
+   }
+
+   if( created == NULL )
+   {
+      Skip( ds , skip_length );
+      return;
+   }
+
+   // owned before decoding, so that a malformed PDU does not leak it.
+   std::shared_ptr<Pdu> decoded( created );
+   if( !Decode( *decoded , ds , _typeCounters[pdu_type] , entity_key , skip_length ) )
+   {
+      return;
+   }
+
+   const ProcessorExecutor::PduPointer shared( decoded );
+   size_t next = 0;
+   for(PacketProcessorContainer::iterator processor_iter = rangepair.first; processor_iter != rangepair.second; ++processor_iter)
+   {
+      ProcessorCounters* counters = NextProcessorCounters( pdu_type , processor_iter->second , next );
+      if( counters != NULL )
+      {
+         counters->calls.Add( 1 );
+      }
+      _executor->Execute( processor_iter->second , shared , context , entity_key );
+   }
+}
+
+void IncomingMessage::Skip(DataStream& ds, unsigned int skip_length)
+{
+   if( skip_length == 0 )
+   {
+      ds.clear();
+   }
+   else
+   {
+      ds.Skip( skip_length );
+   }
+}
+
+bool IncomingMessage::Decode(Pdu& pdu, DataStream& ds, TypeCounters& counters, unsigned long long entity_key, unsigned int length)
+{
+#if defined(DIS_TRACEPOINTS)
+   const size_t begin = ds.GetReadPos();
+#endif
+   DIS_TRACEPOINT3( unmarshal_begin , pdu.getPduType() , length , entity_key );
+
+   const long long start = _timing ? Now() : 0;
+   try
+   {
+      DIS_PROFILE_SCOPE( PROFILE_UNMARSHAL , pdu.getPduType() );
+      pdu.unmarshal( ds );
+   }
+   catch( const std::exception& )
+   {
+      // the stream throws when a field is read past the end of the buffer.
+      DIS_TRACEPOINT4( unmarshal_end , pdu.getPduType() , ds.GetReadPos() - begin , entity_key , 0 );
+      counters.decodeFailures.Add( 1 );
+      ds.clear();
+      return false;
+   }
+   DIS_TRACEPOINT4( unmarshal_end , pdu.getPduType() , ds.GetReadPos() - begin , entity_key , 1 );
+
+   if( _timing )
+   {
+      counters.decodeNanoseconds.Add( Now() - start );
+   }
+   return true;
+}
+
+void IncomingMessage::CallProcessor(unsigned char pdu_type, IPacketProcessor* pp, ProcessorCounters* counters, const Pdu& pdu, const ReceiveContext& context, unsigned long long entity_key)
+{
+   DIS_TRACEPOINT4( dispatch , pdu_type , pdu.getLength() , entity_key , reinterpret_cast<unsigned long long>( pp ) );
+   DIS_PROFILE_SCOPE( PROFILE_DISPATCH , pdu_type );
+   if( counters == NULL )
+   {
+      pp->Process( pdu , context );
+      return;
+   }
+
+   counters->calls.Add( 1 );
+#if defined(DIS_PROFILING)
+   const unsigned long long allocations = Profiler::GetThreadAllocations();
+   const unsigned long long bytes = Profiler::GetThreadAllocatedBytes();
+#endif
+
+   const long long start = _timing ? Now() : 0;
+   pp->Process( pdu , context );
+   if( _timing )
+   {
+      counters->nanoseconds.Add( Now() - start );
+   }
+
+#if defined(DIS_PROFILING)
+   counters->allocations.Add( Profiler::GetThreadAllocations() - allocations );
+   counters->allocatedBytes.Add( Profiler::GetThreadAllocatedBytes() - bytes );
+#endif
+}
+
+IncomingMessage::ProcessorCounters* IncomingMessage::FindProcessorCounters(unsigned char pdu_type, const IPacketProcessor* pp)
+{
+   const ProcessorCountersContainer& counters = _processorCounters[pdu_type];
+   for(size_t i=0; i<counters.size(); ++i)
+   {
+      if( counters[i]->processor == pp )
+      {
+         return counters[i];
+      }
+   }
+   return NULL;
+}
+
+IncomingMessage::ProcessorCounters* IncomingMessage::NextProcessorCounters(unsigned char pdu_type, const IPacketProcessor* pp, size_t& next)
+{
+   const ProcessorCountersContainer& counters = _processorCounters[pdu_type];
+   if( next < counters.size() && counters[next]->processor == pp )
+   {
+      return counters[next++];
+   }
+   return FindProcessorCounters( pdu_type , pp );
+}
 
 bool IncomingMessage::AddProcessor(unsigned char id, IPacketProcessor* pp)
 {
@@ -87,6 +377,10 @@ bool IncomingMessage::AddProcessor(unsigned char id, IPacketProcessor* pp)
    if (!FindProccessorContainer(id, pp, containerIter))
    {
        _processors.insert( candidate );
+
+       ProcessorCounters* counters = new ProcessorCounters();
+       counters->processor = pp;
+       _processorCounters[id].push_back( counters );
        return true;
    }
 
@@ -103,6 +397,17 @@ bool IncomingMessage::RemoveProcessor(unsigned char id, const IPacketProcessor*
    {
       // Erases only the single pair found in the interator
       _processors.erase( containerIter );
+
+      ProcessorCountersContainer& counters = _processorCounters[id];
+      for(ProcessorCountersContainer::iterator iter = counters.begin(); iter != counters.end(); ++iter)
+      {
+         if( (*iter)->processor == pp )
+         {
+            delete *iter;
+            counters.erase( iter );
+            break;
+         }
+      }
       return true;
    }
 
@@ -142,6 +447,29 @@ bool IncomingMessage::RemovePduBank(unsigned char id, const IPduBank* pduBank)
    return false;
 }
 
+bool IncomingMessage::AddFilter(IPduFilter* filter)
+{
+   if( std::find( _filters.begin() , _filters.end() , filter ) != _filters.end() )
+   {
+      return false;
+   }
+
+   _filters.push_back( filter );
+   return true;
+}
+
+bool IncomingMessage::RemoveFilter(const IPduFilter* filter)
+{
+   PduFilterContainer::iterator iter = std::find( _filters.begin() , _filters.end() , filter );
+   if( iter == _filters.end() )
+   {
+      return false;
+   }
+
+   _filters.erase( iter );
+   return true;
+}
+
 IncomingMessage::PacketProcessorContainer& IncomingMessage::GetProcessors()
 {
    return _processors;
@@ -162,6 +490,64 @@ const IncomingMessage::PduBankContainer& IncomingMessage::GetPduBanks() const
    return _pduBanks;
 }
 
+const IncomingMessage::PduFilterContainer& IncomingMessage::GetFilters() const
+{
+   return _filters;
+}
+
+void IncomingMessage::SetExecutor(ProcessorExecutor* executor)
+{
+   _executor = executor;
+}
+
+ProcessorExecutor* IncomingMessage::GetExecutor() const
+{
+   return _executor;
+}
+
+void IncomingMessage::SetTimingEnabled(bool enabled)
+{
+   _timing = enabled;
+}
+
+bool IncomingMessage::IsTimingEnabled() const
+{
+   return _timing;
+}
+
+IncomingStatistics IncomingMessage::GetStatistics() const
+{
+   IncomingStatistics statistics;
+   statistics.buffers = _buffers.Get();
+   statistics.bytes = _bytes.Get();
+   for(unsigned int type=0; type<PDU_TYPE_COUNT; ++type)
+   {
+      const TypeCounters& counters = _typeCounters[type];
+      PduTypeStatistics& copy = statistics.types[type];
+      copy.pdus = counters.pdus.Get();
+      copy.bytes = counters.bytes.Get();
+      copy.decodeFailures = counters.decodeFailures.Get();
+      copy.filtered = counters.filtered.Get();
+      copy.unhandled = counters.unhandled.Get();
+      copy.unknown = counters.unknown.Get();
+      copy.decodeNanoseconds = counters.decodeNanoseconds.Get();
+
+      for(size_t i=0; i<_processorCounters[type].size(); ++i)
+      {
+         const ProcessorCounters& processor = *_processorCounters[type][i];
+         ProcessorStatistics processorCopy;
+         processorCopy.processor = processor.processor;
+         processorCopy.pduType = static_cast<unsigned char>( type );
+         processorCopy.calls = processor.calls.Get();
+         processorCopy.nanoseconds = processor.nanoseconds.Get();
+         processorCopy.allocations = processor.allocations.Get();
+         processorCopy.allocatedBytes = processor.allocatedBytes.Get();
+         statistics.processors.push_back( processorCopy );
+      }
+   }
+   return statistics;
+}
+
 
 bool IncomingMessage::FindProccessorContainer(unsigned char id, const IPacketProcessor* pp, PacketProcessorContainer::iterator &containerIter)
 {  
@@ -7,7 +7,10 @@
 
 #include <utils/IBufferProcessor.h>   // for base class
 #include <utils/IPduBank.h> 
+#include <utils/ReceiveContext.h>     // for parameter
 #include <map>                      // for member
+#include <vector>                   // for member
+#include <atomic>                   // for member
 #include <utils/Endian.h>             // for internal type
 #include <dis6/msLibMacro.h>         // for library symbols
 #include <utils/PDUType.h>
@@ -16,7 +19,89 @@ namespace DIS
 {
    class Pdu;
    class IPacketProcessor;
+   class IPduFilter;
    class DataStream;
+   class ProcessorExecutor;
+
+   /// the number of values of the PDU type field.
+   const unsigned int PDU_TYPE_COUNT = 256;
+
+   /// the counters of one PDU type.
+   struct PduTypeStatistics
+   {
+      PduTypeStatistics()
+         : pdus(0)
+         , bytes(0)
+         , decodeFailures(0)
+         , filtered(0)
+         , unhandled(0)
+         , unknown(0)
+         , decodeNanoseconds(0)
+      {
+      }
+
+      /// the PDUs of the type received, and the bytes they take.
+      unsigned long long pdus;
+      unsigned long long bytes;
+
+      /// the PDUs that were truncated, or that could not be decoded because they end before their last field.
+      unsigned long long decodeFailures;
+
+      /// the PDUs rejected by a filter before they were decoded.
+      unsigned long long filtered;
+
+      /// the PDUs skipped without being decoded, because no processor is registered for the type.
+      unsigned long long unhandled;
+
+      /// the PDUs of a type the library has no class for.
+      unsigned long long unknown;
+
+      /// the time spent decoding the PDUs, when timing is enabled.
+      unsigned long long decodeNanoseconds;
+   };
+
+   /// the calls made to one processor registered for one PDU type.
+   struct ProcessorStatistics
+   {
+      ProcessorStatistics()
+         : processor(NULL)
+         , pduType(0)
+         , calls(0)
+         , nanoseconds(0)
+         , allocations(0)
+         , allocatedBytes(0)
+      {
+      }
+
+      const IPacketProcessor* processor;
+      unsigned char pduType;
+      unsigned long long calls;
+
+      /// the time spent in the processor, when timing is enabled and no executor is used.
+      unsigned long long nanoseconds;
+
+      /// the heap allocations made by the processor when no executor is used, and their bytes.
+      /// only counted by a library built with OPENDIS_PROFILING, in an application reporting
+      /// its allocations to Profiler::CountAllocation().
+      unsigned long long allocations;
+      unsigned long long allocatedBytes;
+   };
+
+   /// a snapshot of the counters of an IncomingMessage.
+   struct EXPORT_MACRO IncomingStatistics
+   {
+      IncomingStatistics();
+
+      /// the buffers processed, and the bytes they hold.
+      unsigned long long buffers;
+      unsigned long long bytes;
+
+      /// the counters of each PDU type, indexed by the type.
+      std::vector<PduTypeStatistics> types;
+
+      /// the counters of each processor, in registration order for each PDU type.
+      std::vector<ProcessorStatistics> processors;
+   };
 
    /// A framework for routing the packet to the correct processor.
    class EXPORT_MACRO IncomingMessage : public IBufferProcessor
@@ -28,11 +113,19 @@ namespace DIS
       /// the container type for supporting PDU banks.
       typedef std::multimap<unsigned char,IPduBank*> PduBankContainer;
 
+      /// the container type for the filters, applied in registration order.
+      typedef std::vector<IPduFilter*> PduFilterContainer;
+
       IncomingMessage();
       ~IncomingMessage();
 
       void Process(const char* buf, unsigned int size, Endian e);
 
+      /// process the PDUs in the buffer, passing the datagram details to the filters and processors.
+      /// the PDU offset and index of the context are advanced for each PDU in the buffer,
+      /// starting from the values passed in.
+      void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context);
+
       /// registers the ipp instance to process packets with the id
       /// @return 'true' if the pair of parameters were not found in the container and were addded.  'false' if the pair was found.
       bool AddProcessor(unsigned char id, IPacketProcessor* pp);
@@ -49,20 +142,137 @@ namespace DIS
       /// @return 'true' if the pair of parameters were found in the container and removed.  'false' if the pair was not found.
       bool RemovePduBank(unsigned char pdu_type, const IPduBank* pduBank);
 
+      /// registers a filter that can skip PDUs before they are decoded.
+      /// @return 'true' if the filter was not already registered and was added.
+      bool AddFilter(IPduFilter* filter);
+
+      /// unregisters the filter.  it does not delete the filter.
+      /// @return 'true' if the filter was found and removed.
+      bool RemoveFilter(const IPduFilter* filter);
+
       PacketProcessorContainer& GetProcessors();
       const PacketProcessorContainer& GetProcessors() const;
 
       PduBankContainer& GetPduBanks();
       const PduBankContainer& GetPduBanks() const;
 
+      const PduFilterContainer& GetFilters() const;
+
+      /// hand the processors to an executor instead of calling them on the receiving thread.
+      /// each PDU is then decoded into a new instance shared by its processors.
+      /// PDU types provided by a registered PDU bank are still processed on the receiving thread,
+      /// because the bank owns and reuses their instances.
+      /// @param executor NULL to call the processors directly, which is the default.  it is not deleted.
+      void SetExecutor(ProcessorExecutor* executor);
+      ProcessorExecutor* GetExecutor() const;
+
+      /// measure the time spent decoding each PDU type and in each processor.
+      /// timing reads the clock around every decode and every call, so it is off by default.
+      void SetTimingEnabled(bool enabled);
+      bool IsTimingEnabled() const;
+
+      /// copy the counters.  this is safe while another thread is processing,
+      /// but not while processors are added or removed.
+      IncomingStatistics GetStatistics() const;
+
    private:
+      IncomingMessage(const IncomingMessage&);              ///< not implemented by design
+      IncomingMessage& operator=(const IncomingMessage&);   ///< not implemented by design
+
+      /// a counter written by the thread processing the buffers, and read by any thread.
+      /// a single writer needs no atomic increment, only atomic loads and stores.
+      struct Counter
+      {
+         Counter()
+            : value(0)
+         {
+         }
+
+         void Add(unsigned long long amount)
+         {
+            value.store( value.load( std::memory_order_relaxed ) + amount , std::memory_order_relaxed );
+         }
+
+         unsigned long long Get() const
+         {
+            return value.load( std::memory_order_relaxed );
+         }
+
+         std::atomic<unsigned long long> value;
+      };
+
+      struct TypeCounters
+      {
+         Counter pdus;
+         Counter bytes;
+         Counter decodeFailures;
+         Counter filtered;
+         Counter unhandled;
+         Counter unknown;
+         Counter decodeNanoseconds;
+      };
+
+      struct ProcessorCounters
+      {
+         const IPacketProcessor* processor;
+         Counter calls;
+         Counter nanoseconds;
+         Counter allocations;
+         Counter allocatedBytes;
+      };
+
+      typedef std::vector<ProcessorCounters*> ProcessorCountersContainer;
+
+      /// @return the counters of the processor for the PDU type, or NULL for a processor
+      /// inserted directly into the container returned by GetProcessors().
+      ProcessorCounters* FindProcessorCounters(unsigned char pdu_type, const IPacketProcessor* pp);
+
+      /// @return the counters of the next processor of a dispatch.  the counters are added with the
+      /// processors, in the same order, so that they are taken in turn rather than searched for.
+      /// they are only searched for once the container returned by GetProcessors() has been changed directly.
+      /// @param next the position of the counters of the processor, moved past them.
+      ProcessorCounters* NextProcessorCounters(unsigned char pdu_type, const IPacketProcessor* pp, size_t& next);
+
+      /// call the processor with the PDU, and count the call.
+      /// @param counters the counters of the processor, NULL to call it without counting.
+      /// @param entity_key the entity of the PDU, when the executor or a tracepoint needs it.
+      void CallProcessor(unsigned char pdu_type, IPacketProcessor* pp, ProcessorCounters* counters, const Pdu& pdu, const ReceiveContext& context, unsigned long long entity_key);
+
+      /// decode the PDU at the read position, counting a failure when it is truncated.
+      /// @param length the length of the PDU in its header, or 0 when not valid, for the tracepoints.
+      /// @return 'false' if the PDU could not be decoded.  the rest of the buffer is then dropped.
+      bool Decode(Pdu& pdu, DataStream& ds, TypeCounters& counters, unsigned long long entity_key, unsigned int length);
+
       typedef std::pair<PacketProcessorContainer::iterator, PacketProcessorContainer::iterator> PacketProcessIteratorPair;
       PacketProcessorContainer _processors;
       
       typedef std::pair<PduBankContainer::iterator, PduBankContainer::iterator> PduBankIteratorPair;
       PduBankContainer _pduBanks;
 
-      void SwitchOnType(DIS::PDUType pdu_type, DataStream& ds);
+      PduFilterContainer _filters;
+
+      ProcessorExecutor* _executor;
+
+      bool _timing;
+      Counter _buffers;
+      Counter _bytes;
+      TypeCounters _typeCounters[PDU_TYPE_COUNT];
+
+      /// the counters of the processors of each PDU type, in registration order.
+      ProcessorCountersContainer _processorCounters[PDU_TYPE_COUNT];
+
+      /// @param skip_length the length of the PDU, to skip it when it is not decoded.
+      /// 0 when the length is not valid, which drops the rest of the buffer instead.
+      void SwitchOnType(DIS::PDUType pdu_type, DataStream& ds, const ReceiveContext& context, unsigned long long entity_key, unsigned int skip_length);
+
+      /// decode the PDU into a new instance and queue it for each processor on the executor.
+      void Execute(DIS::PDUType pdu_type, DataStream& ds, const ReceiveContext& context, unsigned long long entity_key, unsigned int skip_length);
+
+      /// move past a PDU that is not decoded.
+      void Skip(DataStream& ds, unsigned int skip_length);
+
+      /// @return 'false' if any filter rejected the PDU at the read position, which is then skipped.
+      bool ApplyFilters(const char* pdu, unsigned int remaining, Endian e, DataStream& ds, const ReceiveContext& context);
 
       /// Searches the proccesor container multimap for a matching container and returns the iterator
       bool FindProccessorContainer(unsigned char id, const IPacketProcessor* pp, PacketProcessorContainer::iterator &containerIter);
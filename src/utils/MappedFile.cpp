@@ -0,0 +1,138 @@
+#include <utils/MappedFile.h>
+
+#include <cerrno>
+#include <cstdio>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace DIS;
+
+MappedFile::MappedFile()
+   : _data(NULL)
+   , _size(0)
+   , _mapped(false)
+   , _buffer()
+   , _error(0)
+{
+}
+
+MappedFile::~MappedFile()
+{
+   Close();
+}
+
+bool MappedFile::Open(const std::string& path, bool sequential)
+{
+   Close();
+
+#if !defined(_WIN32)
+   int fd = ::open( path.c_str() , O_RDONLY );
+   if( fd < 0 )
+   {
+      _error = errno;
+      return false;
+   }
+
+   struct stat status;
+   if( fstat( fd , &status ) != 0 )
+   {
+      _error = errno;
+      ::close( fd );
+      return false;
+   }
+
+   if( status.st_size > 0 )
+   {
+      void* mapping = mmap( NULL , status.st_size , PROT_READ , MAP_PRIVATE , fd , 0 );
+      if( mapping == MAP_FAILED )
+      {
+         _error = errno;
+         ::close( fd );
+         return false;
+      }
+
+      if( sequential )
+      {
+         madvise( mapping , status.st_size , MADV_SEQUENTIAL );
+      }
+      _data = static_cast<const char*>( mapping );
+      _size = static_cast<size_t>( status.st_size );
+      _mapped = true;
+   }
+   ::close( fd );
+#else
+   (void)sequential;
+
+   FILE* file = fopen( path.c_str() , "rb" );
+   if( file == NULL )
+   {
+      _error = errno;
+      return false;
+   }
+
+   char chunk[65536];
+   size_t count = 0;
+   while( (count = fread( chunk , 1 , sizeof(chunk) , file )) > 0 )
+   {
+      _buffer.insert( _buffer.end() , chunk , chunk + count );
+   }
+   fclose( file );
+
+   _data = _buffer.empty() ? NULL : &_buffer[0];
+   _size = _buffer.size();
+#endif
+
+   return true;
+}
+
+void MappedFile::Close()
+{
+#if !defined(_WIN32)
+   if( _mapped )
+   {
+      munmap( const_cast<char*>( _data ) , _size );
+   }
+#endif
+
+   _data = NULL;
+   _size = 0;
+   _mapped = false;
+   _buffer.clear();
+}
+
+const char* MappedFile::GetData() const
+{
+   return _data;
+}
+
+size_t MappedFile::GetSize() const
+{
+   return _size;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t length) const
+{
+#if !defined(_WIN32)
+   if( _mapped && offset < _size )
+   {
+      // the advice starts on a page boundary.
+      const size_t page = static_cast<size_t>( sysconf( _SC_PAGESIZE ) );
+      const size_t begin = offset & ~( page - 1 );
+      const size_t end = ( length < _size - offset ) ? offset + length : _size;
+      madvise( const_cast<char*>( _data ) + begin , end - begin , MADV_WILLNEED );
+   }
+#else
+   (void)offset;
+   (void)length;
+#endif
+}
+
+int MappedFile::GetLastError() const
+{
+   return _error;
+}
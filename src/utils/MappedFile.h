@@ -0,0 +1,51 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_mapped_file_h_
+#define _dcl_dis_mapped_file_h_
+
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <cstddef>                  // for size_t definition
+
+namespace DIS
+{
+   /// the read only contents of a whole file, for the readers of captures, recordings and archives.
+   /// the file is memory mapped where possible, and otherwise read into memory.
+   class EXPORT_MACRO MappedFile
+   {
+   public:
+      MappedFile();
+      ~MappedFile();
+
+      /// map the file.
+      /// @param sequential 'true' to advise the kernel that the file is read once from start to end.
+      /// @return 'false' if the file could not be read.  GetLastError() has the errno value.
+      bool Open(const std::string& path, bool sequential=false);
+
+      void Close();
+
+      /// @return the contents of the file, NULL when it is closed or empty.
+      const char* GetData() const;
+      size_t GetSize() const;
+
+      /// ask for a range of the file to be read ahead.  does nothing when the file is not mapped.
+      void Prefetch(size_t offset, size_t length) const;
+
+      int GetLastError() const;
+
+   private:
+      MappedFile(const MappedFile&);              ///< not implemented by design
+      MappedFile& operator=(const MappedFile&);   ///< not implemented by design
+
+      const char* _data;
+      size_t _size;
+      bool _mapped;
+      std::vector<char> _buffer;
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_mapped_file_h_
@@ -7,6 +7,8 @@ namespace DIS
 {
     /// houses instances for the set of known PDU classes to be returned
     /// when provided with the PDU type's identifier value.
+    /// every thread has its own set of instances.
+    /// the known classes are those of dis6/PduRegistry.h.
     class EXPORT_MACRO PduBank
     {
     public:
@@ -15,6 +17,12 @@ namespace DIS
         /// @return NULL when the pdu_type is unknown.
         ///\todo make this parameter just 'unsigned char' since that will be easier to generate.
         static Pdu* GetStaticPDU( DIS::PDUType pdu_type );  
+
+        /// creates a new instance of the PDU class corresponding to the identifier,
+        /// for PDUs that must outlive the next decode.
+        /// @param pdu_type the 8-bit PDU type identifier
+        /// @return NULL when the pdu_type is unknown.  the caller owns the PDU.
+        static Pdu* CreatePDU( DIS::PDUType pdu_type );
     };   
 }
 
@@ -55,6 +55,25 @@ namespace DIS
       PDU_APPEARANCE = 47,
       PDU_ARTICULATED_PARTS = 48
    };
+
+   /// the protocol family field of the PDU header.
+   enum ProtocolFamily
+   {
+      PROTOCOL_FAMILY_OTHER = 0,
+      PROTOCOL_FAMILY_ENTITY_INFORMATION = 1,
+      PROTOCOL_FAMILY_WARFARE = 2,
+      PROTOCOL_FAMILY_LOGISTICS = 3,
+      PROTOCOL_FAMILY_RADIO_COMMUNICATIONS = 4,
+      PROTOCOL_FAMILY_SIMULATION_MANAGEMENT = 5,
+      PROTOCOL_FAMILY_DISTRIBUTED_EMISSION_REGENERATION = 6,
+      PROTOCOL_FAMILY_ENTITY_MANAGEMENT = 7,
+      PROTOCOL_FAMILY_MINEFIELD = 8,
+      PROTOCOL_FAMILY_SYNTHETIC_ENVIRONMENT = 9,
+      PROTOCOL_FAMILY_SIMULATION_MANAGEMENT_WITH_RELIABILITY = 10,
+      PROTOCOL_FAMILY_LIVE_ENTITY = 11,
+      PROTOCOL_FAMILY_NON_REAL_TIME = 12,
+      PROTOCOL_FAMILY_INFORMATION_OPERATIONS = 13
+   };
 }
 
 #endif // _dtdis_pdu_type_h_
@@ -1,15 +1,43 @@
 #include <utils/PacketFactory.h>
-#include <dis6/Pdu.h>
+#include <dis6/PduRegistry.h>
 #include <cstdlib>
 
 using namespace DIS;
 
+namespace
+{
+   /// registers each class of the registry.
+   struct RegisterEntry
+   {
+      RegisterEntry(PacketFactory& f)
+         : factory(f)
+      {
+      }
+
+      template<typename Entry>
+      void Call()
+      {
+         factory.RegisterPacket<typename Entry::PduClass>( Entry::TYPE );
+      }
+
+      PacketFactory& factory;
+   };
+}
+
+PacketFactory::PacketFactory()
+{
+   for(unsigned int i=0; i<PDU_TYPE_TABLE_SIZE; ++i)
+   {
+      _functions[i] = NULL;
+   }
+}
+
 Pdu* PacketFactory::CreatePacket(unsigned char id)
 {
-   FunctionMap::iterator iter =_fMap.find( id );
-   if( iter != _fMap.end() )
+   CREATE_FUNC create = _functions[id];
+   if( create != NULL )
    {
-      return (iter->second)();
+      return create();
    }
 
    return NULL;
@@ -20,8 +48,13 @@ void PacketFactory::DestroyPacket(Pdu* pdu)
    delete pdu;
 }
 
-bool PacketFactory::IsRegistered(unsigned char id) const
+void PacketFactory::RegisterAllPackets()
 {
-   FunctionMap::const_iterator iter = _fMap.find(id);
-   return( iter != _fMap.end() );
+   RegisterEntry entry( *this );
+   PduTypeListForEach<PduRegistry>::Apply( entry );
 }
+
+bool PacketFactory::IsRegistered(unsigned char id) const
+{
+   return( _functions[id] != NULL );
+}
\ No newline at end of file
@@ -4,8 +4,8 @@
 #ifndef _dcl_dis_packet_factory_h_
 #define _dcl_dis_packet_factory_h_
 
-#include <map>                      // for member
 #include <dis6/msLibMacro.h>         // for library symbols
+#include <utils/PduTypeList.h>        // for PDU_TYPE_TABLE_SIZE
 
 namespace DIS
 {
@@ -19,9 +19,11 @@ namespace DIS
    }
 
    /// responsible for mapping an ID value to a Pdu type.
+   /// the functions creating the Pdu are indexed by the ID.
    class EXPORT_MACRO PacketFactory
    {
    public:
+      PacketFactory();
 
       /// Create a Pdu.
       /// @param id the value representing the "type" of the Pdu.  The value will be stored in the 3rd position of the buffer, as defined by the DIS specification.
@@ -38,17 +40,26 @@ namespace DIS
       template<class T>
       bool RegisterPacket(unsigned char id)
       {
-         FunctionMap::value_type candidate(id,&CreateImplementation<Pdu,T>);
-         std::pair<FunctionMap::iterator,bool> result = _fMap.insert( candidate );
-         return result.second;
+         if( _functions[id] != NULL )
+         {
+            return false;
+         }
+         _functions[id] = &CreateImplementation<Pdu,T>;
+         return true;
       }
 
+      /// Add support for creating every Pdu of dis6/PduRegistry.h, except the IDs already registered.
+      void RegisterAllPackets();
+
       /// Remove support for creating the Pdu.
       /// @param id The value identifying the type of the Pdu.
       /// @return 'false' if no support previously existed.  'true' if support was removed.
       bool UnRegisterPacket(char id)
       {
-         return( _fMap.erase( id )>0 );
+         const unsigned char index = static_cast<unsigned char>( id );
+         const bool registered = ( _functions[index] != NULL );
+         _functions[index] = NULL;
+         return registered;
       }
 
       /// Check to know if the Pdu type is supported.
@@ -60,11 +71,8 @@ namespace DIS
       /// the function signature required for creating Pdu instances.
       typedef Pdu* (*CREATE_FUNC)();
 
-      /// the type to contain mappings to functions used to create Pdu instances.
-      typedef std::map<unsigned char,CREATE_FUNC> FunctionMap;
-
-      /// instance of the storage mechanism for creating Pdu instances.
-      FunctionMap _fMap;
+      /// the functions used to create Pdu instances, indexed by the ID.  NULL when not registered.
+      CREATE_FUNC _functions[PDU_TYPE_TABLE_SIZE];
    };
 }
 
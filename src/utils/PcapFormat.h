@@ -0,0 +1,51 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pcap_format_h_
+#define _dcl_dis_pcap_format_h_
+
+namespace DIS
+{
+   /// the magic numbers opening a classic pcap file, as written by the capturing host.
+   const unsigned int PCAP_MAGIC_MICROSECONDS = 0xa1b2c3d4;
+   const unsigned int PCAP_MAGIC_NANOSECONDS = 0xa1b23c4d;
+
+   /// the size of the classic pcap file header, and of each record header.
+   const unsigned int PCAP_FILE_HEADER_SIZE = 24;
+   const unsigned int PCAP_RECORD_HEADER_SIZE = 16;
+
+   /// the pcapng block types read by PcapReader.
+   const unsigned int PCAPNG_SECTION_HEADER_BLOCK = 0x0a0d0d0a;
+   const unsigned int PCAPNG_INTERFACE_DESCRIPTION_BLOCK = 1;
+   const unsigned int PCAPNG_SIMPLE_PACKET_BLOCK = 3;
+   const unsigned int PCAPNG_ENHANCED_PACKET_BLOCK = 6;
+
+   /// the magic number of a pcapng section header, giving the byte order of the section.
+   const unsigned int PCAPNG_BYTE_ORDER_MAGIC = 0x1a2b3c4d;
+
+   /// the interface option giving the resolution of the packet timestamps.
+   const unsigned short PCAPNG_OPTION_END = 0;
+   const unsigned short PCAPNG_OPTION_TIMESTAMP_RESOLUTION = 9;
+
+   /// the link layer header types PcapReader can strip.
+   enum PcapLinkType
+   {
+      PCAP_LINKTYPE_NULL = 0,
+      PCAP_LINKTYPE_ETHERNET = 1,
+      PCAP_LINKTYPE_RAW = 101,
+      PCAP_LINKTYPE_LINUX_SLL = 113,
+      PCAP_LINKTYPE_IPV4 = 228,
+      PCAP_LINKTYPE_IPV6 = 229,
+      PCAP_LINKTYPE_LINUX_SLL2 = 276
+   };
+
+   /// the layout of a capture file.
+   enum PcapFormat
+   {
+      PCAP_FORMAT_UNKNOWN = 0,
+      PCAP_FORMAT_PCAP,
+      PCAP_FORMAT_PCAPNG
+   };
+}
+
+#endif  // _dcl_dis_pcap_format_h_
@@ -0,0 +1,625 @@
+#include <utils/PcapReader.h>
+#include <utils/IBufferProcessor.h>
+#include <utils/ReceiveContext.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+using namespace DIS;
+
+namespace
+{
+   const unsigned int ETHERNET_HEADER_SIZE = 14;
+   const unsigned int VLAN_TAG_SIZE = 4;
+   const unsigned int LINUX_SLL_HEADER_SIZE = 16;
+   const unsigned int LINUX_SLL2_HEADER_SIZE = 20;
+   const unsigned int NULL_HEADER_SIZE = 4;
+   const unsigned int IPV4_MIN_HEADER_SIZE = 20;
+   const unsigned int IPV6_HEADER_SIZE = 40;
+   const unsigned int UDP_HEADER_SIZE = 8;
+
+   const unsigned short ETHERTYPE_IPV4 = 0x0800;
+   const unsigned short ETHERTYPE_IPV6 = 0x86dd;
+   const unsigned short ETHERTYPE_VLAN = 0x8100;
+   const unsigned short ETHERTYPE_QINQ = 0x88a8;
+
+   const unsigned char IP_PROTOCOL_UDP = 17;
+
+   /// the BSD loopback address family of IPv4, in either byte order.
+   const unsigned int NULL_FAMILY_IPV4 = 2;
+   const unsigned int NULL_FAMILY_IPV4_SWAPPED = 0x02000000;
+
+   /// read the network byte order fields of the protocol headers.
+   unsigned short Network16(const char* buf)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>( buf );
+      return static_cast<unsigned short>( (bytes[0] << 8) | bytes[1] );
+   }
+
+   unsigned int Network32(const char* buf)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>( buf );
+      return (static_cast<unsigned int>( bytes[0] ) << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+   }
+
+   unsigned int Swap32(unsigned int value)
+   {
+      return ((value & 0xff) << 24) | ((value & 0xff00) << 8) | ((value >> 8) & 0xff00) | (value >> 24);
+   }
+
+   /// pcapng blocks are padded to 32 bits.
+   unsigned int Padded(unsigned int length)
+   {
+      return (length + 3) & ~3u;
+   }
+}
+
+PcapReader::PcapReader()
+   : _file()
+   , _data(NULL)
+   , _size(0)
+   , _position(0)
+   , _start(0)
+   , _format(PCAP_FORMAT_UNKNOWN)
+   , _swapped(false)
+   , _linkType(0)
+   , _nanosecondsPerUnit(1000)
+   , _interfaces()
+   , _skipped(0)
+   , _error(0)
+{
+}
+
+PcapReader::~PcapReader()
+{
+   Close();
+}
+
+bool PcapReader::Open(const std::string& path)
+{
+   Close();
+
+   // the file is read once from start to end.
+   if( !_file.Open( path , true ) )
+   {
+      _error = _file.GetLastError();
+      return false;
+   }
+   _data = _file.GetData();
+   _size = _file.GetSize();
+
+   if( !ReadHeader() )
+   {
+      _error = EINVAL;
+      Close();
+      return false;
+   }
+
+   return true;
+}
+
+void PcapReader::Close()
+{
+   _file.Close();
+   _data = NULL;
+   _size = 0;
+   _position = 0;
+   _start = 0;
+   _format = PCAP_FORMAT_UNKNOWN;
+   _swapped = false;
+   _linkType = 0;
+   _interfaces.clear();
+   _skipped = 0;
+}
+
+bool PcapReader::IsOpen() const
+{
+   return( _format != PCAP_FORMAT_UNKNOWN );
+}
+
+bool PcapReader::ReadHeader()
+{
+   if( _size < PCAP_FILE_HEADER_SIZE )
+   {
+      return false;
+   }
+
+   unsigned int magic = 0;
+   memcpy( &magic , _data , sizeof(magic) );
+
+   if( magic == PCAPNG_SECTION_HEADER_BLOCK )
+   {
+      // the byte order of pcapng is given by each section header, which is read as a block.
+      _format = PCAP_FORMAT_PCAPNG;
+      _start = 0;
+      _position = 0;
+
+      // read up to the first interface, for the link type.
+      const char* frame = NULL;
+      unsigned int length = 0;
+      long long timestamp = 0;
+      while( _interfaces.empty() && NextPcapngFrame( frame , length , _linkType , timestamp ) )
+      {
+      }
+      if( !_interfaces.empty() )
+      {
+         _linkType = _interfaces[0].linkType;
+      }
+      _interfaces.clear();
+      _position = 0;
+      _skipped = 0;
+      return true;
+   }
+
+   if( magic == PCAP_MAGIC_MICROSECONDS || magic == PCAP_MAGIC_NANOSECONDS )
+   {
+      _swapped = false;
+   }
+   else if( Swap32( magic ) == PCAP_MAGIC_MICROSECONDS || Swap32( magic ) == PCAP_MAGIC_NANOSECONDS )
+   {
+      _swapped = true;
+      magic = Swap32( magic );
+   }
+   else
+   {
+      return false;
+   }
+
+   _format = PCAP_FORMAT_PCAP;
+   _nanosecondsPerUnit = ( magic == PCAP_MAGIC_NANOSECONDS ) ? 1 : 1000;
+   _linkType = Read32( _data + 20 ) & 0xffff;
+   _start = PCAP_FILE_HEADER_SIZE;
+   _position = _start;
+   return true;
+}
+
+void PcapReader::Rewind()
+{
+   _position = _start;
+   _interfaces.clear();
+}
+
+bool PcapReader::Next(PcapDatagram& datagram)
+{
+   const char* frame = NULL;
+   unsigned int length = 0;
+   unsigned int linkType = 0;
+   long long timestamp = 0;
+
+   while( true )
+   {
+      bool read = false;
+      if( _format == PCAP_FORMAT_PCAP )
+      {
+         read = NextPcapFrame( frame , length , linkType , timestamp );
+      }
+      else if( _format == PCAP_FORMAT_PCAPNG )
+      {
+         read = NextPcapngFrame( frame , length , linkType , timestamp );
+      }
+
+      if( !read )
+      {
+         return false;
+      }
+
+      if( ParseFrame( frame , length , linkType , datagram ) )
+      {
+         datagram.timestamp = timestamp;
+         return true;
+      }
+      ++_skipped;
+   }
+}
+
+bool PcapReader::Read(const char*& buf, unsigned int& size, ReceiveContext& context)
+{
+   PcapDatagram datagram;
+   if( !Next( datagram ) )
+   {
+      return false;
+   }
+
+   buf = datagram.payload;
+   size = datagram.length;
+   context = ReceiveContext();
+   context.sourceAddress = datagram.sourceAddress;
+   context.sourcePort = datagram.sourcePort;
+   context.destinationAddress = datagram.destinationAddress;
+   context.timestamp = datagram.timestamp;
+   context.datagramLength = datagram.length;
+   return true;
+}
+
+bool PcapReader::Seek(long long timestamp)
+{
+   Rewind();
+
+   PcapDatagram datagram;
+   while( true )
+   {
+      // the reading state before the datagram, which the pcapng blocks on the way may change.
+      const size_t position = _position;
+      const size_t interfaces = _interfaces.size();
+      const bool swapped = _swapped;
+
+      if( !Next( datagram ) )
+      {
+         return false;
+      }
+
+      if( datagram.timestamp >= timestamp )
+      {
+         _position = position;
+         _interfaces.resize( interfaces );
+         _swapped = swapped;
+         return true;
+      }
+   }
+}
+
+unsigned long long PcapReader::Process(IBufferProcessor& processor, unsigned short port)
+{
+   unsigned long long count = 0;
+   PcapDatagram datagram;
+   ReceiveContext context;
+
+   while( Next( datagram ) )
+   {
+      if( port != 0 && datagram.destinationPort != port )
+      {
+         continue;
+      }
+
+      context.sourceAddress = datagram.sourceAddress;
+      context.sourcePort = datagram.sourcePort;
+      context.destinationAddress = datagram.destinationAddress;
+      context.timestamp = datagram.timestamp;
+      context.datagramLength = datagram.length;
+      processor.Process( datagram.payload , datagram.length , BIG , context );
+      ++count;
+   }
+
+   return count;
+}
+
+bool PcapReader::NextPcapFrame(const char*& frame, unsigned int& length, unsigned int& linkType, long long& timestamp)
+{
+   if( _size - _position < PCAP_RECORD_HEADER_SIZE )
+   {
+      return false;
+   }
+
+   const char* record = _data + _position;
+   const unsigned int captured = Read32( record + 8 );
+   if( captured > _size - _position - PCAP_RECORD_HEADER_SIZE )
+   {
+      // a capture cut short while writing.
+      _position = _size;
+      return false;
+   }
+
+   timestamp = static_cast<long long>( Read32( record ) ) * 1000000000LL +
+               static_cast<long long>( Read32( record + 4 ) ) * _nanosecondsPerUnit;
+   frame = record + PCAP_RECORD_HEADER_SIZE;
+   length = captured;
+   linkType = _linkType;
+   _position += PCAP_RECORD_HEADER_SIZE + captured;
+   return true;
+}
+
+bool PcapReader::NextPcapngFrame(const char*& frame, unsigned int& length, unsigned int& linkType, long long& timestamp)
+{
+   // the block type, the block length, and the repeated block length.
+   const unsigned int MIN_BLOCK_SIZE = 12;
+
+   while( _size - _position >= MIN_BLOCK_SIZE )
+   {
+      const char* block = _data + _position;
+
+      unsigned int type = 0;
+      memcpy( &type , block , sizeof(type) );
+
+      if( type == PCAPNG_SECTION_HEADER_BLOCK )
+      {
+         // a new section starts over with its own byte order and interfaces.
+         if( _size - _position < MIN_BLOCK_SIZE + 4 )
+         {
+            return false;
+         }
+         unsigned int order = 0;
+         memcpy( &order , block + 8 , sizeof(order) );
+         if( order == PCAPNG_BYTE_ORDER_MAGIC )
+         {
+            _swapped = false;
+         }
+         else if( Swap32( order ) == PCAPNG_BYTE_ORDER_MAGIC )
+         {
+            _swapped = true;
+         }
+         else
+         {
+            return false;
+         }
+         _interfaces.clear();
+      }
+      else
+      {
+         type = Read32( block );
+      }
+
+      // the blocks are a multiple of 4 bytes long, so that the next block stays within the file.
+      const unsigned int total = Read32( block + 4 );
+      if( total < MIN_BLOCK_SIZE || total % 4 != 0 || total > _size - _position )
+      {
+         _position = _size;
+         return false;
+      }
+      _position += Padded( total );
+
+      const char* body = block + 8;
+      const unsigned int bodyLength = total - MIN_BLOCK_SIZE;
+
+      if( type == PCAPNG_INTERFACE_DESCRIPTION_BLOCK && bodyLength >= 8 )
+      {
+         Interface iface;
+         iface.linkType = Read16( body );
+         iface.binary = false;
+         iface.exponent = 6;
+
+         // the options follow the link type, reserved field and snap length.
+         unsigned int offset = 8;
+         while( offset + 4 <= bodyLength )
+         {
+            const unsigned short code = Read16( body + offset );
+            const unsigned short size = Read16( body + offset + 2 );
+            if( code == PCAPNG_OPTION_END || offset + 4 + size > bodyLength )
+            {
+               break;
+            }
+            if( code == PCAPNG_OPTION_TIMESTAMP_RESOLUTION && size >= 1 )
+            {
+               const unsigned char resolution = static_cast<unsigned char>( body[offset+4] );
+               iface.binary = ( resolution & 0x80 ) != 0;
+               iface.exponent = resolution & 0x7f;
+            }
+            offset += 4 + Padded( size );
+         }
+         _interfaces.push_back( iface );
+      }
+      else if( type == PCAPNG_ENHANCED_PACKET_BLOCK && bodyLength >= 20 )
+      {
+         const unsigned int index = Read32( body );
+         const unsigned int captured = Read32( body + 12 );
+         if( index >= _interfaces.size() || captured > bodyLength - 20 )
+         {
+            ++_skipped;
+            continue;
+         }
+
+         const unsigned long long units = (static_cast<unsigned long long>( Read32( body + 4 ) ) << 32) | Read32( body + 8 );
+         timestamp = ToNanoseconds( units , _interfaces[index] );
+         frame = body + 20;
+         length = captured;
+         linkType = _interfaces[index].linkType;
+         return true;
+      }
+      else if( type == PCAPNG_SIMPLE_PACKET_BLOCK && bodyLength >= 4 && !_interfaces.empty() )
+      {
+         // simple packets belong to the first interface, and carry no timestamp.
+         const unsigned int original = Read32( body );
+         frame = body + 4;
+         length = ( original < bodyLength - 4 ) ? original : bodyLength - 4;
+         linkType = _interfaces[0].linkType;
+         timestamp = 0;
+         return true;
+      }
+   }
+
+   return false;
+}
+
+long long PcapReader::ToNanoseconds(unsigned long long units, const Interface& iface)
+{
+   const unsigned long long NANOSECONDS = 1000000000ULL;
+
+   if( iface.binary )
+   {
+      if( iface.exponent >= 64 )
+      {
+         return 0;
+      }
+      const unsigned long long seconds = iface.exponent > 0 ? units >> iface.exponent : units;
+      const unsigned long long fraction = iface.exponent > 0 ? units & ((1ULL << iface.exponent) - 1) : 0;
+      unsigned long long nanoseconds = seconds * NANOSECONDS;
+      if( iface.exponent > 0 && iface.exponent <= 32 )
+      {
+         nanoseconds += (fraction * NANOSECONDS) >> iface.exponent;
+      }
+      else if( iface.exponent > 32 )
+      {
+         nanoseconds += ((fraction >> (iface.exponent - 32)) * NANOSECONDS) >> 32;
+      }
+      return static_cast<long long>( nanoseconds );
+   }
+
+   unsigned long long scale = 1;
+   if( iface.exponent <= 9 )
+   {
+      for(unsigned int i=iface.exponent; i<9; ++i)
+      {
+         scale *= 10;
+      }
+      return static_cast<long long>( units * scale );
+   }
+
+   for(unsigned int i=9; i<iface.exponent && i<28; ++i)
+   {
+      scale *= 10;
+   }
+   return static_cast<long long>( units / scale );
+}
+
+bool PcapReader::ParseFrame(const char* frame, unsigned int length, unsigned int linkType, PcapDatagram& datagram) const
+{
+   unsigned int offset = 0;
+   unsigned short ethertype = 0;
+
+   switch( linkType )
+   {
+   case PCAP_LINKTYPE_ETHERNET:
+      if( length < ETHERNET_HEADER_SIZE )
+      {
+         return false;
+      }
+      ethertype = Network16( frame + 12 );
+      offset = ETHERNET_HEADER_SIZE;
+      while( (ethertype == ETHERTYPE_VLAN || ethertype == ETHERTYPE_QINQ) && length - offset >= VLAN_TAG_SIZE )
+      {
+         ethertype = Network16( frame + offset + 2 );
+         offset += VLAN_TAG_SIZE;
+      }
+      break;
+
+   case PCAP_LINKTYPE_LINUX_SLL:
+      if( length < LINUX_SLL_HEADER_SIZE )
+      {
+         return false;
+      }
+      ethertype = Network16( frame + 14 );
+      offset = LINUX_SLL_HEADER_SIZE;
+      break;
+
+   case PCAP_LINKTYPE_LINUX_SLL2:
+      if( length < LINUX_SLL2_HEADER_SIZE )
+      {
+         return false;
+      }
+      ethertype = Network16( frame );
+      offset = LINUX_SLL2_HEADER_SIZE;
+      break;
+
+   case PCAP_LINKTYPE_NULL:
+   {
+      if( length < NULL_HEADER_SIZE )
+      {
+         return false;
+      }
+      unsigned int family = 0;
+      memcpy( &family , frame , sizeof(family) );
+      ethertype = ( family == NULL_FAMILY_IPV4 || family == NULL_FAMILY_IPV4_SWAPPED ) ? ETHERTYPE_IPV4 : ETHERTYPE_IPV6;
+      offset = NULL_HEADER_SIZE;
+      break;
+   }
+
+   case PCAP_LINKTYPE_RAW:
+   case PCAP_LINKTYPE_IPV4:
+   case PCAP_LINKTYPE_IPV6:
+      if( length < 1 )
+      {
+         return false;
+      }
+      ethertype = ( (static_cast<unsigned char>( frame[0] ) >> 4) == 4 ) ? ETHERTYPE_IPV4 : ETHERTYPE_IPV6;
+      break;
+
+   default:
+      return false;
+   }
+
+   const char* ip = frame + offset;
+   const unsigned int remaining = length - offset;
+   unsigned int header = 0;
+
+   if( ethertype == ETHERTYPE_IPV4 )
+   {
+      if( remaining < IPV4_MIN_HEADER_SIZE || (static_cast<unsigned char>( ip[0] ) >> 4) != 4 )
+      {
+         return false;
+      }
+      header = (ip[0] & 0x0f) * 4;
+
+      // fragments are skipped, only the first one holds the UDP header.
+      const unsigned short fragment = Network16( ip + 6 );
+      if( header < IPV4_MIN_HEADER_SIZE || header > remaining ||
+          static_cast<unsigned char>( ip[9] ) != IP_PROTOCOL_UDP || (fragment & 0x3fff) != 0 )
+      {
+         return false;
+      }
+      datagram.sourceAddress = Network32( ip + 12 );
+      datagram.destinationAddress = Network32( ip + 16 );
+   }
+   else if( ethertype == ETHERTYPE_IPV6 )
+   {
+      // extension headers are not followed.
+      if( remaining < IPV6_HEADER_SIZE || static_cast<unsigned char>( ip[6] ) != IP_PROTOCOL_UDP )
+      {
+         return false;
+      }
+      header = IPV6_HEADER_SIZE;
+      datagram.sourceAddress = 0;
+      datagram.destinationAddress = 0;
+   }
+   else
+   {
+      return false;
+   }
+
+   const char* udp = ip + header;
+   if( remaining - header < UDP_HEADER_SIZE )
+   {
+      return false;
+   }
+
+   // the UDP length covers the header, and a snap length may have cut the payload short.
+   const unsigned short udpLength = Network16( udp + 4 );
+   if( udpLength < UDP_HEADER_SIZE || udpLength > remaining - header )
+   {
+      return false;
+   }
+
+   datagram.sourcePort = Network16( udp );
+   datagram.destinationPort = Network16( udp + 2 );
+   datagram.payload = udp + UDP_HEADER_SIZE;
+   datagram.length = udpLength - UDP_HEADER_SIZE;
+   return true;
+}
+
+unsigned int PcapReader::Read32(const char* buf) const
+{
+   unsigned int value = 0;
+   memcpy( &value , buf , sizeof(value) );
+   return _swapped ? Swap32( value ) : value;
+}
+
+unsigned short PcapReader::Read16(const char* buf) const
+{
+   unsigned short value = 0;
+   memcpy( &value , buf , sizeof(value) );
+   return _swapped ? static_cast<unsigned short>( (value << 8) | (value >> 8) ) : value;
+}
+
+PcapFormat PcapReader::GetFormat() const
+{
+   return _format;
+}
+
+unsigned int PcapReader::GetLinkType() const
+{
+   return _linkType;
+}
+
+unsigned long long PcapReader::GetSkippedCount() const
+{
+   return _skipped;
+}
+
+size_t PcapReader::GetSize() const
+{
+   return _size;
+}
+
+int PcapReader::GetLastError() const
+{
+   return _error;
+}
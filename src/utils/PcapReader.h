@@ -0,0 +1,147 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pcap_reader_h_
+#define _dcl_dis_pcap_reader_h_
+
+#include <utils/PcapFormat.h>         // for member
+#include <utils/IPlaybackSource.h>    // for base class
+#include <utils/MappedFile.h>         // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <cstddef>                  // for size_t definition
+
+namespace DIS
+{
+   class IBufferProcessor;
+
+   /// one UDP datagram read from a capture file.
+   struct PcapDatagram
+   {
+      PcapDatagram()
+         : payload(NULL), length(0), timestamp(0)
+         , sourceAddress(0), sourcePort(0), destinationAddress(0), destinationPort(0)
+      {
+      }
+
+      /// the UDP payload, inside the mapped file.  valid until the reader is closed.
+      const char* payload;
+      unsigned int length;
+
+      /// the capture time, in nanoseconds since the epoch.
+      long long timestamp;
+
+      /// the IPv4 addresses in host byte order, 0 for IPv6.
+      unsigned int sourceAddress;
+      unsigned short sourcePort;
+      unsigned int destinationAddress;
+      unsigned short destinationPort;
+   };
+
+   /// reads the UDP datagrams of a pcap or pcapng capture, such as one written by tcpdump.
+   /// the file is memory mapped and the Ethernet, Linux cooked, IP and UDP headers are stripped
+   /// in place, so that the payloads can be decoded as fast as the processor allows.
+   /// frames that are not complete UDP datagrams, such as IP fragments, are skipped and counted.
+   /// the reader is an IPlaybackSource, so that a capture can be played back.
+   class EXPORT_MACRO PcapReader : public IPlaybackSource
+   {
+   public:
+      PcapReader();
+      ~PcapReader();
+
+      /// map the file and read its header.
+      /// @return 'false' if the file could not be read or is not a capture.  GetLastError() has the errno value.
+      bool Open(const std::string& path);
+
+      void Close();
+      bool IsOpen() const;
+
+      /// read the next UDP datagram.
+      /// @return 'false' at the end of the file, or when the rest of the file is malformed.
+      bool Next(PcapDatagram& datagram);
+
+      /// go back to the first datagram.
+      void Rewind();
+
+      /// read the next UDP datagram, with its addresses and capture time in the context.
+      bool Read(const char*& buf, unsigned int& size, ReceiveContext& context);
+
+      /// go to the first datagram captured at or after the time.
+      /// captures have no index, so the file is read from the start.
+      bool Seek(long long timestamp);
+
+      /// pass every remaining datagram to the processor, with its addresses and capture time in the context.
+      /// @param port only pass datagrams sent to this UDP port.  0 passes them all.
+      /// @return the number of datagrams passed to the processor.
+      unsigned long long Process(IBufferProcessor& processor, unsigned short port=0);
+
+      PcapFormat GetFormat() const;
+
+      /// @return the link layer header type of the file, or of the first interface for pcapng.
+      unsigned int GetLinkType() const;
+
+      /// @return the number of frames skipped because they were not complete UDP datagrams.
+      unsigned long long GetSkippedCount() const;
+
+      /// @return the size of the mapped file.
+      size_t GetSize() const;
+
+      int GetLastError() const;
+
+   private:
+      PcapReader(const PcapReader&);              ///< not implemented by design
+      PcapReader& operator=(const PcapReader&);   ///< not implemented by design
+
+      /// the link layer and timestamp resolution of a pcapng interface.
+      struct Interface
+      {
+         unsigned int linkType;
+
+         /// the timestamp unit is 2^-exponent seconds when binary, 10^-exponent seconds otherwise.
+         bool binary;
+         unsigned int exponent;
+      };
+
+      /// convert a pcapng timestamp to nanoseconds.
+      static long long ToNanoseconds(unsigned long long units, const Interface& iface);
+
+      bool ReadHeader();
+
+      /// read the next frame of a classic pcap file.
+      /// @return 'false' at the end of the file.
+      bool NextPcapFrame(const char*& frame, unsigned int& length, unsigned int& linkType, long long& timestamp);
+
+      /// read the next packet block of a pcapng file, remembering the interfaces along the way.
+      bool NextPcapngFrame(const char*& frame, unsigned int& length, unsigned int& linkType, long long& timestamp);
+
+      /// strip the link layer, IP and UDP headers.
+      /// @return 'false' if the frame is not a complete UDP datagram.
+      bool ParseFrame(const char* frame, unsigned int length, unsigned int linkType, PcapDatagram& datagram) const;
+
+      /// read an integer in the byte order of the file.
+      unsigned int Read32(const char* buf) const;
+      unsigned short Read16(const char* buf) const;
+
+      /// the file, and its contents.
+      MappedFile _file;
+      const char* _data;
+      size_t _size;
+      size_t _position;
+      size_t _start;
+
+      PcapFormat _format;
+      bool _swapped;
+      unsigned int _linkType;
+
+      /// the number of nanoseconds per fraction of a second in a classic pcap record.
+      long long _nanosecondsPerUnit;
+      std::vector<Interface> _interfaces;
+
+      unsigned long long _skipped;
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_pcap_reader_h_
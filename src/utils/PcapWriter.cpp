@@ -0,0 +1,222 @@
+#include <utils/PcapWriter.h>
+#include <utils/ReceiveContext.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+using namespace DIS;
+
+namespace
+{
+   const unsigned int ETHERNET_HEADER_SIZE = 14;
+   const unsigned int IPV4_HEADER_SIZE = 20;
+   const unsigned int UDP_HEADER_SIZE = 8;
+   const unsigned int FRAME_HEADER_SIZE = ETHERNET_HEADER_SIZE + IPV4_HEADER_SIZE + UDP_HEADER_SIZE;
+
+   /// the largest payload an IPv4 datagram can carry.
+   const unsigned int MAX_PAYLOAD = 65535 - IPV4_HEADER_SIZE - UDP_HEADER_SIZE;
+
+   /// the snap length written to the file header, large enough for any datagram.
+   const unsigned int SNAP_LENGTH = 65535 + ETHERNET_HEADER_SIZE;
+
+   /// the buffer size of the file stream, so that records are written in large blocks.
+   const size_t STREAM_BUFFER_SIZE = 1 << 20;
+
+   /// write the pcap file fields in the byte order of this host, as the format expects.
+   void Host16(char* buf, unsigned short value)
+   {
+      memcpy( buf , &value , sizeof(value) );
+   }
+
+   void Host32(char* buf, unsigned int value)
+   {
+      memcpy( buf , &value , sizeof(value) );
+   }
+
+   /// write the protocol header fields in network byte order.
+   void Network16(char* buf, unsigned short value)
+   {
+      buf[0] = static_cast<char>( value >> 8 );
+      buf[1] = static_cast<char>( value );
+   }
+
+   void Network32(char* buf, unsigned int value)
+   {
+      buf[0] = static_cast<char>( value >> 24 );
+      buf[1] = static_cast<char>( value >> 16 );
+      buf[2] = static_cast<char>( value >> 8 );
+      buf[3] = static_cast<char>( value );
+   }
+
+   /// the ones' complement sum of the IPv4 header.
+   unsigned short HeaderChecksum(const char* header, unsigned int size)
+   {
+      const unsigned char* bytes = reinterpret_cast<const unsigned char*>( header );
+      unsigned int sum = 0;
+      for(unsigned int i=0; i+1<size; i+=2)
+      {
+         sum += (bytes[i] << 8) | bytes[i+1];
+      }
+      while( sum >> 16 )
+      {
+         sum = (sum & 0xffff) + (sum >> 16);
+      }
+      return static_cast<unsigned short>( ~sum );
+   }
+}
+
+PcapWriter::PcapWriter()
+   : _file(NULL)
+   , _destinationPort(0)
+   , _record()
+   , _count(0)
+   , _error(0)
+{
+}
+
+PcapWriter::~PcapWriter()
+{
+   Close();
+}
+
+bool PcapWriter::Open(const std::string& path, unsigned short destinationPort)
+{
+   Close();
+
+   _file = fopen( path.c_str() , "wb" );
+   if( _file == NULL )
+   {
+      _error = errno;
+      return false;
+   }
+   setvbuf( _file , NULL , _IOFBF , STREAM_BUFFER_SIZE );
+
+   char header[PCAP_FILE_HEADER_SIZE];
+   Host32( header , PCAP_MAGIC_NANOSECONDS );
+   Host16( header + 4 , 2 );     // version 2.4
+   Host16( header + 6 , 4 );
+   Host32( header + 8 , 0 );     // the timestamps are UTC
+   Host32( header + 12 , 0 );
+   Host32( header + 16 , SNAP_LENGTH );
+   Host32( header + 20 , PCAP_LINKTYPE_ETHERNET );
+
+   if( fwrite( header , sizeof(header) , 1 , _file ) != 1 )
+   {
+      _error = errno;
+      Close();
+      return false;
+   }
+
+   _destinationPort = destinationPort;
+   _record.resize( PCAP_RECORD_HEADER_SIZE + FRAME_HEADER_SIZE );
+   _count = 0;
+   return true;
+}
+
+void PcapWriter::Close()
+{
+   if( _file != NULL )
+   {
+      fclose( _file );
+      _file = NULL;
+   }
+}
+
+bool PcapWriter::IsOpen() const
+{
+   return( _file != NULL );
+}
+
+bool PcapWriter::Write(const char* payload, unsigned int length, const ReceiveContext& context)
+{
+   if( _file == NULL || length > MAX_PAYLOAD )
+   {
+      return false;
+   }
+
+   long long timestamp = context.timestamp;
+   if( timestamp == 0 )
+   {
+      timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::system_clock::now().time_since_epoch() ).count();
+   }
+
+   const unsigned int frameLength = FRAME_HEADER_SIZE + length;
+   char* record = &_record[0];
+   Host32( record , static_cast<unsigned int>( timestamp / 1000000000LL ) );
+   Host32( record + 4 , static_cast<unsigned int>( timestamp % 1000000000LL ) );
+   Host32( record + 8 , frameLength );
+   Host32( record + 12 , frameLength );
+
+   // multicast groups map to their ethernet group address, anything else to a null address.
+   char* ethernet = record + PCAP_RECORD_HEADER_SIZE;
+   memset( ethernet , 0 , ETHERNET_HEADER_SIZE );
+   if( (context.destinationAddress >> 28) == 0xe )
+   {
+      ethernet[0] = 0x01;
+      ethernet[2] = 0x5e;
+      ethernet[3] = static_cast<char>( (context.destinationAddress >> 16) & 0x7f );
+      ethernet[4] = static_cast<char>( context.destinationAddress >> 8 );
+      ethernet[5] = static_cast<char>( context.destinationAddress );
+   }
+   Network16( ethernet + 12 , 0x0800 );
+
+   char* ip = ethernet + ETHERNET_HEADER_SIZE;
+   memset( ip , 0 , IPV4_HEADER_SIZE );
+   ip[0] = 0x45;
+   Network16( ip + 2 , static_cast<unsigned short>( IPV4_HEADER_SIZE + UDP_HEADER_SIZE + length ) );
+   Network16( ip + 6 , 0x4000 );  // don't fragment
+   ip[8] = 64;
+   ip[9] = 17;
+   Network32( ip + 12 , context.sourceAddress );
+   Network32( ip + 16 , context.destinationAddress );
+   Network16( ip + 10 , HeaderChecksum( ip , IPV4_HEADER_SIZE ) );
+
+   // a UDP checksum of 0 means none was computed.
+   char* udp = ip + IPV4_HEADER_SIZE;
+   Network16( udp , context.sourcePort );
+   Network16( udp + 2 , _destinationPort );
+   Network16( udp + 4 , static_cast<unsigned short>( UDP_HEADER_SIZE + length ) );
+   Network16( udp + 6 , 0 );
+
+   if( fwrite( record , _record.size() , 1 , _file ) != 1 ||
+       ( length > 0 && fwrite( payload , length , 1 , _file ) != 1 ) )
+   {
+      _error = errno;
+      return false;
+   }
+
+   ++_count;
+   return true;
+}
+
+void PcapWriter::Process(const char* buf, unsigned int size, Endian e)
+{
+   Process( buf , size , e , ReceiveContext() );
+}
+
+void PcapWriter::Process(const char* buf, unsigned int size, Endian /*e*/, const ReceiveContext& context)
+{
+   Write( buf , size , context );
+}
+
+bool PcapWriter::Flush()
+{
+   if( _file == NULL || fflush( _file ) != 0 )
+   {
+      _error = errno;
+      return false;
+   }
+   return true;
+}
+
+unsigned long long PcapWriter::GetCount() const
+{
+   return _count;
+}
+
+int PcapWriter::GetLastError() const
+{
+   return _error;
+}
@@ -0,0 +1,69 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pcap_writer_h_
+#define _dcl_dis_pcap_writer_h_
+
+#include <utils/IBufferProcessor.h>   // for base class
+#include <utils/PcapFormat.h>         // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <cstdio>                   // for FILE
+
+namespace DIS
+{
+   /// writes UDP datagrams to a classic pcap file with nanosecond timestamps,
+   /// which tcpdump, Wireshark and PcapReader can read.
+   /// each payload is wrapped in Ethernet, IPv4 and UDP headers built from its ReceiveContext.
+   /// the writer is an IBufferProcessor, so a transport can record straight to the file.
+   class EXPORT_MACRO PcapWriter : public IBufferProcessor
+   {
+   public:
+      PcapWriter();
+
+      /// flushes and closes the file.
+      ~PcapWriter();
+
+      /// create the file and write its header.
+      /// @param destinationPort the UDP port written for the datagrams, which ReceiveContext does not carry.
+      /// @return 'false' if the file could not be created.  GetLastError() has the errno value.
+      bool Open(const std::string& path, unsigned short destinationPort=3000);
+
+      void Close();
+      bool IsOpen() const;
+
+      /// write one datagram.
+      /// the source and destination come from the context, and a context without a timestamp is stamped with the current time.
+      /// @return 'false' if the payload does not fit one datagram or the file could not be written.
+      bool Write(const char* payload, unsigned int length, const ReceiveContext& context);
+
+      /// write the buffer as one datagram.
+      void Process(const char* buf, unsigned int size, Endian e);
+      void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context);
+
+      /// write the buffered records to the file.
+      bool Flush();
+
+      /// @return the number of datagrams written.
+      unsigned long long GetCount() const;
+
+      int GetLastError() const;
+
+   private:
+      PcapWriter(const PcapWriter&);              ///< not implemented by design
+      PcapWriter& operator=(const PcapWriter&);   ///< not implemented by design
+
+      FILE* _file;
+      unsigned short _destinationPort;
+
+      /// holds one record while it is built.
+      std::vector<char> _record;
+
+      unsigned long long _count;
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_pcap_writer_h_
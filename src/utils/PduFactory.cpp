@@ -1,17 +1,5 @@
 #include "PduFactory.h"
-#include <dis6/EntityStatePdu.h>
-#include <dis6/FirePdu.h>
-#include <dis6/SetDataPdu.h>
-#include <dis6/DetonationPdu.h>
-#include <dis6/CreateEntityPdu.h>
-#include <dis6/RemoveEntityPdu.h>
-#include <dis6/StartResumePdu.h>
-#include <dis6/StopFreezePdu.h>
-#include <dis6/ElectromagneticEmissionsPdu.h>
-#include <dis6/TransmitterPdu.h>
-#include <dis6/SignalPdu.h>
-#include <dis6/ReceiverPdu.h>
-#include <dis6/TransferControlRequestPdu.h>
+#include <utils/PDUBank.h>
 #include <utils/Endian.h>
 #include <utils/PDUType.h>
 
@@ -40,84 +28,21 @@ PduFactory::~PduFactory(void)
 Pdu * PduFactory::createPdu(const char* data)
 {
 	int dataLength = 1500; // MTU, might fail for some very large PDUs
-	int pduType = data[2];
+	int pduType = static_cast<unsigned char>( data[2] );
 
 	//std::cout << "Decoding PDU of type " << (int)pduType << std::endl;
 
 	DataStream dataStream(data, dataLength, DIS::BIG);
 
-	Pdu* pdu = NULL;
-
-	switch(pduType)
+	// the classes are those of dis6/PduRegistry.h, shared with the PDU bank.
+	Pdu* pdu = PduBank::CreatePDU( static_cast<PDUType>( pduType ) );
+	if( pdu != NULL )
 	{
-	case PDU_ENTITY_STATE:
-	    pdu = new EntityStatePdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	case PDU_FIRE:
-		pdu = new FirePdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	case PDU_DETONATION:
-		pdu = new DetonationPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	case PDU_SET_DATA:
-		pdu = new SetDataPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	case PDU_CREATE_ENTITY:
-		pdu = new CreateEntityPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	case PDU_REMOVE_ENTITY:
-		pdu = new RemoveEntityPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_START_RESUME:
-		pdu = new StartResumePdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_STOP_FREEZE:
-		pdu = new StopFreezePdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_ELECTRONIC_EMMISIONS:
-		pdu = new ElectromagneticEmissionsPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_TRANSMITTER:
-		pdu = new TransmitterPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_SIGNAL:
-		pdu = new SignalPdu();
 		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_RECEIVER:
-		pdu = new ReceiverPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-        case PDU_TRANSFER_OWNERSHIP:
-		pdu = new TransferControlRequestPdu();
-		pdu->unmarshal(dataStream);
-		break;
-
-	default:
-		std::cout << "Received Unrecognized PDU of type " << (int)pduType << " change PduFactory.cpp to add new PDUs" << std::endl;
-		break;
+	}
+	else
+	{
+		std::cout << "Received Unrecognized PDU of type " << pduType << " add it to dis6/PduRegistry.h to add new PDUs" << std::endl;
 	}
 
 	return pdu;
@@ -0,0 +1,166 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pdu_header_h_
+#define _dcl_dis_pdu_header_h_
+
+#include <utils/Endian.h>             // for parameter
+
+namespace DIS
+{
+   /// the PDU header is common to every PDU, and is 12 bytes long.
+   const unsigned int PDU_HEADER_SIZE = 12;
+
+   /// the byte positions of the PDU header fields, as defined by IEEE Std 1278.1.
+   const unsigned int PDU_VERSION_POSITION = 0;
+   const unsigned int PDU_EXERCISE_POSITION = 1;
+   const unsigned int PDU_TYPE_POSITION = 2;
+   const unsigned int PDU_FAMILY_POSITION = 3;
+   const unsigned int PDU_TIMESTAMP_POSITION = 4;
+   const unsigned int PDU_LENGTH_POSITION = 8;
+
+   /// most PDUs begin their body with the ID of the entity the PDU describes or was issued by,
+   /// such as the entity ID of the Entity State PDU or the firing entity ID of the Fire PDU.
+   const unsigned int PDU_ENTITY_ID_POSITION = 12;
+   const unsigned int ENTITY_ID_SIZE = 6;
+
+   /// reads and writes header fields directly in a marshalled PDU, without unmarshalling it.
+   /// the callers are responsible for the buffer holding at least PDU_HEADER_SIZE bytes.
+   struct PduHeader
+   {
+      static unsigned char GetPduType(const char* pdu)
+      {
+         return static_cast<unsigned char>( pdu[PDU_TYPE_POSITION] );
+      }
+
+      static unsigned char GetProtocolFamily(const char* pdu)
+      {
+         return static_cast<unsigned char>( pdu[PDU_FAMILY_POSITION] );
+      }
+
+      static unsigned short GetLength(const char* pdu, Endian e=BIG)
+      {
+         return static_cast<unsigned short>( ReadUnsigned( pdu + PDU_LENGTH_POSITION , 2 , e ) );
+      }
+
+      /// the length of the PDU at the start of the bytes left in a datagram of bundled PDUs.
+      /// @param remaining the bytes left in the datagram, at least PDU_HEADER_SIZE.
+      /// @return 0 when the length field is shorter than the header or longer than the bytes left,
+      /// and the PDU can not be skipped by it.
+      static unsigned int GetBundledLength(const char* pdu, unsigned int remaining, Endian e=BIG)
+      {
+         const unsigned int length = GetLength( pdu , e );
+         return ( length < PDU_HEADER_SIZE || length > remaining ) ? 0 : length;
+      }
+
+      static unsigned int GetTimestamp(const char* pdu, Endian e=BIG)
+      {
+         return ReadUnsigned( pdu + PDU_TIMESTAMP_POSITION , 4 , e );
+      }
+
+      /// overwrite the timestamp of a marshalled PDU.  the rest of the PDU is unchanged.
+      static void SetTimestamp(char* pdu, unsigned int timestamp, Endian e=BIG)
+      {
+         WriteUnsigned( pdu + PDU_TIMESTAMP_POSITION , 4 , timestamp , e );
+      }
+
+      /// convert a time to a DIS timestamp: the time past the hour in units of 3600/2^31 seconds,
+      /// shifted left by one bit, with the lowest bit set for absolute time.
+      /// @param nanoseconds the time since the epoch.
+      static unsigned int MakeTimestamp(long long nanoseconds, bool absolute=true)
+      {
+         const long long NANOSECONDS_PER_HOUR = 3600000000000LL;
+         long long past = nanoseconds % NANOSECONDS_PER_HOUR;
+         if( past < 0 )
+         {
+            past += NANOSECONDS_PER_HOUR;
+         }
+         const unsigned int units = static_cast<unsigned int>( past * ( 2147483648.0 / NANOSECONDS_PER_HOUR ) );
+         return ( units << 1 ) | ( absolute ? 1u : 0u );
+      }
+
+      /// pack the site, application and entity numbers following the header into one value.
+      /// @param length the number of bytes in the PDU.
+      /// @return 0 when the PDU is too short to hold an entity ID.
+      static unsigned long long GetEntityKey(const char* pdu, unsigned int length)
+      {
+         if( length < PDU_ENTITY_ID_POSITION + ENTITY_ID_SIZE )
+         {
+            return 0;
+         }
+
+         unsigned long long key = 0;
+         for(unsigned int i=0; i<ENTITY_ID_SIZE; ++i)
+         {
+            key = (key << 8) | static_cast<unsigned char>( pdu[PDU_ENTITY_ID_POSITION+i] );
+         }
+         return key;
+      }
+
+      /// pack an entity ID the way GetEntityKey does.
+      static unsigned long long MakeEntityKey(unsigned short site, unsigned short application, unsigned short entity)
+      {
+         return ( static_cast<unsigned long long>( site ) << 32 ) |
+                ( static_cast<unsigned long long>( application ) << 16 ) | entity;
+      }
+
+      /// spread the entity key over the whole value range, for partitioning entities among workers.
+      static unsigned long long HashEntityKey(unsigned long long key)
+      {
+         key ^= key >> 33;
+         key *= 0xff51afd7ed558ccdULL;
+         key ^= key >> 33;
+         key *= 0xc4ceb9fe1a85ec53ULL;
+         key ^= key >> 33;
+         return key;
+      }
+
+      /// read an unsigned integer of 'size' bytes in the stream's byte order.
+      static unsigned int ReadUnsigned(const char* buf, unsigned int size, Endian e)
+      {
+         const unsigned char* bytes = reinterpret_cast<const unsigned char*>( buf );
+         unsigned int value = 0;
+         for(unsigned int i=0; i<size; ++i)
+         {
+            const unsigned int index = ( e == BIG ) ? i : size - 1 - i;
+            value = (value << 8) | bytes[index];
+         }
+         return value;
+      }
+
+      /// write an unsigned integer of 'size' bytes in the stream's byte order.
+      static void WriteUnsigned(char* buf, unsigned int size, unsigned int value, Endian e)
+      {
+         unsigned char* bytes = reinterpret_cast<unsigned char*>( buf );
+         for(unsigned int i=0; i<size; ++i)
+         {
+            const unsigned int index = ( e == BIG ) ? size - 1 - i : i;
+            bytes[index] = static_cast<unsigned char>( value );
+            value >>= 8;
+         }
+      }
+   };
+
+   /// call the function with each PDU bundled in a datagram, as fn( pdu , length , offset ).
+   /// a malformed length leaves the rest of the datagram to the decoder, as one PDU.
+   /// the bytes after the last whole header are not passed.
+   template<typename Function>
+   void ForEachBundledPdu(const char* buf, unsigned int size, Endian e, Function fn)
+   {
+      unsigned int offset = 0;
+      while( size - offset >= PDU_HEADER_SIZE )
+      {
+         const unsigned int remaining = size - offset;
+         unsigned int length = PduHeader::GetBundledLength( buf + offset , remaining , e );
+         if( length == 0 )
+         {
+            length = remaining;
+         }
+
+         fn( buf + offset , length , offset );
+         offset += length;
+      }
+   }
+}
+
+#endif  // _dcl_dis_pdu_header_h_
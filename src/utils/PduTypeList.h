@@ -0,0 +1,195 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pdu_type_list_h_
+#define _dcl_dis_pdu_type_list_h_
+
+#include <cstddef>                // for NULL definition
+#include <type_traits>            // for std::conditional
+
+namespace DIS
+{
+   /// the number of values of the PDU type field, and the size of the jump tables.
+   const unsigned int PDU_TYPE_TABLE_SIZE = 256;
+
+   /// a PDU class, and the value of the PDU type field identifying it.
+   template<unsigned char Type, typename T>
+   struct PduRegistryEntry
+   {
+      static const unsigned char TYPE = Type;
+      typedef T PduClass;
+   };
+
+   /// the PDU classes of a library, listed once in dis6/PduRegistry.h or dis7/PduRegistry.h,
+   /// from which every table mapping a PDU type to its class is generated at compile time.
+   template<typename... Entries>
+   struct PduTypeList
+   {
+      static const unsigned int SIZE = sizeof...(Entries);
+   };
+
+   template<typename... Entries>
+   const unsigned int PduTypeList<Entries...>::SIZE;
+
+   /// PduClassOf<List, Type>::PduClass is the class registered for the type, or void.
+   template<typename List, unsigned int Type>
+   struct PduClassOf;
+
+   template<unsigned int Type>
+   struct PduClassOf<PduTypeList<>, Type>
+   {
+      typedef void PduClass;
+   };
+
+   template<unsigned int Type, typename Entry, typename... Rest>
+   struct PduClassOf<PduTypeList<Entry, Rest...>, Type>
+      : std::conditional< Entry::TYPE == Type , Entry , PduClassOf<PduTypeList<Rest...>, Type> >::type
+   {
+   };
+
+   /// PduTypeOf<List, T>::value is the type the class is registered for.
+   /// PduTypeOf<List, T>::FOUND is 'false' when the class is not registered.
+   template<typename List, typename T>
+   struct PduTypeOf;
+
+   template<bool Found, unsigned char Type>
+   struct PduTypeResult
+   {
+      static const bool FOUND = Found;
+      static const unsigned char value = Type;
+   };
+
+   template<typename T>
+   struct PduTypeOf<PduTypeList<>, T> : PduTypeResult<false, 0>
+   {
+   };
+
+   template<typename T, typename Entry, typename... Rest>
+   struct PduTypeOf<PduTypeList<Entry, Rest...>, T>
+      : std::conditional< std::is_same<typename Entry::PduClass, T>::value ,
+                          PduTypeResult<true, Entry::TYPE> ,
+                          PduTypeOf<PduTypeList<Rest...>, T> >::type
+   {
+   };
+
+   /// PduTypesUnique<List>::value is 'false' when two entries have the same type.
+   template<typename List>
+   struct PduTypesUnique;
+
+   template<>
+   struct PduTypesUnique< PduTypeList<> > : std::true_type
+   {
+   };
+
+   template<typename Entry, typename... Rest>
+   struct PduTypesUnique< PduTypeList<Entry, Rest...> >
+      : std::integral_constant< bool , std::is_void< typename PduClassOf<PduTypeList<Rest...>, Entry::TYPE>::PduClass >::value
+                                       && PduTypesUnique< PduTypeList<Rest...> >::value >
+   {
+   };
+
+   /// the indices of a jump table.
+   template<unsigned int... Indices>
+   struct PduTableIndices
+   {
+   };
+
+   template<unsigned int N, unsigned int... Indices>
+   struct MakePduTableIndices : MakePduTableIndices<N - 1, N - 1, Indices...>
+   {
+   };
+
+   template<unsigned int... Indices>
+   struct MakePduTableIndices<0, Indices...>
+   {
+      typedef PduTableIndices<Indices...> Type;
+   };
+
+   /// the entry of an operation for a class, NULL when no class is registered for the type.
+   template<typename Operation, typename T>
+   struct PduOperationOf
+   {
+      static constexpr typename Operation::Function Get()
+      {
+         return &Operation::template Call<T>;
+      }
+   };
+
+   template<typename Operation>
+   struct PduOperationOf<Operation, void>
+   {
+      static constexpr typename Operation::Function Get()
+      {
+         return NULL;
+      }
+   };
+
+   /// a table of the operation for every PDU type, indexed by the type.
+   /// the operation declares the function type of its entries, and the function template of a class:
+   ///
+   ///    struct Create
+   ///    {
+   ///       typedef Pdu* (*Function)();
+   ///       template<typename T> static Pdu* Call() { return new T(); }
+   ///    };
+   ///
+   ///    Pdu* pdu = PduJumpTable<PduRegistry, Create>::TABLE[type]();
+   ///
+   /// the table is a constant, initialized before any code runs.
+   template<typename List, typename Operation, typename Indices = typename MakePduTableIndices<PDU_TYPE_TABLE_SIZE>::Type>
+   struct PduJumpTable;
+
+   template<typename List, typename Operation, unsigned int... Indices>
+   struct PduJumpTable< List , Operation , PduTableIndices<Indices...> >
+   {
+      static_assert( PduTypesUnique<List>::value , "a PDU type is registered twice" );
+
+      typedef typename Operation::Function Function;
+
+      /// @return the entry of the type, NULL when no class is registered for it.
+      static Function Get(unsigned char type)
+      {
+         return TABLE[type];
+      }
+
+      static const Function TABLE[PDU_TYPE_TABLE_SIZE];
+   };
+
+   template<typename List, typename Operation, unsigned int... Indices>
+   const typename Operation::Function PduJumpTable< List , Operation , PduTableIndices<Indices...> >::TABLE[PDU_TYPE_TABLE_SIZE] =
+   {
+      PduOperationOf< Operation , typename PduClassOf<List, Indices>::PduClass >::Get()...
+   };
+
+   /// call the operation on each entry of the list, in order, such as to register the classes:
+   ///
+   ///    struct Register
+   ///    {
+   ///       template<typename Entry> void Call() { factory.RegisterPacket<typename Entry::PduClass>( Entry::TYPE ); }
+   ///       PacketFactory& factory;
+   ///    };
+   template<typename List>
+   struct PduTypeListForEach;
+
+   template<>
+   struct PduTypeListForEach< PduTypeList<> >
+   {
+      template<typename Operation>
+      static void Apply(Operation& /*operation*/)
+      {
+      }
+   };
+
+   template<typename Entry, typename... Rest>
+   struct PduTypeListForEach< PduTypeList<Entry, Rest...> >
+   {
+      template<typename Operation>
+      static void Apply(Operation& operation)
+      {
+         operation.template Call<Entry>();
+         PduTypeListForEach< PduTypeList<Rest...> >::Apply( operation );
+      }
+   };
+}
+
+#endif  // _dcl_dis_pdu_type_list_h_
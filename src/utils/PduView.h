@@ -0,0 +1,54 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_pdu_view_h_
+#define _dcl_dis_pdu_view_h_
+
+#include <utils/PduHeader.h>          // for usage
+
+#include <cstddef>                  // for NULL definition
+
+namespace DIS
+{
+   /// a non-owning view of one marshalled PDU, such as a PDU inside a mapped recording,
+   /// with the details of its reception.  the header fields are read from the bytes on demand,
+   /// so that PDUs can be inspected without being unmarshalled.
+   struct PduView
+   {
+      PduView()
+         : pdu(NULL), length(0), timestamp(0)
+         , sourceAddress(0), sourcePort(0), destinationAddress(0)
+      {
+      }
+
+      unsigned char GetPduType() const
+      {
+         return PduHeader::GetPduType( pdu );
+      }
+
+      unsigned char GetProtocolFamily() const
+      {
+         return PduHeader::GetProtocolFamily( pdu );
+      }
+
+      /// @return the packed entity ID following the header, 0 when the PDU is too short.
+      unsigned long long GetEntityKey() const
+      {
+         return PduHeader::GetEntityKey( pdu , length );
+      }
+
+      /// the PDU bytes, which belong to the owner of the view.
+      const char* pdu;
+      unsigned int length;
+
+      /// the receive time, in nanoseconds since the epoch.
+      long long timestamp;
+
+      /// the IPv4 addresses in host byte order.
+      unsigned int sourceAddress;
+      unsigned short sourcePort;
+      unsigned int destinationAddress;
+   };
+}
+
+#endif  // _dcl_dis_pdu_view_h_
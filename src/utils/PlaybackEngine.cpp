@@ -0,0 +1,258 @@
+#include <utils/PlaybackEngine.h>
+
+#if defined(__linux__)
+
+#include <utils/IPlaybackSource.h>
+#include <utils/UdpTransport.h>
+#include <utils/PduHeader.h>
+
+#include <chrono>
+#include <ctime>
+
+using namespace DIS;
+
+namespace
+{
+   /// a buffer sent later than this after it was due counts as late.
+   const long long LATE_NANOSECONDS = 1000000;
+
+   /// the longest sleep before checking whether the playback was stopped.
+   const long long MAX_SLEEP_NANOSECONDS = 100000000;
+
+   /// copies every buffer into the send ring of the transport.
+   class TransportProcessor : public IBufferProcessor
+   {
+   public:
+      explicit TransportProcessor(UdpTransport& transport)
+         : _transport(transport)
+      {
+      }
+
+      void Process(const char* buf, unsigned int size, Endian /*e*/)
+      {
+         _transport.Send( buf , size );
+      }
+
+   private:
+      TransportProcessor(const TransportProcessor&);              ///< not implemented by design
+      TransportProcessor& operator=(const TransportProcessor&);   ///< not implemented by design
+
+      UdpTransport& _transport;
+   };
+
+   long long SystemNanoseconds()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::system_clock::now().time_since_epoch() ).count();
+   }
+}
+
+PlaybackSettings::PlaybackSettings()
+   : speed(1.0)
+   , rewriteTimestamps(false)
+   , batchWindowUs(100)
+   , spinUs(50)
+   , maxBatch(64)
+{
+}
+
+PlaybackStatistics::PlaybackStatistics()
+   : sent(0)
+   , batches(0)
+   , late(0)
+   , maxLateness(0)
+{
+}
+
+PlaybackEngine::PlaybackEngine()
+   : _playing(false)
+   , _stop(false)
+   , _scratch()
+   , _sent(0)
+   , _batches(0)
+   , _late(0)
+   , _maxLateness(0)
+{
+}
+
+unsigned long long PlaybackEngine::Play(IPlaybackSource& source, UdpTransport& transport, const PlaybackSettings& settings)
+{
+   TransportProcessor processor( transport );
+   return Play( source , processor , &transport , settings );
+}
+
+unsigned long long PlaybackEngine::Play(IPlaybackSource& source, IBufferProcessor& processor, const PlaybackSettings& settings)
+{
+   return Play( source , processor , NULL , settings );
+}
+
+unsigned long long PlaybackEngine::Play(IPlaybackSource& source, IBufferProcessor& processor, UdpTransport* transport,
+                                        const PlaybackSettings& settings)
+{
+   _stop = false;
+   _playing = true;
+   _sent = 0;
+   _batches = 0;
+   _late = 0;
+   _maxLateness = 0;
+
+   const bool paced = ( settings.speed > 0.0 );
+   const long long window = static_cast<long long>( settings.batchWindowUs ) * 1000;
+   const long long spin = static_cast<long long>( settings.spinUs ) * 1000;
+   const unsigned int maxBatch = ( settings.maxBatch > 0 ) ? settings.maxBatch : 1;
+
+   const char* buf = NULL;
+   unsigned int size = 0;
+   ReceiveContext context;
+   bool more = source.Read( buf , size , context );
+
+   // the first buffer is due now, and the others keep their recorded distance from it.
+   const long long firstRecorded = context.timestamp;
+   const long long start = Now();
+   long long due = start;
+
+   unsigned long long sent = 0;
+   while( more && !_stop.load( std::memory_order_relaxed ) )
+   {
+      if( paced && due > Now() && !SleepUntil( due , spin ) )
+      {
+         break;
+      }
+
+      const long long batchDue = due;
+      const long long sendTime = Now();
+      const long long wallTime = settings.rewriteTimestamps ? SystemNanoseconds() : 0;
+
+      unsigned int batch = 0;
+      do
+      {
+         if( paced && sendTime - due > 0 )
+         {
+            const long long lateness = sendTime - due;
+            if( lateness > LATE_NANOSECONDS )
+            {
+               _late.fetch_add( 1 , std::memory_order_relaxed );
+            }
+            if( lateness > _maxLateness.load( std::memory_order_relaxed ) )
+            {
+               _maxLateness.store( lateness , std::memory_order_relaxed );
+            }
+         }
+
+         if( settings.rewriteTimestamps )
+         {
+            buf = Rewrite( buf , size , wallTime );
+         }
+         processor.Process( buf , size , BIG , context );
+         ++batch;
+
+         more = source.Read( buf , size , context );
+         if( more && paced )
+         {
+            due = start + static_cast<long long>( ( context.timestamp - firstRecorded ) / settings.speed );
+         }
+      }
+      while( more && batch < maxBatch && ( !paced || due <= batchDue + window ) );
+
+      if( transport != NULL )
+      {
+         transport->Flush();
+      }
+
+      sent += batch;
+      _sent.fetch_add( batch , std::memory_order_relaxed );
+      _batches.fetch_add( 1 , std::memory_order_relaxed );
+   }
+
+   _playing = false;
+   return sent;
+}
+
+const char* PlaybackEngine::Rewrite(const char* buf, unsigned int size, long long now)
+{
+   if( size < PDU_HEADER_SIZE )
+   {
+      return buf;
+   }
+
+   _scratch.assign( buf , buf + size );
+   char* copy = &_scratch[0];
+
+   // every PDU of the buffer is sent with the same time.
+   unsigned int offset = 0;
+   while( size - offset >= PDU_HEADER_SIZE )
+   {
+      char* pdu = copy + offset;
+      const bool absolute = ( PduHeader::GetTimestamp( pdu ) & 1 ) != 0;
+      PduHeader::SetTimestamp( pdu , PduHeader::MakeTimestamp( now , absolute ) );
+
+      unsigned int length = PduHeader::GetLength( pdu );
+      if( length < PDU_HEADER_SIZE || length > size - offset )
+      {
+         break;
+      }
+      offset += length;
+   }
+
+   return copy;
+}
+
+bool PlaybackEngine::SleepUntil(long long deadline, long long spin)
+{
+   // sleep most of the way, in slices short enough to notice Stop().
+   long long wake = deadline - spin;
+   while( Now() < wake )
+   {
+      if( _stop.load( std::memory_order_relaxed ) )
+      {
+         return false;
+      }
+
+      long long until = wake;
+      if( until - Now() > MAX_SLEEP_NANOSECONDS )
+      {
+         until = Now() + MAX_SLEEP_NANOSECONDS;
+      }
+
+      timespec time;
+      time.tv_sec = static_cast<time_t>( until / 1000000000 );
+      time.tv_nsec = static_cast<long>( until % 1000000000 );
+      clock_nanosleep( CLOCK_MONOTONIC , TIMER_ABSTIME , &time , NULL );
+   }
+
+   // then spin for the rest, which the timer slack would otherwise overshoot.
+   while( Now() < deadline )
+   {
+   }
+
+   return !_stop.load( std::memory_order_relaxed );
+}
+
+long long PlaybackEngine::Now()
+{
+   timespec time;
+   clock_gettime( CLOCK_MONOTONIC , &time );
+   return static_cast<long long>( time.tv_sec ) * 1000000000 + time.tv_nsec;
+}
+
+void PlaybackEngine::Stop()
+{
+   _stop = true;
+}
+
+bool PlaybackEngine::IsPlaying() const
+{
+   return _playing.load();
+}
+
+PlaybackStatistics PlaybackEngine::GetStatistics() const
+{
+   PlaybackStatistics statistics;
+   statistics.sent = _sent.load( std::memory_order_relaxed );
+   statistics.batches = _batches.load( std::memory_order_relaxed );
+   statistics.late = _late.load( std::memory_order_relaxed );
+   statistics.maxLateness = _maxLateness.load( std::memory_order_relaxed );
+   return statistics;
+}
+
+#endif  // __linux__
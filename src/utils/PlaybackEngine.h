@@ -0,0 +1,125 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_playback_engine_h_
+#define _dcl_dis_playback_engine_h_
+
+#if defined(__linux__)
+
+#include <utils/IBufferProcessor.h>   // for parameter
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <vector>                   // for member
+#include <atomic>                   // for member
+
+namespace DIS
+{
+   class IPlaybackSource;
+   class UdpTransport;
+
+   /// the parameters of one playback.
+   struct EXPORT_MACRO PlaybackSettings
+   {
+      PlaybackSettings();
+
+      /// the playback rate relative to the recording, such as 0.25 or 100.
+      /// 1 plays at the recorded pace, 0 plays as fast as possible.
+      double speed;
+
+      /// when 'true' the timestamp of every PDU is rewritten with the time it is sent,
+      /// keeping its absolute or relative flag.
+      bool rewriteTimestamps;
+
+      /// buffers due within this many microseconds of the first buffer of a batch are sent with it.
+      unsigned int batchWindowUs;
+
+      /// the scheduler sleeps until this many microseconds before a batch is due, then spins,
+      /// so that the batch is not delayed by the timer slack of the kernel.
+      unsigned int spinUs;
+
+      /// the most buffers sent in one batch.
+      unsigned int maxBatch;
+   };
+
+   /// how closely a playback kept to the recorded pace.
+   struct EXPORT_MACRO PlaybackStatistics
+   {
+      PlaybackStatistics();
+
+      /// the number of buffers and batches sent.
+      unsigned long long sent;
+      unsigned long long batches;
+
+      /// the number of buffers sent more than a millisecond after they were due.
+      unsigned long long late;
+
+      /// the longest time a buffer was sent after it was due, in nanoseconds.
+      long long maxLateness;
+   };
+
+   /// re-emits recorded traffic, such as a RecordingReader or a PcapReader, with its original pacing
+   /// scaled by a speed factor, or as fast as possible.
+   /// the buffers are scheduled against the monotonic clock with clock_nanosleep and a short spin,
+   /// rather than a millisecond tick, and the buffers due at about the same time are sent together,
+   /// so that tens of thousands of PDUs per second keep their spacing.
+   /// PDU timestamps can be rewritten in the raw bytes as the PDUs are sent.
+   /// playback starts at the current position of the source, so seek the source to start later.
+   /// this class is only available on Linux.
+   class EXPORT_MACRO PlaybackEngine
+   {
+   public:
+      PlaybackEngine();
+
+      /// send the remaining buffers of the source through the transport, flushing it after each batch.
+      /// blocks until the end of the source or Stop().
+      /// @return the number of buffers sent.
+      unsigned long long Play(IPlaybackSource& source, UdpTransport& transport, const PlaybackSettings& settings=PlaybackSettings());
+
+      /// pass the remaining buffers of the source to the processor, with their recorded context.
+      /// blocks until the end of the source or Stop().
+      /// @return the number of buffers passed to the processor.
+      unsigned long long Play(IPlaybackSource& source, IBufferProcessor& processor, const PlaybackSettings& settings=PlaybackSettings());
+
+      /// end the playback after the current batch.  safe to call from any thread.
+      void Stop();
+
+      bool IsPlaying() const;
+
+      /// @return the statistics of the current or last playback.  safe to call from any thread.
+      PlaybackStatistics GetStatistics() const;
+
+   private:
+      PlaybackEngine(const PlaybackEngine&);              ///< not implemented by design
+      PlaybackEngine& operator=(const PlaybackEngine&);   ///< not implemented by design
+
+      /// play to the processor, and flush the transport after each batch when there is one.
+      unsigned long long Play(IPlaybackSource& source, IBufferProcessor& processor, UdpTransport* transport,
+                              const PlaybackSettings& settings);
+
+      /// copy the buffer and rewrite the timestamps of its PDUs.
+      /// @return the copy.
+      const char* Rewrite(const char* buf, unsigned int size, long long now);
+
+      /// wait on the monotonic clock until the time, in nanoseconds.
+      /// @return 'false' if the playback was stopped while waiting.
+      bool SleepUntil(long long deadline, long long spin);
+
+      /// @return the monotonic clock, in nanoseconds.
+      static long long Now();
+
+      std::atomic<bool> _playing;
+      std::atomic<bool> _stop;
+
+      /// the copy of the buffer whose timestamps are rewritten.
+      std::vector<char> _scratch;
+
+      std::atomic<unsigned long long> _sent;
+      std::atomic<unsigned long long> _batches;
+      std::atomic<unsigned long long> _late;
+      std::atomic<long long> _maxLateness;
+   };
+}
+
+#endif  // __linux__
+
+#endif  // _dcl_dis_playback_engine_h_
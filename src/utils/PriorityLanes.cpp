@@ -0,0 +1,221 @@
+#include <utils/PriorityLanes.h>
+#include <utils/PduHeader.h>
+#include <utils/PDUType.h>
+
+#include <chrono>
+#include <cstring>
+
+using namespace DIS;
+
+namespace
+{
+   /// the number of values of the protocol family field.
+   const unsigned int FAMILY_COUNT = 256;
+
+   long long SteadyNanoseconds()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::steady_clock::now().time_since_epoch() ).count();
+   }
+}
+
+PriorityLaneSettings::PriorityLaneSettings(unsigned int capacity, unsigned int budget, unsigned int maxAgeMs)
+   : capacity(capacity)
+   , budget(budget)
+   , maxAgeMs(maxAgeMs)
+{
+}
+
+PriorityLanesSettings::PriorityLanesSettings()
+   : lanes()
+   , familyLanes(FAMILY_COUNT, PRIORITY_LANE_STATE)
+   , slotSize(1500)
+{
+   lanes.push_back( PriorityLaneSettings( 1024 , 64 ) );   // PRIORITY_LANE_CRITICAL
+   lanes.push_back( PriorityLaneSettings( 4096 , 32 ) );   // PRIORITY_LANE_STATE
+   lanes.push_back( PriorityLaneSettings( 1024 , 8 ) );    // PRIORITY_LANE_RADIO
+
+   familyLanes[PROTOCOL_FAMILY_WARFARE] = PRIORITY_LANE_CRITICAL;
+   familyLanes[PROTOCOL_FAMILY_SIMULATION_MANAGEMENT] = PRIORITY_LANE_CRITICAL;
+   familyLanes[PROTOCOL_FAMILY_SIMULATION_MANAGEMENT_WITH_RELIABILITY] = PRIORITY_LANE_CRITICAL;
+   familyLanes[PROTOCOL_FAMILY_RADIO_COMMUNICATIONS] = PRIORITY_LANE_RADIO;
+}
+
+PriorityLanes::Lane::Lane(const PriorityLaneSettings& settings, const Slot& prototype)
+   : settings(settings)
+   , ring(settings.capacity, prototype)
+   , received(0)
+   , dispatched(0)
+   , shedFull(0)
+   , shedStale(0)
+{
+}
+
+PriorityLanes::PriorityLanes(const PriorityLanesSettings& settings)
+   : _lanes()
+   , _familyLanes(settings.familyLanes)
+{
+   Slot prototype;
+   prototype.endian = BIG;
+   prototype.length = 0;
+   prototype.queued = 0;
+   prototype.data.resize( settings.slotSize );
+
+   for(unsigned int i=0; i<settings.lanes.size(); ++i)
+   {
+      _lanes.push_back( new Lane( settings.lanes[i] , prototype ) );
+   }
+   if( _lanes.empty() )
+   {
+      _lanes.push_back( new Lane( PriorityLaneSettings() , prototype ) );
+   }
+
+   // families without a valid lane go to the lowest one.
+   const unsigned int lowest = static_cast<unsigned int>( _lanes.size() ) - 1;
+   _familyLanes.resize( FAMILY_COUNT , lowest );
+   for(unsigned int family=0; family<FAMILY_COUNT; ++family)
+   {
+      if( _familyLanes[family] > lowest )
+      {
+         _familyLanes[family] = lowest;
+      }
+   }
+}
+
+PriorityLanes::~PriorityLanes()
+{
+   for(unsigned int i=0; i<_lanes.size(); ++i)
+   {
+      delete _lanes[i];
+   }
+}
+
+void PriorityLanes::Process(const char* buf, unsigned int size, Endian e)
+{
+   Process( buf , size , e , ReceiveContext() );
+}
+
+void PriorityLanes::Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context)
+{
+   ReceiveContext pduContext( context );
+   long long now = 0;
+
+   ForEachBundledPdu( buf , size , e , [&](const char* pdu, unsigned int length, unsigned int offset)
+   {
+      pduContext.pduOffset = context.pduOffset + offset;
+      Lane& lane = *_lanes[_familyLanes[PduHeader::GetProtocolFamily( pdu )]];
+      lane.received.fetch_add( 1 , std::memory_order_relaxed );
+
+      Slot* slot = lane.ring.Reserve();
+      if( slot == NULL || length > slot->data.size() )
+      {
+         lane.shedFull.fetch_add( 1 , std::memory_order_relaxed );
+      }
+      else
+      {
+         memcpy( &slot->data[0] , pdu , length );
+         slot->length = length;
+         slot->endian = e;
+         slot->context = pduContext;
+         if( lane.settings.maxAgeMs > 0 )
+         {
+            // read the clock once per datagram.
+            if( now == 0 )
+            {
+               now = SteadyNanoseconds();
+            }
+            slot->queued = now;
+         }
+         lane.ring.Publish();
+      }
+
+      ++pduContext.pduIndex;
+   } );
+}
+
+unsigned int PriorityLanes::Dispatch(IBufferProcessor& processor, unsigned int max)
+{
+   const long long now = SteadyNanoseconds();
+   unsigned int dispatched = 0;
+
+   // every pass starts again from the highest lane, until a pass finds nothing.
+   while( dispatched < max )
+   {
+      unsigned int pass = 0;
+      for(unsigned int i=0; i<_lanes.size() && dispatched < max; ++i)
+      {
+         Lane& lane = *_lanes[i];
+         unsigned int budget = lane.settings.budget > 0 ? lane.settings.budget : 1;
+         if( budget > max - dispatched )
+         {
+            budget = max - dispatched;
+         }
+
+         const unsigned int count = DispatchLane( lane , processor , budget , now );
+         dispatched += count;
+         pass += count;
+      }
+
+      if( pass == 0 )
+      {
+         break;
+      }
+   }
+
+   return dispatched;
+}
+
+unsigned int PriorityLanes::DispatchLane(Lane& lane, IBufferProcessor& processor, unsigned int max, long long now)
+{
+   const long long maxAge = static_cast<long long>( lane.settings.maxAgeMs ) * 1000000;
+   unsigned int dispatched = 0;
+
+   while( dispatched < max )
+   {
+      Slot* slot = lane.ring.Front();
+      if( slot == NULL )
+      {
+         break;
+      }
+
+      if( maxAge > 0 && now - slot->queued > maxAge )
+      {
+         lane.shedStale.fetch_add( 1 , std::memory_order_relaxed );
+      }
+      else
+      {
+         processor.Process( &slot->data[0] , slot->length , slot->endian , slot->context );
+         lane.dispatched.fetch_add( 1 , std::memory_order_relaxed );
+         ++dispatched;
+      }
+      lane.ring.Pop();
+   }
+
+   return dispatched;
+}
+
+unsigned int PriorityLanes::GetLane(unsigned char protocolFamily) const
+{
+   return _familyLanes[protocolFamily];
+}
+
+unsigned int PriorityLanes::GetLaneCount() const
+{
+   return static_cast<unsigned int>( _lanes.size() );
+}
+
+unsigned int PriorityLanes::GetQueuedCount(unsigned int lane) const
+{
+   return static_cast<unsigned int>( _lanes[lane]->ring.Size() );
+}
+
+PriorityLaneStatistics PriorityLanes::GetStatistics(unsigned int lane) const
+{
+   const Lane& source = *_lanes[lane];
+   PriorityLaneStatistics statistics;
+   statistics.received = source.received.load();
+   statistics.dispatched = source.dispatched.load();
+   statistics.shedFull = source.shedFull.load();
+   statistics.shedStale = source.shedStale.load();
+   return statistics;
+}
@@ -0,0 +1,147 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_priority_lanes_h_
+#define _dcl_dis_priority_lanes_h_
+
+#include <utils/IBufferProcessor.h>   // for base class
+#include <utils/CacheAligned.h>       // for base class
+#include <utils/ReceiveContext.h>     // for member
+#include <utils/SpscRing.h>           // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <vector>                   // for member
+#include <atomic>                   // for member
+
+namespace DIS
+{
+   /// the lanes created by the default PriorityLanesSettings, in priority order.
+   enum PriorityLane
+   {
+      /// the warfare, simulation management and reliable simulation management families.
+      PRIORITY_LANE_CRITICAL = 0,
+
+      /// every family without a lane of its own, such as entity information.
+      PRIORITY_LANE_STATE = 1,
+
+      /// the radio communications family, such as Signal PDUs carrying voice.
+      PRIORITY_LANE_RADIO = 2
+   };
+
+   /// the parameters of one lane.
+   struct EXPORT_MACRO PriorityLaneSettings
+   {
+      PriorityLaneSettings(unsigned int capacity=1024, unsigned int budget=32, unsigned int maxAgeMs=0);
+
+      /// the number of PDUs the lane holds.  PDUs arriving when it is full are shed.
+      unsigned int capacity;
+
+      /// the number of PDUs dispatched from the lane before the lanes below it get a turn.
+      unsigned int budget;
+
+      /// PDUs that waited longer than this are shed rather than dispatched.  0 never sheds on age.
+      unsigned int maxAgeMs;
+   };
+
+   /// the parameters used to create PriorityLanes.
+   struct EXPORT_MACRO PriorityLanesSettings
+   {
+      /// creates the three lanes of PriorityLane, with each protocol family assigned to one.
+      PriorityLanesSettings();
+
+      /// the lanes, highest priority first.
+      std::vector<PriorityLaneSettings> lanes;
+
+      /// the lane of each protocol family, indexed by the family value.
+      std::vector<unsigned int> familyLanes;
+
+      /// the largest PDU, in bytes, that fits a slot.  larger PDUs are shed.
+      unsigned int slotSize;
+   };
+
+   /// the counters of one lane.
+   struct PriorityLaneStatistics
+   {
+      PriorityLaneStatistics() : received(0), dispatched(0), shedFull(0), shedStale(0) {}
+
+      unsigned long long received;
+      unsigned long long dispatched;
+
+      /// PDUs shed because the lane was full, or the PDU too large.
+      unsigned long long shedFull;
+
+      /// PDUs shed because they waited longer than the lane's maximum age.
+      unsigned long long shedStale;
+   };
+
+   /// sorts PDUs into lanes by the protocol family of their header, so that important PDUs
+   /// do not wait behind a flood of less important ones, such as voice or entity state heartbeats.
+   /// each time the lanes are dispatched the highest lane goes first, and each lane is
+   /// limited to its budget before the next one gets a turn, so that no lane is starved.
+   /// when a lane can not keep up, its PDUs are shed and counted, leaving the other lanes unaffected.
+   ///
+   /// the producer passes datagrams to Process(), so the lanes can be given straight to a transport.
+   /// the consumer calls Dispatch() with the IBufferProcessor, such as an IncomingMessage, that decodes the PDUs.
+   /// the producer and consumer may be different threads, one of each.
+   class EXPORT_MACRO PriorityLanes : public IBufferProcessor
+   {
+   public:
+      explicit PriorityLanes(const PriorityLanesSettings& settings=PriorityLanesSettings());
+      ~PriorityLanes();
+
+      /// producer side.  split the buffer into PDUs and queue each on the lane of its family.
+      void Process(const char* buf, unsigned int size, Endian e);
+      void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context);
+
+      /// consumer side.  pass up to 'max' PDUs, one at a time, to the processor, in priority order.
+      /// @return the number of PDUs passed to the processor.
+      unsigned int Dispatch(IBufferProcessor& processor, unsigned int max=~0u);
+
+      /// @return the lane PDUs of the family are queued on.
+      unsigned int GetLane(unsigned char protocolFamily) const;
+
+      unsigned int GetLaneCount() const;
+
+      /// @return the number of PDUs waiting in the lane.
+      unsigned int GetQueuedCount(unsigned int lane) const;
+
+      PriorityLaneStatistics GetStatistics(unsigned int lane) const;
+
+   private:
+      PriorityLanes(const PriorityLanes&);              ///< not implemented by design
+      PriorityLanes& operator=(const PriorityLanes&);   ///< not implemented by design
+
+      /// one queued PDU.
+      struct Slot
+      {
+         ReceiveContext context;
+         Endian endian;
+         unsigned int length;
+
+         /// when the PDU was queued, in steady clock nanoseconds.  only set for lanes shedding on age.
+         long long queued;
+         std::vector<char> data;
+      };
+
+      struct Lane : public CacheAligned
+      {
+         Lane(const PriorityLaneSettings& settings, const Slot& prototype);
+
+         PriorityLaneSettings settings;
+         SpscRing<Slot> ring;
+         std::atomic<unsigned long long> received;
+         std::atomic<unsigned long long> dispatched;
+         std::atomic<unsigned long long> shedFull;
+         std::atomic<unsigned long long> shedStale;
+      };
+
+      /// dispatch up to 'max' PDUs from the lane.
+      /// @return the number of PDUs passed to the processor.
+      unsigned int DispatchLane(Lane& lane, IBufferProcessor& processor, unsigned int max, long long now);
+
+      std::vector<Lane*> _lanes;
+      std::vector<unsigned int> _familyLanes;
+   };
+}
+
+#endif  // _dcl_dis_priority_lanes_h_
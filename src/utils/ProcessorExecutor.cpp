@@ -0,0 +1,333 @@
+#include <utils/ProcessorExecutor.h>
+#include <utils/IPacketProcessor.h>
+#include <utils/PduHeader.h>
+#include <utils/Profiler.h>
+#include <dis6/Pdu.h>
+
+using namespace DIS;
+
+ProcessorExecutorSettings::ProcessorExecutorSettings()
+   : threads(0)
+   , ordering(ORDER_PER_PROCESSOR)
+   , entityStrands(64)
+   , strandBudget(32)
+{
+}
+
+ProcessorExecutor::Strand::Strand(IPacketProcessor* pp)
+   : processor(pp)
+   , mutex()
+   , tasks()
+   , scheduled(false)
+{
+}
+
+ProcessorExecutor::ProcessorExecutor()
+   : _settings()
+   , _queues()
+   , _threads()
+   , _strands()
+   , _strandsMutex()
+   , _running(false)
+   , _runnable(0)
+   , _sleepers(0)
+   , _mutex()
+   , _wakeup()
+   , _idle()
+   , _nextQueue(0)
+   , _pending(0)
+   , _stolen(0)
+   , _failures(0)
+{
+}
+
+ProcessorExecutor::~ProcessorExecutor()
+{
+   Stop();
+
+   for(StrandContainer::iterator iter = _strands.begin(); iter != _strands.end(); ++iter)
+   {
+      delete iter->second;
+   }
+}
+
+bool ProcessorExecutor::Start(const ProcessorExecutorSettings& settings)
+{
+   if( _running.load() )
+   {
+      return false;
+   }
+
+   _settings = settings;
+   if( _settings.threads == 0 )
+   {
+      _settings.threads = std::thread::hardware_concurrency();
+      if( _settings.threads == 0 )
+      {
+         _settings.threads = 1;
+      }
+   }
+   if( _settings.entityStrands == 0 )
+   {
+      _settings.entityStrands = 1;
+   }
+   if( _settings.strandBudget == 0 )
+   {
+      _settings.strandBudget = 1;
+   }
+
+   for(unsigned int i=0; i<_settings.threads; ++i)
+   {
+      _queues.push_back( new WorkQueue() );
+   }
+
+   _running.store( true );
+   for(unsigned int i=0; i<_settings.threads; ++i)
+   {
+      _threads.push_back( std::thread( &ProcessorExecutor::WorkLoop , this , i ) );
+   }
+
+   return true;
+}
+
+void ProcessorExecutor::Stop()
+{
+   {
+      std::lock_guard<std::mutex> lock( _mutex );
+      if( !_running.exchange( false ) )
+      {
+         return;
+      }
+   }
+   _wakeup.notify_all();
+
+   for(unsigned int i=0; i<_threads.size(); ++i)
+   {
+      _threads[i].join();
+   }
+   _threads.clear();
+
+   for(unsigned int i=0; i<_queues.size(); ++i)
+   {
+      delete _queues[i];
+   }
+   _queues.clear();
+}
+
+bool ProcessorExecutor::IsRunning() const
+{
+   return _running.load();
+}
+
+void ProcessorExecutor::Execute(IPacketProcessor* pp, const PduPointer& pdu, const ReceiveContext& context, unsigned long long entityKey)
+{
+   Task task;
+   task.pdu = pdu;
+   task.context = context;
+   _pending.fetch_add( 1 );
+
+   if( !_running.load() )
+   {
+      Process( pp , task );
+      return;
+   }
+
+   Strand& strand = GetStrand( pp , entityKey );
+   bool schedule = false;
+   {
+      std::lock_guard<std::mutex> lock( strand.mutex );
+      strand.tasks.push_back( task );
+      if( !strand.scheduled )
+      {
+         strand.scheduled = true;
+         schedule = true;
+      }
+   }
+
+   if( schedule )
+   {
+      Schedule( strand , static_cast<unsigned int>( _queues.size() ) );
+   }
+}
+
+void ProcessorExecutor::Wait()
+{
+   std::unique_lock<std::mutex> lock( _mutex );
+   while( _pending.load() > 0 )
+   {
+      _idle.wait( lock );
+   }
+}
+
+unsigned int ProcessorExecutor::GetThreadCount() const
+{
+   return static_cast<unsigned int>( _threads.size() );
+}
+
+unsigned long long ProcessorExecutor::GetPendingCount() const
+{
+   return _pending.load();
+}
+
+unsigned long long ProcessorExecutor::GetStolenCount() const
+{
+   return _stolen.load();
+}
+
+unsigned long long ProcessorExecutor::GetFailureCount() const
+{
+   return _failures.load();
+}
+
+ProcessorExecutor::Strand& ProcessorExecutor::GetStrand(IPacketProcessor* pp, unsigned long long entityKey)
+{
+   unsigned int group = 0;
+   if( _settings.ordering == ORDER_PER_ENTITY )
+   {
+      group = static_cast<unsigned int>( PduHeader::HashEntityKey( entityKey ) % _settings.entityStrands );
+   }
+
+   std::lock_guard<std::mutex> lock( _strandsMutex );
+   Strand*& strand = _strands[StrandKey( pp , group )];
+   if( strand == NULL )
+   {
+      strand = new Strand( pp );
+   }
+   return *strand;
+}
+
+void ProcessorExecutor::Schedule(Strand& strand, unsigned int index)
+{
+   // pool threads keep their own work, other threads spread it around.
+   if( index >= _queues.size() )
+   {
+      index = _nextQueue.fetch_add( 1 , std::memory_order_relaxed ) % _queues.size();
+   }
+
+   // counted before it is queued, so that the count never falls below the queued strands.
+   _runnable.fetch_add( 1 );
+   {
+      WorkQueue& queue = *_queues[index];
+      std::lock_guard<std::mutex> lock( queue.mutex );
+      queue.strands.push_back( &strand );
+   }
+
+   // the sleepers are counted before they check for work, so that one of the two sides sees the other.
+   if( _sleepers.load() > 0 )
+   {
+      std::lock_guard<std::mutex> lock( _mutex );
+      _wakeup.notify_one();
+   }
+}
+
+ProcessorExecutor::Strand* ProcessorExecutor::Take(unsigned int index)
+{
+   {
+      WorkQueue& queue = *_queues[index];
+      std::lock_guard<std::mutex> lock( queue.mutex );
+      if( !queue.strands.empty() )
+      {
+         Strand* strand = queue.strands.front();
+         queue.strands.pop_front();
+         _runnable.fetch_sub( 1 );
+         return strand;
+      }
+   }
+
+   for(unsigned int i=1; i<_queues.size(); ++i)
+   {
+      WorkQueue& victim = *_queues[(index + i) % _queues.size()];
+      std::lock_guard<std::mutex> lock( victim.mutex );
+      if( !victim.strands.empty() )
+      {
+         Strand* strand = victim.strands.back();
+         victim.strands.pop_back();
+         _runnable.fetch_sub( 1 );
+         _stolen.fetch_add( 1 , std::memory_order_relaxed );
+         return strand;
+      }
+   }
+
+   return NULL;
+}
+
+void ProcessorExecutor::Run(Strand& strand, unsigned int index)
+{
+   for(unsigned int count=0; count<_settings.strandBudget; ++count)
+   {
+      Task task;
+      {
+         std::lock_guard<std::mutex> lock( strand.mutex );
+         if( strand.tasks.empty() )
+         {
+            strand.scheduled = false;
+            return;
+         }
+         task.pdu.swap( strand.tasks.front().pdu );
+         task.context = strand.tasks.front().context;
+         strand.tasks.pop_front();
+      }
+
+      Process( strand.processor , task );
+   }
+
+   {
+      std::lock_guard<std::mutex> lock( strand.mutex );
+      if( strand.tasks.empty() )
+      {
+         strand.scheduled = false;
+         return;
+      }
+   }
+
+   // the budget is spent, so the strand goes to the back of the queue behind the other processors.
+   Schedule( strand , index );
+}
+
+void ProcessorExecutor::Process(IPacketProcessor* pp, Task& task)
+{
+   // a failing processor must not take down the pool thread, and is counted instead.
+   try
+   {
+      DIS_PROFILE_SCOPE( PROFILE_DISPATCH , task.pdu->getPduType() );
+      pp->Process( *task.pdu , task.context );
+   }
+   catch( ... )
+   {
+      _failures.fetch_add( 1 , std::memory_order_relaxed );
+   }
+   task.pdu.reset();
+
+   if( _pending.fetch_sub( 1 ) == 1 )
+   {
+      std::lock_guard<std::mutex> lock( _mutex );
+      _idle.notify_all();
+   }
+}
+
+void ProcessorExecutor::WorkLoop(unsigned int index)
+{
+   while( true )
+   {
+      Strand* strand = Take( index );
+      if( strand != NULL )
+      {
+         Run( *strand , index );
+         continue;
+      }
+
+      std::unique_lock<std::mutex> lock( _mutex );
+      _sleepers.fetch_add( 1 );
+      while( _runnable.load() == 0 && _running.load() )
+      {
+         _wakeup.wait( lock );
+      }
+      _sleepers.fetch_sub( 1 );
+
+      // every strand is run to completion before the threads leave.
+      if( _runnable.load() == 0 && !_running.load() )
+      {
+         break;
+      }
+   }
+}
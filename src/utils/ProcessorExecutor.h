@@ -0,0 +1,179 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_processor_executor_h_
+#define _dcl_dis_processor_executor_h_
+
+#include <utils/ReceiveContext.h>     // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <map>                      // for member
+#include <deque>                    // for member
+#include <vector>                   // for member
+#include <memory>                   // for parameter
+#include <atomic>                   // for member
+#include <thread>                   // for member
+#include <mutex>                    // for member
+#include <condition_variable>       // for member
+
+namespace DIS
+{
+   class Pdu;
+   class IPacketProcessor;
+
+   /// the order in which an executor delivers PDUs to a processor.
+   enum ExecutorOrdering
+   {
+      /// each processor sees every PDU in the order it was received,
+      /// and is never called by two threads at once.
+      ORDER_PER_PROCESSOR,
+
+      /// each processor sees the PDUs of an entity in the order they were received,
+      /// and may be called concurrently for different entities.
+      ORDER_PER_ENTITY
+   };
+
+   /// the parameters used to start a ProcessorExecutor.
+   struct EXPORT_MACRO ProcessorExecutorSettings
+   {
+      ProcessorExecutorSettings();
+
+      /// the number of pool threads.  0 uses one per core.
+      unsigned int threads;
+
+      ExecutorOrdering ordering;
+
+      /// with ORDER_PER_ENTITY, the number of queues each processor's entities are spread over.
+      unsigned int entityStrands;
+
+      /// the number of PDUs a thread hands to one processor before moving on to other work.
+      unsigned int strandBudget;
+   };
+
+   /// runs packet processors on a work-stealing thread pool, so that a slow processor
+   /// does not hold up the thread receiving the PDUs, nor the other processors.
+   /// every PDU is decoded once into an instance shared by all its processors, which must not modify it.
+   /// the work for a processor, or for a processor and a group of entities, is queued on a strand.
+   /// a strand is run by one thread at a time, which gives the ordering guarantee.
+   /// idle threads take runnable strands from the back of the busy threads' queues.
+   ///
+   /// an exception thrown by a processor has no caller to reach, unlike when IncomingMessage calls
+   /// the processor directly.  it is caught, of any type, and counted by GetFailureCount(), and the
+   /// processor goes on to its next PDU.
+   class EXPORT_MACRO ProcessorExecutor
+   {
+   public:
+      /// the decoded PDU, shared by the processors it is delivered to.
+      typedef std::shared_ptr<const Pdu> PduPointer;
+
+      ProcessorExecutor();
+
+      /// stops the pool, after the queued PDUs are processed.
+      ~ProcessorExecutor();
+
+      /// launch the pool threads.
+      /// @return 'false' if the pool is already running.
+      bool Start(const ProcessorExecutorSettings& settings);
+
+      /// finish the queued PDUs, then stop the threads.
+      /// PDUs executed after stopping are processed on the calling thread.
+      void Stop();
+
+      bool IsRunning() const;
+
+      /// queue the PDU for the processor.
+      /// @param entityKey the key of the entity the PDU describes, as packed by PduHeader::GetEntityKey.
+      void Execute(IPacketProcessor* pp, const PduPointer& pdu, const ReceiveContext& context, unsigned long long entityKey);
+
+      /// block until every PDU queued so far has been processed.
+      /// processors should not be removed or deleted before their PDUs are processed.
+      void Wait();
+
+      unsigned int GetThreadCount() const;
+
+      /// @return the number of PDUs queued and not yet processed.
+      unsigned long long GetPendingCount() const;
+
+      /// @return the number of times an idle thread took work from another thread's queue.
+      unsigned long long GetStolenCount() const;
+
+      /// @return the number of PDUs whose processor threw an exception.
+      unsigned long long GetFailureCount() const;
+
+   private:
+      ProcessorExecutor(const ProcessorExecutor&);              ///< not implemented by design
+      ProcessorExecutor& operator=(const ProcessorExecutor&);   ///< not implemented by design
+
+      /// one PDU waiting for a processor.
+      struct Task
+      {
+         PduPointer pdu;
+         ReceiveContext context;
+      };
+
+      /// the ordered work of one processor, or of one processor and a group of entities.
+      struct Strand
+      {
+         Strand(IPacketProcessor* pp);
+
+         IPacketProcessor* processor;
+         std::mutex mutex;
+         std::deque<Task> tasks;
+
+         /// set while the strand is queued on, or run by, a pool thread.
+         bool scheduled;
+      };
+
+      /// the runnable strands of one pool thread.
+      struct WorkQueue
+      {
+         std::mutex mutex;
+         std::deque<Strand*> strands;
+      };
+
+      typedef std::pair<IPacketProcessor*,unsigned int> StrandKey;
+      typedef std::map<StrandKey,Strand*> StrandContainer;
+
+      Strand& GetStrand(IPacketProcessor* pp, unsigned long long entityKey);
+
+      /// queue a runnable strand on a pool thread.
+      /// @param index the pool thread making the call, or the size of the pool when called from elsewhere.
+      void Schedule(Strand& strand, unsigned int index);
+
+      /// @return NULL when there is no runnable strand in the thread's own queue nor in any other.
+      Strand* Take(unsigned int index);
+
+      /// process up to the budget of the strand's PDUs, then schedule it again if some remain.
+      void Run(Strand& strand, unsigned int index);
+
+      /// process one PDU and account for it.
+      void Process(IPacketProcessor* pp, Task& task);
+
+      void WorkLoop(unsigned int index);
+
+      ProcessorExecutorSettings _settings;
+      std::vector<WorkQueue*> _queues;
+      std::vector<std::thread> _threads;
+
+      StrandContainer _strands;
+      std::mutex _strandsMutex;
+
+      std::atomic<bool> _running;
+
+      /// the number of runnable strands in the queues.
+      std::atomic<unsigned int> _runnable;
+
+      /// the number of threads waiting for a runnable strand.
+      std::atomic<unsigned int> _sleepers;
+      std::mutex _mutex;
+      std::condition_variable _wakeup;
+      std::condition_variable _idle;
+
+      std::atomic<unsigned int> _nextQueue;
+      std::atomic<unsigned long long> _pending;
+      std::atomic<unsigned long long> _stolen;
+      std::atomic<unsigned long long> _failures;
+   };
+}
+
+#endif  // _dcl_dis_processor_executor_h_
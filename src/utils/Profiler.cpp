@@ -0,0 +1,228 @@
+#include <utils/Profiler.h>
+
+#if defined(DIS_PROFILING)
+
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+using namespace DIS;
+
+namespace
+{
+   const unsigned int PROFILE_TYPE_COUNT = 256;
+
+   /// the allocations counted on each thread.  plain integers, so that counting does not allocate.
+   thread_local unsigned long long t_allocations = 0;
+   thread_local unsigned long long t_allocatedBytes = 0;
+
+   void Add(ProfileAllocations& total, const ProfileAllocations& other)
+   {
+      total.calls += other.calls;
+      total.allocations += other.allocations;
+      total.bytes += other.bytes;
+   }
+
+   /// the histograms of one thread, allocated on the first time of their stage and PDU type.
+   struct ThreadProfile
+   {
+      ThreadProfile()
+      {
+         std::fill( &_histograms[0][0] , &_histograms[0][0] + PROFILE_STAGE_COUNT * PROFILE_TYPE_COUNT , static_cast<Histogram*>( NULL ) );
+      }
+
+      ~ThreadProfile()
+      {
+         for(unsigned int i=0; i<PROFILE_STAGE_COUNT * PROFILE_TYPE_COUNT; ++i)
+         {
+            delete (&_histograms[0][0])[i];
+         }
+      }
+
+      void Record(ProfileStage stage, unsigned char pduType, unsigned long long nanoseconds, const ProfileAllocations& allocations)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         Histogram*& histogram = _histograms[stage][pduType];
+         if( histogram == NULL )
+         {
+            histogram = new Histogram();
+         }
+         histogram->Record( nanoseconds );
+         Add( _allocations[stage][pduType] , allocations );
+      }
+
+      void MergeInto(ProfileStage stage, unsigned char pduType, Histogram& merged)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         if( _histograms[stage][pduType] != NULL )
+         {
+            merged.Merge( *_histograms[stage][pduType] );
+         }
+      }
+
+      void MergeInto(ProfileStage stage, unsigned char pduType, ProfileAllocations& total)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         Add( total , _allocations[stage][pduType] );
+      }
+
+      void MergeInto(ThreadProfile& other)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         for(unsigned int stage=0; stage<PROFILE_STAGE_COUNT; ++stage)
+         {
+            for(unsigned int pduType=0; pduType<PROFILE_TYPE_COUNT; ++pduType)
+            {
+               if( _histograms[stage][pduType] != NULL )
+               {
+                  other.Merge( static_cast<ProfileStage>( stage ) , static_cast<unsigned char>( pduType ) , *_histograms[stage][pduType] , _allocations[stage][pduType] );
+               }
+            }
+         }
+      }
+
+      void Merge(ProfileStage stage, unsigned char pduType, const Histogram& histogram, const ProfileAllocations& allocations)
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         Histogram*& mine = _histograms[stage][pduType];
+         if( mine == NULL )
+         {
+            mine = new Histogram();
+         }
+         mine->Merge( histogram );
+         Add( _allocations[stage][pduType] , allocations );
+      }
+
+      void Reset()
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         for(unsigned int i=0; i<PROFILE_STAGE_COUNT * PROFILE_TYPE_COUNT; ++i)
+         {
+            Histogram* histogram = (&_histograms[0][0])[i];
+            if( histogram != NULL )
+            {
+               histogram->Reset();
+            }
+            (&_allocations[0][0])[i] = ProfileAllocations();
+         }
+      }
+
+   private:
+      ThreadProfile(const ThreadProfile&);              ///< not implemented by design
+      ThreadProfile& operator=(const ThreadProfile&);   ///< not implemented by design
+
+      /// only taken by another thread while merging or resetting.
+      std::mutex _mutex;
+      Histogram* _histograms[PROFILE_STAGE_COUNT][PROFILE_TYPE_COUNT];
+      ProfileAllocations _allocations[PROFILE_STAGE_COUNT][PROFILE_TYPE_COUNT];
+   };
+
+   /// the profiles of the running threads, and the times of the threads that exited.
+   struct ProfileRegistry
+   {
+      std::mutex mutex;
+      std::vector<ThreadProfile*> profiles;
+      ThreadProfile retired;
+   };
+
+   /// never destroyed, so that threads exiting during the shutdown of the process can still retire their profile.
+   ProfileRegistry& GetRegistry()
+   {
+      static ProfileRegistry* registry = new ProfileRegistry();
+      return *registry;
+   }
+
+   /// registers the profile of its thread, and retires it when the thread exits.
+   struct ThreadProfileHolder
+   {
+      ThreadProfileHolder()
+      {
+         ProfileRegistry& registry = GetRegistry();
+         std::lock_guard<std::mutex> lock( registry.mutex );
+         registry.profiles.push_back( &profile );
+      }
+
+      ~ThreadProfileHolder()
+      {
+         ProfileRegistry& registry = GetRegistry();
+         std::lock_guard<std::mutex> lock( registry.mutex );
+         profile.MergeInto( registry.retired );
+         registry.profiles.erase( std::remove( registry.profiles.begin() , registry.profiles.end() , &profile ) , registry.profiles.end() );
+      }
+
+      ThreadProfile profile;
+   };
+}
+
+ProfileAllocations::ProfileAllocations()
+   : calls(0)
+   , allocations(0)
+   , bytes(0)
+{
+}
+
+void Profiler::Record(ProfileStage stage, unsigned char pduType, unsigned long long nanoseconds,
+                      unsigned long long allocations, unsigned long long bytes)
+{
+   static thread_local ThreadProfileHolder holder;
+   ProfileAllocations counted;
+   counted.calls = 1;
+   counted.allocations = allocations;
+   counted.bytes = bytes;
+   holder.profile.Record( stage , pduType , nanoseconds , counted );
+}
+
+void Profiler::CountAllocation(std::size_t bytes)
+{
+   ++t_allocations;
+   t_allocatedBytes += bytes;
+}
+
+unsigned long long Profiler::GetThreadAllocations()
+{
+   return t_allocations;
+}
+
+unsigned long long Profiler::GetThreadAllocatedBytes()
+{
+   return t_allocatedBytes;
+}
+
+Histogram Profiler::GetHistogram(ProfileStage stage, unsigned char pduType)
+{
+   Histogram merged;
+   ProfileRegistry& registry = GetRegistry();
+   std::lock_guard<std::mutex> lock( registry.mutex );
+   registry.retired.MergeInto( stage , pduType , merged );
+   for(size_t i=0; i<registry.profiles.size(); ++i)
+   {
+      registry.profiles[i]->MergeInto( stage , pduType , merged );
+   }
+   return merged;
+}
+
+ProfileAllocations Profiler::GetAllocations(ProfileStage stage, unsigned char pduType)
+{
+   ProfileAllocations total;
+   ProfileRegistry& registry = GetRegistry();
+   std::lock_guard<std::mutex> lock( registry.mutex );
+   registry.retired.MergeInto( stage , pduType , total );
+   for(size_t i=0; i<registry.profiles.size(); ++i)
+   {
+      registry.profiles[i]->MergeInto( stage , pduType , total );
+   }
+   return total;
+}
+
+void Profiler::Reset()
+{
+   ProfileRegistry& registry = GetRegistry();
+   std::lock_guard<std::mutex> lock( registry.mutex );
+   registry.retired.Reset();
+   for(size_t i=0; i<registry.profiles.size(); ++i)
+   {
+      registry.profiles[i]->Reset();
+   }
+}
+
+#endif  // DIS_PROFILING
@@ -0,0 +1,115 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_profiler_h_
+#define _dcl_dis_profiler_h_
+
+/// DIS_PROFILE_SCOPE(stage, pduType) times the rest of the enclosing scope, and records the
+/// time in the histogram of the stage and PDU type, along with the allocations made meanwhile.
+/// the library times the decoding in IncomingMessage, the encoding in TrafficGenerator, and each processor call.
+/// the timing is only compiled in when DIS_PROFILING is defined, which the OPENDIS_PROFILING
+/// build option does.  otherwise the macro expands to nothing, and costs nothing.
+#if defined(DIS_PROFILING)
+
+#include <utils/Histogram.h>          // for return value
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <chrono>                   // for member
+#include <cstddef>                  // for std::size_t
+
+namespace DIS
+{
+   /// the parts of the handling of a PDU that are timed.
+   enum ProfileStage
+   {
+      PROFILE_UNMARSHAL,
+      PROFILE_MARSHAL,
+
+      /// a call to a processor.
+      PROFILE_DISPATCH,
+
+      PROFILE_STAGE_COUNT
+   };
+
+   /// the heap allocations made during the timed calls of a stage and PDU type,
+   /// including those of the calls nested within them.
+   struct EXPORT_MACRO ProfileAllocations
+   {
+      ProfileAllocations();
+
+      unsigned long long calls;
+      unsigned long long allocations;
+      unsigned long long bytes;
+   };
+
+   /// the latency histograms of each stage and PDU type, in nanoseconds, and their allocations.
+   /// every thread records into its own histograms, under a lock only taken by another thread
+   /// when the histograms are merged.  the histograms of a thread are kept when the thread exits.
+   struct EXPORT_MACRO Profiler
+   {
+      static void Record(ProfileStage stage, unsigned char pduType, unsigned long long nanoseconds,
+                         unsigned long long allocations=0, unsigned long long bytes=0);
+
+      /// count an allocation made by the calling thread.  the library does not replace operator new:
+      /// an application accounts for its allocations by calling this from its own replacement,
+      /// as the benchmarks do.  this does not allocate, and takes no lock.
+      static void CountAllocation(std::size_t bytes);
+
+      /// @return the allocations counted on the calling thread so far, and their bytes.
+      static unsigned long long GetThreadAllocations();
+      static unsigned long long GetThreadAllocatedBytes();
+
+      /// @return the histograms of every thread, merged.
+      static Histogram GetHistogram(ProfileStage stage, unsigned char pduType);
+
+      /// @return the allocations of every thread, summed.
+      static ProfileAllocations GetAllocations(ProfileStage stage, unsigned char pduType);
+
+      /// forget the times recorded so far, by every thread.
+      static void Reset();
+   };
+
+   /// records the time from its construction to its destruction.
+   class ProfileScope
+   {
+   public:
+      ProfileScope(ProfileStage stage, unsigned char pduType)
+         : _stage(stage)
+         , _pduType(pduType)
+         , _allocations(Profiler::GetThreadAllocations())
+         , _bytes(Profiler::GetThreadAllocatedBytes())
+         , _start(std::chrono::steady_clock::now())
+      {
+      }
+
+      ~ProfileScope()
+      {
+         const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - _start;
+         Profiler::Record( _stage , _pduType , std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ,
+                           Profiler::GetThreadAllocations() - _allocations , Profiler::GetThreadAllocatedBytes() - _bytes );
+      }
+
+   private:
+      ProfileScope(const ProfileScope&);              ///< not implemented by design
+      ProfileScope& operator=(const ProfileScope&);   ///< not implemented by design
+
+      ProfileStage _stage;
+      unsigned char _pduType;
+      unsigned long long _allocations;
+      unsigned long long _bytes;
+      std::chrono::steady_clock::time_point _start;
+   };
+}
+
+#define DIS_PROFILE_CONCATENATE_(a, b) a##b
+#define DIS_PROFILE_CONCATENATE(a, b) DIS_PROFILE_CONCATENATE_(a, b)
+#define DIS_PROFILE_SCOPE(stage, pduType) \
+   DIS::ProfileScope DIS_PROFILE_CONCATENATE(dis_profile_scope_, __LINE__)( DIS::stage , static_cast<unsigned char>( pduType ) )
+
+#else
+
+#define DIS_PROFILE_SCOPE(stage, pduType)
+
+#endif  // DIS_PROFILING
+
+#endif  // _dcl_dis_profiler_h_
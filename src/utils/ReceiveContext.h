@@ -0,0 +1,56 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_receive_context_h_
+#define _dcl_dis_receive_context_h_
+
+namespace DIS
+{
+   /// describes where and when the datagram holding a PDU was received.
+   /// transports fill in the datagram details, IncomingMessage fills in the PDU position.
+   /// fields the transport can not provide are left as 0.
+   struct ReceiveContext
+   {
+      ReceiveContext()
+         : sourceAddress(0)
+         , sourcePort(0)
+         , destinationAddress(0)
+         , interfaceIndex(0)
+         , timestamp(0)
+         , datagramIndex(0)
+         , datagramLength(0)
+         , pduOffset(0)
+         , pduIndex(0)
+      {
+      }
+
+      /// the IPv4 address of the sender, in host byte order.
+      unsigned int sourceAddress;
+
+      /// the UDP port of the sender.
+      unsigned short sourcePort;
+
+      /// the address the datagram was sent to, such as the multicast group, in host byte order.
+      unsigned int destinationAddress;
+
+      /// the index of the network interface the datagram arrived on.
+      int interfaceIndex;
+
+      /// the kernel receive time, in nanoseconds since the epoch.
+      long long timestamp;
+
+      /// the position of the datagram within the batch read by the transport.
+      unsigned int datagramIndex;
+
+      /// the number of bytes in the datagram.
+      unsigned int datagramLength;
+
+      /// the byte offset of the PDU within its datagram, for datagrams bundling several PDUs.
+      unsigned int pduOffset;
+
+      /// the position of the PDU within its datagram.
+      unsigned int pduIndex;
+   };
+}
+
+#endif  // _dcl_dis_receive_context_h_
@@ -0,0 +1,141 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_recording_format_h_
+#define _dcl_dis_recording_format_h_
+
+#include <stdint.h>                 // for fixed size fields
+
+namespace DIS
+{
+   /// the layout of a PDU recording file, as written by RecordingWriter.
+   ///
+   /// the file is a header followed by chunks, each starting on a RECORDING_ALIGNMENT boundary.
+   /// a chunk is a RecordingChunkHeader, the records, then the chunk's index, padded to the alignment.
+   /// each record is a RecordingRecordHeader followed by the PDU bytes, padded to 8 bytes.
+   /// the index lists the time of every RECORDING_TIME_INDEX_INTERVAL-th record,
+   /// then each entity in the chunk with the offset of its first record, sorted by entity key.
+   /// together with the per type counts of the chunk header, readers can skip the chunks
+   /// that hold nothing of interest without reading their records.
+   /// keyframe chunks are interleaved with the others, so that the world state at any time
+   /// can be rebuilt from the keyframe before it rather than from the start of the file.
+   ///
+   /// every field is little-endian.  a file cut short by a crash loses at most its last chunk.
+
+   /// identifies a recording file, and the layout version.
+   const char RECORDING_MAGIC[8] = { 'D','I','S','R','E','C','0','1' };
+
+   /// identifies the start of a chunk, "DCHK" when read as bytes.
+   const uint32_t RECORDING_CHUNK_MAGIC = 0x4b484344;
+
+   /// the file header and every chunk start on a multiple of this size, so that they can be written directly.
+   const uint32_t RECORDING_ALIGNMENT = 4096;
+
+   /// records are padded to a multiple of this size.
+   const uint32_t RECORDING_RECORD_ALIGNMENT = 8;
+
+   /// the number of records between two entries of the time index.
+   const uint32_t RECORDING_TIME_INDEX_INTERVAL = 64;
+
+   /// the start of the file, padded to RECORDING_ALIGNMENT.
+   struct RecordingFileHeader
+   {
+      char magic[8];
+
+      /// the size of the file header, including the padding.
+      uint32_t headerSize;
+
+      /// the largest number of record bytes in a chunk.
+      uint32_t chunkSize;
+
+      /// when the recording was started, in nanoseconds since the epoch.
+      int64_t created;
+   };
+
+   /// marks a keyframe chunk: a snapshot of the world state rather than a part of the PDU stream.
+   /// its records are the last Entity State PDU of every entity received up to the chunk before it,
+   /// sorted by entity key, and both timestamps of its header are the time of the snapshot.
+   const uint32_t RECORDING_CHUNK_KEYFRAME = 1;
+
+   /// the start of every chunk.
+   struct RecordingChunkHeader
+   {
+      uint32_t magic;
+
+      /// the position of the chunk in the file, counting from 0.
+      uint32_t sequence;
+
+      /// the size of the whole chunk, including the header, the index and the padding.
+      uint64_t chunkLength;
+
+      /// the size of the records, which follow the header.
+      uint32_t recordsLength;
+      uint32_t recordCount;
+
+      /// the offset of the index from the start of the chunk, and the number of entries of each part.
+      uint32_t indexOffset;
+      uint32_t timeEntryCount;
+      uint32_t entityEntryCount;
+
+      /// RECORDING_CHUNK_KEYFRAME for a keyframe, 0 for the chunks of the PDU stream.
+      uint32_t flags;
+
+      /// the receive times of the first and last records, in nanoseconds since the epoch.
+      int64_t firstTimestamp;
+      int64_t lastTimestamp;
+
+      /// the number of records of each PDU type.
+      uint32_t typeCounts[256];
+   };
+
+   /// the offset of the first record from the start of its chunk.
+   const uint32_t RECORDING_RECORDS_OFFSET =
+      ( sizeof(RecordingChunkHeader) + RECORDING_RECORD_ALIGNMENT - 1 ) & ~( RECORDING_RECORD_ALIGNMENT - 1 );
+
+   /// the start of every record.
+   struct RecordingRecordHeader
+   {
+      /// the receive time, in nanoseconds since the epoch.
+      int64_t timestamp;
+
+      /// the sender and the destination, IPv4 in host byte order.
+      uint32_t sourceAddress;
+      uint32_t destinationAddress;
+      uint16_t sourcePort;
+
+      /// the number of PDU bytes following the header.
+      uint16_t length;
+      uint32_t reserved;
+   };
+
+   /// an entry of the time index.
+   struct RecordingTimeEntry
+   {
+      int64_t timestamp;
+
+      /// the offset of the record from the start of the chunk.
+      uint32_t offset;
+      uint32_t reserved;
+   };
+
+   /// an entry of the entity index.
+   struct RecordingEntityEntry
+   {
+      /// the site, application and entity numbers, as packed by PduHeader::GetEntityKey.
+      uint64_t entityKey;
+
+      /// the offset of the entity's first record from the start of the chunk.
+      uint32_t offset;
+
+      /// the number of records for the entity in the chunk.
+      uint32_t count;
+   };
+
+   /// round a size up to a multiple of the alignment, which must be a power of 2.
+   inline uint64_t RecordingAlign(uint64_t size, uint64_t alignment)
+   {
+      return (size + alignment - 1) & ~(alignment - 1);
+   }
+}
+
+#endif  // _dcl_dis_recording_format_h_
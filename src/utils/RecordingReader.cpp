@@ -0,0 +1,592 @@
+#include <utils/RecordingReader.h>
+#include <utils/IBufferProcessor.h>
+#include <utils/IPduViewProcessor.h>
+#include <utils/ReceiveContext.h>
+#include <utils/PDUType.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <thread>
+
+using namespace DIS;
+
+struct RecordingReader::ScanPlan
+{
+   long long startTime;
+   long long endTime;
+
+   /// sorted, for binary searches.
+   std::vector<unsigned long long> entities;
+
+   /// when 'false' the types are not checked.
+   bool filterTypes;
+   bool types[256];
+};
+
+RecordingQuery::RecordingQuery()
+   : startTime(LLONG_MIN)
+   , endTime(LLONG_MAX)
+   , entities()
+   , types()
+{
+}
+
+RecordingScanStatistics::RecordingScanStatistics()
+   : scannedChunks(0)
+   , skippedChunks(0)
+   , records(0)
+   , matched(0)
+   , workers(0)
+{
+}
+
+RecordingReader::RecordingReader()
+   : _file()
+   , _data(NULL)
+   , _size(0)
+   , _chunks()
+   , _keyframes()
+   , _records(0)
+   , _chunk(0)
+   , _record(0)
+   , _offset(RECORDING_RECORDS_OFFSET)
+   , _error(0)
+{
+}
+
+RecordingReader::~RecordingReader()
+{
+   Close();
+}
+
+bool RecordingReader::Open(const std::string& path)
+{
+   Close();
+
+   if( !_file.Open( path ) )
+   {
+      _error = _file.GetLastError();
+      return false;
+   }
+   _data = _file.GetData();
+   _size = _file.GetSize();
+
+   if( !ReadHeaders() )
+   {
+      _error = EINVAL;
+      Close();
+      return false;
+   }
+
+   return true;
+}
+
+void RecordingReader::Close()
+{
+   _file.Close();
+   _data = NULL;
+   _size = 0;
+   _chunks.clear();
+   _keyframes.clear();
+   _records = 0;
+   Rewind();
+}
+
+bool RecordingReader::IsOpen() const
+{
+   return( _data != NULL );
+}
+
+bool RecordingReader::ReadHeaders()
+{
+   if( _size < sizeof(RecordingFileHeader) )
+   {
+      return false;
+   }
+
+   RecordingFileHeader header;
+   memcpy( &header , _data , sizeof(header) );
+   if( memcmp( header.magic , RECORDING_MAGIC , sizeof(header.magic) ) != 0 ||
+       header.headerSize < sizeof(header) || header.headerSize > _size )
+   {
+      return false;
+   }
+
+   // the chunks are read up to the end of the file, or up to the first one that is incomplete.
+   size_t position = header.headerSize;
+   while( _size - position >= sizeof(RecordingChunkHeader) )
+   {
+      RecordingChunkHeader chunk;
+      memcpy( &chunk , _data + position , sizeof(chunk) );
+
+      const unsigned long long index = static_cast<unsigned long long>( chunk.timeEntryCount ) * sizeof(RecordingTimeEntry) +
+                                       static_cast<unsigned long long>( chunk.entityEntryCount ) * sizeof(RecordingEntityEntry);
+      if( chunk.magic != RECORDING_CHUNK_MAGIC ||
+          chunk.chunkLength > _size - position ||
+          chunk.indexOffset != RECORDING_RECORDS_OFFSET + static_cast<unsigned long long>( chunk.recordsLength ) ||
+          chunk.indexOffset + index > chunk.chunkLength )
+      {
+         break;
+      }
+
+      Chunk entry;
+      entry.position = position;
+      entry.recordCount = chunk.recordCount;
+      entry.indexOffset = chunk.indexOffset;
+      entry.timeEntryCount = chunk.timeEntryCount;
+      entry.entityEntryCount = chunk.entityEntryCount;
+      entry.firstTimestamp = chunk.firstTimestamp;
+      entry.lastTimestamp = chunk.lastTimestamp;
+      entry.following = _chunks.size();
+      if( chunk.flags & RECORDING_CHUNK_KEYFRAME )
+      {
+         _keyframes.push_back( entry );
+      }
+      else
+      {
+         _chunks.push_back( entry );
+         _records += chunk.recordCount;
+      }
+      position += static_cast<size_t>( chunk.chunkLength );
+   }
+
+   return true;
+}
+
+void RecordingReader::SetPosition(size_t chunk, uint32_t offset, uint32_t record)
+{
+   _chunk = chunk;
+   _offset = offset;
+   _record = record;
+}
+
+bool RecordingReader::ReadRecord(const Chunk& chunk, uint32_t& offset, PduView& view) const
+{
+   // a record running past the records of its chunk ends the chunk.
+   if( chunk.indexOffset - offset < sizeof(RecordingRecordHeader) )
+   {
+      return false;
+   }
+
+   const char* data = _data + chunk.position + offset;
+   RecordingRecordHeader header;
+   memcpy( &header , data , sizeof(header) );
+   if( header.length > chunk.indexOffset - offset - sizeof(header) )
+   {
+      return false;
+   }
+
+   view.pdu = data + sizeof(header);
+   view.length = header.length;
+   view.timestamp = header.timestamp;
+   view.sourceAddress = header.sourceAddress;
+   view.sourcePort = header.sourcePort;
+   view.destinationAddress = header.destinationAddress;
+   offset += static_cast<uint32_t>( RecordingAlign( sizeof(header) + header.length , RECORDING_RECORD_ALIGNMENT ) );
+   return true;
+}
+
+void RecordingReader::Rewind()
+{
+   SetPosition( 0 , RECORDING_RECORDS_OFFSET , 0 );
+}
+
+bool RecordingReader::Next(PduView& record)
+{
+   while( _chunk < _chunks.size() )
+   {
+      if( _record < _chunks[_chunk].recordCount && ReadRecord( _chunks[_chunk] , _offset , record ) )
+      {
+         ++_record;
+         return true;
+      }
+
+      SetPosition( _chunk + 1 , RECORDING_RECORDS_OFFSET , 0 );
+   }
+
+   return false;
+}
+
+bool RecordingReader::Read(const char*& buf, unsigned int& size, ReceiveContext& context)
+{
+   PduView record;
+   if( !Next( record ) )
+   {
+      return false;
+   }
+
+   buf = record.pdu;
+   size = record.length;
+   context = ReceiveContext();
+   context.sourceAddress = record.sourceAddress;
+   context.sourcePort = record.sourcePort;
+   context.destinationAddress = record.destinationAddress;
+   context.timestamp = record.timestamp;
+   context.datagramLength = record.length;
+   return true;
+}
+
+bool RecordingReader::Seek(long long timestamp)
+{
+   for(size_t i=0; i<_chunks.size(); ++i)
+   {
+      const Chunk& chunk = _chunks[i];
+      if( chunk.recordCount == 0 || chunk.lastTimestamp < timestamp )
+      {
+         continue;
+      }
+
+      // start from the last indexed record received before the time.
+      SetPosition( i , RECORDING_RECORDS_OFFSET , 0 );
+      const char* times = _data + chunk.position + chunk.indexOffset;
+      for(uint32_t entry=0; entry<chunk.timeEntryCount; ++entry)
+      {
+         RecordingTimeEntry time;
+         memcpy( &time , times + entry * sizeof(time) , sizeof(time) );
+         if( time.timestamp >= timestamp || time.offset < RECORDING_RECORDS_OFFSET || time.offset >= chunk.indexOffset )
+         {
+            break;
+         }
+         SetPosition( i , time.offset , entry * RECORDING_TIME_INDEX_INTERVAL );
+      }
+
+      PduView record;
+      while( true )
+      {
+         const size_t chunkBefore = _chunk;
+         const uint32_t offsetBefore = _offset;
+         const uint32_t recordBefore = _record;
+         if( !Next( record ) )
+         {
+            return false;
+         }
+         if( record.timestamp >= timestamp )
+         {
+            SetPosition( chunkBefore , offsetBefore , recordBefore );
+            return true;
+         }
+      }
+   }
+
+   SetPosition( _chunks.size() , RECORDING_RECORDS_OFFSET , 0 );
+   return false;
+}
+
+unsigned long long RecordingReader::Process(IBufferProcessor& processor)
+{
+   unsigned long long count = 0;
+   const char* buf = NULL;
+   unsigned int size = 0;
+   ReceiveContext context;
+
+   while( Read( buf , size , context ) )
+   {
+      processor.Process( buf , size , BIG , context );
+      ++count;
+   }
+
+   return count;
+}
+
+RecordingScanStatistics RecordingReader::Scan(const RecordingQuery& query, IPduViewProcessor& processor, unsigned int workers) const
+{
+   ScanPlan plan;
+   plan.startTime = query.startTime;
+   plan.endTime = query.endTime;
+   plan.entities = query.entities;
+   std::sort( plan.entities.begin() , plan.entities.end() );
+   plan.entities.erase( std::unique( plan.entities.begin() , plan.entities.end() ) , plan.entities.end() );
+   plan.filterTypes = !query.types.empty();
+   memset( plan.types , 0 , sizeof(plan.types) );
+   for(size_t i=0; i<query.types.size(); ++i)
+   {
+      plan.types[query.types[i]] = true;
+   }
+
+   if( workers == 0 )
+   {
+      workers = std::thread::hardware_concurrency();
+   }
+   workers = std::max( 1u , std::min<unsigned int>( workers , static_cast<unsigned int>( _chunks.size() ) ) );
+
+   // the workers take the next chunk as they finish one, so that slow chunks do not hold the others back.
+   std::atomic<size_t> next( 0 );
+   std::vector<RecordingScanStatistics> statistics( workers );
+   std::vector<std::thread> threads;
+   for(unsigned int worker=1; worker<workers; ++worker)
+   {
+      threads.push_back( std::thread( &RecordingReader::ScanChunks , this , std::cref( plan ) , std::ref( processor ) ,
+                                      worker , std::ref( next ) , std::ref( statistics[worker] ) ) );
+   }
+   ScanChunks( plan , processor , 0 , next , statistics[0] );
+   for(size_t i=0; i<threads.size(); ++i)
+   {
+      threads[i].join();
+   }
+
+   RecordingScanStatistics total;
+   total.workers = workers;
+   for(unsigned int worker=0; worker<workers; ++worker)
+   {
+      total.scannedChunks += statistics[worker].scannedChunks;
+      total.skippedChunks += statistics[worker].skippedChunks;
+      total.records += statistics[worker].records;
+      total.matched += statistics[worker].matched;
+   }
+   return total;
+}
+
+void RecordingReader::ScanChunks(const ScanPlan& plan, IPduViewProcessor& processor, unsigned int worker,
+                                 std::atomic<size_t>& next, RecordingScanStatistics& statistics) const
+{
+   size_t chunk = 0;
+   while( (chunk = next.fetch_add( 1 , std::memory_order_relaxed )) < _chunks.size() )
+   {
+      if( ScanChunk( chunk , plan , processor , worker , statistics ) )
+      {
+         ++statistics.scannedChunks;
+      }
+      else
+      {
+         ++statistics.skippedChunks;
+      }
+   }
+}
+
+bool RecordingReader::ScanChunk(size_t index, const ScanPlan& plan, IPduViewProcessor& processor, unsigned int worker,
+                                RecordingScanStatistics& statistics) const
+{
+   const Chunk& chunk = _chunks[index];
+   const char* base = _data + chunk.position;
+
+   if( chunk.recordCount == 0 || chunk.lastTimestamp < plan.startTime || chunk.firstTimestamp > plan.endTime )
+   {
+      return false;
+   }
+
+   if( plan.filterTypes )
+   {
+      uint32_t counts[256];
+      memcpy( counts , base + offsetof( RecordingChunkHeader , typeCounts ) , sizeof(counts) );
+      bool present = false;
+      for(unsigned int type=0; type<256 && !present; ++type)
+      {
+         present = plan.types[type] && counts[type] > 0;
+      }
+      if( !present )
+      {
+         return false;
+      }
+   }
+
+   // the records of interest start at the first record of the entities, and the last indexed time before the start.
+   uint32_t offset = RECORDING_RECORDS_OFFSET;
+   unsigned long long entityRecords = ULLONG_MAX;
+   if( !plan.entities.empty() )
+   {
+      const char* entries = base + chunk.indexOffset + chunk.timeEntryCount * sizeof(RecordingTimeEntry);
+      uint32_t first = chunk.indexOffset;
+      entityRecords = 0;
+      for(size_t i=0; i<plan.entities.size(); ++i)
+      {
+         uint32_t low = 0;
+         uint32_t high = chunk.entityEntryCount;
+         while( low < high )
+         {
+            const uint32_t middle = low + (high - low) / 2;
+            RecordingEntityEntry entry;
+            memcpy( &entry , entries + middle * sizeof(entry) , sizeof(entry) );
+            if( entry.entityKey < plan.entities[i] )
+            {
+               low = middle + 1;
+            }
+            else if( entry.entityKey > plan.entities[i] )
+            {
+               high = middle;
+            }
+            else
+            {
+               first = std::min( first , entry.offset );
+               entityRecords += entry.count;
+               break;
+            }
+         }
+      }
+
+      if( entityRecords == 0 )
+      {
+         return false;
+      }
+      offset = std::max( offset , first );
+   }
+
+   if( plan.startTime > chunk.firstTimestamp )
+   {
+      const char* times = base + chunk.indexOffset;
+      for(uint32_t entry=0; entry<chunk.timeEntryCount; ++entry)
+      {
+         RecordingTimeEntry time;
+         memcpy( &time , times + entry * sizeof(time) , sizeof(time) );
+         if( time.timestamp >= plan.startTime || time.offset >= chunk.indexOffset )
+         {
+            break;
+         }
+         offset = std::max( offset , time.offset );
+      }
+   }
+
+   // ask for the rest of the chunk to be read ahead while the first records are processed.
+   _file.Prefetch( chunk.position + offset , chunk.indexOffset - offset );
+
+   // the records of a chunk are in the order they were received, so the scan ends after the end time.
+   PduView view;
+   while( chunk.indexOffset - offset >= sizeof(RecordingRecordHeader) && entityRecords > 0 )
+   {
+      if( !ReadRecord( chunk , offset , view ) )
+      {
+         break;
+      }
+      ++statistics.records;
+
+      if( view.timestamp > plan.endTime )
+      {
+         break;
+      }
+
+      if( !plan.entities.empty() )
+      {
+         if( !std::binary_search( plan.entities.begin() , plan.entities.end() , view.GetEntityKey() ) )
+         {
+            continue;
+         }
+         --entityRecords;
+      }
+
+      if( view.timestamp < plan.startTime || ( plan.filterTypes && !plan.types[view.GetPduType()] ) )
+      {
+         continue;
+      }
+
+      processor.Process( view , worker );
+      ++statistics.matched;
+   }
+
+   return true;
+}
+
+unsigned long long RecordingReader::GetWorldState(long long time, std::vector<EntitySnapshot>& entities, bool deadReckon) const
+{
+   std::map<unsigned long long, PduView> states;
+
+   // the last keyframe taken at or before the time.
+   size_t chunk = 0;
+   for(size_t i=_keyframes.size(); i>0; --i)
+   {
+      const Chunk& keyframe = _keyframes[i-1];
+      if( keyframe.lastTimestamp <= time )
+      {
+         uint32_t offset = RECORDING_RECORDS_OFFSET;
+         PduView view;
+         while( ReadRecord( keyframe , offset , view ) )
+         {
+            states[view.GetEntityKey()] = view;
+         }
+         chunk = keyframe.following;
+         break;
+      }
+   }
+
+   // roll forward, up to the first PDU received after the time.
+   unsigned long long rolled = 0;
+   for(; chunk<_chunks.size() && _chunks[chunk].firstTimestamp <= time; ++chunk)
+   {
+      const Chunk& current = _chunks[chunk];
+      if( current.recordCount == 0 )
+      {
+         continue;
+      }
+
+      uint32_t offset = RECORDING_RECORDS_OFFSET;
+      PduView view;
+      while( ReadRecord( current , offset , view ) && view.timestamp <= time )
+      {
+         if( view.length >= ENTITY_STATE_MIN_SIZE && view.GetPduType() == PDU_ENTITY_STATE )
+         {
+            states[view.GetEntityKey()] = view;
+         }
+         ++rolled;
+      }
+   }
+
+   entities.clear();
+   entities.reserve( states.size() );
+   EntitySnapshot snapshot;
+   for(std::map<unsigned long long, PduView>::const_iterator it=states.begin(); it!=states.end(); ++it)
+   {
+      if( DeadReckoning::Read( it->second , snapshot ) )
+      {
+         if( deadReckon )
+         {
+            DeadReckoning::Extrapolate( snapshot , ( time - snapshot.view.timestamp ) / 1e9 );
+         }
+         entities.push_back( snapshot );
+      }
+   }
+
+   return rolled;
+}
+
+size_t RecordingReader::GetKeyframeCount() const
+{
+   return _keyframes.size();
+}
+
+size_t RecordingReader::GetChunkCount() const
+{
+   return _chunks.size();
+}
+
+unsigned long long RecordingReader::GetRecordCount() const
+{
+   return _records;
+}
+
+long long RecordingReader::GetFirstTimestamp() const
+{
+   for(size_t i=0; i<_chunks.size(); ++i)
+   {
+      if( _chunks[i].recordCount > 0 )
+      {
+         return _chunks[i].firstTimestamp;
+      }
+   }
+   return 0;
+}
+
+long long RecordingReader::GetLastTimestamp() const
+{
+   for(size_t i=_chunks.size(); i>0; --i)
+   {
+      if( _chunks[i-1].recordCount > 0 )
+      {
+         return _chunks[i-1].lastTimestamp;
+      }
+   }
+   return 0;
+}
+
+size_t RecordingReader::GetSize() const
+{
+   return _size;
+}
+
+int RecordingReader::GetLastError() const
+{
+   return _error;
+}
@@ -0,0 +1,191 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_recording_reader_h_
+#define _dcl_dis_recording_reader_h_
+
+#include <utils/RecordingFormat.h>    // for member
+#include <utils/IPlaybackSource.h>    // for base class
+#include <utils/PduView.h>            // for parameter
+#include <utils/DeadReckoning.h>      // for parameter
+#include <utils/MappedFile.h>         // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <cstddef>                  // for size_t definition
+#include <atomic>                   // for parameter
+
+namespace DIS
+{
+   class IBufferProcessor;
+
+   class IPduViewProcessor;
+
+   /// the predicates of a recording scan.  every part is checked against the chunk headers and indexes first,
+   /// so that chunks holding nothing of interest are skipped without reading their records.
+   struct EXPORT_MACRO RecordingQuery
+   {
+      RecordingQuery();
+
+      /// the receive times of the PDUs, in nanoseconds since the epoch, both inclusive.
+      /// the default is every time.
+      long long startTime;
+      long long endTime;
+
+      /// the entity keys of the PDUs, packed by PduHeader::MakeEntityKey.  empty selects every PDU.
+      std::vector<unsigned long long> entities;
+
+      /// the PDU types.  empty selects every type.
+      std::vector<unsigned char> types;
+   };
+
+   /// the work done by a recording scan.
+   struct EXPORT_MACRO RecordingScanStatistics
+   {
+      RecordingScanStatistics();
+
+      /// the number of chunks whose records were read, and skipped by their headers and indexes.
+      unsigned long long scannedChunks;
+      unsigned long long skippedChunks;
+
+      /// the number of records read, and of those passed to the processor.
+      unsigned long long records;
+      unsigned long long matched;
+
+      /// the number of workers used.
+      unsigned int workers;
+   };
+
+   /// reads the PDUs of a file written by RecordingWriter, in the order they were received.
+   /// the file is memory mapped, and the chunk headers are read when the file is opened,
+   /// so that Seek() only reads the chunk holding the time, starting from its time index.
+   /// a last chunk cut short by a crash is ignored.
+   /// Scan() reads whole chunks in parallel and hands out non-owning PduViews rather than decoded PDUs,
+   /// so that analysing a large recording is bound by the disk rather than by decoding.
+   /// the reader is an IPlaybackSource, so that a recording can be played back.
+   class EXPORT_MACRO RecordingReader : public IPlaybackSource
+   {
+   public:
+      RecordingReader();
+      ~RecordingReader();
+
+      /// map the file and read its chunk headers.
+      /// @return 'false' if the file could not be read or is not a recording.  GetLastError() has the errno value.
+      bool Open(const std::string& path);
+
+      void Close();
+      bool IsOpen() const;
+
+      /// read the next PDU.
+      /// @return 'false' at the end of the file.
+      bool Next(PduView& record);
+
+      /// go back to the first PDU.
+      void Rewind();
+
+      /// read the next PDU, with its addresses and receive time in the context.
+      bool Read(const char*& buf, unsigned int& size, ReceiveContext& context);
+
+      /// go to the first PDU received at or after the time, using the chunk headers and time index.
+      bool Seek(long long timestamp);
+
+      /// pass every remaining PDU to the processor, with its addresses and receive time in the context.
+      /// @return the number of PDUs passed to the processor.
+      unsigned long long Process(IBufferProcessor& processor);
+
+      /// pass every PDU matching the query to the processor, reading the chunks on several threads.
+      /// the PDUs of a chunk are passed in order by one worker, but the chunks are processed in any order.
+      /// the reading position of Next() is not changed, and several scans can run at once.
+      /// @param workers the number of threads.  0 uses one per core.
+      RecordingScanStatistics Scan(const RecordingQuery& query, IPduViewProcessor& processor, unsigned int workers=0) const;
+
+      /// rebuild the state of every entity at the time: start from the last keyframe before it,
+      /// then roll forward through the Entity State PDUs received up to the time.
+      /// entities are those that sent an Entity State PDU since the start of the recording.
+      /// @param time the time, in nanoseconds since the epoch.
+      /// @param entities is given the state of every entity, sorted by entity key.
+      /// @param deadReckon when 'true' each state is extrapolated from its PDU to the time.
+      /// @return the number of PDUs read after the keyframe.
+      unsigned long long GetWorldState(long long time, std::vector<EntitySnapshot>& entities, bool deadReckon=true) const;
+
+      /// @return the number of complete keyframes.
+      size_t GetKeyframeCount() const;
+
+      /// @return the number of complete chunks, not counting keyframes.
+      size_t GetChunkCount() const;
+
+      /// @return the number of PDUs in the complete chunks.
+      unsigned long long GetRecordCount() const;
+
+      /// @return the receive times of the first and last PDUs, in nanoseconds since the epoch.
+      long long GetFirstTimestamp() const;
+      long long GetLastTimestamp() const;
+
+      /// @return the size of the mapped file.
+      size_t GetSize() const;
+
+      int GetLastError() const;
+
+   private:
+      RecordingReader(const RecordingReader&);              ///< not implemented by design
+      RecordingReader& operator=(const RecordingReader&);   ///< not implemented by design
+
+      /// find the complete chunks.
+      /// @return 'false' if the file is not a recording.
+      bool ReadHeaders();
+
+      struct Chunk;
+
+      /// read the record at the offset from the start of the chunk, and move the offset to the next record.
+      /// @return 'false' if no complete record is left in the chunk.
+      bool ReadRecord(const Chunk& chunk, uint32_t& offset, PduView& view) const;
+
+      /// the query, prepared for checking every record.
+      struct ScanPlan;
+
+      /// scan the chunks handed out by the counter until there are none left.
+      void ScanChunks(const ScanPlan& plan, IPduViewProcessor& processor, unsigned int worker,
+                      std::atomic<size_t>& next, RecordingScanStatistics& statistics) const;
+
+      /// scan the records of one chunk.
+      /// @return 'false' if the chunk was skipped by its header and indexes.
+      bool ScanChunk(size_t chunk, const ScanPlan& plan, IPduViewProcessor& processor, unsigned int worker,
+                     RecordingScanStatistics& statistics) const;
+
+      /// position at a record of the current chunk.
+      void SetPosition(size_t chunk, uint32_t offset, uint32_t record);
+
+      /// the file, and its contents.
+      MappedFile _file;
+      const char* _data;
+      size_t _size;
+
+      /// the parts of a complete chunk's header needed to read it.
+      struct Chunk
+      {
+         size_t position;
+         uint32_t recordCount;
+         uint32_t indexOffset;
+         uint32_t timeEntryCount;
+         uint32_t entityEntryCount;
+         long long firstTimestamp;
+         long long lastTimestamp;
+
+         /// for keyframes, the number of chunks before the keyframe.
+         size_t following;
+      };
+      std::vector<Chunk> _chunks;
+      std::vector<Chunk> _keyframes;
+      unsigned long long _records;
+
+      /// the reading position: the chunk, the record within it, and the record's offset from the chunk start.
+      size_t _chunk;
+      uint32_t _record;
+      uint32_t _offset;
+
+      int _error;
+   };
+}
+
+#endif  // _dcl_dis_recording_reader_h_
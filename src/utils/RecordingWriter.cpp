@@ -0,0 +1,615 @@
+#include <utils/RecordingWriter.h>
+
+#if defined(__linux__)
+
+#include <utils/PduHeader.h>
+#include <utils/PDUType.h>
+#include <utils/DeadReckoning.h>
+#include <utils/ReceiveContext.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace DIS;
+
+namespace
+{
+   /// the smallest record: a header and a bare PDU header.
+   const uint32_t MIN_RECORD_SIZE = static_cast<uint32_t>(
+      RecordingAlign( sizeof(RecordingRecordHeader) + PDU_HEADER_SIZE , RECORDING_RECORD_ALIGNMENT ) );
+
+   /// the longest time the background thread sleeps before checking whether it should stop.
+   const unsigned int WRITER_SLEEP_MS = 100;
+
+   long long SteadyNanoseconds()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::steady_clock::now().time_since_epoch() ).count();
+   }
+
+   long long SystemNanoseconds()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::system_clock::now().time_since_epoch() ).count();
+   }
+
+   /// the most records a chunk can hold.
+   uint32_t MaxRecords(uint32_t chunkSize)
+   {
+      return chunkSize / MIN_RECORD_SIZE + 1;
+   }
+
+   /// the largest index the records of a chunk can need.
+   size_t MaxIndexSize(uint32_t chunkSize)
+   {
+      const size_t records = MaxRecords( chunkSize );
+      return ( records / RECORDING_TIME_INDEX_INTERVAL + 1 ) * sizeof(RecordingTimeEntry) +
+             records * sizeof(RecordingEntityEntry);
+   }
+}
+
+RecordingWriterSettings::RecordingWriterSettings()
+   : chunkSize(4 * 1024 * 1024)
+   , chunkCount(8)
+   , waitForChunks(false)
+   , maxChunkAgeMs(1000)
+   , keyframeIntervalMs(10000)
+   , directIo(false)
+{
+}
+
+RecordingWriter::RecordingWriter()
+   : _settings()
+   , _fd(-1)
+   , _chunks()
+   , _current(NULL)
+   , _full(NULL)
+   , _free(NULL)
+   , _thread()
+   , _running(false)
+   , _mutex()
+   , _wakeup()
+   , _entities()
+   , _entityStates()
+   , _keyframe(NULL)
+   , _keyframeCapacity(0)
+   , _keyframeTime(0)
+   , _sequence(0)
+   , _recorded(0)
+   , _dropped(0)
+   , _written(0)
+   , _keyframes(0)
+   , _bytes(0)
+   , _error(0)
+{
+}
+
+RecordingWriter::~RecordingWriter()
+{
+   Close();
+}
+
+bool RecordingWriter::Open(const std::string& path, const RecordingWriterSettings& settings)
+{
+   Close();
+
+   // a failure of the previous recording would otherwise stop this one from being written.
+   _error = 0;
+
+   _settings = settings;
+   if( _settings.chunkCount < 2 )
+   {
+      _settings.chunkCount = 2;
+   }
+   if( _settings.chunkSize < RECORDING_ALIGNMENT )
+   {
+      _settings.chunkSize = RECORDING_ALIGNMENT;
+   }
+
+   int flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+   if( _settings.directIo )
+   {
+      flags |= O_DIRECT;
+   }
+   _fd = ::open( path.c_str() , flags , 0644 );
+   if( _fd < 0 )
+   {
+      _error = errno;
+      return false;
+   }
+
+   // every buffer is aligned and sized for direct writes, including the file header.
+   const size_t capacity = RecordingAlign( RECORDING_RECORDS_OFFSET + _settings.chunkSize + MaxIndexSize( _settings.chunkSize ) ,
+                                           RECORDING_ALIGNMENT );
+   for(unsigned int i=0; i<_settings.chunkCount; ++i)
+   {
+      void* buffer = NULL;
+      if( posix_memalign( &buffer , RECORDING_ALIGNMENT , capacity ) != 0 )
+      {
+         _error = ENOMEM;
+         Close();
+         return false;
+      }
+      memset( buffer , 0 , capacity );
+
+      Chunk* chunk = new Chunk();
+      chunk->buffer = static_cast<char*>( buffer );
+      chunk->capacity = capacity;
+      chunk->recordsLength = 0;
+      chunk->recordCount = 0;
+      chunk->started = 0;
+      _chunks.push_back( chunk );
+   }
+
+   RecordingFileHeader header;
+   memset( &header , 0 , sizeof(header) );
+   memcpy( header.magic , RECORDING_MAGIC , sizeof(header.magic) );
+   header.headerSize = RECORDING_ALIGNMENT;
+   header.chunkSize = _settings.chunkSize;
+   header.created = SystemNanoseconds();
+
+   char* first = _chunks[0]->buffer;
+   memcpy( first , &header , sizeof(header) );
+   if( !WriteAll( first , RECORDING_ALIGNMENT ) )
+   {
+      Close();
+      return false;
+   }
+   memset( first , 0 , RECORDING_ALIGNMENT );
+   _bytes = RECORDING_ALIGNMENT;
+
+   _full = new ChunkRing( _settings.chunkCount );
+   _free = new ChunkRing( _settings.chunkCount );
+   for(unsigned int i=1; i<_chunks.size(); ++i)
+   {
+      _free->Push( _chunks[i] );
+   }
+   _current = _chunks[0];
+
+   _entities.reserve( MaxRecords( _settings.chunkSize ) );
+   _entityStates.clear();
+   _keyframeTime = 0;
+   _sequence = 0;
+   _recorded = 0;
+   _dropped = 0;
+   _written = 0;
+   _keyframes = 0;
+
+   _running = true;
+   _thread = std::thread( &RecordingWriter::WriteLoop , this );
+   return true;
+}
+
+void RecordingWriter::Close()
+{
+   if( _running.load() )
+   {
+      if( _current != NULL && _current->recordCount > 0 )
+      {
+         Seal();
+      }
+
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         _running = false;
+      }
+      _wakeup.notify_one();
+      _thread.join();
+   }
+
+   if( _fd >= 0 )
+   {
+      ::close( _fd );
+      _fd = -1;
+   }
+
+   for(unsigned int i=0; i<_chunks.size(); ++i)
+   {
+      free( _chunks[i]->buffer );
+      delete _chunks[i];
+   }
+   _chunks.clear();
+   _current = NULL;
+
+   free( _keyframe );
+   _keyframe = NULL;
+   _keyframeCapacity = 0;
+   _entityStates.clear();
+
+   delete _full;
+   _full = NULL;
+   delete _free;
+   _free = NULL;
+}
+
+bool RecordingWriter::IsOpen() const
+{
+   return _running.load();
+}
+
+void RecordingWriter::Process(const char* buf, unsigned int size, Endian e)
+{
+   Process( buf , size , e , ReceiveContext() );
+}
+
+void RecordingWriter::Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context)
+{
+   if( !_running.load( std::memory_order_relaxed ) )
+   {
+      return;
+   }
+
+   ReceiveContext pduContext( context );
+   if( pduContext.timestamp == 0 )
+   {
+      pduContext.timestamp = SystemNanoseconds();
+   }
+
+   unsigned int offset = 0;
+   while( size - offset >= PDU_HEADER_SIZE )
+   {
+      // a malformed length records the rest of the datagram as one PDU.
+      unsigned int length = PduHeader::GetLength( buf + offset , e );
+      if( length < PDU_HEADER_SIZE || length > size - offset )
+      {
+         length = size - offset;
+      }
+
+      Record( buf + offset , length , pduContext );
+      offset += length;
+   }
+
+   // a quiet exercise still reaches the disk regularly.
+   if( _settings.maxChunkAgeMs > 0 && _current != NULL && _current->recordCount > 0 &&
+       SteadyNanoseconds() - _current->started > static_cast<long long>( _settings.maxChunkAgeMs ) * 1000000 )
+   {
+      Seal();
+   }
+}
+
+bool RecordingWriter::Record(const char* pdu, unsigned int length, const ReceiveContext& context)
+{
+   const uint32_t size = static_cast<uint32_t>(
+      RecordingAlign( sizeof(RecordingRecordHeader) + length , RECORDING_RECORD_ALIGNMENT ) );
+
+   if( _current != NULL && _current->recordsLength + size > _settings.chunkSize )
+   {
+      Seal();
+   }
+
+   // waiting for a free chunk only happens when the disk has fallen behind.
+   while( _current == NULL && _free != NULL )
+   {
+      Chunk** chunk = _free->Front();
+      if( chunk != NULL )
+      {
+         _current = *chunk;
+         _free->Pop();
+      }
+      else if( _settings.waitForChunks && size <= _settings.chunkSize )
+      {
+         std::this_thread::yield();
+      }
+      else
+      {
+         break;
+      }
+   }
+
+   if( _current == NULL || size > _settings.chunkSize || length > 0xffff )
+   {
+      _dropped.fetch_add( 1 , std::memory_order_relaxed );
+      return false;
+   }
+
+   if( _current->recordCount == 0 )
+   {
+      _current->started = SteadyNanoseconds();
+   }
+
+   char* record = _current->buffer + RECORDING_RECORDS_OFFSET + _current->recordsLength;
+   RecordingRecordHeader header;
+   header.timestamp = context.timestamp != 0 ? context.timestamp : SystemNanoseconds();
+   header.sourceAddress = context.sourceAddress;
+   header.destinationAddress = context.destinationAddress;
+   header.sourcePort = context.sourcePort;
+   header.length = static_cast<uint16_t>( length );
+   header.reserved = 0;
+   memcpy( record , &header , sizeof(header) );
+   memcpy( record + sizeof(header) , pdu , length );
+
+   // the padding is zeroed, so that files are reproducible.
+   memset( record + sizeof(header) + length , 0 , size - sizeof(header) - length );
+
+   _current->recordsLength += size;
+   ++_current->recordCount;
+   _recorded.fetch_add( 1 , std::memory_order_relaxed );
+   return true;
+}
+
+void RecordingWriter::Flush()
+{
+   if( _running.load() && _current != NULL && _current->recordCount > 0 )
+   {
+      Seal();
+   }
+}
+
+void RecordingWriter::Seal()
+{
+   // the ring holds every chunk, so there is always room.
+   _full->Push( _current );
+   _current = NULL;
+
+   {
+      std::lock_guard<std::mutex> lock( _mutex );
+   }
+   _wakeup.notify_one();
+
+   Chunk** chunk = _free->Front();
+   if( chunk != NULL )
+   {
+      _current = *chunk;
+      _free->Pop();
+   }
+}
+
+void RecordingWriter::WriteLoop()
+{
+   while( true )
+   {
+      Chunk** chunk = _full->Front();
+      if( chunk != NULL )
+      {
+         WriteChunk( **chunk );
+         _free->Push( *chunk );
+         _full->Pop();
+         continue;
+      }
+
+      std::unique_lock<std::mutex> lock( _mutex );
+      if( !_running.load() )
+      {
+         // the final chunk was queued before the flag was cleared.
+         if( _full->Empty() )
+         {
+            break;
+         }
+         continue;
+      }
+      if( _full->Empty() )
+      {
+         _wakeup.wait_for( lock , std::chrono::milliseconds( WRITER_SLEEP_MS ) );
+      }
+   }
+}
+
+void RecordingWriter::WriteChunk(Chunk& chunk)
+{
+   RecordingChunkHeader header;
+   memset( &header , 0 , sizeof(header) );
+   header.magic = RECORDING_CHUNK_MAGIC;
+   header.sequence = _sequence++;
+   header.recordsLength = chunk.recordsLength;
+   header.recordCount = chunk.recordCount;
+
+   // walk the records for the index.
+   char* index = chunk.buffer + RECORDING_RECORDS_OFFSET + chunk.recordsLength;
+   RecordingTimeEntry* times = reinterpret_cast<RecordingTimeEntry*>( index );
+   _entities.clear();
+
+   uint32_t offset = RECORDING_RECORDS_OFFSET;
+   for(uint32_t i=0; i<chunk.recordCount; ++i)
+   {
+      RecordingRecordHeader record;
+      memcpy( &record , chunk.buffer + offset , sizeof(record) );
+      const char* pdu = chunk.buffer + offset + sizeof(record);
+
+      if( i == 0 )
+      {
+         header.firstTimestamp = record.timestamp;
+      }
+      header.lastTimestamp = record.timestamp;
+      ++header.typeCounts[PduHeader::GetPduType( pdu )];
+
+      if( i % RECORDING_TIME_INDEX_INTERVAL == 0 )
+      {
+         RecordingTimeEntry& entry = times[header.timeEntryCount++];
+         entry.timestamp = record.timestamp;
+         entry.offset = offset;
+         entry.reserved = 0;
+      }
+
+      const uint32_t size = static_cast<uint32_t>( RecordingAlign( sizeof(record) + record.length , RECORDING_RECORD_ALIGNMENT ) );
+      if( record.length >= PDU_ENTITY_ID_POSITION + ENTITY_ID_SIZE )
+      {
+         const unsigned long long key = PduHeader::GetEntityKey( pdu , record.length );
+         _entities.push_back( std::make_pair( key , offset ) );
+
+         // the latest state of every entity, for the next keyframe.
+         if( _settings.keyframeIntervalMs > 0 && record.length >= ENTITY_STATE_MIN_SIZE &&
+             PduHeader::GetPduType( pdu ) == PDU_ENTITY_STATE )
+         {
+            _entityStates[key].assign( chunk.buffer + offset , chunk.buffer + offset + size );
+         }
+      }
+
+      offset += size;
+   }
+
+   // the records were appended in order, so the first offset of each entity stays first.
+   std::stable_sort( _entities.begin() , _entities.end() );
+   RecordingEntityEntry* entities = reinterpret_cast<RecordingEntityEntry*>( times + header.timeEntryCount );
+   for(size_t i=0; i<_entities.size(); ++i)
+   {
+      if( header.entityEntryCount > 0 && entities[header.entityEntryCount-1].entityKey == _entities[i].first )
+      {
+         ++entities[header.entityEntryCount-1].count;
+         continue;
+      }
+      RecordingEntityEntry& entry = entities[header.entityEntryCount++];
+      entry.entityKey = _entities[i].first;
+      entry.offset = _entities[i].second;
+      entry.count = 1;
+   }
+
+   header.indexOffset = RECORDING_RECORDS_OFFSET + chunk.recordsLength;
+   if( WriteSealed( chunk.buffer , header ) )
+   {
+      _written.fetch_add( 1 );
+   }
+   else
+   {
+      _dropped.fetch_add( chunk.recordCount );
+   }
+
+   chunk.recordsLength = 0;
+   chunk.recordCount = 0;
+
+   // the keyframe follows the chunk holding its time, so that readers roll forward from the next chunk.
+   if( _settings.keyframeIntervalMs > 0 && header.recordCount > 0 )
+   {
+      if( _keyframeTime == 0 )
+      {
+         _keyframeTime = header.firstTimestamp;
+      }
+      if( header.lastTimestamp - _keyframeTime >= static_cast<long long>( _settings.keyframeIntervalMs ) * 1000000 )
+      {
+         WriteKeyframe( header.lastTimestamp );
+      }
+   }
+}
+
+void RecordingWriter::WriteKeyframe(long long time)
+{
+   std::vector<unsigned long long> keys;
+   keys.reserve( _entityStates.size() );
+   size_t recordsLength = 0;
+   for(EntityStates::const_iterator it=_entityStates.begin(); it!=_entityStates.end(); ++it)
+   {
+      keys.push_back( it->first );
+      recordsLength += it->second.size();
+   }
+   std::sort( keys.begin() , keys.end() );
+
+   const size_t capacity = RecordingAlign( RECORDING_RECORDS_OFFSET + recordsLength + keys.size() * sizeof(RecordingEntityEntry) ,
+                                           RECORDING_ALIGNMENT );
+   if( capacity > _keyframeCapacity )
+   {
+      void* buffer = NULL;
+      if( posix_memalign( &buffer , RECORDING_ALIGNMENT , capacity ) != 0 )
+      {
+         return;
+      }
+      free( _keyframe );
+      _keyframe = static_cast<char*>( buffer );
+      _keyframeCapacity = capacity;
+   }
+
+   RecordingChunkHeader header;
+   memset( &header , 0 , sizeof(header) );
+   header.magic = RECORDING_CHUNK_MAGIC;
+   header.sequence = _sequence++;
+   header.flags = RECORDING_CHUNK_KEYFRAME;
+   header.recordsLength = static_cast<uint32_t>( recordsLength );
+   header.recordCount = static_cast<uint32_t>( keys.size() );
+   header.typeCounts[PDU_ENTITY_STATE] = header.recordCount;
+   header.firstTimestamp = time;
+   header.lastTimestamp = time;
+   header.indexOffset = static_cast<uint32_t>( RECORDING_RECORDS_OFFSET + recordsLength );
+   header.entityEntryCount = header.recordCount;
+
+   // the records are sorted by entity, so every entity has one index entry and no time index is needed.
+   uint32_t offset = RECORDING_RECORDS_OFFSET;
+   RecordingEntityEntry* entities = reinterpret_cast<RecordingEntityEntry*>( _keyframe + header.indexOffset );
+   for(size_t i=0; i<keys.size(); ++i)
+   {
+      const std::vector<char>& record = _entityStates[keys[i]];
+      memcpy( _keyframe + offset , &record[0] , record.size() );
+      entities[i].entityKey = keys[i];
+      entities[i].offset = offset;
+      entities[i].count = 1;
+      offset += static_cast<uint32_t>( record.size() );
+   }
+
+   if( WriteSealed( _keyframe , header ) )
+   {
+      _keyframes.fetch_add( 1 );
+   }
+   _keyframeTime = time;
+}
+
+bool RecordingWriter::WriteSealed(char* buffer, RecordingChunkHeader& header)
+{
+   const size_t end = header.indexOffset + header.timeEntryCount * sizeof(RecordingTimeEntry) +
+                      header.entityEntryCount * sizeof(RecordingEntityEntry);
+   header.chunkLength = RecordingAlign( end , RECORDING_ALIGNMENT );
+   memset( buffer + end , 0 , header.chunkLength - end );
+   memcpy( buffer , &header , sizeof(header) );
+
+   // after a failed write the rest of the recording is dropped, rather than leaving a hole.
+   if( _error.load() != 0 || !WriteAll( buffer , header.chunkLength ) )
+   {
+      return false;
+   }
+   _bytes.fetch_add( header.chunkLength );
+   return true;
+}
+
+bool RecordingWriter::WriteAll(const char* buf, size_t size)
+{
+   while( size > 0 )
+   {
+      const ssize_t written = ::write( _fd , buf , size );
+      if( written < 0 )
+      {
+         if( errno == EINTR )
+         {
+            continue;
+         }
+         _error = errno;
+         return false;
+      }
+      buf += written;
+      size -= static_cast<size_t>( written );
+   }
+   return true;
+}
+
+unsigned long long RecordingWriter::GetRecordedCount() const
+{
+   return _recorded.load();
+}
+
+unsigned long long RecordingWriter::GetDroppedCount() const
+{
+   return _dropped.load();
+}
+
+unsigned long long RecordingWriter::GetChunkCount() const
+{
+   return _written.load();
+}
+
+unsigned long long RecordingWriter::GetKeyframeCount() const
+{
+   return _keyframes.load();
+}
+
+unsigned long long RecordingWriter::GetBytesWritten() const
+{
+   return _bytes.load();
+}
+
+int RecordingWriter::GetLastError() const
+{
+   return _error.load();
+}
+
+#endif  // __linux__
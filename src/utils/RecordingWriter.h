@@ -0,0 +1,177 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_recording_writer_h_
+#define _dcl_dis_recording_writer_h_
+
+#if defined(__linux__)
+
+#include <utils/IBufferProcessor.h>   // for base class
+#include <utils/RecordingFormat.h>    // for member
+#include <utils/SpscRing.h>           // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <string>                   // for parameter
+#include <vector>                   // for member
+#include <utility>                  // for member
+#include <unordered_map>            // for member
+#include <atomic>                   // for member
+#include <thread>                   // for member
+#include <mutex>                    // for member
+#include <condition_variable>       // for member
+
+namespace DIS
+{
+   /// the parameters used to open a RecordingWriter.
+   struct EXPORT_MACRO RecordingWriterSettings
+   {
+      RecordingWriterSettings();
+
+      /// the largest number of record bytes in a chunk, and so in one write.
+      unsigned int chunkSize;
+
+      /// the number of chunk buffers.  when the disk falls this many chunks behind, records are dropped.
+      unsigned int chunkCount;
+
+      /// wait for a chunk buffer to be written rather than dropping records, when converting offline.
+      bool waitForChunks;
+
+      /// a chunk holding records is written after this long, even when it is not full.  0 waits for it to fill.
+      unsigned int maxChunkAgeMs;
+
+      /// a keyframe holding the last Entity State PDU of every entity is written after the chunk
+      /// that ends this long after the previous keyframe, in recorded time.  0 writes no keyframes.
+      unsigned int keyframeIntervalMs;
+
+      /// write around the page cache with O_DIRECT, which every chunk is aligned for.
+      bool directIo;
+   };
+
+   /// records every PDU it is given, with its receive time and addresses, to a chunked, append-only
+   /// file described by RecordingFormat.h.
+   /// the receiving thread only copies the PDUs into the current chunk buffer.  full chunks are handed
+   /// to a background thread, which indexes them by time, PDU type and entity, and writes each
+   /// chunk with one large aligned write.  the receiving thread never waits for the disk:
+   /// when every chunk buffer is waiting to be written, records are dropped and counted.
+   /// the background thread also keeps the latest state of every entity, and writes it periodically
+   /// as a keyframe chunk, so that readers can rebuild the world state without replaying the whole file.
+   /// the writer is an IBufferProcessor, so a transport can record straight to the file.
+   /// this class is only available on Linux.
+   class EXPORT_MACRO RecordingWriter : public IBufferProcessor
+   {
+   public:
+      RecordingWriter();
+
+      /// writes the last chunk and closes the file.
+      ~RecordingWriter();
+
+      /// create the file, write its header and start the background thread.
+      /// @return 'false' if the file could not be created.  GetLastError() has the errno value.
+      bool Open(const std::string& path, const RecordingWriterSettings& settings=RecordingWriterSettings());
+
+      /// write the current chunk, wait for every chunk to be written, and close the file.
+      void Close();
+
+      bool IsOpen() const;
+
+      /// record every PDU of the buffer.
+      void Process(const char* buf, unsigned int size, Endian e);
+      void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context);
+
+      /// record one PDU.  a context without a timestamp is stamped with the current time.
+      /// @return 'false' if the PDU was dropped.
+      bool Record(const char* pdu, unsigned int length, const ReceiveContext& context);
+
+      /// hand the current chunk to the background thread, even when it is not full.
+      void Flush();
+
+      /// @return the number of PDUs recorded.
+      unsigned long long GetRecordedCount() const;
+
+      /// @return the number of PDUs dropped because no chunk buffer was free, or the PDU was too large.
+      unsigned long long GetDroppedCount() const;
+
+      /// @return the number of chunks of PDUs written to the file, not counting keyframes.
+      unsigned long long GetChunkCount() const;
+
+      /// @return the number of keyframes written to the file.
+      unsigned long long GetKeyframeCount() const;
+
+      /// @return the number of bytes written to the file.
+      unsigned long long GetBytesWritten() const;
+
+      int GetLastError() const;
+
+   private:
+      RecordingWriter(const RecordingWriter&);              ///< not implemented by design
+      RecordingWriter& operator=(const RecordingWriter&);   ///< not implemented by design
+
+      /// one aligned buffer, laid out as the chunk will be written.
+      struct Chunk
+      {
+         char* buffer;
+         size_t capacity;
+         uint32_t recordsLength;
+         uint32_t recordCount;
+
+         /// when the first record was copied in, in steady clock nanoseconds.
+         long long started;
+      };
+      typedef SpscRing<Chunk*> ChunkRing;
+
+      /// producer only.  hand the current chunk to the background thread and take a free one.
+      void Seal();
+
+      /// build the header and index of the chunk, then write it.
+      void WriteChunk(Chunk& chunk);
+
+      void WriteLoop();
+
+      /// write the snapshot of every entity's latest state.
+      void WriteKeyframe(long long time);
+
+      /// finish the header of a chunk whose records and index are in the buffer, and write it.
+      /// @return 'false' if the chunk could not be written.
+      bool WriteSealed(char* buffer, RecordingChunkHeader& header);
+
+      /// write the whole buffer, continuing after partial writes.
+      bool WriteAll(const char* buf, size_t size);
+
+      RecordingWriterSettings _settings;
+      int _fd;
+      std::vector<Chunk*> _chunks;
+      Chunk* _current;
+
+      /// chunks waiting to be written, and chunks waiting to be filled.
+      ChunkRing* _full;
+      ChunkRing* _free;
+
+      std::thread _thread;
+      std::atomic<bool> _running;
+      std::mutex _mutex;
+      std::condition_variable _wakeup;
+
+      /// writer thread only.  the entity of each record, reused for every chunk.
+      std::vector< std::pair<uint64_t,uint32_t> > _entities;
+
+      /// writer thread only.  the last Entity State record of every entity, and the keyframe buffer.
+      typedef std::unordered_map< unsigned long long, std::vector<char> > EntityStates;
+      EntityStates _entityStates;
+      char* _keyframe;
+      size_t _keyframeCapacity;
+      long long _keyframeTime;
+
+      uint32_t _sequence;
+
+      std::atomic<unsigned long long> _recorded;
+      std::atomic<unsigned long long> _dropped;
+      std::atomic<unsigned long long> _written;
+      std::atomic<unsigned long long> _keyframes;
+      std::atomic<unsigned long long> _bytes;
+      std::atomic<int> _error;
+   };
+}
+
+#endif  // __linux__
+
+#endif  // _dcl_dis_recording_writer_h_
@@ -0,0 +1,447 @@
+#include <utils/ShardedReceiver.h>
+
+#if defined(__linux__)
+
+#include <utils/IBufferProcessor.h>
+#include <utils/PduHeader.h>
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <chrono>
+
+using namespace DIS;
+
+namespace
+{
+   /// the number of slots a worker takes from one ring before visiting the next,
+   /// so that one busy receive thread can not starve the others.
+   const unsigned int WORKER_BATCH = 256;
+
+   /// the number of empty polls a worker makes before it goes to sleep.
+   const unsigned int WORKER_SPINS = 64;
+
+   /// the longest time a sleeping worker waits before checking its rings again.
+   const unsigned int WORKER_SLEEP_MS = 10;
+
+   /// the longest time a receive thread blocks before checking whether it should stop.
+   const int RECEIVE_TIMEOUT_MS = 100;
+
+   unsigned int CoreCount()
+   {
+      unsigned int cores = std::thread::hardware_concurrency();
+      return( cores > 0 ? cores : 1 );
+   }
+}
+
+/// reads one socket and routes each PDU to the ring of the worker owning its entity.
+class ShardedReceiver::Receiver : public IBufferProcessor
+{
+public:
+   Receiver(ShardedReceiver& owner, unsigned int index)
+      : _owner(owner)
+      , _index(index)
+      , _touched(owner._workers.size(), false)
+      , transport()
+      , thread()
+   {
+   }
+
+   void Process(const char* buf, unsigned int size, Endian e)
+   {
+      Process( buf , size , e , ReceiveContext() );
+   }
+
+   void Process(const char* buf, unsigned int size, Endian e, const ReceiveContext& context)
+   {
+      ReceiveContext pduContext( context );
+
+      ForEachBundledPdu( buf , size , e , [&](const char* pdu, unsigned int length, unsigned int offset)
+      {
+         const unsigned int worker = _owner.GetWorkerForEntity( PduHeader::GetEntityKey( pdu , length ) );
+         Ring& ring = *_owner._workers[worker]->rings[_index];
+
+         Slot* slot = ring.Reserve();
+         if( slot == NULL || length > slot->data.size() )
+         {
+            _owner._dropped.fetch_add( 1 , std::memory_order_relaxed );
+         }
+         else
+         {
+            memcpy( &slot->data[0] , pdu , length );
+            slot->length = length;
+            slot->context = pduContext;
+            slot->context.pduOffset = context.pduOffset + offset;
+            ring.Publish();
+            _touched[worker] = true;
+            _owner._queued.fetch_add( 1 , std::memory_order_relaxed );
+         }
+
+         ++pduContext.pduIndex;
+      } );
+   }
+
+   /// wake the workers that were handed PDUs by the batch, rather than once the socket is drained,
+   /// so that they empty their rings while the next batch is read.
+   void EndBatch()
+   {
+      for(unsigned int i=0; i<_touched.size(); ++i)
+      {
+         if( _touched[i] )
+         {
+            _owner.Wake( *_owner._workers[i] );
+            _touched[i] = false;
+         }
+      }
+   }
+
+private:
+   ShardedReceiver& _owner;
+   unsigned int _index;
+   std::vector<bool> _touched;
+
+public:
+   UdpTransport transport;
+   std::thread thread;
+};
+
+ShardedReceiverSettings::ShardedReceiverSettings()
+   : transport()
+   , receiveThreads(0)
+   , workerThreads(0)
+   , ringCapacity(1024)
+   , slotSize(1500)
+{
+}
+
+ShardedReceiver::Worker::Worker()
+   : incoming()
+   , rings()
+   , sleeping(false)
+   , mutex()
+   , wakeup()
+   , thread()
+{
+}
+
+ShardedReceiver::ShardedReceiver()
+   : _settings()
+   , _receivers()
+   , _workers()
+   , _running(false)
+   , _dropped(0)
+   , _queued(0)
+   , _error(0)
+{
+}
+
+ShardedReceiver::~ShardedReceiver()
+{
+   Close();
+}
+
+bool ShardedReceiver::Open(const ShardedReceiverSettings& settings)
+{
+   Close();
+
+   _settings = settings;
+   if( _settings.receiveThreads == 0 )
+   {
+      _settings.receiveThreads = CoreCount();
+   }
+   if( _settings.workerThreads == 0 )
+   {
+      _settings.workerThreads = CoreCount();
+   }
+
+   in_addr group;
+   if( inet_pton( AF_INET , _settings.transport.address.c_str() , &group ) == 1 &&
+       IN_MULTICAST( ntohl( group.s_addr ) ) )
+   {
+      _settings.receiveThreads = 1;
+   }
+   _settings.transport.reusePort = _settings.receiveThreads > 1;
+
+   Slot prototype;
+   prototype.length = 0;
+   prototype.data.resize( _settings.slotSize );
+
+   for(unsigned int w=0; w<_settings.workerThreads; ++w)
+   {
+      Worker* worker = new Worker();
+      for(unsigned int r=0; r<_settings.receiveThreads; ++r)
+      {
+         worker->rings.push_back( new Ring( _settings.ringCapacity , prototype ) );
+      }
+      _workers.push_back( worker );
+   }
+
+   // every socket binds the port chosen for the first one.
+   UdpTransportSettings transport = _settings.transport;
+   for(unsigned int r=0; r<_settings.receiveThreads; ++r)
+   {
+      Receiver* receiver = new Receiver( *this , r );
+      _receivers.push_back( receiver );
+      if( !receiver->transport.Open( transport ) )
+      {
+         _error = receiver->transport.GetLastError();
+         Close();
+         return false;
+      }
+      transport.port = receiver->transport.GetLocalPort();
+   }
+
+   return true;
+}
+
+void ShardedReceiver::Close()
+{
+   Stop();
+
+   for(unsigned int r=0; r<_receivers.size(); ++r)
+   {
+      delete _receivers[r];
+   }
+   _receivers.clear();
+
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      for(unsigned int r=0; r<_workers[w]->rings.size(); ++r)
+      {
+         delete _workers[w]->rings[r];
+      }
+      delete _workers[w];
+   }
+   _workers.clear();
+}
+
+bool ShardedReceiver::Start()
+{
+   if( _receivers.empty() || _running.load() )
+   {
+      return false;
+   }
+
+   _running.store( true );
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      _workers[w]->thread = std::thread( &ShardedReceiver::WorkLoop , this , w );
+   }
+   for(unsigned int r=0; r<_receivers.size(); ++r)
+   {
+      _receivers[r]->thread = std::thread( &ShardedReceiver::ReceiveLoop , this , r );
+   }
+
+   return true;
+}
+
+void ShardedReceiver::Stop()
+{
+   if( !_running.exchange( false ) )
+   {
+      return;
+   }
+
+   // the receive threads go first, so that the workers can drain everything already queued.
+   for(unsigned int r=0; r<_receivers.size(); ++r)
+   {
+      _receivers[r]->transport.Interrupt();
+   }
+   for(unsigned int r=0; r<_receivers.size(); ++r)
+   {
+      if( _receivers[r]->thread.joinable() )
+      {
+         _receivers[r]->thread.join();
+      }
+   }
+
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      Wake( *_workers[w] );
+   }
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      if( _workers[w]->thread.joinable() )
+      {
+         _workers[w]->thread.join();
+      }
+   }
+}
+
+void ShardedReceiver::ReceiveLoop(unsigned int index)
+{
+   Receiver& receiver = *_receivers[index];
+   while( _running.load( std::memory_order_relaxed ) )
+   {
+      if( receiver.transport.Receive( receiver , RECEIVE_TIMEOUT_MS ) < 0 )
+      {
+         _error = receiver.transport.GetLastError();
+         break;
+      }
+   }
+}
+
+void ShardedReceiver::WorkLoop(unsigned int index)
+{
+   Worker& worker = *_workers[index];
+   unsigned int spins = 0;
+
+   while( true )
+   {
+      if( DrainRings( worker ) )
+      {
+         spins = 0;
+         continue;
+      }
+
+      if( !_running.load() )
+      {
+         // the receive threads have stopped, so one more empty pass means everything was processed.
+         if( !DrainRings( worker ) )
+         {
+            break;
+         }
+         continue;
+      }
+
+      if( ++spins < WORKER_SPINS )
+      {
+         std::this_thread::yield();
+         continue;
+      }
+      spins = 0;
+
+      // announce the sleep before the final check, the receive threads look at the flag after publishing.
+      std::unique_lock<std::mutex> lock( worker.mutex );
+      worker.sleeping.store( true );
+      bool pending = false;
+      for(unsigned int r=0; r<worker.rings.size(); ++r)
+      {
+         pending = pending || !worker.rings[r]->Empty();
+      }
+      if( !pending && _running.load() )
+      {
+         worker.wakeup.wait_for( lock , std::chrono::milliseconds( WORKER_SLEEP_MS ) );
+      }
+      worker.sleeping.store( false );
+   }
+}
+
+bool ShardedReceiver::DrainRings(Worker& worker)
+{
+   bool processed = false;
+   for(unsigned int r=0; r<worker.rings.size(); ++r)
+   {
+      Ring& ring = *worker.rings[r];
+      for(unsigned int count=0; count<WORKER_BATCH; ++count)
+      {
+         Slot* slot = ring.Front();
+         if( slot == NULL )
+         {
+            break;
+         }
+
+         // a malformed PDU must not take down the worker.
+         try
+         {
+            worker.incoming.Process( &slot->data[0] , slot->length , BIG , slot->context );
+         }
+         catch( const std::exception& )
+         {
+         }
+
+         ring.Pop();
+         processed = true;
+      }
+   }
+   return processed;
+}
+
+void ShardedReceiver::Wake(Worker& worker)
+{
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   if( worker.sleeping.load() )
+   {
+      std::lock_guard<std::mutex> lock( worker.mutex );
+      worker.wakeup.notify_one();
+   }
+}
+
+bool ShardedReceiver::AddProcessor(unsigned char id, IPacketProcessor* pp)
+{
+   bool added = true;
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      added = _workers[w]->incoming.AddProcessor( id , pp ) && added;
+   }
+   return( added && !_workers.empty() );
+}
+
+bool ShardedReceiver::RemoveProcessor(unsigned char id, const IPacketProcessor* pp)
+{
+   bool removed = true;
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      removed = _workers[w]->incoming.RemoveProcessor( id , pp ) && removed;
+   }
+   return( removed && !_workers.empty() );
+}
+
+IncomingMessage& ShardedReceiver::GetIncomingMessage(unsigned int worker)
+{
+   return _workers[worker]->incoming;
+}
+
+unsigned int ShardedReceiver::GetWorkerCount() const
+{
+   return static_cast<unsigned int>( _workers.size() );
+}
+
+unsigned int ShardedReceiver::GetReceiveThreadCount() const
+{
+   return static_cast<unsigned int>( _receivers.size() );
+}
+
+unsigned int ShardedReceiver::GetWorkerForEntity(unsigned long long entityKey) const
+{
+   return static_cast<unsigned int>( PduHeader::HashEntityKey( entityKey ) % _workers.size() );
+}
+
+unsigned short ShardedReceiver::GetLocalPort() const
+{
+   return( _receivers.empty() ? 0 : _receivers[0]->transport.GetLocalPort() );
+}
+
+unsigned long long ShardedReceiver::GetDroppedCount() const
+{
+   return _dropped.load();
+}
+
+unsigned long long ShardedReceiver::GetQueuedCount() const
+{
+   return _queued.load();
+}
+
+UdpTransportStatistics ShardedReceiver::GetTransportStatistics() const
+{
+   UdpTransportStatistics total;
+   for(unsigned int r=0; r<_receivers.size(); ++r)
+   {
+      const UdpTransportStatistics statistics = _receivers[r]->transport.GetStatistics();
+      total.datagrams += statistics.datagrams;
+      total.bytes += statistics.bytes;
+      total.truncated += statistics.truncated;
+      total.kernelDrops += statistics.kernelDrops;
+      total.receiveBufferSize += statistics.receiveBufferSize;
+      total.sources.insert( total.sources.end() , statistics.sources.begin() , statistics.sources.end() );
+   }
+   return total;
+}
+
+int ShardedReceiver::GetLastError() const
+{
+   return _error.load();
+}
+
+#endif  // __linux__
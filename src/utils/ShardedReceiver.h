@@ -0,0 +1,163 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_sharded_receiver_h_
+#define _dcl_dis_sharded_receiver_h_
+
+#if defined(__linux__)
+
+#include <utils/UdpTransport.h>       // for member
+#include <utils/IncomingMessage.h>    // for member
+#include <utils/ReceiveContext.h>     // for member
+#include <utils/SpscRing.h>           // for member
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <vector>                   // for member
+#include <atomic>                   // for member
+#include <thread>                   // for member
+#include <mutex>                    // for member
+#include <condition_variable>       // for member
+
+namespace DIS
+{
+   class IPacketProcessor;
+
+   /// the parameters used to open a ShardedReceiver.
+   struct EXPORT_MACRO ShardedReceiverSettings
+   {
+      ShardedReceiverSettings();
+
+      /// the socket parameters shared by every receive thread.
+      UdpTransportSettings transport;
+
+      /// the number of SO_REUSEPORT sockets, each read by its own thread.
+      /// 0 uses one per core.  multicast groups always use 1, because the kernel
+      /// copies every multicast datagram to each socket of the group.
+      unsigned int receiveThreads;
+
+      /// the number of threads decoding and processing PDUs.  0 uses one per core.
+      unsigned int workerThreads;
+
+      /// the number of PDU slots between each receive thread and each worker.
+      unsigned int ringCapacity;
+
+      /// the largest PDU, in bytes, that fits a ring slot.  larger PDUs are dropped.
+      unsigned int slotSize;
+   };
+
+   /// a multi-core receive front end.
+   /// several receive threads each read their own SO_REUSEPORT socket, split the datagrams
+   /// into PDUs and hand each PDU to a worker thread chosen by the hash of its entity ID,
+   /// through a lock-free single producer, single consumer ring per thread pair.
+   /// each worker decodes with its own IncomingMessage, so that all updates for an entity
+   /// are processed in order by the same thread.
+   /// the receive threads never wait for the workers: when a ring is full the PDU is dropped and counted.
+   /// this class is only available on Linux.
+   class EXPORT_MACRO ShardedReceiver
+   {
+   public:
+      ShardedReceiver();
+      ~ShardedReceiver();
+
+      /// create the sockets, rings and each worker's IncomingMessage.
+      /// @return 'false' if a socket could not be opened.  GetLastError() has the errno value.
+      bool Open(const ShardedReceiverSettings& settings);
+
+      /// stop the threads and release the sockets.
+      void Close();
+
+      /// launch the receive and worker threads.
+      /// processors should be registered before starting.
+      bool Start();
+
+      /// ask the threads to finish, and wait for them.  PDUs already queued are processed first.
+      void Stop();
+
+      /// registers the processor with every worker.  the processor will be called
+      /// concurrently by the workers, for different entities.
+      /// @return 'false' if the pair was already registered.
+      bool AddProcessor(unsigned char id, IPacketProcessor* pp);
+
+      /// unregisters the processor from every worker.
+      bool RemoveProcessor(unsigned char id, const IPacketProcessor* pp);
+
+      /// @return the IncomingMessage of a worker, to register processors for that worker alone.
+      IncomingMessage& GetIncomingMessage(unsigned int worker);
+
+      unsigned int GetWorkerCount() const;
+      unsigned int GetReceiveThreadCount() const;
+
+      /// @return the worker that processes the PDUs of an entity, as packed by PduHeader::GetEntityKey.
+      unsigned int GetWorkerForEntity(unsigned long long entityKey) const;
+
+      /// @return the port the sockets are bound to.
+      unsigned short GetLocalPort() const;
+
+      /// @return the number of PDUs dropped because a worker's ring was full or the PDU was too large.
+      unsigned long long GetDroppedCount() const;
+
+      /// @return the number of PDUs handed to the workers.
+      unsigned long long GetQueuedCount() const;
+
+      /// @return the counters of the sockets summed, including their receive buffer sizes,
+      /// with the senders heard by each socket.
+      UdpTransportStatistics GetTransportStatistics() const;
+
+      int GetLastError() const;
+
+   private:
+      ShardedReceiver(const ShardedReceiver&);              ///< not implemented by design
+      ShardedReceiver& operator=(const ShardedReceiver&);   ///< not implemented by design
+
+      /// one PDU in transit from a receive thread to a worker.
+      struct Slot
+      {
+         ReceiveContext context;
+         unsigned int length;
+         std::vector<char> data;
+      };
+      typedef SpscRing<Slot> Ring;
+
+      /// the state owned by one worker thread.
+      struct Worker
+      {
+         Worker();
+
+         IncomingMessage incoming;
+
+         /// one ring per receive thread.
+         std::vector<Ring*> rings;
+
+         /// set while the worker waits for PDUs.
+         std::atomic<bool> sleeping;
+         std::mutex mutex;
+         std::condition_variable wakeup;
+         std::thread thread;
+      };
+
+      /// the state owned by one receive thread.
+      class Receiver;
+
+      void ReceiveLoop(unsigned int index);
+      void WorkLoop(unsigned int index);
+
+      /// @return 'true' if any PDU was processed.
+      bool DrainRings(Worker& worker);
+
+      void Wake(Worker& worker);
+
+      ShardedReceiverSettings _settings;
+      std::vector<Receiver*> _receivers;
+      std::vector<Worker*> _workers;
+      std::atomic<bool> _running;
+      std::atomic<unsigned long long> _dropped;
+      std::atomic<unsigned long long> _queued;
+
+      /// written by the receiving threads, and read by any thread.
+      std::atomic<int> _error;
+   };
+}
+
+#endif  // __linux__
+
+#endif  // _dcl_dis_sharded_receiver_h_
@@ -0,0 +1,133 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_spsc_ring_h_
+#define _dcl_dis_spsc_ring_h_
+
+#include <utils/CacheAligned.h>       // for base class
+
+#include <vector>                   // for member
+#include <atomic>                   // for member
+#include <cstddef>                  // for size_t definition
+
+namespace DIS
+{
+   /// a bounded, lock-free queue for exactly one producer thread and one consumer thread.
+   /// the slots are allocated once and reused, so elements holding buffers can be
+   /// filled in place with Reserve()/Publish() and read in place with Front()/Pop().
+   /// the producer and consumer indices are kept on separate cache lines, also when the ring is made with new.
+   template<typename T>
+   class SpscRing : public CacheAligned
+   {
+   public:
+      /// @param capacity the minimum number of slots, rounded up to a power of 2.
+      /// @param prototype the value every slot is initialized with.
+      explicit SpscRing(size_t capacity, const T& prototype=T())
+         : _slots()
+         , _mask(0)
+         , _head(0)
+         , _cachedTail(0)
+         , _tail(0)
+         , _cachedHead(0)
+      {
+         size_t size = 2;
+         while( size < capacity )
+         {
+            size <<= 1;
+         }
+         _slots.assign( size , prototype );
+         _mask = size - 1;
+      }
+
+      /// producer side.  get the next free slot to fill.
+      /// @return NULL when the ring is full.
+      T* Reserve()
+      {
+         const size_t tail = _tail.load( std::memory_order_relaxed );
+         if( tail - _cachedHead > _mask )
+         {
+            _cachedHead = _head.load( std::memory_order_acquire );
+            if( tail - _cachedHead > _mask )
+            {
+               return NULL;
+            }
+         }
+         return &_slots[tail & _mask];
+      }
+
+      /// producer side.  make the slot returned by Reserve() visible to the consumer.
+      void Publish()
+      {
+         _tail.store( _tail.load( std::memory_order_relaxed ) + 1 , std::memory_order_release );
+      }
+
+      /// producer side.  copy the value into the ring.
+      /// @return 'false' when the ring is full.
+      bool Push(const T& value)
+      {
+         T* slot = Reserve();
+         if( slot == NULL )
+         {
+            return false;
+         }
+         *slot = value;
+         Publish();
+         return true;
+      }
+
+      /// consumer side.  get the oldest published slot.
+      /// @return NULL when the ring is empty.
+      T* Front()
+      {
+         const size_t head = _head.load( std::memory_order_relaxed );
+         if( head == _cachedTail )
+         {
+            _cachedTail = _tail.load( std::memory_order_acquire );
+            if( head == _cachedTail )
+            {
+               return NULL;
+            }
+         }
+         return &_slots[head & _mask];
+      }
+
+      /// consumer side.  release the slot returned by Front() back to the producer.
+      void Pop()
+      {
+         _head.store( _head.load( std::memory_order_relaxed ) + 1 , std::memory_order_release );
+      }
+
+      /// an estimate of the number of published elements, exact when called by either side while the other is idle.
+      size_t Size() const
+      {
+         return _tail.load( std::memory_order_acquire ) - _head.load( std::memory_order_acquire );
+      }
+
+      bool Empty() const
+      {
+         return( Size() == 0 );
+      }
+
+      size_t Capacity() const
+      {
+         return _slots.size();
+      }
+
+   private:
+      SpscRing(const SpscRing&);              ///< not implemented by design
+      SpscRing& operator=(const SpscRing&);   ///< not implemented by design
+
+      std::vector<T> _slots;
+      size_t _mask;
+
+      /// written by the consumer, along with its view of the producer index.
+      alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head;
+      size_t _cachedTail;
+
+      /// written by the producer, along with its view of the consumer index.
+      alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail;
+      size_t _cachedHead;
+   };
+}
+
+#endif  // _dcl_dis_spsc_ring_h_
@@ -0,0 +1,96 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_tracepoints_h_
+#define _dcl_dis_tracepoints_h_
+
+/// static user-space tracepoints (USDT) of the "opendis" provider, in the format of SystemTap's
+/// sys/sdt.h, without depending on it.  each tracepoint is a single nop, described by a note
+/// of the .note.stapsdt section giving its name and where to find its arguments.
+/// perf, bpftrace and SystemTap attach to them in a running process, for example:
+///
+///    bpftrace -e 'usdt:./libOpenDIS6.so:opendis:unmarshal_end { @[arg0] = hist(arg3); }'
+///
+/// the arguments of a tracepoint are only evaluated when a tool is attached to it, which the tool
+/// signals by incrementing the tracepoint's semaphore.  the translation unit firing a tracepoint
+/// defines its semaphore once, at namespace scope, with DIS_TRACEPOINT_SEMAPHORE(name).
+///
+/// the tracepoints are available with GCC and Clang on Linux for x86-64 and AArch64,
+/// unless DIS_NO_TRACEPOINTS is defined.  otherwise the macros expand to nothing.
+#if defined(__linux__) && defined(__GNUC__) && ( defined(__x86_64__) || defined(__aarch64__) ) && !defined(DIS_NO_TRACEPOINTS)
+#define DIS_TRACEPOINTS
+#endif
+
+#if defined(DIS_TRACEPOINTS)
+
+/// the constraint of the arguments: a constant, memory or a register, as sys/sdt.h allows on x86-64.
+#if defined(__x86_64__)
+#define DIS_TRACEPOINT_CONSTRAINT "nor"
+#else
+#define DIS_TRACEPOINT_CONSTRAINT "r"
+#endif
+
+#define DIS_TRACEPOINT_SEMAPHORE(name) \
+   extern "C" { volatile unsigned short opendis_##name##_semaphore __attribute__((section(".probes"))) = 0; }
+
+/// @return 'true' when a tool is attached to the tracepoint.
+#define DIS_TRACEPOINT_ENABLED(name) \
+   __builtin_expect( opendis_##name##_semaphore != 0 , 0 )
+
+/// the nop, and its note.  every argument is passed as an unsigned 64 bit value.
+#define DIS_TRACEPOINT_ASM(name, args) \
+   "990: nop\n" \
+   ".pushsection .note.stapsdt,\"?\",\"note\"\n" \
+   ".balign 4\n" \
+   ".4byte 992f-991f, 994f-993f, 3\n" \
+   "991: .asciz \"stapsdt\"\n" \
+   "992: .balign 4\n" \
+   "993: .8byte 990b\n" \
+   ".8byte _.stapsdt.base\n" \
+   ".8byte opendis_" #name "_semaphore\n" \
+   ".asciz \"opendis\"\n" \
+   ".asciz \"" #name "\"\n" \
+   ".asciz \"" args "\"\n" \
+   "994: .balign 4\n" \
+   ".popsection\n" \
+   ".ifndef _.stapsdt.base\n" \
+   ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n" \
+   ".weak _.stapsdt.base\n" \
+   ".hidden _.stapsdt.base\n" \
+   "_.stapsdt.base: .space 1\n" \
+   ".size _.stapsdt.base, 1\n" \
+   ".popsection\n" \
+   ".endif\n"
+
+#define DIS_TRACEPOINT_ARG(a) DIS_TRACEPOINT_CONSTRAINT( static_cast<unsigned long long>( a ) )
+
+#define DIS_TRACEPOINT3(name, a1, a2, a3) \
+   do \
+   { \
+      if( DIS_TRACEPOINT_ENABLED(name) ) \
+      { \
+         __asm__ __volatile__ ( DIS_TRACEPOINT_ASM( name , "8@%0 8@%1 8@%2" ) \
+            : : DIS_TRACEPOINT_ARG( a1 ) , DIS_TRACEPOINT_ARG( a2 ) , DIS_TRACEPOINT_ARG( a3 ) ); \
+      } \
+   } while( 0 )
+
+#define DIS_TRACEPOINT4(name, a1, a2, a3, a4) \
+   do \
+   { \
+      if( DIS_TRACEPOINT_ENABLED(name) ) \
+      { \
+         __asm__ __volatile__ ( DIS_TRACEPOINT_ASM( name , "8@%0 8@%1 8@%2 8@%3" ) \
+            : : DIS_TRACEPOINT_ARG( a1 ) , DIS_TRACEPOINT_ARG( a2 ) , DIS_TRACEPOINT_ARG( a3 ) , DIS_TRACEPOINT_ARG( a4 ) ); \
+      } \
+   } while( 0 )
+
+#else
+
+#define DIS_TRACEPOINT_SEMAPHORE(name)
+#define DIS_TRACEPOINT_ENABLED(name) false
+#define DIS_TRACEPOINT3(name, a1, a2, a3) do {} while( 0 )
+#define DIS_TRACEPOINT4(name, a1, a2, a3, a4) do {} while( 0 )
+
+#endif  // DIS_TRACEPOINTS
+
+#endif  // _dcl_dis_tracepoints_h_
@@ -0,0 +1,752 @@
+#include <utils/TrafficGenerator.h>
+#include <utils/IBufferProcessor.h>
+#include <utils/DataStream.h>
+#include <utils/PduHeader.h>
+#include <utils/PDUType.h>
+#include <utils/Profiler.h>
+#include <dis6/EntityStatePdu.h>
+#include <dis6/FirePdu.h>
+#include <dis6/DetonationPdu.h>
+#include <dis6/TransmitterPdu.h>
+#include <dis6/SignalPdu.h>
+#include <dis6/ElectromagneticEmissionsPdu.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+using namespace DIS;
+
+namespace
+{
+   const double PI = 3.14159265358979323846;
+
+   /// the voice of a transmitting radio is sent in frames of 20 ms, of 8 bit samples at 8 kHz.
+   const double VOICE_FRAME_SECONDS = 0.02;
+   const unsigned int VOICE_FRAME_SAMPLES = 160;
+
+   /// the average length of a radio transmission, in seconds.
+   const double TALK_SECONDS = 5.0;
+
+   /// the WGS 84 ellipsoid.
+   const double EARTH_SEMI_MAJOR_AXIS = 6378137.0;
+   const double EARTH_ECCENTRICITY_SQUARED = 6.69437999014e-3;
+
+   /// a small and fast generator of random numbers, good enough to vary the entities.
+   unsigned int NextRandom(unsigned int& state)
+   {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state;
+   }
+
+   /// @return a random number from 0 up to 1.
+   double Uniform(unsigned int& state)
+   {
+      return ( NextRandom( state ) >> 8 ) * ( 1.0 / 16777216.0 );
+   }
+
+   /// @return a random number from low up to high.
+   double Uniform(unsigned int& state, double low, double high)
+   {
+      return low + ( high - low ) * Uniform( state );
+   }
+
+   /// @return the random time to the next of events occurring at the rate, in seconds.
+   double Exponential(unsigned int& state, double rate)
+   {
+      return -std::log( 1.0 - Uniform( state ) ) / rate;
+   }
+
+   /// @return the time after which a periodic event of the rate never occurs.
+   double Never()
+   {
+      return 1e300;
+   }
+}
+
+namespace DIS
+{
+   /// the state of one simulated entity.  the positions are in meters east, north and up
+   /// of the center of the exercise area.
+   struct TrafficGenerator::Entity
+   {
+      EntityID id;
+      MotionModel motion;
+      unsigned int random;
+      unsigned char forceId;
+
+      double position[3];
+      double velocity[3];
+      double heading;
+      double speed;
+
+      /// the center, radius, angle and angular velocity of the circle of MOTION_CIRCLE.
+      double center[2];
+      double radius;
+      double angle;
+      double angularVelocity;
+
+      /// the times the next PDUs are sent, in seconds since the first tick.
+      double nextUpdate;
+      double nextFire;
+      double nextDetonation;
+      double nextTalkChange;
+      double nextTransmitter;
+      double nextSignal;
+      double nextEmission;
+
+      /// the point the last fired munition detonates at.
+      double target[3];
+      unsigned short eventNumber;
+
+      bool radio;
+      bool transmitting;
+      bool emitter;
+   };
+
+   /// a PDU marshalled by a worker, and the time it is sent, in seconds since the first tick.
+   struct TrafficDatagram
+   {
+      unsigned int offset;
+      unsigned int length;
+      double time;
+
+      bool operator <(const TrafficDatagram& other) const
+      {
+         return time < other.time;
+      }
+   };
+
+   /// a generator thread, with its share of the entities and the PDUs it reuses for every tick.
+   struct TrafficGenerator::Worker
+   {
+      Worker()
+         : entities()
+         , stream(BIG)
+         , datagrams()
+         , statistics()
+         , entityState()
+         , fire()
+         , detonation()
+         , transmitter()
+         , signal()
+         , emission()
+      {
+      }
+
+      std::vector<Entity> entities;
+
+      /// the PDUs of the tick, marshalled one after the other.
+      DataStream stream;
+      std::vector<TrafficDatagram> datagrams;
+      TrafficStatistics statistics;
+
+      EntityStatePdu entityState;
+      FirePdu fire;
+      DetonationPdu detonation;
+      TransmitterPdu transmitter;
+      SignalPdu signal;
+      ElectromagneticEmissionsPdu emission;
+   };
+}
+
+TrafficGeneratorSettings::TrafficGeneratorSettings()
+   : entities(1000)
+   , threads(0)
+   , seed(1)
+   , motion(MOTION_MIXED)
+   , exerciseID(1)
+   , site(1)
+   , application(1)
+   , latitude(36.0)
+   , longitude(-117.0)
+   , areaRadius(50000.0)
+   , tickMs(20)
+   , updateRate(1.0)
+   , heartbeatRate(0.2)
+   , fireRate(0.001)
+   , radioFraction(0.05)
+   , talkFraction(0.02)
+   , transmitterRate(0.5)
+   , emitterFraction(0.05)
+   , emissionRate(0.2)
+   , startTime(0)
+{
+}
+
+TrafficStatistics::TrafficStatistics()
+   : entityStates(0)
+   , fires(0)
+   , detonations(0)
+   , transmitters(0)
+   , signals(0)
+   , emissions(0)
+   , bytes(0)
+{
+}
+
+TrafficGenerator::TrafficGenerator()
+   : _settings()
+   , _workers()
+   , _threads()
+   , _mutex()
+   , _wakeup()
+   , _done()
+   , _tick(0)
+   , _generation(0)
+   , _finished(0)
+   , _running(false)
+   , _statistics()
+{
+}
+
+TrafficGenerator::~TrafficGenerator()
+{
+   Stop();
+}
+
+bool TrafficGenerator::Start(const TrafficGeneratorSettings& settings)
+{
+   if( _running || settings.entities == 0 || settings.tickMs == 0 || settings.areaRadius <= 0 )
+   {
+      return false;
+   }
+
+   _settings = settings;
+   if( _settings.startTime == 0 )
+   {
+      _settings.startTime = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::system_clock::now().time_since_epoch() ).count();
+   }
+   if( _settings.threads == 0 )
+   {
+      _settings.threads = std::thread::hardware_concurrency();
+   }
+   _settings.threads = std::max( 1u , std::min( _settings.threads , _settings.entities ) );
+
+   _tick = 0;
+   _generation = 0;
+   _finished = 0;
+   _statistics = TrafficStatistics();
+
+   // the local east, north and up directions of the center of the area.
+   const double latitude = _settings.latitude * PI / 180.0;
+   const double longitude = _settings.longitude * PI / 180.0;
+   const double normal = EARTH_SEMI_MAJOR_AXIS / std::sqrt( 1.0 - EARTH_ECCENTRICITY_SQUARED * std::sin( latitude ) * std::sin( latitude ) );
+   _origin[0] = normal * std::cos( latitude ) * std::cos( longitude );
+   _origin[1] = normal * std::cos( latitude ) * std::sin( longitude );
+   _origin[2] = normal * ( 1.0 - EARTH_ECCENTRICITY_SQUARED ) * std::sin( latitude );
+   _east[0] = -std::sin( longitude );
+   _east[1] = std::cos( longitude );
+   _east[2] = 0.0;
+   _north[0] = -std::sin( latitude ) * std::cos( longitude );
+   _north[1] = -std::sin( latitude ) * std::sin( longitude );
+   _north[2] = std::cos( latitude );
+   _up[0] = std::cos( latitude ) * std::cos( longitude );
+   _up[1] = std::cos( latitude ) * std::sin( longitude );
+   _up[2] = std::sin( latitude );
+
+   for(unsigned int w=0; w<_settings.threads; ++w)
+   {
+      Worker* worker = new Worker();
+      _workers.push_back( worker );
+
+      // the PDUs are filled once, and only their changing fields are set for each PDU sent.
+      EntityStatePdu& entityState = worker->entityState;
+      entityState.setExerciseID( _settings.exerciseID );
+      entityState.getEntityType().setEntityKind( 1 );
+      entityState.getEntityType().setCountry( 225 );
+      entityState.getEntityType().setCategory( 1 );
+      entityState.setLength( static_cast<unsigned short>( entityState.getMarshalledSize() ) );
+
+      FirePdu& fire = worker->fire;
+      fire.setExerciseID( _settings.exerciseID );
+      fire.getBurstDescriptor().getMunition().setEntityKind( 2 );
+      fire.getBurstDescriptor().getMunition().setDomain( 1 );
+      fire.getBurstDescriptor().getMunition().setCountry( 225 );
+      fire.getBurstDescriptor().getMunition().setCategory( 2 );
+      fire.getBurstDescriptor().setWarhead( 1000 );
+      fire.getBurstDescriptor().setFuse( 1000 );
+      fire.getBurstDescriptor().setQuantity( 1 );
+      fire.setLength( static_cast<unsigned short>( fire.getMarshalledSize() ) );
+
+      DetonationPdu& detonation = worker->detonation;
+      detonation.setExerciseID( _settings.exerciseID );
+      detonation.setBurstDescriptor( fire.getBurstDescriptor() );
+      detonation.setDetonationResult( 5 );
+      detonation.setLength( static_cast<unsigned short>( detonation.getMarshalledSize() ) );
+
+      TransmitterPdu& transmitter = worker->transmitter;
+      transmitter.setExerciseID( _settings.exerciseID );
+      transmitter.setRadioId( 1 );
+      transmitter.getRadioEntityType().setEntityKind( 7 );
+      transmitter.getRadioEntityType().setCountry( 225 );
+      transmitter.setInputSource( 1 );
+      transmitter.setFrequency( 30000000ULL );
+      transmitter.setTransmitFrequencyBandwidth( 25000.0f );
+      transmitter.setPower( 40.0f );
+      transmitter.getModulationType().setMajor( 2 );
+      transmitter.getModulationType().setSystem( 1 );
+      transmitter.setLength( static_cast<unsigned short>( transmitter.getMarshalledSize() ) );
+
+      SignalPdu& signal = worker->signal;
+      signal.setExerciseID( _settings.exerciseID );
+      signal.setRadioId( 1 );
+      signal.setEncodingScheme( 1 );
+      signal.setSampleRate( 8000 );
+      signal.setSamples( VOICE_FRAME_SAMPLES );
+      signal.getData().resize( VOICE_FRAME_SAMPLES );
+      signal.setLength( static_cast<unsigned short>( signal.getMarshalledSize() ) );
+
+      ElectromagneticEmissionsPdu& emission = worker->emission;
+      emission.setExerciseID( _settings.exerciseID );
+      emission.getSystems().resize( 1 );
+      ElectromagneticEmissionSystemData& system = emission.getSystems()[0];
+      system.getEmitterSystem().setEmitterName( 1000 );
+      system.getEmitterSystem().setFunction( 1 );
+      system.getEmitterSystem().setEmitterIdNumber( 1 );
+      system.getBeamDataRecords().resize( 1 );
+      ElectromagneticEmissionBeamData& beam = system.getBeamDataRecords()[0];
+      beam.setBeamIDNumber( 1 );
+      beam.setBeamFunction( 2 );
+      beam.getFundamentalParameterData().setFrequency( 9.4e9f );
+      beam.getFundamentalParameterData().setEffectiveRadiatedPower( 70.0f );
+      beam.getFundamentalParameterData().setPulseRepetitionFrequency( 1000.0f );
+      beam.getFundamentalParameterData().setPulseWidth( 1.0f );
+      beam.getFundamentalParameterData().setBeamAzimuthSweep( static_cast<float>( PI ) );
+      beam.getFundamentalParameterData().setBeamElevationSweep( 0.1f );
+
+      // the lengths are counted in 32 bit words.
+      beam.setBeamDataLength( static_cast<unsigned char>( beam.getMarshalledSize() / 4 ) );
+      system.setSystemDataLength( static_cast<unsigned char>( system.getMarshalledSize() / 4 ) );
+      emission.setLength( static_cast<unsigned short>( emission.getMarshalledSize() ) );
+   }
+
+   // the entities are spread in blocks over the workers, and each is given its own
+   // random numbers, so that what it does does not depend on the number of workers.
+   for(unsigned int i=0; i<_settings.entities; ++i)
+   {
+      Worker& worker = *_workers[ static_cast<unsigned long long>( i ) * _settings.threads / _settings.entities ];
+      worker.entities.push_back( Entity() );
+      Entity& entity = worker.entities.back();
+
+      entity.id.setSite( _settings.site );
+      entity.id.setApplication( static_cast<unsigned short>( _settings.application + i / 65535 ) );
+      entity.id.setEntity( static_cast<unsigned short>( i % 65535 + 1 ) );
+      entity.random = static_cast<unsigned int>( PduHeader::HashEntityKey( ( static_cast<unsigned long long>( _settings.seed ) << 32 ) | i ) ) | 1u;
+      entity.motion = ( _settings.motion == MOTION_MIXED ) ? static_cast<MotionModel>( i % MOTION_MIXED ) : _settings.motion;
+      entity.forceId = static_cast<unsigned char>( 1 + i % 2 );
+
+      // a random point within the area, the ground for vehicles and a few hundred meters up for the helicopters.
+      const double distance = _settings.areaRadius * std::sqrt( Uniform( entity.random ) );
+      const double bearing = Uniform( entity.random , 0 , 2 * PI );
+      entity.position[0] = distance * std::sin( bearing );
+      entity.position[1] = distance * std::cos( bearing );
+      entity.position[2] = ( entity.motion == MOTION_CIRCLE ) ? Uniform( entity.random , 100 , 500 ) : 0.0;
+      entity.velocity[0] = 0.0;
+      entity.velocity[1] = 0.0;
+      entity.velocity[2] = 0.0;
+      entity.heading = Uniform( entity.random , 0 , 2 * PI );
+      entity.speed = ( entity.motion == MOTION_STATIC ) ? 0.0 : Uniform( entity.random , 2 , 20 );
+
+      entity.radius = Uniform( entity.random , 200 , 2000 );
+      entity.angle = Uniform( entity.random , 0 , 2 * PI );
+      entity.angularVelocity = Uniform( entity.random , 20 , 60 ) / entity.radius;
+      entity.center[0] = entity.position[0] - entity.radius * std::cos( entity.angle );
+      entity.center[1] = entity.position[1] - entity.radius * std::sin( entity.angle );
+
+      // the periodic PDUs start at a random phase, so that they are spread over time.
+      const double updateRate = ( entity.motion == MOTION_STATIC ) ? _settings.heartbeatRate : _settings.updateRate;
+      entity.nextUpdate = ( updateRate > 0 ) ? Uniform( entity.random ) / updateRate : Never();
+      entity.nextFire = ( _settings.fireRate > 0 ) ? Exponential( entity.random , _settings.fireRate ) : Never();
+      entity.nextDetonation = Never();
+      entity.target[0] = entity.target[1] = entity.target[2] = 0.0;
+      entity.eventNumber = 0;
+
+      entity.radio = Uniform( entity.random ) < _settings.radioFraction;
+      entity.transmitting = entity.radio && Uniform( entity.random ) < _settings.talkFraction;
+      entity.nextTalkChange = Never();
+      if( entity.radio && _settings.talkFraction > 0 && _settings.talkFraction < 1 )
+      {
+         const double silence = TALK_SECONDS * ( 1 - _settings.talkFraction ) / _settings.talkFraction;
+         entity.nextTalkChange = Exponential( entity.random , 1.0 / ( entity.transmitting ? TALK_SECONDS : silence ) );
+      }
+      entity.nextTransmitter = ( entity.radio && _settings.transmitterRate > 0 ) ? Uniform( entity.random ) / _settings.transmitterRate : Never();
+      entity.nextSignal = Uniform( entity.random ) * VOICE_FRAME_SECONDS;
+
+      entity.emitter = Uniform( entity.random ) < _settings.emitterFraction;
+      entity.nextEmission = ( entity.emitter && _settings.emissionRate > 0 ) ? Uniform( entity.random ) / _settings.emissionRate : Never();
+   }
+
+   for(unsigned int w=0; w<_workers.size(); ++w)
+   {
+      // enough for a tick of typical traffic, so that the buffers rarely grow.
+      const size_t expected = _workers[w]->entities.size() * _settings.tickMs / 100 + 64;
+      _workers[w]->datagrams.reserve( expected );
+   }
+
+   _running = true;
+
+   // a single worker runs on the thread calling Generate().
+   if( _workers.size() > 1 )
+   {
+      for(unsigned int w=0; w<_workers.size(); ++w)
+      {
+         _threads.push_back( std::thread( &TrafficGenerator::WorkLoop , this , w ) );
+      }
+   }
+   return true;
+}
+
+void TrafficGenerator::Stop()
+{
+   {
+      std::lock_guard<std::mutex> lock( _mutex );
+      _running = false;
+   }
+   _wakeup.notify_all();
+
+   for(unsigned int i=0; i<_threads.size(); ++i)
+   {
+      _threads[i].join();
+   }
+   _threads.clear();
+
+   for(unsigned int i=0; i<_workers.size(); ++i)
+   {
+      delete _workers[i];
+   }
+   _workers.clear();
+}
+
+bool TrafficGenerator::IsRunning() const
+{
+   return _running;
+}
+
+unsigned int TrafficGenerator::Generate(IBufferProcessor& processor, const ReceiveContext& context)
+{
+   if( !_running )
+   {
+      return 0;
+   }
+
+   if( _threads.empty() )
+   {
+      Simulate( *_workers[0] , _tick );
+   }
+   else
+   {
+      std::unique_lock<std::mutex> lock( _mutex );
+      _finished = 0;
+      ++_generation;
+      _wakeup.notify_all();
+      while( _finished < _workers.size() )
+      {
+         _done.wait( lock );
+      }
+   }
+   ++_tick;
+
+   // the workers' PDUs are merged by time.  PDUs sent at the same time keep the order of their entities.
+   std::vector<size_t> next( _workers.size() , 0 );
+   ReceiveContext datagramContext = context;
+   unsigned int count = 0;
+   while( true )
+   {
+      Worker* earliest = NULL;
+      size_t earliestIndex = 0;
+      for(size_t w=0; w<_workers.size(); ++w)
+      {
+         Worker* worker = _workers[w];
+         if( next[w] < worker->datagrams.size() &&
+             ( earliest == NULL || worker->datagrams[next[w]].time < earliest->datagrams[next[earliestIndex]].time ) )
+         {
+            earliest = worker;
+            earliestIndex = w;
+         }
+      }
+      if( earliest == NULL )
+      {
+         break;
+      }
+
+      const TrafficDatagram& datagram = earliest->datagrams[next[earliestIndex]++];
+      datagramContext.timestamp = _settings.startTime + static_cast<long long>( datagram.time * 1e9 );
+      datagramContext.datagramIndex = count++;
+      datagramContext.datagramLength = datagram.length;
+      processor.Process( &earliest->stream[datagram.offset] , datagram.length , BIG , datagramContext );
+   }
+
+   for(size_t w=0; w<_workers.size(); ++w)
+   {
+      const TrafficStatistics& statistics = _workers[w]->statistics;
+      _statistics.entityStates += statistics.entityStates;
+      _statistics.fires += statistics.fires;
+      _statistics.detonations += statistics.detonations;
+      _statistics.transmitters += statistics.transmitters;
+      _statistics.signals += statistics.signals;
+      _statistics.emissions += statistics.emissions;
+      _statistics.bytes += statistics.bytes;
+   }
+   return count;
+}
+
+long long TrafficGenerator::GetTime() const
+{
+   return _settings.startTime + static_cast<long long>( _tick ) * _settings.tickMs * 1000000LL;
+}
+
+TrafficStatistics TrafficGenerator::GetStatistics() const
+{
+   return _statistics;
+}
+
+unsigned int TrafficGenerator::GetThreadCount() const
+{
+   return static_cast<unsigned int>( _workers.size() );
+}
+
+void TrafficGenerator::WorkLoop(unsigned int index)
+{
+   unsigned long long generation = 0;
+   while( true )
+   {
+      unsigned long long tick = 0;
+      {
+         std::unique_lock<std::mutex> lock( _mutex );
+         while( _running && _generation == generation )
+         {
+            _wakeup.wait( lock );
+         }
+         if( !_running )
+         {
+            return;
+         }
+         generation = _generation;
+         tick = _tick;
+      }
+
+      Simulate( *_workers[index] , tick );
+
+      {
+         std::lock_guard<std::mutex> lock( _mutex );
+         ++_finished;
+      }
+      _done.notify_one();
+   }
+}
+
+void TrafficGenerator::Simulate(Worker& worker, unsigned long long tick)
+{
+   const double dt = _settings.tickMs / 1000.0;
+   const double begin = tick * dt;
+   const double end = begin + dt;
+
+   worker.stream.clear();
+   worker.datagrams.clear();
+   worker.statistics = TrafficStatistics();
+
+   for(size_t i=0; i<worker.entities.size(); ++i)
+   {
+      Entity& entity = worker.entities[i];
+
+      // move to the end of the tick.
+      switch( entity.motion )
+      {
+      case MOTION_CIRCLE:
+         entity.angle += entity.angularVelocity * dt;
+         entity.position[0] = entity.center[0] + entity.radius * std::cos( entity.angle );
+         entity.position[1] = entity.center[1] + entity.radius * std::sin( entity.angle );
+         entity.velocity[0] = -entity.angularVelocity * entity.radius * std::sin( entity.angle );
+         entity.velocity[1] = entity.angularVelocity * entity.radius * std::cos( entity.angle );
+         entity.heading = std::atan2( entity.velocity[0] , entity.velocity[1] );
+         break;
+
+      case MOTION_RANDOM_WALK:
+         // about one change of heading and speed every 10 seconds.
+         if( Uniform( entity.random ) < dt / 10.0 )
+         {
+            entity.heading += Uniform( entity.random , -PI / 2 , PI / 2 );
+            entity.speed = Uniform( entity.random , 1 , 10 );
+         }
+         // then move along the heading.
+         // fall through
+      case MOTION_LINEAR:
+         entity.velocity[0] = entity.speed * std::sin( entity.heading );
+         entity.velocity[1] = entity.speed * std::cos( entity.heading );
+         entity.position[0] += entity.velocity[0] * dt;
+         entity.position[1] += entity.velocity[1] * dt;
+
+         // turn back towards the center at the edge of the area.
+         if( entity.position[0] * entity.position[0] + entity.position[1] * entity.position[1] > _settings.areaRadius * _settings.areaRadius )
+         {
+            entity.heading = std::atan2( -entity.position[0] , -entity.position[1] );
+         }
+         break;
+
+      default:
+         break;
+      }
+
+      while( entity.nextUpdate < end )
+      {
+         EntityStatePdu& pdu = worker.entityState;
+         pdu.setEntityID( entity.id );
+         pdu.setForceId( entity.forceId );
+         pdu.getEntityType().setDomain( ( entity.motion == MOTION_CIRCLE ) ? 2 : 1 );
+         pdu.setEntityLocation( ToWorld( entity.position ) );
+
+         // the velocity is turned from local to geocentric axes.
+         Vector3Float& velocity = pdu.getEntityLinearVelocity();
+         velocity.setX( static_cast<float>( entity.velocity[0] * _east[0] + entity.velocity[1] * _north[0] ) );
+         velocity.setY( static_cast<float>( entity.velocity[0] * _east[1] + entity.velocity[1] * _north[1] ) );
+         velocity.setZ( static_cast<float>( entity.velocity[0] * _east[2] + entity.velocity[1] * _north[2] ) );
+         pdu.getEntityOrientation().setPsi( static_cast<float>( entity.heading ) );
+         pdu.getDeadReckoningParameters().setDeadReckoningAlgorithm( ( entity.motion == MOTION_STATIC ) ? 1 : 2 );
+
+         char marking[12];
+         snprintf( marking , sizeof(marking) , "E%u" , entity.id.getEntity() );
+         pdu.getMarking().setByStringCharacters( marking );
+
+         Emit( worker , pdu , entity.nextUpdate );
+         entity.nextUpdate += 1.0 / ( ( entity.motion == MOTION_STATIC ) ? _settings.heartbeatRate : _settings.updateRate );
+      }
+
+      // a munition is fired at a point a few kilometers away, and detonates there a few seconds later.
+      // an entity does not fire again before its munition has detonated.
+      while( entity.nextFire < end && entity.nextDetonation != Never() )
+      {
+         entity.nextFire += Exponential( entity.random , _settings.fireRate );
+      }
+      if( entity.nextFire < end )
+      {
+         const double range = Uniform( entity.random , 1000 , 5000 );
+         const double bearing = Uniform( entity.random , 0 , 2 * PI );
+         entity.target[0] = entity.position[0] + range * std::sin( bearing );
+         entity.target[1] = entity.position[1] + range * std::cos( bearing );
+         entity.target[2] = 0.0;
+         ++entity.eventNumber;
+
+         FirePdu& pdu = worker.fire;
+         pdu.setFiringEntityID( entity.id );
+         pdu.getEventID().setSite( entity.id.getSite() );
+         pdu.getEventID().setApplication( entity.id.getApplication() );
+         pdu.getEventID().setEventNumber( entity.eventNumber );
+         pdu.setLocationInWorldCoordinates( ToWorld( entity.position ) );
+         pdu.setRange( static_cast<float>( range ) );
+         Emit( worker , pdu , entity.nextFire );
+
+         entity.nextDetonation = entity.nextFire + range / 500.0;
+         entity.nextFire += Exponential( entity.random , _settings.fireRate );
+      }
+
+      if( entity.nextDetonation < end )
+      {
+         DetonationPdu& pdu = worker.detonation;
+         pdu.setFiringEntityID( entity.id );
+         pdu.getEventID().setSite( entity.id.getSite() );
+         pdu.getEventID().setApplication( entity.id.getApplication() );
+         pdu.getEventID().setEventNumber( entity.eventNumber );
+         pdu.setLocationInWorldCoordinates( ToWorld( entity.target ) );
+         Emit( worker , pdu , entity.nextDetonation );
+         entity.nextDetonation = Never();
+      }
+
+      if( entity.radio )
+      {
+         // every change of the transmit state is announced by a Transmitter PDU, as well as the heartbeats.
+         double announce = Never();
+         while( entity.nextTalkChange < end )
+         {
+            entity.transmitting = !entity.transmitting;
+            announce = std::min( announce , entity.nextTalkChange );
+            if( entity.transmitting )
+            {
+               entity.nextSignal = entity.nextTalkChange;
+            }
+
+            const double silence = TALK_SECONDS * ( 1 - _settings.talkFraction ) / _settings.talkFraction;
+            entity.nextTalkChange += Exponential( entity.random , 1.0 / ( entity.transmitting ? TALK_SECONDS : silence ) );
+         }
+         if( entity.nextTransmitter < end )
+         {
+            announce = std::min( announce , entity.nextTransmitter );
+            while( entity.nextTransmitter < end )
+            {
+               entity.nextTransmitter += 1.0 / _settings.transmitterRate;
+            }
+         }
+
+         if( announce != Never() )
+         {
+            TransmitterPdu& pdu = worker.transmitter;
+            pdu.setEntityId( entity.id );
+            pdu.setTransmitState( entity.transmitting ? 2 : 1 );
+            pdu.setAntennaLocation( ToWorld( entity.position ) );
+            Emit( worker , pdu , announce );
+         }
+
+         while( entity.transmitting && entity.nextSignal < end )
+         {
+            SignalPdu& pdu = worker.signal;
+            pdu.setEntityId( entity.id );
+            Emit( worker , pdu , entity.nextSignal );
+            entity.nextSignal += VOICE_FRAME_SECONDS;
+         }
+      }
+
+      while( entity.nextEmission < end )
+      {
+         ElectromagneticEmissionsPdu& pdu = worker.emission;
+         pdu.setEmittingEntityID( entity.id );
+         pdu.getEventID().setSite( entity.id.getSite() );
+         pdu.getEventID().setApplication( entity.id.getApplication() );
+         pdu.getEventID().setEventNumber( ++entity.eventNumber );
+         Emit( worker , pdu , entity.nextEmission );
+         entity.nextEmission += 1.0 / _settings.emissionRate;
+      }
+   }
+
+   // the PDUs of the tick are sent in time order.  the entities' order is kept for the same times.
+   std::stable_sort( worker.datagrams.begin() , worker.datagrams.end() );
+}
+
+void TrafficGenerator::Emit(Worker& worker, Pdu& pdu, double time)
+{
+   pdu.setTimestamp( PduHeader::MakeTimestamp( _settings.startTime + static_cast<long long>( time * 1e9 ) ) );
+
+   TrafficDatagram datagram;
+   datagram.offset = static_cast<unsigned int>( worker.stream.size() );
+   {
+      DIS_PROFILE_SCOPE( PROFILE_MARSHAL , pdu.getPduType() );
+      pdu.marshal( worker.stream );
+   }
+   datagram.length = static_cast<unsigned int>( worker.stream.size() ) - datagram.offset;
+   datagram.time = time;
+   worker.datagrams.push_back( datagram );
+
+   TrafficStatistics& statistics = worker.statistics;
+   switch( pdu.getPduType() )
+   {
+   case PDU_ENTITY_STATE:                  ++statistics.entityStates;  break;
+   case PDU_FIRE:                          ++statistics.fires;         break;
+   case PDU_DETONATION:                    ++statistics.detonations;   break;
+   case PDU_TRANSMITTER:                   ++statistics.transmitters;  break;
+   case PDU_SIGNAL:                        ++statistics.signals;       break;
+   case PDU_ELECTRONIC_EMMISIONS:          ++statistics.emissions;     break;
+   default:                                                            break;
+   }
+   statistics.bytes += datagram.length;
+}
+
+Vector3Double TrafficGenerator::ToWorld(const double local[3]) const
+{
+   Vector3Double world;
+   world.setX( _origin[0] + local[0] * _east[0] + local[1] * _north[0] + local[2] * _up[0] );
+   world.setY( _origin[1] + local[0] * _east[1] + local[1] * _north[1] + local[2] * _up[1] );
+   world.setZ( _origin[2] + local[0] * _east[2] + local[1] * _north[2] + local[2] * _up[2] );
+   return world;
+}
@@ -0,0 +1,188 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_traffic_generator_h_
+#define _dcl_dis_traffic_generator_h_
+
+#include <utils/ReceiveContext.h>     // for parameter
+#include <dis6/Vector3Double.h>       // for return value
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <vector>                   // for member
+#include <thread>                   // for member
+#include <mutex>                    // for member
+#include <condition_variable>       // for member
+
+namespace DIS
+{
+   class IBufferProcessor;
+   class Pdu;
+
+   /// how a simulated entity moves.
+   enum MotionModel
+   {
+      /// stays in place, sending only heartbeats.
+      MOTION_STATIC,
+
+      /// drives in a straight line at a constant speed, turning back at the edge of the area.
+      MOTION_LINEAR,
+
+      /// hovers in a circle around a point, as HeloFlightDynamics of the examples does.
+      MOTION_CIRCLE,
+
+      /// wanders, changing heading and speed at random.
+      MOTION_RANDOM_WALK,
+
+      /// a quarter of the entities of each of the models above.
+      MOTION_MIXED
+   };
+
+   /// the parameters of the simulated exercise.
+   /// the rates are per entity, and chosen to give the ratios of PDUs seen on a typical exercise network:
+   /// mostly Entity State PDUs, radio voice as the next largest share, and a few weapon and emission events.
+   struct EXPORT_MACRO TrafficGeneratorSettings
+   {
+      TrafficGeneratorSettings();
+
+      /// the number of simulated entities.  an application numbers up to 65535 entities,
+      /// the entities past those are numbered by the next applications.
+      unsigned int entities;
+
+      /// the number of threads generating the PDUs.  0 uses one per core.
+      unsigned int threads;
+
+      /// the seed of the random choices.  the same settings and seed generate the same PDUs,
+      /// whatever the number of threads.
+      unsigned int seed;
+
+      MotionModel motion;
+
+      unsigned char exerciseID;
+      unsigned short site;
+      unsigned short application;
+
+      /// the geodetic position of the center of the exercise area, in degrees, and its radius in meters.
+      double latitude;
+      double longitude;
+      double areaRadius;
+
+      /// the simulated time between two calls to Generate(), in milliseconds.
+      unsigned int tickMs;
+
+      /// the Entity State PDUs per second of a moving entity, and the heartbeats per second of a static one.
+      double updateRate;
+      double heartbeatRate;
+
+      /// the Fire PDUs per second of an entity.  each Fire PDU is followed by a Detonation PDU.
+      double fireRate;
+
+      /// the fraction of the entities with a radio, the fraction of the time a radio transmits,
+      /// and the Transmitter PDUs per second of a radio.  a transmitting radio sends a Signal PDU
+      /// holding 20 ms of 8 kHz voice every 20 ms.
+      double radioFraction;
+      double talkFraction;
+      double transmitterRate;
+
+      /// the fraction of the entities with an emitter, and the Electromagnetic Emission PDUs per second of an emitter.
+      double emitterFraction;
+      double emissionRate;
+
+      /// the time of the first tick, in nanoseconds since the epoch.  0 uses the time Start() is called.
+      long long startTime;
+   };
+
+   /// the number of PDUs of each kind generated, and the bytes they take.
+   struct EXPORT_MACRO TrafficStatistics
+   {
+      TrafficStatistics();
+
+      unsigned long long entityStates;
+      unsigned long long fires;
+      unsigned long long detonations;
+      unsigned long long transmitters;
+      unsigned long long signals;
+      unsigned long long emissions;
+      unsigned long long bytes;
+   };
+
+   /// simulates a number of entities, from tens to hundreds of thousands, and generates the PDUs
+   /// they would send, for load testing receivers repeatably.
+   /// each call to Generate() advances the simulation by one tick.  the entities are split among
+   /// the generator threads, which marshal their PDUs into buffers that are reused from tick to tick.
+   /// the PDUs are then handed to a processor, such as a PcapWriter, a RecordingWriter or a sender,
+   /// one PDU per datagram, in the same order whatever the number of threads.
+   class EXPORT_MACRO TrafficGenerator
+   {
+   public:
+      TrafficGenerator();
+
+      /// stops the threads.
+      ~TrafficGenerator();
+
+      /// create the entities and launch the threads.
+      /// @return 'false' if the generator is already running, or the settings are not valid.
+      bool Start(const TrafficGeneratorSettings& settings);
+
+      void Stop();
+
+      bool IsRunning() const;
+
+      /// advance the simulation by one tick, and hand the PDUs sent during the tick to the processor.
+      /// the context of each PDU holds the sender and the simulated send time.
+      /// @param context the addresses given to the PDUs.
+      /// @return the number of PDUs generated.
+      unsigned int Generate(IBufferProcessor& processor, const ReceiveContext& context=ReceiveContext());
+
+      /// @return the simulated time of the next tick, in nanoseconds since the epoch.
+      long long GetTime() const;
+
+      TrafficStatistics GetStatistics() const;
+
+      unsigned int GetThreadCount() const;
+
+   private:
+      TrafficGenerator(const TrafficGenerator&);              ///< not implemented by design
+      TrafficGenerator& operator=(const TrafficGenerator&);   ///< not implemented by design
+
+      struct Entity;
+      struct Worker;
+
+      /// simulate the tick for the worker's entities, marshalling their PDUs into its stream.
+      void Simulate(Worker& worker, unsigned long long tick);
+
+      /// marshal the PDU sent at the time, in seconds since the first tick, into the worker's stream.
+      void Emit(Worker& worker, Pdu& pdu, double time);
+
+      /// @return the geocentric position of a point of the exercise area.
+      /// @param local the meters east, north and up of the center of the area.
+      Vector3Double ToWorld(const double local[3]) const;
+
+      void WorkLoop(unsigned int index);
+
+      TrafficGeneratorSettings _settings;
+
+      /// each worker owns the PDUs it marshals, and a share of the entities.
+      std::vector<Worker*> _workers;
+      std::vector<std::thread> _threads;
+
+      /// the tick the workers are asked to simulate, which changes with every generation,
+      /// and the number of workers done with it.
+      std::mutex _mutex;
+      std::condition_variable _wakeup;
+      std::condition_variable _done;
+      unsigned long long _tick;
+      unsigned long long _generation;
+      unsigned int _finished;
+      bool _running;
+
+      /// the center of the exercise area in geocentric coordinates, and the rotation from local east, north and up.
+      double _origin[3];
+      double _east[3];
+      double _north[3];
+      double _up[3];
+
+      TrafficStatistics _statistics;
+   };
+}
+
+#endif  // _dcl_dis_traffic_generator_h_
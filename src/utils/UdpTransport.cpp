@@ -0,0 +1,797 @@
+#include <utils/UdpTransport.h>
+
+#if defined(__linux__)
+
+#include <utils/IBufferProcessor.h>
+#include <utils/ReceiveContext.h>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/udp.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <stdint.h>
+
+// older C library headers do not define the UDP offload options.
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#ifndef SO_RXQ_OVFL
+#define SO_RXQ_OVFL 40
+#endif
+#ifndef SO_RCVBUFFORCE
+#define SO_RCVBUFFORCE 33
+#endif
+
+using namespace DIS;
+
+namespace
+{
+   /// the epoll user data identifying which descriptor is ready.
+   const unsigned int EVENT_SOCKET = 0;
+   const unsigned int EVENT_WAKEUP = 1;
+
+   /// the space reserved for the ancillary data of each received datagram.
+   const size_t RECV_CONTROL_SIZE = 256;
+
+   /// the space needed for the UDP_SEGMENT ancillary data of each sent message.
+   const size_t SEND_CONTROL_SIZE = CMSG_SPACE( sizeof(uint16_t) );
+
+   /// convert the dotted string to an address.  an empty string is INADDR_ANY.
+   bool ToAddress(const std::string& text, in_addr& addr)
+   {
+      if( text.empty() )
+      {
+         addr.s_addr = htonl( INADDR_ANY );
+         return true;
+      }
+
+      return( inet_pton( AF_INET , text.c_str() , &addr ) == 1 );
+   }
+
+   /// @return the time now, in nanoseconds since the epoch.
+   long long Now()
+   {
+      timespec now;
+      clock_gettime( CLOCK_REALTIME , &now );
+      return static_cast<long long>( now.tv_sec ) * 1000000000LL + now.tv_nsec;
+   }
+}
+
+UdpTransportSettings::UdpTransportSettings()
+   : port(0)
+   , address()
+   , interfaceAddress()
+   , destination()
+   , destinationPort(0)
+   , batchSize(64)
+   , maxBatches(16)
+   , bufferSize(8192)
+   , multicastTtl(1)
+   , multicastLoop(true)
+   , reuseAddress(true)
+   , reusePort(false)
+   , gso(false)
+   , gro(false)
+   , timestamps(true)
+   , receiveBufferSize(8 * 1024 * 1024)
+   , dropCounting(true)
+   , sourceStatistics(false)
+{
+}
+
+UdpSourceStatistics::UdpSourceStatistics()
+   : address(0)
+   , port(0)
+   , datagrams(0)
+   , bytes(0)
+   , firstTime(0)
+   , lastTime(0)
+   , maxGap(0)
+   , rate(0.0)
+{
+}
+
+UdpTransportStatistics::UdpTransportStatistics()
+   : datagrams(0)
+   , bytes(0)
+   , truncated(0)
+   , kernelDrops(0)
+   , receiveBufferSize(0)
+   , sources()
+{
+}
+
+UdpTransport::UdpTransport()
+   : _settings()
+   , _socket(-1)
+   , _epoll(-1)
+   , _wakeup(-1)
+   , _error(0)
+   , _gso(false)
+   , _gro(false)
+   , _recvBuffer()
+   , _recvControl()
+   , _recvHeaders()
+   , _recvVectors()
+   , _recvSources()
+   , _recvSlotSize(0)
+   , _recvDatagrams()
+   , _recvTimes()
+   , _statisticsMutex()
+   , _statistics()
+   , _sources()
+   , _dropCounter(0)
+   , _sendBuffer()
+   , _sendControl()
+   , _sendHeaders()
+   , _sendVectors()
+   , _sendSegmentSize()
+   , _sendSegments()
+   , _sendCount(0)
+   , _sendDatagrams(0)
+   , _sendUsed(0)
+   , _destination()
+{
+}
+
+UdpTransport::~UdpTransport()
+{
+   Close();
+}
+
+bool UdpTransport::Open(const UdpTransportSettings& settings)
+{
+   Close();
+
+   _settings = settings;
+   if( _settings.batchSize < 1 )
+   {
+      _settings.batchSize = 1;
+   }
+   if( _settings.maxBatches < 1 )
+   {
+      _settings.maxBatches = 1;
+   }
+   if( _settings.bufferSize < 1 || _settings.bufferSize > UDP_MAX_PAYLOAD )
+   {
+      _settings.bufferSize = UDP_MAX_PAYLOAD;
+   }
+
+   in_addr local;
+   in_addr iface;
+   if( !ToAddress( _settings.address , local ) || !ToAddress( _settings.interfaceAddress , iface ) )
+   {
+      _error = EINVAL;
+      return false;
+   }
+   const bool multicast = IN_MULTICAST( ntohl( local.s_addr ) );
+
+   _socket = socket( AF_INET , SOCK_DGRAM | SOCK_CLOEXEC , 0 );
+   if( _socket < 0 )
+   {
+      return Fail();
+   }
+
+   int on = 1;
+   if( _settings.reuseAddress &&
+       setsockopt( _socket , SOL_SOCKET , SO_REUSEADDR , &on , sizeof(on) ) != 0 )
+   {
+      return Fail();
+   }
+   if( _settings.reusePort &&
+       setsockopt( _socket , SOL_SOCKET , SO_REUSEPORT , &on , sizeof(on) ) != 0 )
+   {
+      return Fail();
+   }
+
+   // multicast listeners bind to the group so that other groups on the port are filtered by the kernel.
+   sockaddr_in bindAddr;
+   memset( &bindAddr , 0 , sizeof(bindAddr) );
+   bindAddr.sin_family = AF_INET;
+   bindAddr.sin_port = htons( _settings.port );
+   bindAddr.sin_addr = local;
+   if( bind( _socket , reinterpret_cast<sockaddr*>( &bindAddr ) , sizeof(bindAddr) ) != 0 )
+   {
+      return Fail();
+   }
+
+   if( multicast )
+   {
+      ip_mreq membership;
+      membership.imr_multiaddr = local;
+      membership.imr_interface = iface;
+      if( setsockopt( _socket , IPPROTO_IP , IP_ADD_MEMBERSHIP , &membership , sizeof(membership) ) != 0 )
+      {
+         return Fail();
+      }
+   }
+
+   if( !_settings.interfaceAddress.empty() &&
+       setsockopt( _socket , IPPROTO_IP , IP_MULTICAST_IF , &iface , sizeof(iface) ) != 0 )
+   {
+      return Fail();
+   }
+
+   int loop = _settings.multicastLoop ? 1 : 0;
+   int ttl = _settings.multicastTtl;
+   if( setsockopt( _socket , IPPROTO_IP , IP_MULTICAST_LOOP , &loop , sizeof(loop) ) != 0 ||
+       setsockopt( _socket , IPPROTO_IP , IP_MULTICAST_TTL , &ttl , sizeof(ttl) ) != 0 )
+   {
+      return Fail();
+   }
+
+   // the destination defaults to the joined multicast group.
+   memset( &_destination , 0 , sizeof(_destination) );
+   _destination.sin_family = AF_INET;
+   _destination.sin_port = htons( _settings.destinationPort ? _settings.destinationPort : GetLocalPort() );
+   if( !_settings.destination.empty() )
+   {
+      if( !ToAddress( _settings.destination , _destination.sin_addr ) )
+      {
+         _error = EINVAL;
+         Close();
+         return false;
+      }
+   }
+   else if( multicast )
+   {
+      _destination.sin_addr = local;
+   }
+   else
+   {
+      _destination.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+   }
+
+   _wakeup = eventfd( 0 , EFD_NONBLOCK | EFD_CLOEXEC );
+   _epoll = epoll_create1( EPOLL_CLOEXEC );
+   if( _wakeup < 0 || _epoll < 0 )
+   {
+      return Fail();
+   }
+
+   epoll_event ev;
+   memset( &ev , 0 , sizeof(ev) );
+   ev.events = EPOLLIN;
+   ev.data.u32 = EVENT_SOCKET;
+   if( epoll_ctl( _epoll , EPOLL_CTL_ADD , _socket , &ev ) != 0 )
+   {
+      return Fail();
+   }
+   ev.data.u32 = EVENT_WAKEUP;
+   if( epoll_ctl( _epoll , EPOLL_CTL_ADD , _wakeup , &ev ) != 0 )
+   {
+      return Fail();
+   }
+
+   // ask for the receiving interface and destination, and optionally the kernel receive time.
+   if( setsockopt( _socket , IPPROTO_IP , IP_PKTINFO , &on , sizeof(on) ) != 0 ||
+       ( _settings.timestamps &&
+         setsockopt( _socket , SOL_SOCKET , SO_TIMESTAMPNS , &on , sizeof(on) ) != 0 ) )
+   {
+      return Fail();
+   }
+
+   // a large kernel buffer absorbs the bursts of an exercise.  forcing it past net.core.rmem_max
+   // needs CAP_NET_ADMIN, otherwise the kernel caps the size.  a smaller buffer is not an error.
+   if( _settings.receiveBufferSize > 0 )
+   {
+      int size = _settings.receiveBufferSize;
+      if( setsockopt( _socket , SOL_SOCKET , SO_RCVBUFFORCE , &size , sizeof(size) ) != 0 )
+      {
+         setsockopt( _socket , SOL_SOCKET , SO_RCVBUF , &size , sizeof(size) );
+      }
+   }
+   int granted = 0;
+   socklen_t grantedLength = sizeof(granted);
+   getsockopt( _socket , SOL_SOCKET , SO_RCVBUF , &granted , &grantedLength );
+
+   // the kernel counts the datagrams dropped for the socket, and reports the count with each datagram.
+   if( _settings.dropCounting &&
+       setsockopt( _socket , SOL_SOCKET , SO_RXQ_OVFL , &on , sizeof(on) ) != 0 )
+   {
+      return Fail();
+   }
+
+   // the offloads are optional, older kernels reject the options and plain datagrams are used instead.
+   int segment = 0;
+   _gso = _settings.gso &&
+          setsockopt( _socket , SOL_UDP , UDP_SEGMENT , &segment , sizeof(segment) ) == 0;
+   _gro = _settings.gro &&
+          setsockopt( _socket , SOL_UDP , UDP_GRO , &on , sizeof(on) ) == 0;
+
+   // allocate the rings once, so that steady state receiving and sending never allocates.
+   const size_t batch = _settings.batchSize;
+   _recvSlotSize = _gro ? UDP_MAX_PAYLOAD : _settings.bufferSize;
+
+   _recvBuffer.assign( batch * _recvSlotSize , 0 );
+   _recvControl.assign( batch * RECV_CONTROL_SIZE , 0 );
+   _recvVectors.resize( batch );
+   _recvHeaders.resize( batch );
+   _recvSources.resize( batch );
+   _recvDatagrams.assign( batch , 0 );
+   _recvTimes.assign( batch , 0 );
+   _sendBuffer.assign( batch * _settings.bufferSize , 0 );
+   _sendControl.assign( batch * SEND_CONTROL_SIZE , 0 );
+   _sendVectors.resize( batch );
+   _sendHeaders.resize( batch );
+   _sendSegmentSize.assign( batch , 0 );
+   _sendSegments.assign( batch , 0 );
+   _sendCount = 0;
+   _sendDatagrams = 0;
+   _sendUsed = 0;
+
+   {
+      std::lock_guard<std::mutex> lock( _statisticsMutex );
+      _statistics = UdpTransportStatistics();
+      _statistics.receiveBufferSize = granted;
+      _sources.clear();
+      _dropCounter = 0;
+   }
+
+   for(size_t i=0; i<batch; ++i)
+   {
+      _recvVectors[i].iov_base = &_recvBuffer[i*_recvSlotSize];
+      _recvVectors[i].iov_len = _recvSlotSize;
+      memset( &_recvHeaders[i] , 0 , sizeof(mmsghdr) );
+      _recvHeaders[i].msg_hdr.msg_iov = &_recvVectors[i];
+      _recvHeaders[i].msg_hdr.msg_iovlen = 1;
+
+      _sendVectors[i].iov_base = &_sendBuffer[0];
+      _sendVectors[i].iov_len = 0;
+      memset( &_sendHeaders[i] , 0 , sizeof(mmsghdr) );
+      _sendHeaders[i].msg_hdr.msg_iov = &_sendVectors[i];
+      _sendHeaders[i].msg_hdr.msg_iovlen = 1;
+      _sendHeaders[i].msg_hdr.msg_name = &_destination;
+      _sendHeaders[i].msg_hdr.msg_namelen = sizeof(_destination);
+   }
+
+   return true;
+}
+
+void UdpTransport::Close()
+{
+   if( _socket >= 0 && _sendCount > 0 )
+   {
+      Flush();
+   }
+
+   if( _epoll >= 0 )
+   {
+      close( _epoll );
+      _epoll = -1;
+   }
+   if( _wakeup >= 0 )
+   {
+      close( _wakeup );
+      _wakeup = -1;
+   }
+   if( _socket >= 0 )
+   {
+      close( _socket );
+      _socket = -1;
+   }
+   _sendCount = 0;
+   _sendDatagrams = 0;
+   _sendUsed = 0;
+   _gso = false;
+   _gro = false;
+}
+
+bool UdpTransport::IsOpen() const
+{
+   return( _socket >= 0 );
+}
+
+int UdpTransport::Receive(IBufferProcessor& processor, int timeout_ms)
+{
+   if( _socket < 0 )
+   {
+      _error = EBADF;
+      return -1;
+   }
+
+   epoll_event events[2];
+   int ready = epoll_wait( _epoll , events , 2 , timeout_ms );
+   if( ready < 0 )
+   {
+      if( errno == EINTR )
+      {
+         return 0;
+      }
+      _error = errno;
+      return -1;
+   }
+
+   int processed = 0;
+   for(int i=0; i<ready; ++i)
+   {
+      if( events[i].data.u32 == EVENT_WAKEUP )
+      {
+         eventfd_t value;
+         eventfd_read( _wakeup , &value );
+      }
+      else
+      {
+         int count = Drain( processor );
+         if( count < 0 )
+         {
+            return -1;
+         }
+         processed += count;
+      }
+   }
+
+   return processed;
+}
+
+int UdpTransport::Drain(IBufferProcessor& processor)
+{
+   const unsigned int batch = _settings.batchSize;
+   int processed = 0;
+
+   for(unsigned int batches=0; batches<_settings.maxBatches; ++batches)
+   {
+      // the kernel overwrites the control lengths, restore the capacity before each call.
+      for(unsigned int i=0; i<batch; ++i)
+      {
+         _recvHeaders[i].msg_hdr.msg_control = &_recvControl[i*RECV_CONTROL_SIZE];
+         _recvHeaders[i].msg_hdr.msg_controllen = RECV_CONTROL_SIZE;
+         _recvHeaders[i].msg_hdr.msg_name = &_recvSources[i];
+         _recvHeaders[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+      }
+
+      int count = recvmmsg( _socket , &_recvHeaders[0] , batch , MSG_DONTWAIT , NULL );
+      if( count < 0 )
+      {
+         if( errno == EINTR )
+         {
+            continue;
+         }
+         if( errno == EAGAIN || errno == EWOULDBLOCK )
+         {
+            break;
+         }
+         _error = errno;
+         return( processed > 0 ? processed : -1 );
+      }
+
+      unsigned int position = 0;
+      unsigned int dropCounter = 0;
+      bool dropReported = false;
+      for(int i=0; i<count; ++i)
+      {
+         msghdr& header = _recvHeaders[i].msg_hdr;
+         _recvDatagrams[i] = 0;
+
+         // a datagram larger than the slot can not be decoded, skip it.
+         if( header.msg_flags & MSG_TRUNC )
+         {
+            _recvTimes[i] = -1;
+            continue;
+         }
+
+         const char* data = static_cast<const char*>( _recvVectors[i].iov_base );
+         const size_t length = _recvHeaders[i].msg_len;
+
+         ReceiveContext context;
+         context.sourceAddress = ntohl( _recvSources[i].sin_addr.s_addr );
+         context.sourcePort = ntohs( _recvSources[i].sin_port );
+
+         // a coalesced buffer holds back to back datagrams of segment bytes, the last may be shorter.
+         size_t segment = length;
+         for(cmsghdr* cmsg = CMSG_FIRSTHDR( &header ); cmsg != NULL; cmsg = CMSG_NXTHDR( &header , cmsg ))
+         {
+            if( cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO )
+            {
+               int size;
+               memcpy( &size , CMSG_DATA( cmsg ) , sizeof(size) );
+               if( size > 0 )
+               {
+                  segment = size;
+               }
+            }
+            else if( cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS )
+            {
+               timespec stamp;
+               memcpy( &stamp , CMSG_DATA( cmsg ) , sizeof(stamp) );
+               context.timestamp = static_cast<long long>( stamp.tv_sec ) * 1000000000LL + stamp.tv_nsec;
+            }
+            else if( cmsg->cmsg_level == IPPROTO_IP && cmsg->cmsg_type == IP_PKTINFO )
+            {
+               in_pktinfo info;
+               memcpy( &info , CMSG_DATA( cmsg ) , sizeof(info) );
+               context.interfaceIndex = info.ipi_ifindex;
+               context.destinationAddress = ntohl( info.ipi_addr.s_addr );
+            }
+            else if( cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL )
+            {
+               uint32_t dropped;
+               memcpy( &dropped , CMSG_DATA( cmsg ) , sizeof(dropped) );
+               dropCounter = dropped;
+               dropReported = true;
+            }
+         }
+         _recvTimes[i] = context.timestamp;
+
+         for(size_t offset=0; offset<length; offset+=segment)
+         {
+            const size_t remaining = length - offset;
+            context.datagramLength = static_cast<unsigned int>( remaining < segment ? remaining : segment );
+            context.datagramIndex = position++;
+            processor.Process( data + offset , context.datagramLength , BIG , context );
+            ++processed;
+            ++_recvDatagrams[i];
+         }
+      }
+      Count( static_cast<unsigned int>( count ) , dropReported , dropCounter );
+      processor.EndBatch();
+
+      // a short batch means the socket has been drained.
+      if( static_cast<unsigned int>( count ) < batch )
+      {
+         break;
+      }
+   }
+
+   return processed;
+}
+
+void UdpTransport::Interrupt()
+{
+   if( _wakeup >= 0 )
+   {
+      eventfd_write( _wakeup , 1 );
+   }
+}
+
+bool UdpTransport::Send(const char* buf, size_t numbytes)
+{
+   if( _socket < 0 )
+   {
+      _error = EBADF;
+      return false;
+   }
+   if( numbytes > _settings.bufferSize )
+   {
+      _error = EMSGSIZE;
+      return false;
+   }
+
+   if( CanCoalesce( numbytes ) )
+   {
+      // extend the last message, the kernel will cut it back into datagrams.
+      const unsigned int last = _sendCount - 1;
+      memcpy( &_sendBuffer[_sendUsed] , buf , numbytes );
+      _sendVectors[last].iov_len += numbytes;
+      ++_sendSegments[last];
+      _sendUsed += numbytes;
+      ++_sendDatagrams;
+      return true;
+   }
+
+   if( ( _sendCount == _settings.batchSize || _sendUsed + numbytes > _sendBuffer.size() ) && !Flush() )
+   {
+      return false;
+   }
+
+   iovec& slot = _sendVectors[_sendCount];
+   slot.iov_base = &_sendBuffer[_sendUsed];
+   slot.iov_len = numbytes;
+   memcpy( slot.iov_base , buf , numbytes );
+   _sendSegmentSize[_sendCount] = static_cast<unsigned short>( numbytes );
+   _sendSegments[_sendCount] = 1;
+   _sendUsed += numbytes;
+   ++_sendCount;
+   ++_sendDatagrams;
+
+   return true;
+}
+
+bool UdpTransport::CanCoalesce(size_t numbytes) const
+{
+   if( !_gso || _sendCount == 0 )
+   {
+      return false;
+   }
+
+   const unsigned int last = _sendCount - 1;
+   const size_t segment = _sendSegmentSize[last];
+   const size_t length = _sendVectors[last].iov_len;
+
+   // only the final segment of a group may be shorter than the others.
+   return( numbytes > 0 &&
+           numbytes <= segment &&
+           segment <= UDP_MAX_GSO_SEGMENT_SIZE &&
+           length % segment == 0 &&
+           _sendSegments[last] < UDP_MAX_GSO_SEGMENTS &&
+           length + numbytes <= UDP_MAX_PAYLOAD &&
+           _sendUsed + numbytes <= _sendBuffer.size() );
+}
+
+bool UdpTransport::Flush()
+{
+   // attach the segment size to each message holding more than one datagram.
+   for(unsigned int i=0; i<_sendCount; ++i)
+   {
+      msghdr& header = _sendHeaders[i].msg_hdr;
+      if( _sendSegments[i] > 1 )
+      {
+         header.msg_control = &_sendControl[i*SEND_CONTROL_SIZE];
+         header.msg_controllen = SEND_CONTROL_SIZE;
+
+         cmsghdr* cmsg = CMSG_FIRSTHDR( &header );
+         cmsg->cmsg_level = SOL_UDP;
+         cmsg->cmsg_type = UDP_SEGMENT;
+         cmsg->cmsg_len = CMSG_LEN( sizeof(uint16_t) );
+         uint16_t size = _sendSegmentSize[i];
+         memcpy( CMSG_DATA( cmsg ) , &size , sizeof(size) );
+      }
+      else
+      {
+         header.msg_control = NULL;
+         header.msg_controllen = 0;
+      }
+   }
+
+   unsigned int sent = 0;
+   bool success = true;
+   while( sent < _sendCount )
+   {
+      int count = sendmmsg( _socket , &_sendHeaders[sent] , _sendCount - sent , 0 );
+      if( count < 0 )
+      {
+         if( errno == EINTR )
+         {
+            continue;
+         }
+         _error = errno;
+         success = false;
+         break;
+      }
+      sent += count;
+   }
+
+   _sendCount = 0;
+   _sendDatagrams = 0;
+   _sendUsed = 0;
+   return success;
+}
+
+unsigned int UdpTransport::GetQueuedCount() const
+{
+   return _sendDatagrams;
+}
+
+bool UdpTransport::IsGsoEnabled() const
+{
+   return _gso;
+}
+
+bool UdpTransport::IsGroEnabled() const
+{
+   return _gro;
+}
+
+unsigned short UdpTransport::GetLocalPort() const
+{
+   sockaddr_in addr;
+   socklen_t length = sizeof(addr);
+   if( _socket < 0 || getsockname( _socket , reinterpret_cast<sockaddr*>( &addr ) , &length ) != 0 )
+   {
+      return 0;
+   }
+
+   return ntohs( addr.sin_port );
+}
+
+int UdpTransport::GetLastError() const
+{
+   return _error;
+}
+
+UdpTransportStatistics UdpTransport::GetStatistics() const
+{
+   std::lock_guard<std::mutex> lock( _statisticsMutex );
+   UdpTransportStatistics statistics = _statistics;
+   statistics.sources.reserve( _sources.size() );
+   for(SourceContainer::const_iterator iter = _sources.begin(); iter != _sources.end(); ++iter)
+   {
+      statistics.sources.push_back( iter->second.statistics );
+   }
+   return statistics;
+}
+
+void UdpTransport::Count(unsigned int count, bool dropReported, unsigned int dropCounter)
+{
+   std::lock_guard<std::mutex> lock( _statisticsMutex );
+
+   // the difference is right across the wrap of the kernel counter.
+   if( dropReported )
+   {
+      _statistics.kernelDrops += static_cast<unsigned int>( dropCounter - _dropCounter );
+      _dropCounter = dropCounter;
+   }
+
+   long long now = 0;
+   for(unsigned int i=0; i<count; ++i)
+   {
+      if( _recvTimes[i] < 0 )
+      {
+         ++_statistics.truncated;
+         continue;
+      }
+
+      const unsigned int length = _recvHeaders[i].msg_len;
+      _statistics.datagrams += _recvDatagrams[i];
+      _statistics.bytes += length;
+      if( !_settings.sourceStatistics )
+      {
+         continue;
+      }
+
+      // without kernel timestamps the datagrams of a batch are given the time it was read.
+      long long time = _recvTimes[i];
+      if( time == 0 )
+      {
+         now = ( now == 0 ) ? Now() : now;
+         time = now;
+      }
+
+      const unsigned long long key = ( static_cast<unsigned long long>( ntohl( _recvSources[i].sin_addr.s_addr ) ) << 16 ) |
+                                     ntohs( _recvSources[i].sin_port );
+      SourceContainer::iterator iter = _sources.find( key );
+      if( iter == _sources.end() )
+      {
+         SourceState state;
+         state.statistics.address = ntohl( _recvSources[i].sin_addr.s_addr );
+         state.statistics.port = ntohs( _recvSources[i].sin_port );
+         state.statistics.firstTime = time;
+         state.statistics.lastTime = time;
+         state.windowStart = time;
+         state.windowDatagrams = 0;
+         iter = _sources.insert( SourceContainer::value_type( key , state ) ).first;
+      }
+
+      SourceState& state = iter->second;
+      UdpSourceStatistics& source = state.statistics;
+      if( time - source.lastTime > source.maxGap )
+      {
+         source.maxGap = time - source.lastTime;
+      }
+      source.datagrams += _recvDatagrams[i];
+      source.bytes += length;
+      source.lastTime = time;
+
+      state.windowDatagrams += _recvDatagrams[i];
+      if( time - state.windowStart >= 1000000000LL )
+      {
+         source.rate = state.windowDatagrams * 1e9 / ( time - state.windowStart );
+         state.windowStart = time;
+         state.windowDatagrams = 0;
+      }
+   }
+}
+
+const UdpTransportSettings& UdpTransport::GetSettings() const
+{
+   return _settings;
+}
+
+bool UdpTransport::Fail()
+{
+   _error = errno;
+   Close();
+   return false;
+}
+
+#endif  // __linux__
@@ -0,0 +1,289 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dcl_dis_udp_transport_h_
+#define _dcl_dis_udp_transport_h_
+
+#if defined(__linux__)
+
+#include <string>                   // for member
+#include <vector>                   // for member
+#include <map>                      // for member
+#include <mutex>                    // for member
+#include <cstddef>                  // for size_t definition
+#include <dis6/msLibMacro.h>         // for library symbols
+
+#include <sys/socket.h>             // for mmsghdr
+#include <sys/uio.h>                // for iovec
+#include <netinet/in.h>             // for sockaddr_in
+
+namespace DIS
+{
+   class IBufferProcessor;
+
+   /// the maximum payload of a single UDP datagram over IPv4.
+   const unsigned int UDP_MAX_PAYLOAD = 65507;
+
+   /// the most datagrams the kernel accepts in one UDP_SEGMENT buffer.
+   const unsigned int UDP_MAX_GSO_SEGMENTS = 64;
+
+   /// the largest datagram that is coalesced for segmentation offload,
+   /// so that every segment fits an ethernet frame.
+   const unsigned int UDP_MAX_GSO_SEGMENT_SIZE = 1472;
+
+   /// the parameters used to open a UdpTransport.
+   struct EXPORT_MACRO UdpTransportSettings
+   {
+      UdpTransportSettings();
+
+      /// the local port to bind.  0 lets the kernel choose an ephemeral port.
+      unsigned short port;
+
+      /// the multicast group to join, or the local unicast address to bind.
+      /// an empty string binds to all local addresses.
+      std::string address;
+
+      /// the local interface address used for multicast membership and multicast sends.
+      /// an empty string lets the kernel choose.
+      std::string interfaceAddress;
+
+      /// the address datagrams are sent to.  when empty the multicast group from 'address' is used,
+      /// or the loopback address when 'address' is not a multicast group.
+      std::string destination;
+
+      /// the port datagrams are sent to.  0 uses 'port'.
+      unsigned short destinationPort;
+
+      /// the number of datagrams moved per recvmmsg/sendmmsg call.
+      unsigned int batchSize;
+
+      /// the most recvmmsg calls made by one Receive().  under a sustained load the socket is never
+      /// drained, so Receive() returns after this many batches for Interrupt() to take effect.
+      /// the datagrams left are read by the next Receive(), which does not wait for them.
+      unsigned int maxBatches;
+
+      /// the number of bytes reserved for each datagram in the buffer ring.
+      unsigned int bufferSize;
+
+      /// the time-to-live used for multicast sends.
+      int multicastTtl;
+
+      /// when 'true' multicast sends are looped back to local listeners.
+      bool multicastLoop;
+
+      /// when 'true' SO_REUSEADDR is set so that several processes can share the port.
+      bool reuseAddress;
+
+      /// when 'true' SO_REUSEPORT is set, so that several sockets can bind the same port
+      /// and the kernel spreads unicast flows among them.
+      bool reusePort;
+
+      /// when 'true' consecutive datagrams of the same size are handed to the kernel
+      /// as one buffer and segmented with UDP_SEGMENT (generic segmentation offload).
+      bool gso;
+
+      /// when 'true' the kernel may coalesce datagrams of one flow with UDP_GRO (generic receive offload).
+      /// coalesced buffers are split back into datagrams before they are processed.
+      /// the receive ring then reserves UDP_MAX_PAYLOAD bytes per slot.
+      bool gro;
+
+      /// when 'true' the kernel records the receive time of every datagram (SO_TIMESTAMPNS),
+      /// which is passed to the processor within the ReceiveContext.
+      bool timestamps;
+
+      /// the size requested for the kernel receive buffer (SO_RCVBUF), in bytes.  a burst larger
+      /// than the buffer is dropped by the kernel before the receive thread can read it.
+      /// the request is forced past net.core.rmem_max when the process has CAP_NET_ADMIN,
+      /// and is otherwise capped by the kernel.  0 keeps the system default.
+      int receiveBufferSize;
+
+      /// when 'true' the kernel reports the datagrams it dropped for the socket (SO_RXQ_OVFL).
+      bool dropCounting;
+
+      /// when 'true' the datagrams, rate and gaps of every sender are tracked.
+      bool sourceStatistics;
+   };
+
+   /// the datagrams received from one sender.
+   struct EXPORT_MACRO UdpSourceStatistics
+   {
+      UdpSourceStatistics();
+
+      /// the IPv4 address of the sender, in host byte order, and its UDP port.
+      unsigned int address;
+      unsigned short port;
+
+      unsigned long long datagrams;
+      unsigned long long bytes;
+
+      /// the receive times of the first and the last datagram, in nanoseconds since the epoch.
+      long long firstTime;
+      long long lastTime;
+
+      /// the longest time between two consecutive datagrams of the sender, in nanoseconds.
+      long long maxGap;
+
+      /// the datagrams per second over the last second the sender was heard.
+      double rate;
+   };
+
+   /// the counters of a UdpTransport since it was opened.
+   struct EXPORT_MACRO UdpTransportStatistics
+   {
+      UdpTransportStatistics();
+
+      /// the datagrams read from the socket, and their bytes.
+      unsigned long long datagrams;
+      unsigned long long bytes;
+
+      /// the datagrams larger than a slot of the receive ring, which were skipped.
+      unsigned long long truncated;
+
+      /// the datagrams the kernel dropped because the receive buffer was full, as reported by
+      /// SO_RXQ_OVFL.  the kernel reports its count with the next datagram received.
+      unsigned long long kernelDrops;
+
+      /// the size of the kernel receive buffer granted, in bytes.
+      int receiveBufferSize;
+
+      /// the senders heard, in address and port order, when source statistics are enabled.
+      std::vector<UdpSourceStatistics> sources;
+   };
+
+   /// a Linux UDP unicast/multicast socket that moves datagrams in batches.
+   /// datagrams are received with recvmmsg into a pre-allocated buffer ring
+   /// and handed directly to an IBufferProcessor, such as IncomingMessage.
+   /// outgoing datagrams are copied into a second ring and sent with sendmmsg.
+   /// the receive call blocks on epoll rather than polling the socket.
+   /// each datagram is accompanied by a ReceiveContext holding the sender, interface and receive time.
+   /// UDP segmentation and receive offload are used when requested and supported by the kernel.
+   /// the receive counters, including the datagrams dropped by the kernel, are available while receiving.
+   /// this class is only available on Linux.
+   class EXPORT_MACRO UdpTransport
+   {
+   public:
+      UdpTransport();
+      ~UdpTransport();
+
+      /// create the socket and the buffer rings.
+      /// @return 'false' if any socket operation failed.  GetLastError() has the errno value.
+      bool Open(const UdpTransportSettings& settings);
+
+      /// flush any queued datagrams and release the socket.
+      void Close();
+
+      bool IsOpen() const;
+
+      /// block until datagrams are available, then read them in batches until the socket
+      /// is drained or 'maxBatches' batches were read, passing each datagram to the processor.
+      /// the processor's EndBatch() is called after the datagrams of each batch.
+      /// @param processor the receiver of each datagram payload.
+      /// @param timeout_ms the time to wait for the first datagram. -1 waits forever.
+      /// @return the number of datagrams processed, 0 on timeout or Interrupt(), -1 on error.
+      int Receive(IBufferProcessor& processor, int timeout_ms);
+
+      /// wake up a thread blocked within Receive.  safe to call from any thread.
+      void Interrupt();
+
+      /// copy the datagram into the send ring.  the ring is flushed when it is full.
+      /// @return 'false' if the datagram is too large or the flush failed.
+      bool Send(const char* buf, size_t numbytes);
+
+      /// transmit all queued datagrams with as few sendmmsg calls as possible.
+      /// @return 'false' if the socket reported an error.
+      bool Flush();
+
+      /// @return the number of datagrams waiting in the send ring.
+      unsigned int GetQueuedCount() const;
+
+      /// @return 'true' if the socket accepted UDP_SEGMENT.  'false' if not requested or not supported.
+      bool IsGsoEnabled() const;
+
+      /// @return 'true' if the socket accepted UDP_GRO.  'false' if not requested or not supported.
+      bool IsGroEnabled() const;
+
+      /// @return the port the socket is bound to, useful when the settings requested port 0.
+      unsigned short GetLocalPort() const;
+
+      /// @return the errno value of the last failed operation.
+      int GetLastError() const;
+
+      /// @return the receive counters.  safe to call from any thread.
+      UdpTransportStatistics GetStatistics() const;
+
+      const UdpTransportSettings& GetSettings() const;
+
+   private:
+      UdpTransport(const UdpTransport&);              ///< not implemented by design
+      UdpTransport& operator=(const UdpTransport&);   ///< not implemented by design
+
+      bool Fail();
+
+      /// read up to 'maxBatches' batches of the datagrams that are ready, without blocking.
+      int Drain(IBufferProcessor& processor);
+
+      /// @return 'true' if the datagram can be appended to the last segmentation group.
+      bool CanCoalesce(size_t numbytes) const;
+
+      /// count the datagrams of a batch read from the socket.
+      /// @param dropReported 'true' if the kernel reported its drop counter with a datagram of the batch.
+      void Count(unsigned int count, bool dropReported, unsigned int dropCounter);
+
+      /// the rate of a sender is measured over windows of a second.
+      struct SourceState
+      {
+         UdpSourceStatistics statistics;
+         long long windowStart;
+         unsigned long long windowDatagrams;
+      };
+      typedef std::map<unsigned long long, SourceState> SourceContainer;
+
+      UdpTransportSettings _settings;
+
+      int _socket;
+      int _epoll;
+      int _wakeup;
+      int _error;
+      bool _gso;
+      bool _gro;
+
+      /// the receive buffer ring, one slot per datagram or coalesced buffer.
+      std::vector<char> _recvBuffer;
+      std::vector<char> _recvControl;
+      std::vector<mmsghdr> _recvHeaders;
+      std::vector<iovec> _recvVectors;
+      std::vector<sockaddr_in> _recvSources;
+      size_t _recvSlotSize;
+
+      /// the datagrams held by each slot of the batch, several when coalesced by UDP_GRO,
+      /// and the receive time of each slot, or -1 for a truncated datagram.
+      std::vector<unsigned int> _recvDatagrams;
+      std::vector<long long> _recvTimes;
+
+      /// the receive counters, written by the receiving thread in batches.
+      mutable std::mutex _statisticsMutex;
+      UdpTransportStatistics _statistics;
+      SourceContainer _sources;
+
+      /// the last drop counter reported by the kernel, which wraps at 32 bits.
+      unsigned int _dropCounter;
+
+      /// the send buffer ring.  datagrams are packed back to back,
+      /// each message carries one datagram or one group of equally sized segments.
+      std::vector<char> _sendBuffer;
+      std::vector<char> _sendControl;
+      std::vector<mmsghdr> _sendHeaders;
+      std::vector<iovec> _sendVectors;
+      std::vector<unsigned short> _sendSegmentSize;
+      std::vector<unsigned short> _sendSegments;
+      unsigned int _sendCount;
+      unsigned int _sendDatagrams;
+      size_t _sendUsed;
+
+      sockaddr_in _destination;
+   };
+}
+
+#endif  // __linux__
+
+#endif  // _dcl_dis_udp_transport_h_
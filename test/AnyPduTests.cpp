@@ -0,0 +1,231 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <dis6/AnyPdu.h>              // for testing
+#include <utils/PduHeader.h>          // for usage
+#include <utils/SpscRing.h>           // for usage
+#include <utils/DataStream.h>         // for usage
+
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests holding, copying, decoding and visiting PDUs in an AnyPdu.
+   class AnyPduTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestHold();
+      void TestCopyAndMove();
+      void TestDecode();
+      void TestVisit();
+      void TestRing();
+
+      CPPUNIT_TEST_SUITE( AnyPduTests );
+         CPPUNIT_TEST( TestHold );
+         CPPUNIT_TEST( TestCopyAndMove );
+         CPPUNIT_TEST( TestDecode );
+         CPPUNIT_TEST( TestVisit );
+         CPPUNIT_TEST( TestRing );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   DIS::EntityStatePdu MakeEntityState(unsigned short entity)
+   {
+      DIS::EntityStatePdu pdu;
+      pdu.getEntityID().setEntity( entity );
+      DIS::ArticulationParameter parameter;
+      parameter.setParameterType( 4096 );
+      pdu.getArticulationParameters().push_back( parameter );
+      return pdu;
+   }
+
+   std::vector<char> Marshal(const DIS::Pdu& pdu)
+   {
+      DIS::DataStream ds( DIS::BIG );
+      pdu.marshal( ds );
+      std::vector<char> buffer( ds.size() );
+      for(size_t i=0; i<ds.size(); ++i)
+      {
+         buffer[i] = ds[static_cast<unsigned int>( i )];
+      }
+      return buffer;
+   }
+
+   /// names the class it is called with.
+   struct NameVisitor
+   {
+      void operator()(const DIS::EntityStatePdu& pdu)
+      {
+         name = "EntityState";
+         entity = pdu.getEntityID().getEntity();
+      }
+
+      void operator()(const DIS::FirePdu& /*pdu*/)
+      {
+         name = "Fire";
+      }
+
+      template<typename T>
+      void operator()(const T& /*pdu*/)
+      {
+         name = "other";
+      }
+
+      std::string name;
+      unsigned short entity;
+   };
+
+   /// changes the PDU it is called with.
+   struct MarkVisitor
+   {
+      void operator()(DIS::EntityStatePdu& pdu)
+      {
+         pdu.getEntityID().setEntity( 99 );
+      }
+
+      template<typename T>
+      void operator()(T& pdu)
+      {
+         pdu.setExerciseID( 99 );
+      }
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( AnyPduTests );
+
+void AnyPduTests::TestHold()
+{
+   AnyPdu any;
+   CPPUNIT_ASSERT( any.IsEmpty() );
+   CPPUNIT_ASSERT( any.GetPdu() == NULL );
+   CPPUNIT_ASSERT( any.Get<EntityStatePdu>() == NULL );
+
+   any.Set( MakeEntityState( 7 ) );
+   CPPUNIT_ASSERT( !any.IsEmpty() );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned char>( PDU_ENTITY_STATE ) , any.GetPduType() );
+   CPPUNIT_ASSERT( any.Get<FirePdu>() == NULL );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 7 ) , any.Get<EntityStatePdu>()->getEntityID().getEntity() );
+   CPPUNIT_ASSERT( any.GetPdu() == any.Get<EntityStatePdu>() );
+
+   // the PDU is held inline.
+   CPPUNIT_ASSERT( reinterpret_cast<const char*>( any.GetPdu() ) >= reinterpret_cast<const char*>( &any ) );
+   CPPUNIT_ASSERT( reinterpret_cast<const char*>( any.GetPdu() ) < reinterpret_cast<const char*>( &any ) + sizeof(any) );
+   CPPUNIT_ASSERT( AnyPdu::STORAGE_SIZE >= sizeof(EntityStatePdu) );
+
+   FirePdu& fire = any.Emplace<FirePdu>();
+   CPPUNIT_ASSERT( &fire == any.Get<FirePdu>() );
+   CPPUNIT_ASSERT( any.Get<EntityStatePdu>() == NULL );
+
+   CPPUNIT_ASSERT( any.Create( PDU_COLLISION ) );
+   CPPUNIT_ASSERT( any.Get<CollisionPdu>() != NULL );
+   CPPUNIT_ASSERT( !any.Create( 200 ) );
+   CPPUNIT_ASSERT( any.IsEmpty() );
+
+   any.Set( MakeEntityState( 1 ) );
+   any.Reset();
+   CPPUNIT_ASSERT( any.IsEmpty() );
+}
+
+void AnyPduTests::TestCopyAndMove()
+{
+   AnyPdu original( MakeEntityState( 3 ) );
+   AnyPdu copy( original );
+   CPPUNIT_ASSERT( copy.Get<EntityStatePdu>() != original.Get<EntityStatePdu>() );
+   CPPUNIT_ASSERT( *copy.Get<EntityStatePdu>() == *original.Get<EntityStatePdu>() );
+
+   AnyPdu moved( std::move( copy ) );
+   CPPUNIT_ASSERT( copy.IsEmpty() );
+   CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( 1 ) , moved.Get<EntityStatePdu>()->getArticulationParameters().size() );
+
+   AnyPdu assigned( ( FirePdu() ) );
+   assigned = original;
+   CPPUNIT_ASSERT( *assigned.Get<EntityStatePdu>() == *original.Get<EntityStatePdu>() );
+   assigned = AnyPdu();
+   CPPUNIT_ASSERT( assigned.IsEmpty() );
+
+   assigned = assigned;
+   original = std::move( original );
+   CPPUNIT_ASSERT( original.Get<EntityStatePdu>() != NULL );
+}
+
+void AnyPduTests::TestDecode()
+{
+   const std::vector<char> buffer = Marshal( MakeEntityState( 12 ) );
+
+   AnyPdu any( ( FirePdu() ) );
+   CPPUNIT_ASSERT( any.Decode( &buffer[0] , static_cast<unsigned int>( buffer.size() ) , BIG ) );
+   const EntityStatePdu* pdu = any.Get<EntityStatePdu>();
+   CPPUNIT_ASSERT( pdu != NULL );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 12 ) , pdu->getEntityID().getEntity() );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 4096 ) , pdu->getArticulationParameters()[0].getParameterType() );
+
+   // too short for its body, too short for a header, and of an unknown type.
+   CPPUNIT_ASSERT( !any.Decode( &buffer[0] , 40 , BIG ) );
+   CPPUNIT_ASSERT( any.IsEmpty() );
+   CPPUNIT_ASSERT( !any.Decode( &buffer[0] , 8 , BIG ) );
+
+   std::vector<char> unknown( buffer );
+   unknown[PDU_TYPE_POSITION] = static_cast<char>( 200 );
+   CPPUNIT_ASSERT( !any.Decode( &unknown[0] , static_cast<unsigned int>( unknown.size() ) , BIG ) );
+
+   // PDUs one after the other in a stream.
+   const std::vector<char> fire = Marshal( FirePdu() );
+   std::vector<char> both( buffer );
+   both.insert( both.end() , fire.begin() , fire.end() );
+   DataStream ds( &both[0] , both.size() , BIG );
+   CPPUNIT_ASSERT( any.Decode( ds ) );
+   CPPUNIT_ASSERT( any.Get<EntityStatePdu>() != NULL );
+   CPPUNIT_ASSERT( any.Decode( ds ) );
+   CPPUNIT_ASSERT( any.Get<FirePdu>() != NULL );
+   CPPUNIT_ASSERT( !any.Decode( ds ) );
+}
+
+void AnyPduTests::TestVisit()
+{
+   NameVisitor names;
+   AnyPdu any;
+   CPPUNIT_ASSERT( !any.Visit( names ) );
+
+   any.Set( MakeEntityState( 5 ) );
+   const AnyPdu& held = any;
+   CPPUNIT_ASSERT( held.Visit( names ) );
+   CPPUNIT_ASSERT_EQUAL( std::string( "EntityState" ) , names.name );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 5 ) , names.entity );
+
+   MarkVisitor mark;
+   any.Visit( mark );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 99 ) , any.Get<EntityStatePdu>()->getEntityID().getEntity() );
+
+   any.Emplace<FirePdu>();
+   held.Visit( names );
+   CPPUNIT_ASSERT_EQUAL( std::string( "Fire" ) , names.name );
+
+   any.Emplace<CommentPdu>();
+   held.Visit( names );
+   CPPUNIT_ASSERT_EQUAL( std::string( "other" ) , names.name );
+   any.Visit( mark );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned char>( 99 ) , any.GetPdu()->getExerciseID() );
+}
+
+void AnyPduTests::TestRing()
+{
+   SpscRing<AnyPdu> ring( 4 );
+   CPPUNIT_ASSERT( ring.Push( AnyPdu( MakeEntityState( 1 ) ) ) );
+   CPPUNIT_ASSERT( ring.Push( AnyPdu( FirePdu() ) ) );
+
+   AnyPdu* front = ring.Front();
+   CPPUNIT_ASSERT( front != NULL );
+   AnyPdu received( std::move( *front ) );
+   ring.Pop();
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 1 ) , received.Get<EntityStatePdu>()->getEntityID().getEntity() );
+
+   front = ring.Front();
+   CPPUNIT_ASSERT( front->Get<FirePdu>() != NULL );
+   ring.Pop();
+   CPPUNIT_ASSERT( ring.Front() == NULL );
+}
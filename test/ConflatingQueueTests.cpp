@@ -0,0 +1,193 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/ConflatingQueue.h>   // for testing
+#include <utils/IncomingMessage.h>   // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+#include <dis6/FirePdu.h>            // for usage
+
+#include <atomic>
+#include <map>
+#include <thread>
+
+namespace TestDIS
+{
+   /// tests conflating the entity state updates between two threads.
+   class ConflatingQueueTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestConflation();
+      void TestEntityLimit();
+      void TestConcurrentConsumer();
+
+      CPPUNIT_TEST_SUITE( ConflatingQueueTests );
+         CPPUNIT_TEST( TestConflation );
+         CPPUNIT_TEST( TestEntityLimit );
+         CPPUNIT_TEST( TestConcurrentConsumer );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// remembers the latest timestamp of each entity and the order of the PDU types.
+   class LatestProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      LatestProcessor() : _hits(0), _regressions(0), _latest(), _types() {}
+
+      void Process(const DIS::Pdu& packet)
+      {
+         _types.push_back( packet.getPduType() );
+         if( packet.getPduType() == DIS::PDU_ENTITY_STATE )
+         {
+            const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
+            const unsigned short entity = espdu.getEntityID().getEntity();
+            if( _latest.count( entity ) > 0 && _latest[entity] >= espdu.getTimestamp() )
+            {
+               ++_regressions;
+            }
+            _latest[entity] = espdu.getTimestamp();
+         }
+         _hits++;
+      }
+
+      unsigned int _hits;
+      unsigned int _regressions;
+      std::map<unsigned short,unsigned int> _latest;
+      std::vector<unsigned char> _types;
+   };
+
+   void QueueEntityState(DIS::ConflatingQueue& queue, unsigned short entity, unsigned int timestamp)
+   {
+      DIS::EntityStatePdu espdu;
+      espdu.getEntityID().setEntity( entity );
+      espdu.setTimestamp( timestamp );
+      DIS::DataStream ds( DIS::BIG );
+      espdu.marshal( ds );
+      queue.Process( &ds[0] , ds.size() , DIS::BIG );
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( ConflatingQueueTests );
+
+void ConflatingQueueTests::TestConflation()
+{
+   ConflatingQueue queue;
+   for(unsigned int update=1; update<=5; ++update)
+   {
+      QueueEntityState( queue , 1 , update );
+   }
+   for(unsigned int update=1; update<=3; ++update)
+   {
+      QueueEntityState( queue , 2 , update );
+   }
+
+   // events are never conflated, and come before the states
+   FirePdu fire;
+   DataStream ds( BIG );
+   fire.marshal( ds );
+   fire.marshal( ds );
+   queue.Process( &ds[0] , ds.size() , BIG );
+
+   CPPUNIT_ASSERT_EQUAL( queue.GetConflatedCount() , 6ull );
+   CPPUNIT_ASSERT_EQUAL( queue.GetEntityCount() , 2u );
+
+   LatestProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.AddProcessor( PDU_FIRE , &processor );
+
+   CPPUNIT_ASSERT_EQUAL( queue.Consume( im ) , 4u );
+   CPPUNIT_ASSERT_EQUAL( processor._hits , 4u );
+   CPPUNIT_ASSERT_EQUAL( processor._types[0] , (unsigned char)PDU_FIRE );
+   CPPUNIT_ASSERT_EQUAL( processor._types[1] , (unsigned char)PDU_FIRE );
+   CPPUNIT_ASSERT_EQUAL( processor._latest[1] , 5u );
+   CPPUNIT_ASSERT_EQUAL( processor._latest[2] , 3u );
+
+   // nothing new
+   CPPUNIT_ASSERT_EQUAL( queue.Consume( im ) , 0u );
+
+   QueueEntityState( queue , 2 , 4 );
+   CPPUNIT_ASSERT_EQUAL( queue.Consume( im ) , 1u );
+   CPPUNIT_ASSERT_EQUAL( processor._latest[2] , 4u );
+   CPPUNIT_ASSERT_EQUAL( queue.GetDroppedCount() , 0ull );
+}
+
+void ConflatingQueueTests::TestEntityLimit()
+{
+   ConflatingQueueSettings settings;
+   settings.maxEntities = 3;
+   settings.eventCapacity = 2;
+
+   ConflatingQueue queue( settings );
+   for(unsigned short entity=0; entity<5; ++entity)
+   {
+      QueueEntityState( queue , entity , 1 );
+   }
+   CPPUNIT_ASSERT_EQUAL( queue.GetEntityCount() , 3u );
+   CPPUNIT_ASSERT_EQUAL( queue.GetDroppedCount() , 2ull );
+
+   FirePdu fire;
+   DataStream ds( BIG );
+   fire.marshal( ds );
+   for(unsigned int i=0; i<3; ++i)
+   {
+      queue.Process( &ds[0] , ds.size() , BIG );
+   }
+   CPPUNIT_ASSERT_EQUAL( queue.GetDroppedCount() , 3ull );
+
+   LatestProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.AddProcessor( PDU_FIRE , &processor );
+   CPPUNIT_ASSERT_EQUAL( queue.Consume( im , 4 ) , 4u );
+   CPPUNIT_ASSERT_EQUAL( queue.Consume( im ) , 1u );
+}
+
+void ConflatingQueueTests::TestConcurrentConsumer()
+{
+   const unsigned int ENTITIES = 50;
+   const unsigned int UPDATES = 2000;
+
+   ConflatingQueueSettings settings;
+   settings.maxEntities = ENTITIES;
+   ConflatingQueue queue( settings );
+
+   LatestProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+
+   std::atomic<bool> done( false );
+   std::thread consumer( [&]()
+   {
+      while( !done.load() )
+      {
+         queue.Consume( im );
+      }
+      queue.Consume( im );
+   } );
+
+   for(unsigned int update=1; update<=UPDATES; ++update)
+   {
+      for(unsigned short entity=0; entity<ENTITIES; ++entity)
+      {
+         QueueEntityState( queue , entity , update );
+      }
+   }
+   done.store( true );
+   consumer.join();
+
+   // every entity ends on its last update, and never goes back in time
+   CPPUNIT_ASSERT_EQUAL( processor._regressions , 0u );
+   CPPUNIT_ASSERT_EQUAL( (unsigned int)processor._latest.size() , ENTITIES );
+   for(unsigned short entity=0; entity<ENTITIES; ++entity)
+   {
+      CPPUNIT_ASSERT_EQUAL( processor._latest[entity] , UPDATES );
+   }
+   CPPUNIT_ASSERT_EQUAL( processor._hits + queue.GetConflatedCount() , (unsigned long long)ENTITIES * UPDATES );
+   CPPUNIT_ASSERT_EQUAL( queue.GetDroppedCount() , 0ull );
+}
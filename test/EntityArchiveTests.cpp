@@ -0,0 +1,316 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/EntityArchiveWriter.h>   // for testing
+#include <utils/EntityArchiveReader.h>   // for testing
+#include <utils/RecordingReader.h>       // for usage
+#include <utils/RecordingWriter.h>       // for usage
+#include <utils/IPduViewProcessor.h>     // for usage
+#include <utils/DataStream.h>            // for usage
+#include <utils/PDUType.h>               // for usage
+#include <dis6/EntityStatePdu.h>         // for usage
+#include <dis6/FirePdu.h>                // for usage
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests the conversion of recordings to entity archives and back.
+   class EntityArchiveTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void setUp();
+      void tearDown();
+
+      void TestEncoding();
+      void TestColumns();
+      void TestRoundTrip();
+      void TestCorruptTemplate();
+
+      CPPUNIT_TEST_SUITE( EntityArchiveTests );
+         CPPUNIT_TEST( TestEncoding );
+         CPPUNIT_TEST( TestColumns );
+         CPPUNIT_TEST( TestRoundTrip );
+         CPPUNIT_TEST( TestCorruptTemplate );
+      CPPUNIT_TEST_SUITE_END();
+
+   private:
+      std::string _recording;
+      std::string _archive;
+   };
+
+   /// entity i moves along x at i meters per second and reports every 100ms.
+   /// every 10th update also has a fire PDU, and entity 3 changes its force half way through.
+   const unsigned int ARCHIVE_ENTITIES = 20;
+   const unsigned int ARCHIVE_UPDATES = 300;
+   const long long ARCHIVE_PERIOD = 100000000;
+   const long long ARCHIVE_START = 1000000000000LL;
+
+   /// keeps a copy of every PDU, with its reception.
+   class CopyingViewProcessor : public DIS::IPduViewProcessor
+   {
+   public:
+      void Process(const DIS::PduView& view, unsigned int /*worker*/)
+      {
+         _pdus.push_back( std::vector<char>( view.pdu , view.pdu + view.length ) );
+         _views.push_back( view );
+         _views.back().pdu = NULL;
+      }
+
+      std::vector< std::vector<char> > _pdus;
+      std::vector<DIS::PduView> _views;
+   };
+
+   /// read every PDU of a recording.
+   void ReadRecording(const std::string& path, CopyingViewProcessor& processor)
+   {
+      DIS::RecordingReader reader;
+      CPPUNIT_ASSERT( reader.Open( path ) );
+      DIS::PduView view;
+      while( reader.Next( view ) )
+      {
+         processor.Process( view , 0 );
+      }
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( EntityArchiveTests );
+
+void EntityArchiveTests::setUp()
+{
+   _recording = "/tmp/opendis_archive.disrec";
+   _archive = "/tmp/opendis_archive.disarc";
+
+   RecordingWriterSettings settings;
+   settings.chunkSize = 65536;
+   settings.chunkCount = 64;
+   settings.maxChunkAgeMs = 0;
+   settings.keyframeIntervalMs = 0;
+
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( writer.Open( _recording , settings ) );
+   ReceiveContext context;
+   context.sourceAddress = 0x0a000001;
+   context.sourcePort = 3000;
+   context.destinationAddress = 0xe0000001;
+   for(unsigned int update=0; update<ARCHIVE_UPDATES; ++update)
+   {
+      context.timestamp = ARCHIVE_START + update * ARCHIVE_PERIOD + ( update % 3 );
+      for(unsigned int entity=0; entity<ARCHIVE_ENTITIES; ++entity)
+      {
+         EntityStatePdu espdu;
+         espdu.setTimestamp( update * 1000 );
+         espdu.getEntityID().setSite( 1 );
+         espdu.getEntityID().setApplication( 1 );
+         espdu.getEntityID().setEntity( static_cast<unsigned short>( entity ) );
+         espdu.setForceId( ( entity == 3 && update >= ARCHIVE_UPDATES / 2 ) ? 2 : 1 );
+         espdu.getEntityLocation().setX( entity * ( update * ARCHIVE_PERIOD / 1e9 ) );
+         espdu.getEntityLocation().setY( -2000000.5 );
+         espdu.getEntityLocation().setZ( 4000000.25 );
+         espdu.getEntityLinearVelocity().setX( static_cast<float>( entity ) );
+         espdu.getEntityOrientation().setPsi( 0.5f );
+         espdu.setEntityAppearance( update < 100 ? 0 : 0x100 );
+         DataStream ds( BIG );
+         espdu.marshal( ds );
+         CPPUNIT_ASSERT( writer.Record( &ds[0] , ds.size() , context ) );
+
+         if( update % 10 == 0 )
+         {
+            FirePdu fire;
+            fire.getFiringEntityID().setEntity( static_cast<unsigned short>( entity ) );
+            DataStream fireStream( BIG );
+            fire.marshal( fireStream );
+            CPPUNIT_ASSERT( writer.Record( &fireStream[0] , fireStream.size() , context ) );
+         }
+      }
+   }
+   writer.Close();
+}
+
+void EntityArchiveTests::tearDown()
+{
+   remove( _recording.c_str() );
+   remove( _archive.c_str() );
+}
+
+void EntityArchiveTests::TestEncoding()
+{
+   const EntityArchiveEncoding encodings[] = { ARCHIVE_DELTA_OF_DELTA , ARCHIVE_DELTA , ARCHIVE_XOR , ARCHIVE_XOR_FLOAT , ARCHIVE_XOR_DOUBLE };
+   const uint64_t values[] = { 0 , 1 , 0xffffffffffffffffull , 0x8000000000000000ull , 0x4059000000000000ull ,
+                               0x4059000000000001ull , 0x3f800000 , 0x3f800000 , 42 , 0 };
+   const unsigned int count = sizeof(values) / sizeof(values[0]);
+
+   for(unsigned int e=0; e<5; ++e)
+   {
+      // the float encoding only keeps 32 bits.
+      const uint64_t mask = ( encodings[e] == ARCHIVE_XOR_FLOAT ) ? 0xffffffffull : ~0ull;
+      std::vector<char> column;
+      EntityArchiveCodec encoder;
+      for(unsigned int i=0; i<count; ++i)
+      {
+         PutArchiveValue( column , encodings[e] , encoder , values[i] & mask );
+      }
+
+      const char* in = &column[0];
+      const char* end = in + column.size();
+      EntityArchiveCodec decoder;
+      for(unsigned int i=0; i<count; ++i)
+      {
+         uint64_t value = 0;
+         CPPUNIT_ASSERT( GetArchiveValue( in , end , encodings[e] , decoder , value ) );
+         CPPUNIT_ASSERT_EQUAL( value , values[i] & mask );
+      }
+      uint64_t value = 0;
+      CPPUNIT_ASSERT( !GetArchiveValue( in , end , encodings[e] , decoder , value ) );
+   }
+
+   // an unchanged value, and a steady heartbeat, take one byte.
+   std::vector<char> column;
+   EntityArchiveCodec codec;
+   PutArchiveValue( column , ARCHIVE_XOR_DOUBLE , codec , 0x4059000000000000ull );
+   column.clear();
+   PutArchiveValue( column , ARCHIVE_XOR_DOUBLE , codec , 0x4059000000000000ull );
+   CPPUNIT_ASSERT_EQUAL( column.size() , (size_t)1 );
+   codec = EntityArchiveCodec();
+   PutArchiveValue( column , ARCHIVE_DELTA_OF_DELTA , codec , 1000000000000LL );
+   PutArchiveValue( column , ARCHIVE_DELTA_OF_DELTA , codec , 1000100000000LL );
+   column.clear();
+   PutArchiveValue( column , ARCHIVE_DELTA_OF_DELTA , codec , 1000200000000LL );
+   CPPUNIT_ASSERT_EQUAL( column.size() , (size_t)1 );
+}
+
+void EntityArchiveTests::TestColumns()
+{
+   RecordingReader recording;
+   CPPUNIT_ASSERT( recording.Open( _recording ) );
+   EntityArchiveWriter writer;
+   CPPUNIT_ASSERT_EQUAL( writer.Add( recording ) , recording.GetRecordCount() );
+   CPPUNIT_ASSERT_EQUAL( writer.GetTrackCount() , (size_t)ARCHIVE_ENTITIES );
+   CPPUNIT_ASSERT( writer.Write( _archive ) );
+
+   // the heartbeats shrink to a small part of the PDU bytes.
+   const unsigned long long pduBytes = ARCHIVE_UPDATES * ARCHIVE_ENTITIES * ENTITY_STATE_MIN_SIZE;
+   CPPUNIT_ASSERT( writer.GetArchiveSize() * 4 < pduBytes );
+
+   EntityArchiveReader archive;
+   CPPUNIT_ASSERT( archive.Open( _archive ) );
+   CPPUNIT_ASSERT_EQUAL( (unsigned long long)archive.GetSize() , writer.GetArchiveSize() );
+   CPPUNIT_ASSERT_EQUAL( archive.GetRecordCount() , recording.GetRecordCount() );
+   CPPUNIT_ASSERT_EQUAL( archive.GetFirstTimestamp() , recording.GetFirstTimestamp() );
+   CPPUNIT_ASSERT_EQUAL( archive.GetLastTimestamp() , recording.GetLastTimestamp() );
+   CPPUNIT_ASSERT_EQUAL( archive.GetTrackCount() , (size_t)ARCHIVE_ENTITIES );
+   CPPUNIT_ASSERT_EQUAL( archive.FindTrack( PduHeader::MakeEntityKey( 9 , 9 , 9 ) ) , archive.GetTrackCount() );
+
+   const size_t track = archive.FindTrack( PduHeader::MakeEntityKey( 1 , 1 , 3 ) );
+   CPPUNIT_ASSERT( track < archive.GetTrackCount() );
+   CPPUNIT_ASSERT_EQUAL( archive.GetTrack( track ).sampleCount , ARCHIVE_UPDATES );
+   CPPUNIT_ASSERT_EQUAL( archive.GetTrack( track ).templateCount , 2u );
+
+   std::vector<double> locations;
+   std::vector<long long> times;
+   std::vector<long long> appearances;
+   CPPUNIT_ASSERT( archive.ReadColumn( track , ARCHIVE_LOCATION_X , locations ) );
+   CPPUNIT_ASSERT( archive.ReadColumn( track , ARCHIVE_TIME , times ) );
+   CPPUNIT_ASSERT( archive.ReadColumn( track , ARCHIVE_APPEARANCE , appearances ) );
+   CPPUNIT_ASSERT_EQUAL( locations.size() , (size_t)ARCHIVE_UPDATES );
+   for(unsigned int update=0; update<ARCHIVE_UPDATES; ++update)
+   {
+      CPPUNIT_ASSERT_EQUAL( locations[update] , 3 * ( update * ARCHIVE_PERIOD / 1e9 ) );
+      CPPUNIT_ASSERT_EQUAL( times[update] , ARCHIVE_START + update * ARCHIVE_PERIOD + ( update % 3 ) );
+      CPPUNIT_ASSERT_EQUAL( appearances[update] , update < 100 ? 0ll : 0x100ll );
+   }
+
+   std::vector<double> velocities;
+   CPPUNIT_ASSERT( archive.ReadColumn( track , ARCHIVE_VELOCITY_X , velocities ) );
+   CPPUNIT_ASSERT_EQUAL( velocities.back() , 3.0 );
+
+   // the columns are read as what they hold.
+   CPPUNIT_ASSERT( !archive.ReadColumn( track , ARCHIVE_TIME , locations ) );
+   CPPUNIT_ASSERT( !archive.ReadColumn( track , ARCHIVE_PSI , times ) );
+   CPPUNIT_ASSERT( !archive.ReadColumn( archive.GetTrackCount() , ARCHIVE_TIME , times ) );
+}
+
+void EntityArchiveTests::TestRoundTrip()
+{
+   {
+      RecordingReader recording;
+      CPPUNIT_ASSERT( recording.Open( _recording ) );
+      EntityArchiveWriter writer;
+      writer.Add( recording );
+      CPPUNIT_ASSERT( writer.Write( _archive ) );
+   }
+
+   CopyingViewProcessor original;
+   ReadRecording( _recording , original );
+
+   // every PDU is rebuilt exactly, in the recorded order.
+   EntityArchiveReader archive;
+   CPPUNIT_ASSERT( archive.Open( _archive ) );
+   CopyingViewProcessor rebuilt;
+   CPPUNIT_ASSERT_EQUAL( archive.Process( rebuilt ) , (unsigned long long)original._pdus.size() );
+   for(size_t i=0; i<original._pdus.size(); ++i)
+   {
+      CPPUNIT_ASSERT( rebuilt._pdus[i] == original._pdus[i] );
+      CPPUNIT_ASSERT_EQUAL( rebuilt._views[i].timestamp , original._views[i].timestamp );
+      CPPUNIT_ASSERT_EQUAL( rebuilt._views[i].sourceAddress , original._views[i].sourceAddress );
+      CPPUNIT_ASSERT_EQUAL( rebuilt._views[i].sourcePort , original._views[i].sourcePort );
+      CPPUNIT_ASSERT_EQUAL( rebuilt._views[i].destinationAddress , original._views[i].destinationAddress );
+   }
+
+   // and written back to a recording, through a writer with few chunk buffers.
+   const std::string restored = "/tmp/opendis_archive_restored.disrec";
+   RecordingWriterSettings settings;
+   settings.chunkSize = 16384;
+   settings.chunkCount = 2;
+   settings.maxChunkAgeMs = 0;
+   CPPUNIT_ASSERT( archive.Restore( restored , settings ) );
+   CopyingViewProcessor reread;
+   ReadRecording( restored , reread );
+   CPPUNIT_ASSERT( reread._pdus == original._pdus );
+   remove( restored.c_str() );
+
+   // a file that is not an archive.
+   CPPUNIT_ASSERT( !archive.Open( _recording ) );
+   CPPUNIT_ASSERT( !archive.IsOpen() );
+}
+
+void EntityArchiveTests::TestCorruptTemplate()
+{
+   {
+      RecordingReader recording;
+      CPPUNIT_ASSERT( recording.Open( _recording ) );
+      EntityArchiveWriter writer;
+      writer.Add( recording );
+      CPPUNIT_ASSERT( writer.Write( _archive ) );
+   }
+
+   // shorten the first template of the first track, so that its samples would be written past it.
+   FILE* file = fopen( _archive.c_str() , "r+b" );
+   CPPUNIT_ASSERT( file != NULL );
+   EntityArchiveTrack track;
+   CPPUNIT_ASSERT_EQUAL( 0 , fseek( file , sizeof(EntityArchiveHeader) , SEEK_SET ) );
+   CPPUNIT_ASSERT_EQUAL( (size_t)1 , fread( &track , sizeof(track) , 1 , file ) );
+   const uint16_t length = 20;
+   CPPUNIT_ASSERT_EQUAL( 0 , fseek( file , track.offset + offsetof( EntityArchiveTemplate , length ) , SEEK_SET ) );
+   CPPUNIT_ASSERT_EQUAL( (size_t)1 , fwrite( &length , sizeof(length) , 1 , file ) );
+   fclose( file );
+
+   // the damaged track is skipped, and the others are rebuilt.
+   EntityArchiveReader archive;
+   CPPUNIT_ASSERT( archive.Open( _archive ) );
+   CopyingViewProcessor rebuilt;
+   CPPUNIT_ASSERT_EQUAL( archive.Process( rebuilt ) , archive.GetRecordCount() - track.sampleCount );
+   for(size_t i=0; i<rebuilt._pdus.size(); ++i)
+   {
+      const std::vector<char>& pdu = rebuilt._pdus[i];
+      CPPUNIT_ASSERT( PduHeader::GetPduType( &pdu[0] ) != PDU_ENTITY_STATE || pdu.size() >= ENTITY_STATE_MIN_SIZE );
+   }
+}
@@ -0,0 +1,73 @@
+/// Copyright goes here
+/// License goes here
+
+#ifndef _dis_field_layout_check_h_
+#define _dis_field_layout_check_h_
+
+#include <utils/FieldAlgorithms.h>
+#include <utils/PduTypeList.h>
+#include <utils/DataStream.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// checks the field visitors of each class of a PDU registry against its marshal functions.
+   /// included by the tests of the dis6 and of the dis7 visitors, whose classes have the same names.
+   struct FieldLayoutCheck
+   {
+      FieldLayoutCheck()
+         : checked(0)
+         , failures()
+      {
+      }
+
+      /// the fields must add up to getMarshalledSize() and to the bytes marshalled,
+      /// and follow each other with neither gaps nor overlaps.
+      template<typename Entry>
+      void Call()
+      {
+         typedef typename Entry::PduClass PduClass;
+         const PduClass pdu;
+         DIS::DataStream ds( DIS::BIG );
+         pdu.marshal( ds );
+
+         std::vector<DIS::FieldOffset> offsets;
+         const unsigned int total = DIS::GetFieldOffsets( pdu , offsets );
+         const unsigned int marshalled = static_cast<unsigned int>( ds.size() );
+
+         std::ostringstream failure;
+         if( total != static_cast<unsigned int>( pdu.getMarshalledSize() ) || total != marshalled )
+         {
+            failure << "type " << static_cast<int>( Entry::TYPE ) << ": the fields have " << total
+                    << " bytes, getMarshalledSize() " << pdu.getMarshalledSize()
+                    << " and marshal() " << marshalled << ". ";
+         }
+
+         unsigned int end = 0;
+         for(size_t i=0; i<offsets.size(); ++i)
+         {
+            if( offsets[i].offset != end )
+            {
+               failure << "type " << static_cast<int>( Entry::TYPE ) << ": " << offsets[i].path
+                       << " is at " << offsets[i].offset << " rather than " << end << ". ";
+               break;
+            }
+            end += offsets[i].size;
+         }
+
+         if( !failure.str().empty() )
+         {
+            failures.push_back( failure.str() );
+         }
+         ++checked;
+      }
+
+      unsigned int checked;
+      std::vector<std::string> failures;
+   };
+}
+
+#endif // _dis_field_layout_check_h_
@@ -0,0 +1,43 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <dis7/Fields.h>              // for testing
+#include <dis7/PduRegistry.h>         // for usage
+#include "FieldLayoutCheck.h"         // for usage
+
+#include <string>
+
+namespace TestDIS
+{
+   /// tests the generated field visitors of the DIS 7 classes.
+   /// built against OpenDIS7 rather than with the DIS 6 tests, whose classes have the same names.
+   class Fields7Tests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestRegistryLayouts();
+
+      CPPUNIT_TEST_SUITE( Fields7Tests );
+         CPPUNIT_TEST( TestRegistryLayouts );
+      CPPUNIT_TEST_SUITE_END();
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( Fields7Tests );
+
+void Fields7Tests::TestRegistryLayouts()
+{
+   FieldLayoutCheck check;
+   PduTypeListForEach<PduRegistry>::Apply( check );
+   CPPUNIT_ASSERT_EQUAL( PduRegistry::SIZE , check.checked );
+
+   std::string failures;
+   for(size_t i=0; i<check.failures.size(); ++i)
+   {
+      failures += check.failures[i];
+   }
+   CPPUNIT_ASSERT_EQUAL( std::string() , failures );
+}
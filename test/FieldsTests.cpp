@@ -0,0 +1,166 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <dis6/Fields.h>              // for testing
+#include <dis6/PduRegistry.h>         // for usage
+#include <utils/FieldAlgorithms.h>    // for testing
+#include <utils/DataStream.h>         // for usage
+#include "FieldLayoutCheck.h"         // for usage
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests the generic algorithms on the generated field visitors.
+   class FieldsTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestOffsets();
+      void TestEqualAndHash();
+      void TestDiff();
+      void TestJson();
+      void TestRegistryLayouts();
+
+      CPPUNIT_TEST_SUITE( FieldsTests );
+         CPPUNIT_TEST( TestOffsets );
+         CPPUNIT_TEST( TestEqualAndHash );
+         CPPUNIT_TEST( TestDiff );
+         CPPUNIT_TEST( TestJson );
+         CPPUNIT_TEST( TestRegistryLayouts );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   DIS::EntityStatePdu MakeEntityState(unsigned int articulations)
+   {
+      DIS::EntityStatePdu pdu;
+      pdu.getEntityID().setSite( 1 );
+      pdu.getEntityID().setApplication( 2 );
+      pdu.getEntityID().setEntity( 3 );
+      pdu.getEntityLocation().setX( 1000.5 );
+      pdu.getMarking().setByStringCharacters( "TANK" );
+      for(unsigned int i=0; i<articulations; ++i)
+      {
+         DIS::ArticulationParameter parameter;
+         parameter.setParameterType( 4096 + i );
+         parameter.setParameterValue( 0.5 * i );
+         pdu.getArticulationParameters().push_back( parameter );
+      }
+      return pdu;
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( FieldsTests );
+
+void FieldsTests::TestOffsets()
+{
+   const EntityStatePdu pdu = MakeEntityState( 2 );
+   DataStream ds( BIG );
+   pdu.marshal( ds );
+
+   std::vector<FieldOffset> offsets;
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned int>( ds.size() ) , GetFieldOffsets( pdu , offsets ) );
+
+   // the header, then the fields of the entity state, then the list.
+   CPPUNIT_ASSERT_EQUAL( std::string( "protocolVersion" ) , offsets.front().path );
+   CPPUNIT_ASSERT_EQUAL( std::string( "entityID.site" ) , offsets[7].path );
+   CPPUNIT_ASSERT_EQUAL( 12u , offsets[7].offset );
+   CPPUNIT_ASSERT_EQUAL( 2u , offsets[7].size );
+   CPPUNIT_ASSERT_EQUAL( std::string( "numberOfArticulationParameters" ) , offsets[11].path );
+   CPPUNIT_ASSERT_EQUAL( 19u , offsets[11].offset );
+   CPPUNIT_ASSERT_EQUAL( std::string( "marking.characters" ) , offsets[offsets.size() - 12].path );
+   CPPUNIT_ASSERT_EQUAL( 11u , offsets[offsets.size() - 12].size );
+
+   const FieldOffset& last = offsets.back();
+   CPPUNIT_ASSERT_EQUAL( std::string( "articulationParameters[1].parameterValue" ) , last.path );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned int>( ds.size() ) , last.offset + last.size );
+}
+
+void FieldsTests::TestEqualAndHash()
+{
+   const EntityStatePdu a = MakeEntityState( 2 );
+   EntityStatePdu b = MakeEntityState( 2 );
+   CPPUNIT_ASSERT( FieldsEqual( a , b ) );
+   CPPUNIT_ASSERT_EQUAL( HashFields( a ) , HashFields( b ) );
+
+   b.getArticulationParameters()[1].setParameterValue( 7.0 );
+   CPPUNIT_ASSERT( !FieldsEqual( a , b ) );
+   CPPUNIT_ASSERT( HashFields( a ) != HashFields( b ) );
+
+   // lists of different sizes are never equal.
+   const EntityStatePdu shorter = MakeEntityState( 1 );
+   CPPUNIT_ASSERT( !FieldsEqual( a , shorter ) );
+   CPPUNIT_ASSERT( !FieldsEqual( shorter , a ) );
+}
+
+void FieldsTests::TestDiff()
+{
+   const EntityStatePdu a = MakeEntityState( 2 );
+   EntityStatePdu b = MakeEntityState( 2 );
+
+   std::vector<std::string> paths;
+   DiffFields( a , b , paths );
+   CPPUNIT_ASSERT( paths.empty() );
+
+   b.getEntityLocation().setY( 3.0 );
+   b.getMarking().setByStringCharacters( "JEEP" );
+   b.getArticulationParameters()[0].setParameterType( 1 );
+   DiffFields( a , b , paths );
+   CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( 3 ) , paths.size() );
+   CPPUNIT_ASSERT_EQUAL( std::string( "entityLocation.y" ) , paths[0] );
+   CPPUNIT_ASSERT_EQUAL( std::string( "marking.characters" ) , paths[1] );
+   CPPUNIT_ASSERT_EQUAL( std::string( "articulationParameters[0].parameterType" ) , paths[2] );
+
+   // a list of another size is named once, with its count and the length of the PDU.
+   paths.clear();
+   DiffFields( a , MakeEntityState( 3 ) , paths );
+   CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( 3 ) , paths.size() );
+   CPPUNIT_ASSERT_EQUAL( std::string( "length" ) , paths[0] );
+   CPPUNIT_ASSERT_EQUAL( std::string( "numberOfArticulationParameters" ) , paths[1] );
+   CPPUNIT_ASSERT_EQUAL( std::string( "articulationParameters" ) , paths[2] );
+}
+
+void FieldsTests::TestJson()
+{
+   Vector3Double location;
+   location.setX( 1.5 );
+   location.setY( -2 );
+   location.setZ( 0.1 );
+
+   std::ostringstream os;
+   WriteFieldsJson( os , location );
+   CPPUNIT_ASSERT_EQUAL( std::string( "{\"x\":1.5,\"y\":-2,\"z\":0.10000000000000001}" ) , os.str() );
+
+   Marking marking;
+   marking.setByStringCharacters( "AB" );
+   os.str( "" );
+   WriteFieldsJson( os , marking );
+   CPPUNIT_ASSERT_EQUAL( std::string( "{\"characterSet\":0,\"characters\":[65,66,0,0,0,0,0,0,0,0,0]}" ) , os.str() );
+
+   // nested records and lists.
+   os.str( "" );
+   WriteFieldsJson( os , MakeEntityState( 1 ) );
+   const std::string json = os.str();
+   CPPUNIT_ASSERT( json.find( "\"entityID\":{\"site\":1,\"application\":2,\"entity\":3}" ) != std::string::npos );
+   CPPUNIT_ASSERT( json.find( "\"articulationParameters\":[{\"parameterTypeDesignator\":0," ) != std::string::npos );
+   CPPUNIT_ASSERT_EQUAL( '}' , json[json.size() - 1] );
+}
+
+void FieldsTests::TestRegistryLayouts()
+{
+   FieldLayoutCheck check;
+   PduTypeListForEach<PduRegistry>::Apply( check );
+   CPPUNIT_ASSERT_EQUAL( PduRegistry::SIZE , check.checked );
+
+   std::string failures;
+   for(size_t i=0; i<check.failures.size(); ++i)
+   {
+      failures += check.failures[i];
+   }
+   CPPUNIT_ASSERT_EQUAL( std::string() , failures );
+}
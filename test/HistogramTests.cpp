@@ -0,0 +1,112 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/Histogram.h>         // for testing
+
+namespace TestDIS
+{
+   /// tests the buckets and percentiles of the latency histogram.
+   class HistogramTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestBuckets();
+      void TestPercentiles();
+      void TestMerge();
+
+      CPPUNIT_TEST_SUITE( HistogramTests );
+         CPPUNIT_TEST( TestBuckets );
+         CPPUNIT_TEST( TestPercentiles );
+         CPPUNIT_TEST( TestMerge );
+      CPPUNIT_TEST_SUITE_END();
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( HistogramTests );
+
+void HistogramTests::TestBuckets()
+{
+   // small values have a bucket each.
+   for(unsigned long long value=0; value<Histogram::SUB_BUCKETS; ++value)
+   {
+      CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( value ) , Histogram::GetBucket( value ) );
+   }
+
+   // every bucket counts the values between its bounds, and is no wider than its share of the value.
+   for(size_t bucket=0; bucket+1<Histogram::BUCKET_COUNT; ++bucket)
+   {
+      const unsigned long long lowest = Histogram::GetBucketLowest( bucket );
+      const unsigned long long highest = Histogram::GetBucketHighest( bucket );
+      CPPUNIT_ASSERT( lowest <= highest );
+      CPPUNIT_ASSERT_EQUAL( bucket , Histogram::GetBucket( lowest ) );
+      CPPUNIT_ASSERT_EQUAL( bucket , Histogram::GetBucket( highest ) );
+      CPPUNIT_ASSERT_EQUAL( highest + 1 , Histogram::GetBucketLowest( bucket + 1 ) );
+      CPPUNIT_ASSERT( highest - lowest <= lowest / Histogram::SUB_BUCKETS );
+   }
+
+   CPPUNIT_ASSERT_EQUAL( Histogram::BUCKET_COUNT - 1 , Histogram::GetBucket( ~0ull ) );
+   CPPUNIT_ASSERT_EQUAL( ~0ull , Histogram::GetBucketHighest( Histogram::BUCKET_COUNT - 1 ) );
+}
+
+void HistogramTests::TestPercentiles()
+{
+   Histogram histogram;
+   CPPUNIT_ASSERT_EQUAL( 0ull , histogram.GetPercentile( 50 ) );
+   CPPUNIT_ASSERT_EQUAL( 0.0 , histogram.GetMean() );
+
+   // 1 to 1000 once each.
+   for(unsigned long long value=1; value<=1000; ++value)
+   {
+      histogram.Record( value );
+   }
+   CPPUNIT_ASSERT_EQUAL( 1000ull , histogram.GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 1ull , histogram.GetMin() );
+   CPPUNIT_ASSERT_EQUAL( 1000ull , histogram.GetMax() );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( 500.5 , histogram.GetMean() , 1e-9 );
+
+   // the exact buckets give exact percentiles, the others are within a bucket above the value.
+   CPPUNIT_ASSERT_EQUAL( 1ull , histogram.GetPercentile( 0 ) );
+   CPPUNIT_ASSERT_EQUAL( 10ull , histogram.GetPercentile( 1 ) );
+   const unsigned long long median = histogram.GetPercentile( 50 );
+   CPPUNIT_ASSERT( median >= 500 && median <= 500 + 500 / Histogram::SUB_BUCKETS );
+   const unsigned long long p99 = histogram.GetPercentile( 99 );
+   CPPUNIT_ASSERT( p99 >= 990 && p99 <= 990 + 990 / Histogram::SUB_BUCKETS );
+   CPPUNIT_ASSERT_EQUAL( 999ull , histogram.GetPercentile( 99.9 ) );
+   CPPUNIT_ASSERT_EQUAL( 1000ull , histogram.GetPercentile( 100 ) );
+
+   // a rare outlier shows only in the highest percentiles.
+   histogram.Reset();
+   histogram.Record( 20000 , 9990 );
+   histogram.Record( 5000000 , 10 );
+   CPPUNIT_ASSERT( histogram.GetPercentile( 99 ) <= 20000 + 20000 / Histogram::SUB_BUCKETS );
+   CPPUNIT_ASSERT( histogram.GetPercentile( 99.9 ) <= 20000 + 20000 / Histogram::SUB_BUCKETS );
+   CPPUNIT_ASSERT_EQUAL( 5000000ull , histogram.GetPercentile( 99.95 ) );
+   CPPUNIT_ASSERT_EQUAL( 10000ull , histogram.GetCount() );
+}
+
+void HistogramTests::TestMerge()
+{
+   Histogram low;
+   Histogram high;
+   low.Record( 10 , 3 );
+   high.Record( 1000000 );
+
+   Histogram total;
+   total.Merge( low );
+   total.Merge( high );
+   total.Merge( Histogram() );
+   CPPUNIT_ASSERT_EQUAL( 4ull , total.GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 10ull , total.GetMin() );
+   CPPUNIT_ASSERT_EQUAL( 1000000ull , total.GetMax() );
+   CPPUNIT_ASSERT_EQUAL( 3ull , total.GetBucketCount( 10 ) );
+   CPPUNIT_ASSERT_EQUAL( 10ull , total.GetPercentile( 75 ) );
+   CPPUNIT_ASSERT_EQUAL( 1000000ull , total.GetPercentile( 76 ) );
+
+   total.Reset();
+   CPPUNIT_ASSERT_EQUAL( 0ull , total.GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 0ull , total.GetMax() );
+   CPPUNIT_ASSERT_EQUAL( 0ull , total.GetBucketCount( 10 ) );
+}
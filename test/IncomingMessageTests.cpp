@@ -7,10 +7,13 @@
 #include <DIS/IncomingMessage.h>    // for testing
 #include <DIS/DataStream.h>         // for usage
 #include <DIS/IPacketProcessor.h>   // for usage
+#include <DIS/IPduFilter.h>         // for usage
 #include <DIS/EntityStatePdu.h>     // for usage
 #include <DIS/DetonationPdu.h>     // for usage
 #include <DIS/CollisionPdu.h>     // for usage
 #include <DIS/PDUType.h>
+#include <DIS/PduHeader.h>         // for usage
+#include <DIS/Tracepoints.h>       // for usage
 #include "PduUtils.h"
 
 namespace TestDIS
@@ -27,12 +30,20 @@ namespace TestDIS
 
       void TestEntityStateThenDetonation();
       void TestCollisionThenEntityState();
+      void TestFilter();
+      void TestBundleContext();
+      void TestStatistics();
+      void TestTracepoints();
 
       CPPUNIT_TEST_SUITE( IMTests );
          CPPUNIT_TEST( TestAddRemoveProcessor );
          CPPUNIT_TEST( TestObserving );
          CPPUNIT_TEST( TestEntityStateThenDetonation );
          CPPUNIT_TEST( TestCollisionThenEntityState );
+         CPPUNIT_TEST( TestFilter );
+         CPPUNIT_TEST( TestBundleContext );
+         CPPUNIT_TEST( TestStatistics );
+         CPPUNIT_TEST( TestTracepoints );
       CPPUNIT_TEST_SUITE_END();
 
    protected:
@@ -59,7 +70,7 @@ namespace TestDIS
       DIS::PDUType GetRegisteredType() const { return mPduType; }
 
       /// test casting to a concrete type
-      void Process(const DIS::Pdu& packet)
+      void Process(const DIS::Pdu& /*packet*/)
       {
          //const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
          //espdu.getEntityAppearance();
@@ -69,6 +80,36 @@ namespace TestDIS
    private:
       HitProcessor(); ///< not implemented by design
    };
+
+   /// remembers the context of the last PDU
+   class ContextProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      std::vector<DIS::ReceiveContext> _contexts;
+
+      void Process(const DIS::Pdu& /*packet*/) {}
+
+      void Process(const DIS::Pdu& /*packet*/, const DIS::ReceiveContext& context)
+      {
+         _contexts.push_back( context );
+      }
+   };
+
+   /// rejects every PDU of one type
+   class TypeFilter : public DIS::IPduFilter
+   {
+   public:
+      unsigned char _rejected;
+      unsigned int _calls;
+
+      TypeFilter(unsigned char rejected) : _rejected(rejected), _calls(0) {}
+
+      bool Accept(const char* buf, unsigned int /*length*/, const DIS::ReceiveContext& /*context*/)
+      {
+         _calls++;
+         return( static_cast<unsigned char>( buf[2] ) != _rejected );
+      }
+   };
 }
 
 using namespace TestDIS;
@@ -165,6 +206,174 @@ void IMTests::TestCollisionThenEntityState()
    TestMultiplePackets( colpdu , espdu );
 }
 
+void IMTests::TestFilter()
+{
+   DIS::EntityStatePdu espdu;
+   TestDIS::InitPDU( espdu );
+
+   DIS::DetonationPdu detpdu;
+   TestDIS::InitPDU( detpdu );
+
+   HitProcessor hp_es(DIS::PDU_ENTITY_STATE);
+   HitProcessor hp_dt(DIS::PDU_DETONATION);
+   TypeFilter filter( DIS::PDU_ENTITY_STATE );
+
+   IncomingMessage im;
+   im.AddProcessor( hp_es.GetRegisteredType() , &hp_es );
+   im.AddProcessor( hp_dt.GetRegisteredType() , &hp_dt );
+   CPPUNIT_ASSERT( im.AddFilter( &filter ) );
+   CPPUNIT_ASSERT( !im.AddFilter( &filter ) );
+   CPPUNIT_ASSERT_EQUAL( im.GetFilters().size() , size_t(1) );
+
+   // the skipped entity state PDU must not disturb the PDU bundled after it
+   DIS::DataStream ds(DIS::BIG);
+   espdu.marshal( ds );
+   detpdu.marshal( ds );
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian() );
+
+   CPPUNIT_ASSERT_EQUAL( filter._calls , (unsigned int)2 );
+   CPPUNIT_ASSERT_EQUAL( hp_es._hits , (unsigned int)0 );
+   CPPUNIT_ASSERT_EQUAL( hp_dt._hits , (unsigned int)1 );
+
+   CPPUNIT_ASSERT( im.RemoveFilter( &filter ) );
+   CPPUNIT_ASSERT( !im.RemoveFilter( &filter ) );
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian() );
+   CPPUNIT_ASSERT_EQUAL( hp_es._hits , (unsigned int)1 );
+   CPPUNIT_ASSERT_EQUAL( hp_dt._hits , (unsigned int)2 );
+}
+
+void IMTests::TestBundleContext()
+{
+   DIS::EntityStatePdu espdu;
+   TestDIS::InitPDU( espdu );
+
+   ContextProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( espdu.getPduType() , &processor );
+
+   DIS::DataStream ds(DIS::BIG);
+   espdu.marshal( ds );
+   espdu.marshal( ds );
+
+   DIS::ReceiveContext context;
+   context.sourcePort = 3000;
+   context.timestamp = 42;
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian(), context );
+
+   CPPUNIT_ASSERT_EQUAL( processor._contexts.size() , size_t(2) );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[0].pduOffset , 0u );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[0].pduIndex , 0u );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[1].pduOffset , (unsigned int)espdu.getMarshalledSize() );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[1].pduIndex , 1u );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[1].sourcePort , (unsigned short)3000 );
+   CPPUNIT_ASSERT_EQUAL( processor._contexts[1].timestamp , 42LL );
+}
+
+void IMTests::TestStatistics()
+{
+   DIS::EntityStatePdu espdu;
+   TestDIS::InitPDU( espdu );
+   espdu.setLength( espdu.getMarshalledSize() );
+
+   DIS::DetonationPdu detpdu;
+   TestDIS::InitPDU( detpdu );
+   detpdu.setLength( detpdu.getMarshalledSize() );
+
+   DIS::CollisionPdu colpdu;
+   TestDIS::InitPDU( colpdu );
+   colpdu.setLength( colpdu.getMarshalledSize() );
+
+   HitProcessor hp_es(DIS::PDU_ENTITY_STATE);
+   HitProcessor hp_dt(DIS::PDU_DETONATION);
+   HitProcessor hp_es2(DIS::PDU_ENTITY_STATE);
+   TypeFilter filter( DIS::PDU_DETONATION );
+
+   IncomingMessage im;
+   im.AddProcessor( DIS::PDU_ENTITY_STATE , &hp_es );
+   im.AddProcessor( DIS::PDU_ENTITY_STATE , &hp_es2 );
+   im.AddProcessor( DIS::PDU_DETONATION , &hp_dt );
+   im.AddProcessor( 200 , &hp_dt );
+   CPPUNIT_ASSERT( !im.IsTimingEnabled() );
+   im.SetTimingEnabled( true );
+
+   // two entity states, a collision nobody listens to, and a detonation.
+   DIS::DataStream ds(DIS::BIG);
+   espdu.marshal( ds );
+   espdu.marshal( ds );
+   colpdu.marshal( ds );
+   detpdu.marshal( ds );
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian() );
+
+   // the detonation is filtered.
+   im.AddFilter( &filter );
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian() );
+   im.RemoveFilter( &filter );
+
+   // a type the library does not know.
+   std::vector<char> unknown( 16 , 0 );
+   unknown[PDU_TYPE_POSITION] = char(200);
+   unknown[PDU_LENGTH_POSITION + 1] = 16;
+   im.Process( &unknown[0], unknown.size(), DIS::BIG );
+
+   // an entity state cut short, and a header cut short.
+   DIS::DataStream truncated(DIS::BIG);
+   espdu.marshal( truncated );
+   im.Process( &(truncated[0]), 100, DIS::BIG );
+   im.Process( &(truncated[0]), 8, DIS::BIG );
+
+   const IncomingStatistics statistics = im.GetStatistics();
+   CPPUNIT_ASSERT_EQUAL( 5ULL , statistics.buffers );
+   CPPUNIT_ASSERT_EQUAL( 2ULL * ds.size() + 16 + 100 + 8 , statistics.bytes );
+   CPPUNIT_ASSERT_EQUAL( size_t(PDU_TYPE_COUNT) , statistics.types.size() );
+
+   const PduTypeStatistics& es = statistics.types[DIS::PDU_ENTITY_STATE];
+   CPPUNIT_ASSERT_EQUAL( 6ULL , es.pdus );
+   CPPUNIT_ASSERT_EQUAL( 4ULL * espdu.getMarshalledSize() + 100 + 8 , es.bytes );
+   CPPUNIT_ASSERT_EQUAL( 2ULL , es.decodeFailures );
+   CPPUNIT_ASSERT_EQUAL( 0ULL , es.filtered );
+   CPPUNIT_ASSERT( es.decodeNanoseconds > 0 );
+
+   const PduTypeStatistics& det = statistics.types[DIS::PDU_DETONATION];
+   CPPUNIT_ASSERT_EQUAL( 2ULL , det.pdus );
+   CPPUNIT_ASSERT_EQUAL( 1ULL , det.filtered );
+   CPPUNIT_ASSERT_EQUAL( 0ULL , det.decodeFailures );
+
+   const PduTypeStatistics& col = statistics.types[DIS::PDU_COLLISION];
+   CPPUNIT_ASSERT_EQUAL( 2ULL , col.pdus );
+   CPPUNIT_ASSERT_EQUAL( 2ULL , col.unhandled );
+   CPPUNIT_ASSERT_EQUAL( 2ULL * colpdu.getMarshalledSize() , col.bytes );
+
+   CPPUNIT_ASSERT_EQUAL( 1ULL , statistics.types[200].pdus );
+   CPPUNIT_ASSERT_EQUAL( 1ULL , statistics.types[200].unknown );
+
+   // the processors in registration order for each type.
+   CPPUNIT_ASSERT_EQUAL( size_t(4) , statistics.processors.size() );
+   CPPUNIT_ASSERT( statistics.processors[0].processor == &hp_es );
+   CPPUNIT_ASSERT_EQUAL( 4ULL , statistics.processors[0].calls );
+   CPPUNIT_ASSERT( statistics.processors[1].processor == &hp_es2 );
+   CPPUNIT_ASSERT_EQUAL( 4ULL , statistics.processors[1].calls );
+   CPPUNIT_ASSERT( statistics.processors[2].processor == &hp_dt );
+   CPPUNIT_ASSERT_EQUAL( (unsigned char)DIS::PDU_DETONATION , statistics.processors[2].pduType );
+   CPPUNIT_ASSERT_EQUAL( 1ULL , statistics.processors[2].calls );
+   CPPUNIT_ASSERT_EQUAL( (unsigned char)200 , statistics.processors[3].pduType );
+   CPPUNIT_ASSERT_EQUAL( 0ULL , statistics.processors[3].calls );
+   CPPUNIT_ASSERT_EQUAL( hp_es._hits , 4u );
+
+   // a removed processor is no longer counted.
+   im.RemoveProcessor( DIS::PDU_ENTITY_STATE , &hp_es2 );
+   CPPUNIT_ASSERT_EQUAL( size_t(3) , im.GetStatistics().processors.size() );
+
+   // a processor inserted directly into the container is called without counters,
+   // and the processors added before it are still counted.
+   im.GetProcessors().insert( std::make_pair( static_cast<unsigned char>( DIS::PDU_ENTITY_STATE ) , static_cast<DIS::IPacketProcessor*>( &hp_es2 ) ) );
+   const unsigned int hits = hp_es2._hits;
+   DIS::DataStream one(DIS::BIG);
+   espdu.marshal( one );
+   im.Process( &(one[0]), one.size(), DIS::BIG );
+   CPPUNIT_ASSERT_EQUAL( hits + 1 , hp_es2._hits );
+   CPPUNIT_ASSERT_EQUAL( 5ULL , im.GetStatistics().processors[0].calls );
+}
+
 template<typename PduT1, typename PduT2>
 void IMTests::TestMultiplePackets(const PduT1& src1, const PduT2& src2)
 {
@@ -208,3 +417,51 @@ void IMTests::TestMultiplePackets(const PduT1& src1, const PduT2& src2)
    im.RemoveProcessor( hp_dt.GetRegisteredType() , &hp_dt );
 }
 
+
+#if defined(DIS_TRACEPOINTS)
+extern "C"
+{
+   extern volatile unsigned short opendis_datagram_semaphore;
+   extern volatile unsigned short opendis_header_semaphore;
+   extern volatile unsigned short opendis_unmarshal_begin_semaphore;
+   extern volatile unsigned short opendis_unmarshal_end_semaphore;
+   extern volatile unsigned short opendis_dispatch_semaphore;
+}
+#endif
+
+void IMTests::TestTracepoints()
+{
+#if defined(DIS_TRACEPOINTS)
+   // attach to every tracepoint, as a tracing tool does.
+   volatile unsigned short* semaphores[] = { &opendis_datagram_semaphore , &opendis_header_semaphore ,
+                                             &opendis_unmarshal_begin_semaphore , &opendis_unmarshal_end_semaphore ,
+                                             &opendis_dispatch_semaphore };
+   for(size_t i=0; i<sizeof(semaphores)/sizeof(semaphores[0]); ++i)
+   {
+      ++*semaphores[i];
+   }
+
+   DIS::EntityStatePdu espdu;
+   TestDIS::InitPDU( espdu );
+   espdu.setLength( espdu.getMarshalledSize() );
+   HitProcessor hp_es(DIS::PDU_ENTITY_STATE);
+
+   IncomingMessage im;
+   im.AddProcessor( DIS::PDU_ENTITY_STATE , &hp_es );
+
+   // the PDUs are handled the same way, including a truncated one.
+   DIS::DataStream ds(DIS::BIG);
+   espdu.marshal( ds );
+   espdu.marshal( ds );
+   im.Process( &(ds[0]), ds.size(), ds.GetStreamEndian() );
+   im.Process( &(ds[0]), 100, ds.GetStreamEndian() );
+   CPPUNIT_ASSERT_EQUAL( 2u , hp_es._hits );
+   CPPUNIT_ASSERT_EQUAL( 1ULL , im.GetStatistics().types[DIS::PDU_ENTITY_STATE].decodeFailures );
+
+   im.RemoveProcessor( DIS::PDU_ENTITY_STATE , &hp_es );
+   for(size_t i=0; i<sizeof(semaphores)/sizeof(semaphores[0]); ++i)
+   {
+      --*semaphores[i];
+   }
+#endif
+}
@@ -0,0 +1,270 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/PcapReader.h>        // for testing
+#include <utils/PcapWriter.h>        // for testing
+#include <utils/IncomingMessage.h>   // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests writing and reading capture files.
+   class PcapTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestRoundTrip();
+      void TestPcapng();
+      void TestMalformedPcapng();
+      void TestNotACapture();
+
+      CPPUNIT_TEST_SUITE( PcapTests );
+         CPPUNIT_TEST( TestRoundTrip );
+         CPPUNIT_TEST( TestPcapng );
+         CPPUNIT_TEST( TestMalformedPcapng );
+         CPPUNIT_TEST( TestNotACapture );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// counts the entity state PDUs and remembers the last context.
+   class CaptureProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      CaptureProcessor() : _hits(0), _context() {}
+
+      void Process(const DIS::Pdu& /*packet*/)
+      {
+         _hits++;
+      }
+
+      void Process(const DIS::Pdu& packet, const DIS::ReceiveContext& context)
+      {
+         _context = context;
+         Process( packet );
+      }
+
+      unsigned int _hits;
+      DIS::ReceiveContext _context;
+   };
+
+   std::string TemporaryPath(const char* name)
+   {
+      return std::string( "/tmp/opendis_" ) + name;
+   }
+
+   void Append32(std::vector<char>& file, unsigned int value)
+   {
+      file.insert( file.end() , reinterpret_cast<const char*>( &value ) , reinterpret_cast<const char*>( &value ) + 4 );
+   }
+
+   void Append16(std::vector<char>& file, unsigned short value)
+   {
+      file.insert( file.end() , reinterpret_cast<const char*>( &value ) , reinterpret_cast<const char*>( &value ) + 2 );
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( PcapTests );
+
+void PcapTests::TestRoundTrip()
+{
+   const std::string path = TemporaryPath( "roundtrip.pcap" );
+
+   PcapWriter writer;
+   CPPUNIT_ASSERT( writer.Open( path , 3000 ) );
+
+   ReceiveContext context;
+   context.sourceAddress = 0x0a000001;
+   context.sourcePort = 4000;
+   context.destinationAddress = 0xefff2a63;
+   context.timestamp = 1700000000123456789LL;
+
+   EntityStatePdu espdu;
+   for(unsigned int i=0; i<10; ++i)
+   {
+      DataStream ds( BIG );
+      espdu.marshal( ds );
+      espdu.marshal( ds );
+      CPPUNIT_ASSERT( writer.Write( &ds[0] , ds.size() , context ) );
+   }
+   CPPUNIT_ASSERT_EQUAL( writer.GetCount() , 10ull );
+   writer.Close();
+
+   PcapReader reader;
+   CPPUNIT_ASSERT( reader.Open( path ) );
+   CPPUNIT_ASSERT_EQUAL( reader.GetFormat() , PCAP_FORMAT_PCAP );
+   CPPUNIT_ASSERT_EQUAL( reader.GetLinkType() , (unsigned int)PCAP_LINKTYPE_ETHERNET );
+
+   PcapDatagram datagram;
+   CPPUNIT_ASSERT( reader.Next( datagram ) );
+   CPPUNIT_ASSERT_EQUAL( datagram.length , 2 * espdu.getMarshalledSize() );
+   CPPUNIT_ASSERT_EQUAL( datagram.sourceAddress , context.sourceAddress );
+   CPPUNIT_ASSERT_EQUAL( datagram.destinationAddress , context.destinationAddress );
+   CPPUNIT_ASSERT_EQUAL( datagram.sourcePort , (unsigned short)4000 );
+   CPPUNIT_ASSERT_EQUAL( datagram.destinationPort , (unsigned short)3000 );
+   CPPUNIT_ASSERT_EQUAL( datagram.timestamp , context.timestamp );
+
+   CaptureProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+
+   // the remaining datagrams, then all of them again
+   CPPUNIT_ASSERT_EQUAL( reader.Process( im ) , 9ull );
+   reader.Rewind();
+   CPPUNIT_ASSERT_EQUAL( reader.Process( im , 3000 ) , 10ull );
+   reader.Rewind();
+   CPPUNIT_ASSERT_EQUAL( reader.Process( im , 3001 ) , 0ull );
+
+   CPPUNIT_ASSERT_EQUAL( processor._hits , 38u );
+   CPPUNIT_ASSERT_EQUAL( processor._context.sourcePort , (unsigned short)4000 );
+   CPPUNIT_ASSERT_EQUAL( processor._context.timestamp , context.timestamp );
+   CPPUNIT_ASSERT_EQUAL( processor._context.pduIndex , 1u );
+   CPPUNIT_ASSERT_EQUAL( reader.GetSkippedCount() , 0ull );
+
+   remove( path.c_str() );
+}
+
+void PcapTests::TestPcapng()
+{
+   EntityStatePdu espdu;
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   const unsigned int payload = static_cast<unsigned int>( ds.size() );
+
+   std::vector<char> file;
+
+   // section header
+   Append32( file , PCAPNG_SECTION_HEADER_BLOCK );
+   Append32( file , 28 );
+   Append32( file , PCAPNG_BYTE_ORDER_MAGIC );
+   Append16( file , 1 );
+   Append16( file , 0 );
+   Append32( file , 0xffffffff );
+   Append32( file , 0xffffffff );
+   Append32( file , 28 );
+
+   // Linux cooked interface with nanosecond timestamps
+   Append32( file , PCAPNG_INTERFACE_DESCRIPTION_BLOCK );
+   Append32( file , 32 );
+   Append16( file , PCAP_LINKTYPE_LINUX_SLL );
+   Append16( file , 0 );
+   Append32( file , 0 );
+   Append16( file , PCAPNG_OPTION_TIMESTAMP_RESOLUTION );
+   Append16( file , 1 );
+   file.push_back( 9 );
+   file.insert( file.end() , 3 , 0 );
+   Append32( file , 0 );
+   Append32( file , 32 );
+
+   // one UDP datagram, padded to 32 bits
+   const unsigned int frame = 16 + 20 + 8 + payload;
+   const unsigned int padded = (frame + 3) & ~3u;
+   Append32( file , PCAPNG_ENHANCED_PACKET_BLOCK );
+   Append32( file , 32 + padded );
+   Append32( file , 0 );
+   const unsigned long long stamp = 5000000001ULL;
+   Append32( file , static_cast<unsigned int>( stamp >> 32 ) );
+   Append32( file , static_cast<unsigned int>( stamp ) );
+   Append32( file , frame );
+   Append32( file , frame );
+
+   const unsigned char cooked[16] = { 0,0, 0,1, 0,6, 0,0,0,0,0,0,0,0, 0x08,0x00 };
+   file.insert( file.end() , cooked , cooked + 16 );
+   const unsigned short total = static_cast<unsigned short>( 28 + payload );
+   const unsigned char ip[20] = { 0x45,0, (unsigned char)(total>>8),(unsigned char)total, 0,0, 0,0, 64,17, 0,0,
+                                  192,168,1,2, 192,168,1,255 };
+   file.insert( file.end() , ip , ip + 20 );
+   const unsigned short udpLength = static_cast<unsigned short>( 8 + payload );
+   const unsigned char udp[8] = { 0x0b,0xb8, 0x0b,0xb8, (unsigned char)(udpLength>>8),(unsigned char)udpLength, 0,0 };
+   file.insert( file.end() , udp , udp + 8 );
+   file.insert( file.end() , &ds[0] , &ds[0] + payload );
+   file.insert( file.end() , padded - frame , 0 );
+   Append32( file , 32 + padded );
+
+   const std::string path = TemporaryPath( "capture.pcapng" );
+   FILE* out = fopen( path.c_str() , "wb" );
+   CPPUNIT_ASSERT( out != NULL );
+   fwrite( &file[0] , file.size() , 1 , out );
+   fclose( out );
+
+   PcapReader reader;
+   CPPUNIT_ASSERT( reader.Open( path ) );
+   CPPUNIT_ASSERT_EQUAL( reader.GetFormat() , PCAP_FORMAT_PCAPNG );
+   CPPUNIT_ASSERT_EQUAL( reader.GetLinkType() , (unsigned int)PCAP_LINKTYPE_LINUX_SLL );
+
+   PcapDatagram datagram;
+   CPPUNIT_ASSERT( reader.Next( datagram ) );
+   CPPUNIT_ASSERT_EQUAL( datagram.length , payload );
+   CPPUNIT_ASSERT_EQUAL( datagram.timestamp , (long long)stamp );
+   CPPUNIT_ASSERT_EQUAL( datagram.sourceAddress , 0xc0a80102u );
+   CPPUNIT_ASSERT_EQUAL( datagram.destinationPort , (unsigned short)3000 );
+   CPPUNIT_ASSERT( memcmp( datagram.payload , &ds[0] , payload ) == 0 );
+   CPPUNIT_ASSERT( !reader.Next( datagram ) );
+
+   remove( path.c_str() );
+}
+
+void PcapTests::TestMalformedPcapng()
+{
+   std::vector<char> file;
+
+   // section header
+   Append32( file , PCAPNG_SECTION_HEADER_BLOCK );
+   Append32( file , 28 );
+   Append32( file , PCAPNG_BYTE_ORDER_MAGIC );
+   Append16( file , 1 );
+   Append16( file , 0 );
+   Append32( file , 0xffffffff );
+   Append32( file , 0xffffffff );
+   Append32( file , 28 );
+
+   // a last block whose length is not a multiple of 4, and ends with the file.
+   Append32( file , 0x00000bad );
+   Append32( file , 13 );
+   file.insert( file.end() , 1 , 0 );
+   Append32( file , 13 );
+
+   const std::string path = TemporaryPath( "malformed.pcapng" );
+   FILE* out = fopen( path.c_str() , "wb" );
+   CPPUNIT_ASSERT( out != NULL );
+   fwrite( &file[0] , file.size() , 1 , out );
+   fclose( out );
+
+   PcapReader reader;
+   CPPUNIT_ASSERT( reader.Open( path ) );
+   PcapDatagram datagram;
+   CPPUNIT_ASSERT( !reader.Next( datagram ) );
+   CPPUNIT_ASSERT( !reader.Next( datagram ) );
+
+   IncomingMessage im;
+   reader.Rewind();
+   CPPUNIT_ASSERT_EQUAL( reader.Process( im ) , 0ull );
+
+   remove( path.c_str() );
+}
+
+void PcapTests::TestNotACapture()
+{
+   const std::string path = TemporaryPath( "not_a_capture.pcap" );
+   FILE* out = fopen( path.c_str() , "wb" );
+   CPPUNIT_ASSERT( out != NULL );
+   fputs( "this is not a packet capture file" , out );
+   fclose( out );
+
+   PcapReader reader;
+   CPPUNIT_ASSERT( !reader.Open( path ) );
+   CPPUNIT_ASSERT( !reader.IsOpen() );
+   CPPUNIT_ASSERT( reader.GetLastError() != 0 );
+
+   remove( path.c_str() );
+   CPPUNIT_ASSERT( !reader.Open( path ) );
+}
@@ -0,0 +1,144 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <dis6/PduRegistry.h>         // for testing
+#include <utils/PDUBank.h>            // for testing
+#include <utils/PacketFactory.h>      // for testing
+#include <utils/PduFactory.h>         // for testing
+#include <utils/DataStream.h>         // for usage
+
+#include <memory>
+#include <thread>
+
+namespace TestDIS
+{
+   /// tests that the bank and the factories provide every class of the registry.
+   class PduRegistryTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestTypes();
+      void TestBank();
+      void TestPacketFactory();
+      void TestPduFactory();
+
+      CPPUNIT_TEST_SUITE( PduRegistryTests );
+         CPPUNIT_TEST( TestTypes );
+         CPPUNIT_TEST( TestBank );
+         CPPUNIT_TEST( TestPacketFactory );
+         CPPUNIT_TEST( TestPduFactory );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// counts the entries whose class marshals the type it is registered for.
+   struct CheckType
+   {
+      CheckType()
+         : matching(0)
+      {
+      }
+
+      template<typename Entry>
+      void Call()
+      {
+         typename Entry::PduClass pdu;
+         if( pdu.getPduType() == Entry::TYPE )
+         {
+            ++matching;
+         }
+      }
+
+      unsigned int matching;
+   };
+
+   void GetStaticEntityState(DIS::Pdu** pdu)
+   {
+      *pdu = DIS::PduBank::GetStaticPDU( DIS::PDU_ENTITY_STATE );
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( PduRegistryTests );
+
+void PduRegistryTests::TestTypes()
+{
+   CheckType check;
+   PduTypeListForEach<PduRegistry>::Apply( check );
+   CPPUNIT_ASSERT_EQUAL( PduRegistry::SIZE , check.matching );
+}
+
+void PduRegistryTests::TestBank()
+{
+   unsigned int known = 0;
+   for(unsigned int type=0; type<PDU_TYPE_TABLE_SIZE; ++type)
+   {
+      Pdu* pdu = PduBank::GetStaticPDU( static_cast<PDUType>( type ) );
+      std::unique_ptr<Pdu> created( PduBank::CreatePDU( static_cast<PDUType>( type ) ) );
+      CPPUNIT_ASSERT_EQUAL( pdu == NULL , created.get() == NULL );
+      if( pdu != NULL )
+      {
+         ++known;
+         CPPUNIT_ASSERT_EQUAL( type , static_cast<unsigned int>( pdu->getPduType() ) );
+         CPPUNIT_ASSERT_EQUAL( type , static_cast<unsigned int>( created->getPduType() ) );
+         CPPUNIT_ASSERT( pdu == PduBank::GetStaticPDU( static_cast<PDUType>( type ) ) );
+      }
+   }
+   CPPUNIT_ASSERT_EQUAL( PduRegistry::SIZE , known );
+
+   // the types that used to be missing from the bank.
+   CPPUNIT_ASSERT( PduBank::GetStaticPDU( PDU_DATA ) != NULL );
+   CPPUNIT_ASSERT( PduBank::GetStaticPDU( PDU_MINEFIELD_STATE ) != NULL );
+
+   // each thread has its own instances.
+   Pdu* other = NULL;
+   std::thread thread( GetStaticEntityState , &other );
+   thread.join();
+   CPPUNIT_ASSERT( other != NULL );
+   CPPUNIT_ASSERT( other != PduBank::GetStaticPDU( PDU_ENTITY_STATE ) );
+}
+
+void PduRegistryTests::TestPacketFactory()
+{
+   PacketFactory factory;
+   CPPUNIT_ASSERT( !factory.IsRegistered( PDU_FIRE ) );
+   CPPUNIT_ASSERT( factory.CreatePacket( PDU_FIRE ) == NULL );
+
+   // a registration is kept by RegisterAllPackets.
+   CPPUNIT_ASSERT( factory.RegisterPacket<EntityStatePdu>( PDU_FIRE ) );
+   CPPUNIT_ASSERT( !factory.RegisterPacket<FirePdu>( PDU_FIRE ) );
+   factory.RegisterAllPackets();
+
+   std::unique_ptr<Pdu> replaced( factory.CreatePacket( PDU_FIRE ) );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned char>( PDU_ENTITY_STATE ) , replaced->getPduType() );
+
+   std::unique_ptr<Pdu> comment( factory.CreatePacket( 62 ) );
+   CPPUNIT_ASSERT( comment.get() != NULL );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned char>( 62 ) , comment->getPduType() );
+   CPPUNIT_ASSERT( !factory.IsRegistered( 200 ) );
+
+   CPPUNIT_ASSERT( factory.UnRegisterPacket( 62 ) );
+   CPPUNIT_ASSERT( !factory.UnRegisterPacket( 62 ) );
+   CPPUNIT_ASSERT( !factory.IsRegistered( 62 ) );
+}
+
+void PduRegistryTests::TestPduFactory()
+{
+   // a type the factory did not know before the registry.
+   CollisionPdu collision;
+   collision.getIssuingEntityID().setEntity( 42 );
+   DataStream ds( BIG );
+   collision.marshal( ds );
+   std::vector<char> buffer( 1500 , 0 );
+   for(size_t i=0; i<ds.size(); ++i)
+   {
+      buffer[i] = ds[static_cast<unsigned int>( i )];
+   }
+
+   PduFactory factory;
+   std::unique_ptr<Pdu> pdu( factory.createPdu( &buffer[0] ) );
+   CollisionPdu* decoded = dynamic_cast<CollisionPdu*>( pdu.get() );
+   CPPUNIT_ASSERT( decoded != NULL );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( 42 ) , decoded->getIssuingEntityID().getEntity() );
+}
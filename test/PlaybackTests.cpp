@@ -0,0 +1,237 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/PlaybackEngine.h>    // for testing
+#include <utils/RecordingReader.h>   // for testing
+#include <utils/RecordingWriter.h>   // for usage
+#include <utils/IPlaybackSource.h>   // for usage
+#include <utils/PduHeader.h>         // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace TestDIS
+{
+   /// tests reading recordings and playing them back.
+   class PlaybackTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestRecordingReader();
+      void TestPacing();
+      void TestRewriteTimestamps();
+
+      CPPUNIT_TEST_SUITE( PlaybackTests );
+         CPPUNIT_TEST( TestRecordingReader );
+         CPPUNIT_TEST( TestPacing );
+         CPPUNIT_TEST( TestRewriteTimestamps );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// plays the same PDU a number of times, a fixed interval apart.
+   class IntervalSource : public DIS::IPlaybackSource
+   {
+   public:
+      IntervalSource(unsigned int count, long long interval)
+         : _pdu(), _count(count), _interval(interval), _next(0)
+      {
+         DIS::EntityStatePdu espdu;
+         espdu.setTimestamp( 12345 );
+         DIS::DataStream ds( DIS::BIG );
+         espdu.marshal( ds );
+         _pdu.assign( &ds[0] , &ds[0] + ds.size() );
+      }
+
+      bool Read(const char*& buf, unsigned int& size, DIS::ReceiveContext& context)
+      {
+         if( _next >= _count )
+         {
+            return false;
+         }
+         buf = &_pdu[0];
+         size = static_cast<unsigned int>( _pdu.size() );
+         context.timestamp = 1000000000LL + _next * _interval;
+         ++_next;
+         return true;
+      }
+
+      bool Seek(long long /*timestamp*/)
+      {
+         return false;
+      }
+
+      std::vector<char> _pdu;
+      unsigned int _count;
+      long long _interval;
+      unsigned int _next;
+   };
+
+   /// remembers when each buffer arrived, and the last buffer.
+   class ArrivalProcessor : public DIS::IBufferProcessor
+   {
+   public:
+      void Process(const char* buf, unsigned int size, DIS::Endian /*e*/)
+      {
+         _arrivals.push_back( std::chrono::steady_clock::now() );
+         _last.assign( buf , buf + size );
+      }
+
+      std::vector<std::chrono::steady_clock::time_point> _arrivals;
+      std::vector<char> _last;
+   };
+
+   double Seconds(const std::vector<std::chrono::steady_clock::time_point>& arrivals)
+   {
+      return std::chrono::duration<double>( arrivals.back() - arrivals.front() ).count();
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( PlaybackTests );
+
+void PlaybackTests::TestRecordingReader()
+{
+   const std::string path = "/tmp/opendis_playback.disrec";
+   const unsigned int COUNT = 1000;
+
+   RecordingWriterSettings settings;
+   settings.chunkSize = 16384;
+   settings.chunkCount = 128;
+   settings.maxChunkAgeMs = 0;
+
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( writer.Open( path , settings ) );
+   ReceiveContext context;
+   context.sourcePort = 4000;
+   for(unsigned int i=0; i<COUNT; ++i)
+   {
+      EntityStatePdu espdu;
+      espdu.getEntityID().setEntity( static_cast<unsigned short>( i % 7 ) );
+      DataStream ds( BIG );
+      espdu.marshal( ds );
+      context.timestamp = 1000000LL * ( i + 1 );
+      CPPUNIT_ASSERT( writer.Record( &ds[0] , ds.size() , context ) );
+   }
+   writer.Close();
+
+   RecordingReader reader;
+   CPPUNIT_ASSERT( reader.Open( path ) );
+   CPPUNIT_ASSERT( reader.GetChunkCount() > 1 );
+   CPPUNIT_ASSERT_EQUAL( reader.GetRecordCount() , (unsigned long long)COUNT );
+   CPPUNIT_ASSERT_EQUAL( reader.GetFirstTimestamp() , 1000000LL );
+   CPPUNIT_ASSERT_EQUAL( reader.GetLastTimestamp() , 1000000LL * COUNT );
+
+   PduView record;
+   for(unsigned int i=0; i<COUNT; ++i)
+   {
+      CPPUNIT_ASSERT( reader.Next( record ) );
+      CPPUNIT_ASSERT_EQUAL( record.timestamp , 1000000LL * ( i + 1 ) );
+      CPPUNIT_ASSERT_EQUAL( record.sourcePort , (unsigned short)4000 );
+      CPPUNIT_ASSERT_EQUAL( PduHeader::GetEntityKey( record.pdu , record.length ) , (unsigned long long)( i % 7 ) );
+   }
+   CPPUNIT_ASSERT( !reader.Next( record ) );
+
+   // exactly on a record, between records, before the first and after the last.
+   CPPUNIT_ASSERT( reader.Seek( 1000000LL * 700 ) );
+   CPPUNIT_ASSERT( reader.Next( record ) );
+   CPPUNIT_ASSERT_EQUAL( record.timestamp , 1000000LL * 700 );
+   CPPUNIT_ASSERT( reader.Seek( 1000000LL * 333 + 1 ) );
+   CPPUNIT_ASSERT( reader.Next( record ) );
+   CPPUNIT_ASSERT_EQUAL( record.timestamp , 1000000LL * 334 );
+   CPPUNIT_ASSERT( reader.Seek( 0 ) );
+   CPPUNIT_ASSERT( reader.Next( record ) );
+   CPPUNIT_ASSERT_EQUAL( record.timestamp , 1000000LL );
+   CPPUNIT_ASSERT( !reader.Seek( 1000000LL * COUNT + 1 ) );
+   CPPUNIT_ASSERT( !reader.Next( record ) );
+
+   reader.Rewind();
+   ArrivalProcessor processor;
+   CPPUNIT_ASSERT_EQUAL( reader.Process( processor ) , (unsigned long long)COUNT );
+   reader.Close();
+
+   // a file cut short keeps its complete chunks.
+   FILE* file = fopen( path.c_str() , "r+b" );
+   CPPUNIT_ASSERT( file != NULL );
+   fseek( file , 0 , SEEK_END );
+   const long size = ftell( file );
+   fclose( file );
+   CPPUNIT_ASSERT( truncate( path.c_str() , size - 100 ) == 0 );
+   CPPUNIT_ASSERT( reader.Open( path ) );
+   CPPUNIT_ASSERT( reader.GetRecordCount() < COUNT );
+   CPPUNIT_ASSERT_EQUAL( reader.Process( processor ) , reader.GetRecordCount() );
+
+   remove( path.c_str() );
+   CPPUNIT_ASSERT( !reader.Open( path ) );
+}
+
+void PlaybackTests::TestPacing()
+{
+   const unsigned int COUNT = 50;
+   const long long INTERVAL = 2000000;
+   const double RECORDED = ( COUNT - 1 ) * INTERVAL / 1e9;
+
+   PlaybackEngine engine;
+   PlaybackSettings settings;
+
+   // at the recorded pace, then ten times faster.
+   {
+      IntervalSource source( COUNT , INTERVAL );
+      ArrivalProcessor processor;
+      CPPUNIT_ASSERT_EQUAL( engine.Play( source , processor , settings ) , (unsigned long long)COUNT );
+      CPPUNIT_ASSERT( Seconds( processor._arrivals ) >= RECORDED - 0.0002 );
+      CPPUNIT_ASSERT( engine.GetStatistics().batches >= COUNT / 2 );
+   }
+   {
+      settings.speed = 10.0;
+      IntervalSource source( COUNT , INTERVAL );
+      ArrivalProcessor processor;
+      CPPUNIT_ASSERT_EQUAL( engine.Play( source , processor , settings ) , (unsigned long long)COUNT );
+      CPPUNIT_ASSERT( Seconds( processor._arrivals ) >= RECORDED / 10 - 0.0002 );
+      CPPUNIT_ASSERT( Seconds( processor._arrivals ) < RECORDED );
+   }
+
+   // as fast as possible, in full batches.
+   {
+      settings.speed = 0.0;
+      settings.maxBatch = 10;
+      IntervalSource source( COUNT , INTERVAL );
+      ArrivalProcessor processor;
+      CPPUNIT_ASSERT_EQUAL( engine.Play( source , processor , settings ) , (unsigned long long)COUNT );
+      CPPUNIT_ASSERT_EQUAL( engine.GetStatistics().batches , (unsigned long long)COUNT / 10 );
+      CPPUNIT_ASSERT_EQUAL( engine.GetStatistics().sent , (unsigned long long)COUNT );
+      CPPUNIT_ASSERT( !engine.IsPlaying() );
+   }
+}
+
+void PlaybackTests::TestRewriteTimestamps()
+{
+   // half past the hour is half of the 31 bit range, and the lowest bit marks absolute time.
+   const long long HOUR = 3600000000000LL;
+   CPPUNIT_ASSERT_EQUAL( PduHeader::MakeTimestamp( 5 * HOUR + HOUR / 2 ) , ( 1u << 31 ) | 1u );
+   CPPUNIT_ASSERT_EQUAL( PduHeader::MakeTimestamp( HOUR / 2 , false ) , 1u << 31 );
+   CPPUNIT_ASSERT_EQUAL( PduHeader::MakeTimestamp( 7 * HOUR ) , 1u );
+
+   PlaybackSettings settings;
+   settings.speed = 0.0;
+   settings.rewriteTimestamps = true;
+
+   IntervalSource source( 1 , 0 );
+   ArrivalProcessor processor;
+   PlaybackEngine engine;
+   CPPUNIT_ASSERT_EQUAL( engine.Play( source , processor , settings ) , 1ull );
+
+   // the absolute flag of the recorded timestamp is kept, and the recording is unchanged.
+   CPPUNIT_ASSERT( PduHeader::GetTimestamp( &processor._last[0] ) != 12345u );
+   CPPUNIT_ASSERT_EQUAL( PduHeader::GetTimestamp( &processor._last[0] ) & 1u , 1u );
+   CPPUNIT_ASSERT_EQUAL( PduHeader::GetTimestamp( &source._pdu[0] ) , 12345u );
+   CPPUNIT_ASSERT( memcmp( &processor._last[PDU_HEADER_SIZE] , &source._pdu[PDU_HEADER_SIZE] , source._pdu.size() - PDU_HEADER_SIZE ) == 0 );
+}
@@ -0,0 +1,152 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/PriorityLanes.h>     // for testing
+#include <utils/IncomingMessage.h>   // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+#include <dis6/FirePdu.h>            // for usage
+#include <dis6/SignalPdu.h>          // for usage
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests ordering and shedding PDUs by their protocol family.
+   class PriorityLanesTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestClassification();
+      void TestPriorityOrder();
+      void TestShedding();
+
+      CPPUNIT_TEST_SUITE( PriorityLanesTests );
+         CPPUNIT_TEST( TestClassification );
+         CPPUNIT_TEST( TestPriorityOrder );
+         CPPUNIT_TEST( TestShedding );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// remembers the order of the PDU types.
+   class TypeOrderProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      void Process(const DIS::Pdu& packet)
+      {
+         _types.push_back( packet.getPduType() );
+      }
+
+      std::vector<unsigned char> _types;
+   };
+
+   template<typename PduT>
+   void QueuePdus(DIS::PriorityLanes& lanes, PduT& pdu, unsigned int count)
+   {
+      DIS::DataStream ds( DIS::BIG );
+      pdu.marshal( ds );
+      for(unsigned int i=0; i<count; ++i)
+      {
+         lanes.Process( &ds[0] , ds.size() , DIS::BIG );
+      }
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( PriorityLanesTests );
+
+void PriorityLanesTests::TestClassification()
+{
+   PriorityLanes lanes;
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLaneCount() , 3u );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLane( PROTOCOL_FAMILY_WARFARE ) , (unsigned int)PRIORITY_LANE_CRITICAL );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLane( PROTOCOL_FAMILY_SIMULATION_MANAGEMENT ) , (unsigned int)PRIORITY_LANE_CRITICAL );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLane( PROTOCOL_FAMILY_ENTITY_INFORMATION ) , (unsigned int)PRIORITY_LANE_STATE );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLane( PROTOCOL_FAMILY_LOGISTICS ) , (unsigned int)PRIORITY_LANE_STATE );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetLane( PROTOCOL_FAMILY_RADIO_COMMUNICATIONS ) , (unsigned int)PRIORITY_LANE_RADIO );
+
+   // lanes that do not exist fall to the lowest
+   PriorityLanesSettings settings;
+   settings.familyLanes[PROTOCOL_FAMILY_LOGISTICS] = 7;
+   PriorityLanes custom( settings );
+   CPPUNIT_ASSERT_EQUAL( custom.GetLane( PROTOCOL_FAMILY_LOGISTICS ) , (unsigned int)PRIORITY_LANE_RADIO );
+}
+
+void PriorityLanesTests::TestPriorityOrder()
+{
+   PriorityLanes lanes;
+
+   SignalPdu signal;
+   EntityStatePdu espdu;
+   FirePdu fire;
+   QueuePdus( lanes , signal , 100 );
+   QueuePdus( lanes , espdu , 50 );
+   QueuePdus( lanes , fire , 2 );
+
+   CPPUNIT_ASSERT_EQUAL( lanes.GetQueuedCount( PRIORITY_LANE_RADIO ) , 100u );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetQueuedCount( PRIORITY_LANE_STATE ) , 50u );
+   CPPUNIT_ASSERT_EQUAL( lanes.GetQueuedCount( PRIORITY_LANE_CRITICAL ) , 2u );
+
+   TypeOrderProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_SIGNAL , &processor );
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.AddProcessor( PDU_FIRE , &processor );
+
+   CPPUNIT_ASSERT_EQUAL( lanes.Dispatch( im ) , 152u );
+   CPPUNIT_ASSERT_EQUAL( (unsigned int)processor._types.size() , 152u );
+
+   // the events jump the queue, then each lane takes its budget in turn
+   CPPUNIT_ASSERT_EQUAL( processor._types[0] , (unsigned char)PDU_FIRE );
+   CPPUNIT_ASSERT_EQUAL( processor._types[1] , (unsigned char)PDU_FIRE );
+   CPPUNIT_ASSERT_EQUAL( processor._types[2] , (unsigned char)PDU_ENTITY_STATE );
+   CPPUNIT_ASSERT_EQUAL( processor._types[33] , (unsigned char)PDU_ENTITY_STATE );
+   CPPUNIT_ASSERT_EQUAL( processor._types[34] , (unsigned char)PDU_SIGNAL );
+   CPPUNIT_ASSERT_EQUAL( processor._types[41] , (unsigned char)PDU_SIGNAL );
+   CPPUNIT_ASSERT_EQUAL( processor._types[42] , (unsigned char)PDU_ENTITY_STATE );
+
+   PriorityLaneStatistics statistics = lanes.GetStatistics( PRIORITY_LANE_RADIO );
+   CPPUNIT_ASSERT_EQUAL( statistics.received , 100ull );
+   CPPUNIT_ASSERT_EQUAL( statistics.dispatched , 100ull );
+   CPPUNIT_ASSERT_EQUAL( statistics.shedFull , 0ull );
+}
+
+void PriorityLanesTests::TestShedding()
+{
+   PriorityLanesSettings settings;
+   settings.lanes[PRIORITY_LANE_RADIO].capacity = 4;
+   settings.lanes[PRIORITY_LANE_STATE].maxAgeMs = 1;
+   PriorityLanes lanes( settings );
+
+   SignalPdu signal;
+   EntityStatePdu espdu;
+   FirePdu fire;
+   QueuePdus( lanes , signal , 10 );
+   QueuePdus( lanes , espdu , 5 );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+   QueuePdus( lanes , fire , 1 );
+
+   TypeOrderProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_SIGNAL , &processor );
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.AddProcessor( PDU_FIRE , &processor );
+   CPPUNIT_ASSERT_EQUAL( lanes.Dispatch( im ) , 5u );
+
+   PriorityLaneStatistics radio = lanes.GetStatistics( PRIORITY_LANE_RADIO );
+   CPPUNIT_ASSERT_EQUAL( radio.received , 10ull );
+   CPPUNIT_ASSERT_EQUAL( radio.dispatched , 4ull );
+   CPPUNIT_ASSERT_EQUAL( radio.shedFull , 6ull );
+
+   PriorityLaneStatistics state = lanes.GetStatistics( PRIORITY_LANE_STATE );
+   CPPUNIT_ASSERT_EQUAL( state.shedStale , 5ull );
+   CPPUNIT_ASSERT_EQUAL( state.dispatched , 0ull );
+
+   PriorityLaneStatistics critical = lanes.GetStatistics( PRIORITY_LANE_CRITICAL );
+   CPPUNIT_ASSERT_EQUAL( critical.dispatched , 1ull );
+}
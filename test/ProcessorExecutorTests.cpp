@@ -0,0 +1,216 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/ProcessorExecutor.h> // for testing
+#include <utils/IncomingMessage.h>   // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests running processors on the executor's thread pool.
+   class ProcessorExecutorTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestPerProcessorOrdering();
+      void TestPerEntityOrdering();
+      void TestStopped();
+      void TestFailures();
+
+      CPPUNIT_TEST_SUITE( ProcessorExecutorTests );
+         CPPUNIT_TEST( TestPerProcessorOrdering );
+         CPPUNIT_TEST( TestPerEntityOrdering );
+         CPPUNIT_TEST( TestStopped );
+         CPPUNIT_TEST( TestFailures );
+      CPPUNIT_TEST_SUITE_END();
+
+   protected:
+      /// send 'updates' rounds of entity state PDUs for 'entities' entities, the timestamp holding the round.
+      void Send(DIS::IncomingMessage& im, unsigned int entities, unsigned int updates);
+   };
+
+   /// checks the order of the updates, and that it is never called concurrently for an entity.
+   class OrderingProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      OrderingProcessor(unsigned int delay_us)
+         : _delay(delay_us), _hits(0), _errors(0), _concurrent(0), _inside(0), _mutex(), _last() {}
+
+      void Process(const DIS::Pdu& packet)
+      {
+         const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
+         if( _inside.fetch_add( 1 ) > 0 )
+         {
+            ++_concurrent;
+         }
+
+         const unsigned short entity = espdu.getEntityID().getEntity();
+         {
+            std::lock_guard<std::mutex> lock( _mutex );
+            std::map<unsigned short,unsigned int>::iterator iter = _last.find( entity );
+            const unsigned int expected = ( iter == _last.end() ) ? 0 : iter->second + 1;
+            if( espdu.getTimestamp() != expected )
+            {
+               ++_errors;
+            }
+            _last[entity] = espdu.getTimestamp();
+         }
+
+         if( _delay > 0 )
+         {
+            std::this_thread::sleep_for( std::chrono::microseconds( _delay ) );
+         }
+
+         --_inside;
+         ++_hits;
+      }
+
+      unsigned int _delay;
+      std::atomic<unsigned int> _hits;
+      std::atomic<unsigned int> _errors;
+      std::atomic<unsigned int> _concurrent;
+
+   private:
+      std::atomic<unsigned int> _inside;
+      std::mutex _mutex;
+      std::map<unsigned short,unsigned int> _last;
+   };
+
+   /// throws for every PDU, a std::exception for even entities and an int for odd ones.
+   class ThrowingProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      void Process(const DIS::Pdu& packet)
+      {
+         const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
+         if( espdu.getEntityID().getEntity() % 2 == 0 )
+         {
+            throw std::runtime_error( "processor failed" );
+         }
+         throw 1;
+      }
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( ProcessorExecutorTests );
+
+void ProcessorExecutorTests::Send(IncomingMessage& im, unsigned int entities, unsigned int updates)
+{
+   EntityStatePdu espdu;
+   for(unsigned int update=0; update<updates; ++update)
+   {
+      for(unsigned int entity=0; entity<entities; ++entity)
+      {
+         espdu.getEntityID().setEntity( entity );
+         espdu.setTimestamp( update );
+         DataStream ds( BIG );
+         espdu.marshal( ds );
+         im.Process( &ds[0] , ds.size() , BIG );
+      }
+   }
+}
+
+void ProcessorExecutorTests::TestPerProcessorOrdering()
+{
+   ProcessorExecutorSettings settings;
+   settings.threads = 3;
+   settings.ordering = ORDER_PER_PROCESSOR;
+   settings.strandBudget = 4;
+
+   ProcessorExecutor executor;
+   CPPUNIT_ASSERT( executor.Start( settings ) );
+   CPPUNIT_ASSERT_EQUAL( executor.GetThreadCount() , 3u );
+
+   // the slow processor does not hold up the fast one
+   OrderingProcessor slow( 200 );
+   OrderingProcessor fast( 0 );
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &slow );
+   im.AddProcessor( PDU_ENTITY_STATE , &fast );
+   im.SetExecutor( &executor );
+
+   Send( im , 10 , 20 );
+   executor.Wait();
+
+   CPPUNIT_ASSERT_EQUAL( executor.GetPendingCount() , 0ull );
+   CPPUNIT_ASSERT_EQUAL( slow._hits.load() , 200u );
+   CPPUNIT_ASSERT_EQUAL( fast._hits.load() , 200u );
+   CPPUNIT_ASSERT_EQUAL( slow._errors.load() , 0u );
+   CPPUNIT_ASSERT_EQUAL( fast._errors.load() , 0u );
+   CPPUNIT_ASSERT_EQUAL( slow._concurrent.load() , 0u );
+   CPPUNIT_ASSERT_EQUAL( fast._concurrent.load() , 0u );
+}
+
+void ProcessorExecutorTests::TestPerEntityOrdering()
+{
+   ProcessorExecutorSettings settings;
+   settings.threads = 4;
+   settings.ordering = ORDER_PER_ENTITY;
+   settings.entityStrands = 8;
+
+   ProcessorExecutor executor;
+   CPPUNIT_ASSERT( executor.Start( settings ) );
+
+   OrderingProcessor processor( 50 );
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.SetExecutor( &executor );
+
+   Send( im , 16 , 30 );
+   executor.Stop();
+
+   CPPUNIT_ASSERT( !executor.IsRunning() );
+   CPPUNIT_ASSERT_EQUAL( processor._hits.load() , 480u );
+   CPPUNIT_ASSERT_EQUAL( processor._errors.load() , 0u );
+}
+
+void ProcessorExecutorTests::TestStopped()
+{
+   // without running threads the processors are called directly
+   ProcessorExecutor executor;
+   OrderingProcessor processor( 0 );
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.SetExecutor( &executor );
+
+   Send( im , 2 , 3 );
+   CPPUNIT_ASSERT_EQUAL( processor._hits.load() , 6u );
+   CPPUNIT_ASSERT_EQUAL( executor.GetPendingCount() , 0ull );
+}
+
+void ProcessorExecutorTests::TestFailures()
+{
+   ProcessorExecutorSettings settings;
+   settings.threads = 2;
+
+   ProcessorExecutor executor;
+   CPPUNIT_ASSERT( executor.Start( settings ) );
+
+   // the exceptions are counted, and do not hold up the other processor
+   ThrowingProcessor throwing;
+   OrderingProcessor processor( 0 );
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &throwing );
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   im.SetExecutor( &executor );
+
+   Send( im , 4 , 5 );
+   executor.Wait();
+
+   CPPUNIT_ASSERT_EQUAL( executor.GetFailureCount() , 20ull );
+   CPPUNIT_ASSERT_EQUAL( processor._hits.load() , 20u );
+   CPPUNIT_ASSERT_EQUAL( executor.GetPendingCount() , 0ull );
+}
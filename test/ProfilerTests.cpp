@@ -0,0 +1,139 @@
+/// Copyright goes here
+/// License goes here
+
+#include <utils/Profiler.h>           // for testing
+
+// the profiler only exists in a library built with OPENDIS_PROFILING.
+#if defined(DIS_PROFILING)
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/IncomingMessage.h>    // for usage
+#include <utils/IPacketProcessor.h>   // for usage
+#include <utils/DataStream.h>         // for usage
+#include <utils/PDUType.h>            // for usage
+#include <dis6/EntityStatePdu.h>      // for usage
+
+#include <thread>
+
+namespace TestDIS
+{
+   /// tests the merging of the histograms of the threads, the instrumented decoding, and the allocation accounting.
+   class ProfilerTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestThreads();
+      void TestDecoding();
+      void TestAllocations();
+
+      CPPUNIT_TEST_SUITE( ProfilerTests );
+         CPPUNIT_TEST( TestThreads );
+         CPPUNIT_TEST( TestDecoding );
+         CPPUNIT_TEST( TestAllocations );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// does nothing with the PDUs.
+   class IgnoringProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      void Process(const DIS::Pdu& /*p*/)
+      {
+      }
+   };
+
+   /// reports two allocations for each PDU, as an operator new calling the profiler would.
+   class AllocatingProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      void Process(const DIS::Pdu& /*p*/)
+      {
+         DIS::Profiler::CountAllocation( 64 );
+         DIS::Profiler::CountAllocation( 64 );
+      }
+   };
+
+   void RecordFire(unsigned int count)
+   {
+      for(unsigned int i=0; i<count; ++i)
+      {
+         DIS::Profiler::Record( DIS::PROFILE_MARSHAL , DIS::PDU_FIRE , 1000 + i );
+      }
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( ProfilerTests );
+
+void ProfilerTests::TestThreads()
+{
+   Profiler::Reset();
+   RecordFire( 100 );
+
+   // the times of a thread are kept after it exits.
+   std::thread other( RecordFire , 50 );
+   other.join();
+
+   const Histogram histogram = Profiler::GetHistogram( PROFILE_MARSHAL , PDU_FIRE );
+   CPPUNIT_ASSERT_EQUAL( 150ull , histogram.GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 1000ull , histogram.GetMin() );
+   CPPUNIT_ASSERT_EQUAL( 0ull , Profiler::GetHistogram( PROFILE_UNMARSHAL , PDU_FIRE ).GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 0ull , Profiler::GetHistogram( PROFILE_MARSHAL , PDU_DETONATION ).GetCount() );
+
+   Profiler::Reset();
+   CPPUNIT_ASSERT_EQUAL( 0ull , Profiler::GetHistogram( PROFILE_MARSHAL , PDU_FIRE ).GetCount() );
+}
+
+void ProfilerTests::TestDecoding()
+{
+   EntityStatePdu pdu;
+   DataStream ds( BIG );
+   pdu.marshal( ds );
+   pdu.marshal( ds );
+
+   IncomingMessage incoming;
+   IgnoringProcessor processor;
+   incoming.AddProcessor( PDU_ENTITY_STATE , &processor );
+
+   Profiler::Reset();
+   incoming.Process( &ds[0] , ds.size() , BIG );
+   CPPUNIT_ASSERT_EQUAL( 2ull , Profiler::GetHistogram( PROFILE_UNMARSHAL , PDU_ENTITY_STATE ).GetCount() );
+   CPPUNIT_ASSERT_EQUAL( 2ull , Profiler::GetHistogram( PROFILE_DISPATCH , PDU_ENTITY_STATE ).GetCount() );
+
+   incoming.RemoveProcessor( PDU_ENTITY_STATE , &processor );
+}
+
+void ProfilerTests::TestAllocations()
+{
+   EntityStatePdu pdu;
+   DataStream ds( BIG );
+   pdu.marshal( ds );
+   pdu.marshal( ds );
+
+   IncomingMessage incoming;
+   AllocatingProcessor processor;
+   incoming.AddProcessor( PDU_ENTITY_STATE , &processor );
+
+   Profiler::Reset();
+   const unsigned long long allocations = Profiler::GetThreadAllocations();
+   incoming.Process( &ds[0] , ds.size() , BIG );
+   CPPUNIT_ASSERT_EQUAL( allocations + 4 , Profiler::GetThreadAllocations() );
+
+   // the allocations are attributed to the stage and the PDU type of the processor call.
+   const ProfileAllocations dispatch = Profiler::GetAllocations( PROFILE_DISPATCH , PDU_ENTITY_STATE );
+   CPPUNIT_ASSERT_EQUAL( 2ull , dispatch.calls );
+   CPPUNIT_ASSERT_EQUAL( 4ull , dispatch.allocations );
+   CPPUNIT_ASSERT_EQUAL( 256ull , dispatch.bytes );
+   CPPUNIT_ASSERT_EQUAL( 0ull , Profiler::GetAllocations( PROFILE_UNMARSHAL , PDU_ENTITY_STATE ).allocations );
+
+   // and to the processor.
+   const IncomingStatistics statistics = incoming.GetStatistics();
+   CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( 1 ) , statistics.processors.size() );
+   CPPUNIT_ASSERT_EQUAL( 4ull , statistics.processors[0].allocations );
+   CPPUNIT_ASSERT_EQUAL( 256ull , statistics.processors[0].allocatedBytes );
+
+   incoming.RemoveProcessor( PDU_ENTITY_STATE , &processor );
+}
+
+#endif  // DIS_PROFILING
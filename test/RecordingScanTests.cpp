@@ -0,0 +1,245 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/RecordingReader.h>     // for testing
+#include <utils/RecordingWriter.h>     // for usage
+#include <utils/IPduViewProcessor.h>   // for usage
+#include <utils/DataStream.h>          // for usage
+#include <dis6/EntityStatePdu.h>       // for usage
+#include <dis6/FirePdu.h>              // for usage
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests the parallel scan of recordings.
+   class RecordingScanTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void setUp();
+      void tearDown();
+
+      void TestScanAll();
+      void TestPredicates();
+
+      CPPUNIT_TEST_SUITE( RecordingScanTests );
+         CPPUNIT_TEST( TestScanAll );
+         CPPUNIT_TEST( TestPredicates );
+      CPPUNIT_TEST_SUITE_END();
+
+   private:
+      std::string _path;
+   };
+
+   /// the number of entities, each updated once per millisecond.
+   const unsigned int SCAN_ENTITIES = 40;
+   const unsigned int SCAN_UPDATES = 200;
+
+   /// entity i is recorded from update i, so that the early chunks do not hold the late entities.
+   /// every 10th update of an entity is followed by a fire PDU.
+   bool IsRecorded(unsigned int entity, unsigned int update)
+   {
+      return update >= entity;
+   }
+
+   /// counts PDUs and sums their times, separately for each worker.
+   class CountingViewProcessor : public DIS::IPduViewProcessor
+   {
+   public:
+      CountingViewProcessor()
+         : _counts(64, 0), _sums(64, 0), _badWorker(false)
+      {
+      }
+
+      void Process(const DIS::PduView& view, unsigned int worker)
+      {
+         if( worker >= _counts.size() )
+         {
+            _badWorker = true;
+            return;
+         }
+         ++_counts[worker];
+         _sums[worker] += view.timestamp;
+      }
+
+      unsigned long long Count() const
+      {
+         unsigned long long total = 0;
+         for(size_t i=0; i<_counts.size(); ++i)
+         {
+            total += _counts[i];
+         }
+         return total;
+      }
+
+      long long Sum() const
+      {
+         long long total = 0;
+         for(size_t i=0; i<_sums.size(); ++i)
+         {
+            total += _sums[i];
+         }
+         return total;
+      }
+
+      std::vector<unsigned long long> _counts;
+      std::vector<long long> _sums;
+      bool _badWorker;
+   };
+
+   long long UpdateTime(unsigned int update)
+   {
+      return 1000000000LL + update * 1000000LL;
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( RecordingScanTests );
+
+void RecordingScanTests::setUp()
+{
+   _path = "/tmp/opendis_scan.disrec";
+
+   RecordingWriterSettings settings;
+   settings.chunkSize = 16384;
+   settings.chunkCount = 256;
+   settings.maxChunkAgeMs = 0;
+
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( writer.Open( _path , settings ) );
+   ReceiveContext context;
+   for(unsigned int update=0; update<SCAN_UPDATES; ++update)
+   {
+      context.timestamp = UpdateTime( update );
+      for(unsigned int entity=0; entity<SCAN_ENTITIES; ++entity)
+      {
+         if( !IsRecorded( entity , update ) )
+         {
+            continue;
+         }
+
+         EntityStatePdu espdu;
+         espdu.getEntityID().setSite( 1 );
+         espdu.getEntityID().setApplication( 1 );
+         espdu.getEntityID().setEntity( static_cast<unsigned short>( entity ) );
+         DataStream ds( BIG );
+         espdu.marshal( ds );
+         if( update % 10 == 0 )
+         {
+            FirePdu fire;
+            fire.getFiringEntityID().setSite( 1 );
+            fire.getFiringEntityID().setApplication( 1 );
+            fire.getFiringEntityID().setEntity( static_cast<unsigned short>( entity ) );
+            fire.marshal( ds );
+         }
+         writer.Process( &ds[0] , ds.size() , BIG , context );
+      }
+   }
+   writer.Close();
+   CPPUNIT_ASSERT_EQUAL( writer.GetDroppedCount() , 0ull );
+}
+
+void RecordingScanTests::tearDown()
+{
+   remove( _path.c_str() );
+}
+
+void RecordingScanTests::TestScanAll()
+{
+   RecordingReader reader;
+   CPPUNIT_ASSERT( reader.Open( _path ) );
+   CPPUNIT_ASSERT( reader.GetChunkCount() > 8 );
+
+   unsigned long long expected = 0;
+   long long sum = 0;
+   for(unsigned int update=0; update<SCAN_UPDATES; ++update)
+   {
+      for(unsigned int entity=0; entity<SCAN_ENTITIES; ++entity)
+      {
+         if( IsRecorded( entity , update ) )
+         {
+            const unsigned int pdus = ( update % 10 == 0 ) ? 2 : 1;
+            expected += pdus;
+            sum += pdus * UpdateTime( update );
+         }
+      }
+   }
+   CPPUNIT_ASSERT_EQUAL( reader.GetRecordCount() , expected );
+
+   for(unsigned int workers=1; workers<=4; ++workers)
+   {
+      CountingViewProcessor processor;
+      const RecordingScanStatistics statistics = reader.Scan( RecordingQuery() , processor , workers );
+      CPPUNIT_ASSERT( !processor._badWorker );
+      CPPUNIT_ASSERT_EQUAL( statistics.workers , workers );
+      CPPUNIT_ASSERT_EQUAL( processor.Count() , expected );
+      CPPUNIT_ASSERT_EQUAL( processor.Sum() , sum );
+      CPPUNIT_ASSERT_EQUAL( statistics.matched , expected );
+      CPPUNIT_ASSERT_EQUAL( statistics.scannedChunks , (unsigned long long)reader.GetChunkCount() );
+      CPPUNIT_ASSERT_EQUAL( statistics.skippedChunks , 0ull );
+   }
+
+   // the scan leaves the reading position alone.
+   PduView view;
+   CPPUNIT_ASSERT( reader.Next( view ) );
+   CPPUNIT_ASSERT_EQUAL( view.timestamp , UpdateTime( 0 ) );
+}
+
+void RecordingScanTests::TestPredicates()
+{
+   RecordingReader reader;
+   CPPUNIT_ASSERT( reader.Open( _path ) );
+
+   // a time range skips the chunks before and after it.
+   {
+      RecordingQuery query;
+      query.startTime = UpdateTime( 100 );
+      query.endTime = UpdateTime( 109 );
+      CountingViewProcessor processor;
+      const RecordingScanStatistics statistics = reader.Scan( query , processor , 3 );
+      CPPUNIT_ASSERT_EQUAL( processor.Count() , 10ull * SCAN_ENTITIES + SCAN_ENTITIES );
+      CPPUNIT_ASSERT( statistics.skippedChunks > statistics.scannedChunks );
+      CPPUNIT_ASSERT( statistics.records < reader.GetRecordCount() / 4 );
+   }
+
+   // an entity is only looked for in the chunks whose index holds it.
+   {
+      RecordingQuery query;
+      query.entities.push_back( PduHeader::MakeEntityKey( 1 , 1 , SCAN_ENTITIES - 1 ) );
+      query.entities.push_back( PduHeader::MakeEntityKey( 9 , 9 , 9 ) );
+      CountingViewProcessor processor;
+      const RecordingScanStatistics statistics = reader.Scan( query , processor , 2 );
+      const unsigned int updates = SCAN_UPDATES - ( SCAN_ENTITIES - 1 );
+      CPPUNIT_ASSERT_EQUAL( processor.Count() , (unsigned long long)( updates + updates / 10 ) );
+      CPPUNIT_ASSERT( statistics.skippedChunks > 0 );
+   }
+
+   // the fire PDUs of one entity within a time range.
+   {
+      RecordingQuery query;
+      query.types.push_back( 2 );
+      query.entities.push_back( PduHeader::MakeEntityKey( 1 , 1 , 0 ) );
+      query.startTime = UpdateTime( 50 );
+      query.endTime = UpdateTime( 150 );
+      CountingViewProcessor processor;
+      reader.Scan( query , processor );
+      CPPUNIT_ASSERT_EQUAL( processor.Count() , 11ull );
+      CPPUNIT_ASSERT_EQUAL( processor.Sum() , UpdateTime( 100 ) * 11 );
+   }
+
+   // a type that was never recorded skips every chunk.
+   {
+      RecordingQuery query;
+      query.types.push_back( 26 );
+      CountingViewProcessor processor;
+      const RecordingScanStatistics statistics = reader.Scan( query , processor );
+      CPPUNIT_ASSERT_EQUAL( processor.Count() , 0ull );
+      CPPUNIT_ASSERT_EQUAL( statistics.records , 0ull );
+      CPPUNIT_ASSERT_EQUAL( statistics.skippedChunks , (unsigned long long)reader.GetChunkCount() );
+   }
+}
@@ -0,0 +1,219 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/RecordingWriter.h>   // for testing
+#include <utils/RecordingFormat.h>   // for testing
+#include <utils/PduHeader.h>         // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+#include <dis6/FirePdu.h>            // for usage
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests the layout and index of recording files.
+   class RecordingWriterTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestChunks();
+      void TestNotWritable();
+      void TestReopen();
+
+      CPPUNIT_TEST_SUITE( RecordingWriterTests );
+         CPPUNIT_TEST( TestChunks );
+         CPPUNIT_TEST( TestNotWritable );
+         CPPUNIT_TEST( TestReopen );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   std::vector<char> ReadRecording(const std::string& path)
+   {
+      std::vector<char> file;
+      FILE* in = fopen( path.c_str() , "rb" );
+      if( in != NULL )
+      {
+         char buffer[4096];
+         size_t count = 0;
+         while( (count = fread( buffer , 1 , sizeof(buffer) , in )) > 0 )
+         {
+            file.insert( file.end() , buffer , buffer + count );
+         }
+         fclose( in );
+      }
+      return file;
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( RecordingWriterTests );
+
+void RecordingWriterTests::TestChunks()
+{
+   const std::string path = "/tmp/opendis_recording.disrec";
+   const unsigned int ENTITIES = 10;
+   const unsigned int UPDATES = 50;
+
+   RecordingWriterSettings settings;
+   settings.chunkSize = 8192;
+   settings.chunkCount = 64;
+   settings.maxChunkAgeMs = 0;
+
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( writer.Open( path , settings ) );
+
+   // every update is a datagram of an entity state and a fire PDU.
+   ReceiveContext context;
+   context.sourceAddress = 0x0a000001;
+   context.sourcePort = 4000;
+   for(unsigned int update=0; update<UPDATES; ++update)
+   {
+      for(unsigned int entity=0; entity<ENTITIES; ++entity)
+      {
+         EntityStatePdu espdu;
+         espdu.getEntityID().setSite( 1 );
+         espdu.getEntityID().setApplication( 2 );
+         espdu.getEntityID().setEntity( static_cast<unsigned short>( entity ) );
+         FirePdu fire;
+         fire.getFiringEntityID().setEntity( 1000 );
+
+         DataStream ds( BIG );
+         espdu.marshal( ds );
+         fire.marshal( ds );
+
+         context.timestamp = 1000000000LL + update * ENTITIES + entity;
+         writer.Process( &ds[0] , ds.size() , BIG , context );
+      }
+   }
+   writer.Close();
+
+   const unsigned long long total = 2ull * ENTITIES * UPDATES;
+   CPPUNIT_ASSERT_EQUAL( writer.GetRecordedCount() , total );
+   CPPUNIT_ASSERT_EQUAL( writer.GetDroppedCount() , 0ull );
+   CPPUNIT_ASSERT( writer.GetChunkCount() > 1 );
+
+   std::vector<char> file = ReadRecording( path );
+   CPPUNIT_ASSERT_EQUAL( (unsigned long long)file.size() , writer.GetBytesWritten() );
+   CPPUNIT_ASSERT( file.size() % RECORDING_ALIGNMENT == 0 );
+
+   RecordingFileHeader fileHeader;
+   memcpy( &fileHeader , &file[0] , sizeof(fileHeader) );
+   CPPUNIT_ASSERT( memcmp( fileHeader.magic , RECORDING_MAGIC , sizeof(fileHeader.magic) ) == 0 );
+   CPPUNIT_ASSERT_EQUAL( fileHeader.chunkSize , settings.chunkSize );
+
+   unsigned long long records = 0;
+   unsigned long long entityStates = 0;
+   unsigned long long fires = 0;
+   unsigned int chunks = 0;
+   long long previous = 0;
+   size_t position = fileHeader.headerSize;
+   while( position < file.size() )
+   {
+      const char* chunk = &file[position];
+      RecordingChunkHeader header;
+      memcpy( &header , chunk , sizeof(header) );
+      CPPUNIT_ASSERT_EQUAL( header.magic , RECORDING_CHUNK_MAGIC );
+      CPPUNIT_ASSERT_EQUAL( header.sequence , chunks );
+      CPPUNIT_ASSERT( header.chunkLength % RECORDING_ALIGNMENT == 0 );
+      CPPUNIT_ASSERT( header.recordsLength <= settings.chunkSize );
+      CPPUNIT_ASSERT( header.firstTimestamp >= previous );
+      CPPUNIT_ASSERT( header.lastTimestamp >= header.firstTimestamp );
+
+      // the records, in receive order.
+      unsigned int offset = static_cast<unsigned int>( RecordingAlign( sizeof(RecordingChunkHeader) , RECORDING_RECORD_ALIGNMENT ) );
+      for(unsigned int i=0; i<header.recordCount; ++i)
+      {
+         RecordingRecordHeader record;
+         memcpy( &record , chunk + offset , sizeof(record) );
+         CPPUNIT_ASSERT( record.timestamp >= previous );
+         CPPUNIT_ASSERT_EQUAL( record.sourceAddress , context.sourceAddress );
+         CPPUNIT_ASSERT_EQUAL( record.sourcePort , (uint16_t)4000 );
+         CPPUNIT_ASSERT_EQUAL( (unsigned int)record.length , (unsigned int)PduHeader::GetLength( chunk + offset + sizeof(record) ) );
+         previous = record.timestamp;
+         offset += static_cast<unsigned int>( RecordingAlign( sizeof(record) + record.length , RECORDING_RECORD_ALIGNMENT ) );
+      }
+      CPPUNIT_ASSERT_EQUAL( header.indexOffset , offset );
+
+      // the time index points at every 64th record.
+      const RecordingTimeEntry* times = reinterpret_cast<const RecordingTimeEntry*>( chunk + header.indexOffset );
+      CPPUNIT_ASSERT_EQUAL( header.timeEntryCount , (header.recordCount + RECORDING_TIME_INDEX_INTERVAL - 1) / RECORDING_TIME_INDEX_INTERVAL );
+      CPPUNIT_ASSERT_EQUAL( times[0].timestamp , header.firstTimestamp );
+
+      // the entity index is sorted, and covers every record.
+      const RecordingEntityEntry* entities = reinterpret_cast<const RecordingEntityEntry*>( times + header.timeEntryCount );
+      unsigned int indexed = 0;
+      for(unsigned int i=0; i<header.entityEntryCount; ++i)
+      {
+         if( i > 0 )
+         {
+            CPPUNIT_ASSERT( entities[i-1].entityKey < entities[i].entityKey );
+         }
+         const char* pdu = chunk + entities[i].offset + sizeof(RecordingRecordHeader);
+         CPPUNIT_ASSERT_EQUAL( PduHeader::GetEntityKey( pdu , PduHeader::GetLength( pdu ) ) , (unsigned long long)entities[i].entityKey );
+         indexed += entities[i].count;
+      }
+      CPPUNIT_ASSERT_EQUAL( indexed , header.recordCount );
+
+      records += header.recordCount;
+      entityStates += header.typeCounts[1];
+      fires += header.typeCounts[2];
+      position += header.chunkLength;
+      ++chunks;
+   }
+
+   CPPUNIT_ASSERT_EQUAL( records , total );
+   CPPUNIT_ASSERT_EQUAL( entityStates , total / 2 );
+   CPPUNIT_ASSERT_EQUAL( fires , total / 2 );
+   CPPUNIT_ASSERT_EQUAL( (unsigned long long)chunks , writer.GetChunkCount() );
+
+   remove( path.c_str() );
+}
+
+void RecordingWriterTests::TestNotWritable()
+{
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( !writer.Open( "/nonexistent/directory/recording.disrec" ) );
+   CPPUNIT_ASSERT( !writer.IsOpen() );
+   CPPUNIT_ASSERT( writer.GetLastError() != 0 );
+
+   // a closed writer drops nothing, and records nothing.
+   const char pdu[PDU_HEADER_SIZE] = { 6,1,1,1, 0,0,0,0, 0,PDU_HEADER_SIZE, 0,0 };
+   writer.Process( pdu , sizeof(pdu) , BIG );
+   CPPUNIT_ASSERT_EQUAL( writer.GetRecordedCount() , 0ull );
+}
+
+void RecordingWriterTests::TestReopen()
+{
+   const std::string path = "/tmp/opendis_reopened.disrec";
+
+   RecordingWriterSettings settings;
+   settings.maxChunkAgeMs = 0;
+
+   // a writer that failed to open records once it is opened again.
+   RecordingWriter writer;
+   CPPUNIT_ASSERT( !writer.Open( "/nonexistent/directory/recording.disrec" , settings ) );
+   CPPUNIT_ASSERT( writer.Open( path , settings ) );
+   CPPUNIT_ASSERT_EQUAL( writer.GetLastError() , 0 );
+
+   EntityStatePdu espdu;
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   for(unsigned int i=0; i<1000; ++i)
+   {
+      writer.Process( &ds[0] , ds.size() , BIG );
+   }
+   writer.Close();
+
+   CPPUNIT_ASSERT_EQUAL( writer.GetRecordedCount() , 1000ull );
+   CPPUNIT_ASSERT( writer.GetChunkCount() > 0 );
+   CPPUNIT_ASSERT_EQUAL( writer.GetLastError() , 0 );
+   CPPUNIT_ASSERT( ReadRecording( path ).size() > RECORDING_ALIGNMENT );
+
+   remove( path.c_str() );
+}
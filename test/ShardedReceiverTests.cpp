@@ -0,0 +1,138 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/ShardedReceiver.h>   // for testing
+#include <utils/UdpTransport.h>      // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/DataStream.h>        // for usage
+#include <utils/PduHeader.h>         // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+#include <map>
+#include <mutex>
+#include <thread>
+#include <chrono>
+
+namespace TestDIS
+{
+   /// tests spreading PDUs over worker threads while keeping each entity in order.
+   class ShardedReceiverTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestEntityOrdering();
+
+      CPPUNIT_TEST_SUITE( ShardedReceiverTests );
+         CPPUNIT_TEST( TestEntityOrdering );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// records the timestamps and threads seen for each entity.
+   class OrderProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      std::mutex _mutex;
+      std::map<unsigned short, std::vector<unsigned int> > _timestamps;
+      std::map<unsigned short, std::thread::id> _threads;
+      bool _sameThread;
+      unsigned int _hits;
+
+      OrderProcessor() : _sameThread(true), _hits(0) {}
+
+      void Process(const DIS::Pdu& packet)
+      {
+         const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
+         const unsigned short entity = espdu.getEntityID().getEntity();
+
+         std::lock_guard<std::mutex> lock( _mutex );
+         _timestamps[entity].push_back( espdu.getTimestamp() );
+         std::map<unsigned short, std::thread::id>::iterator iter = _threads.find( entity );
+         if( iter == _threads.end() )
+         {
+            _threads[entity] = std::this_thread::get_id();
+         }
+         else if( iter->second != std::this_thread::get_id() )
+         {
+            _sameThread = false;
+         }
+         _hits++;
+      }
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( ShardedReceiverTests );
+
+void ShardedReceiverTests::TestEntityOrdering()
+{
+   ShardedReceiverSettings settings;
+   settings.transport.address = "127.0.0.1";
+   settings.receiveThreads = 2;
+   settings.workerThreads = 3;
+
+   ShardedReceiver receiver;
+   CPPUNIT_ASSERT( receiver.Open( settings ) );
+   CPPUNIT_ASSERT_EQUAL( receiver.GetWorkerCount() , 3u );
+   CPPUNIT_ASSERT_EQUAL( receiver.GetReceiveThreadCount() , 2u );
+
+   OrderProcessor processor;
+   CPPUNIT_ASSERT( receiver.AddProcessor( PDU_ENTITY_STATE , &processor ) );
+   CPPUNIT_ASSERT( receiver.Start() );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   // bundle the PDUs of 10 entities per datagram, so the receive threads must split them
+   const unsigned int ENTITIES = 20;
+   const unsigned int UPDATES = 25;
+   const unsigned int BUNDLE = 10;
+   EntityStatePdu espdu;
+   for(unsigned int update=0; update<UPDATES; ++update)
+   {
+      for(unsigned int first=0; first<ENTITIES; first+=BUNDLE)
+      {
+         DataStream ds( BIG );
+         for(unsigned int entity=first; entity<first+BUNDLE; ++entity)
+         {
+            espdu.getEntityID().setEntity( entity );
+            espdu.setTimestamp( update );
+            espdu.marshal( ds );
+         }
+         CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+      }
+      CPPUNIT_ASSERT( sender.Flush() );
+   }
+
+   // the PDUs of an entity always go to the same worker
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   const unsigned long long key = PduHeader::GetEntityKey( &ds[0] , ds.size() );
+   CPPUNIT_ASSERT_EQUAL( receiver.GetWorkerForEntity( key ) , receiver.GetWorkerForEntity( key ) );
+
+   for(int wait=0; wait<200 && receiver.GetQueuedCount() < ENTITIES*UPDATES; ++wait)
+   {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+   }
+   receiver.Stop();
+
+   CPPUNIT_ASSERT_EQUAL( receiver.GetDroppedCount() , 0ULL );
+   CPPUNIT_ASSERT_EQUAL( processor._hits , ENTITIES*UPDATES );
+   CPPUNIT_ASSERT( processor._sameThread );
+   CPPUNIT_ASSERT_EQUAL( processor._timestamps.size() , size_t(ENTITIES) );
+   for(unsigned int entity=0; entity<ENTITIES; ++entity)
+   {
+      const std::vector<unsigned int>& stamps = processor._timestamps[entity];
+      CPPUNIT_ASSERT_EQUAL( stamps.size() , size_t(UPDATES) );
+      for(unsigned int update=0; update<stamps.size(); ++update)
+      {
+         CPPUNIT_ASSERT_EQUAL( stamps[update] , update );
+      }
+   }
+}
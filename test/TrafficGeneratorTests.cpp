@@ -0,0 +1,162 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/TrafficGenerator.h>   // for testing
+#include <utils/IBufferProcessor.h>   // for usage
+#include <utils/IncomingMessage.h>    // for usage
+#include <utils/IPacketProcessor.h>   // for usage
+#include <utils/PduHeader.h>          // for usage
+#include <dis6/EntityStatePdu.h>      // for usage
+
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests the repeatability and the content of the generated traffic.
+   class TrafficGeneratorTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestRepeatable();
+      void TestTraffic();
+
+      CPPUNIT_TEST_SUITE( TrafficGeneratorTests );
+         CPPUNIT_TEST( TestRepeatable );
+         CPPUNIT_TEST( TestTraffic );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// keeps every datagram and its time.
+   class DatagramCollector : public DIS::IBufferProcessor
+   {
+   public:
+      void Process(const char* buf, unsigned int size, DIS::Endian /*e*/)
+      {
+         datagrams.push_back( std::string( buf , size ) );
+         times.push_back( 0 );
+      }
+
+      void Process(const char* buf, unsigned int size, DIS::Endian /*e*/, const DIS::ReceiveContext& context)
+      {
+         datagrams.push_back( std::string( buf , size ) );
+         times.push_back( context.timestamp );
+      }
+
+      std::vector<std::string> datagrams;
+      std::vector<long long> times;
+   };
+
+   /// counts the entity states decoded.
+   class EntityStateCounter : public DIS::IPacketProcessor
+   {
+   public:
+      EntityStateCounter()
+         : count(0)
+         , lastEntity(0)
+      {
+      }
+
+      void Process(const DIS::Pdu& p)
+      {
+         const DIS::EntityStatePdu& pdu = static_cast<const DIS::EntityStatePdu&>( p );
+         lastEntity = pdu.getEntityID().getEntity();
+         ++count;
+      }
+
+      unsigned int count;
+      unsigned short lastEntity;
+   };
+
+   /// generate a number of ticks with the number of threads.
+   void GenerateTraffic(unsigned int threads, unsigned int ticks, DatagramCollector& collector, DIS::TrafficStatistics& statistics)
+   {
+      DIS::TrafficGeneratorSettings settings;
+      settings.entities = 2000;
+      settings.threads = threads;
+      settings.seed = 42;
+      settings.startTime = 1700000000000000000LL;
+      settings.fireRate = 0.05;
+      settings.radioFraction = 0.2;
+      settings.talkFraction = 0.2;
+
+      DIS::TrafficGenerator generator;
+      CPPUNIT_ASSERT( generator.Start( settings ) );
+      CPPUNIT_ASSERT( !generator.Start( settings ) );
+      CPPUNIT_ASSERT_EQUAL( threads , generator.GetThreadCount() );
+      for(unsigned int i=0; i<ticks; ++i)
+      {
+         generator.Generate( collector );
+      }
+      CPPUNIT_ASSERT_EQUAL( settings.startTime + 20000000LL * ticks , generator.GetTime() );
+      statistics = generator.GetStatistics();
+      generator.Stop();
+      CPPUNIT_ASSERT( !generator.IsRunning() );
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( TrafficGeneratorTests );
+
+void TrafficGeneratorTests::TestRepeatable()
+{
+   DatagramCollector single;
+   DatagramCollector several;
+   TrafficStatistics singleStatistics;
+   TrafficStatistics severalStatistics;
+   GenerateTraffic( 1 , 250 , single , singleStatistics );
+   GenerateTraffic( 3 , 250 , several , severalStatistics );
+
+   // the traffic does not depend on the number of threads.
+   CPPUNIT_ASSERT( !single.datagrams.empty() );
+   CPPUNIT_ASSERT( single.datagrams == several.datagrams );
+   CPPUNIT_ASSERT( single.times == several.times );
+   CPPUNIT_ASSERT_EQUAL( singleStatistics.bytes , severalStatistics.bytes );
+
+   // the datagrams are in time order.
+   for(size_t i=1; i<single.times.size(); ++i)
+   {
+      CPPUNIT_ASSERT( single.times[i-1] <= single.times[i] );
+   }
+}
+
+void TrafficGeneratorTests::TestTraffic()
+{
+   DatagramCollector collector;
+   TrafficStatistics statistics;
+   GenerateTraffic( 2 , 250 , collector , statistics );
+
+   // 5 seconds of 2000 entities: a quarter of them static, with heartbeats every 5 seconds,
+   // and the others updating every second.
+   const unsigned long long expected = 1500 * 5 + 500;
+   CPPUNIT_ASSERT( statistics.entityStates >= expected * 9 / 10 && statistics.entityStates <= expected * 11 / 10 );
+   CPPUNIT_ASSERT( statistics.fires > 0 );
+   CPPUNIT_ASSERT( statistics.detonations > 0 && statistics.detonations <= statistics.fires );
+   CPPUNIT_ASSERT( statistics.transmitters > 0 );
+   CPPUNIT_ASSERT( statistics.signals > statistics.transmitters );
+   CPPUNIT_ASSERT( statistics.emissions > 0 );
+
+   const unsigned long long total = statistics.entityStates + statistics.fires + statistics.detonations +
+                                    statistics.transmitters + statistics.signals + statistics.emissions;
+   CPPUNIT_ASSERT_EQUAL( total , static_cast<unsigned long long>( collector.datagrams.size() ) );
+
+   // every datagram is one PDU of its declared length, which decodes.
+   IncomingMessage incoming;
+   EntityStateCounter counter;
+   incoming.AddProcessor( PDU_ENTITY_STATE , &counter );
+   unsigned long long bytes = 0;
+   for(size_t i=0; i<collector.datagrams.size(); ++i)
+   {
+      const std::string& datagram = collector.datagrams[i];
+      CPPUNIT_ASSERT_EQUAL( static_cast<unsigned short>( datagram.size() ) , PduHeader::GetLength( datagram.data() ) );
+      CPPUNIT_ASSERT_EQUAL( PduHeader::MakeTimestamp( collector.times[i] ) , PduHeader::GetTimestamp( datagram.data() ) );
+      incoming.Process( datagram.data() , static_cast<unsigned int>( datagram.size() ) , BIG );
+      bytes += datagram.size();
+   }
+   incoming.RemoveProcessor( PDU_ENTITY_STATE , &counter );
+   CPPUNIT_ASSERT_EQUAL( statistics.entityStates , static_cast<unsigned long long>( counter.count ) );
+   CPPUNIT_ASSERT( counter.lastEntity >= 1 && counter.lastEntity <= 2000 );
+   CPPUNIT_ASSERT_EQUAL( statistics.bytes , bytes );
+}
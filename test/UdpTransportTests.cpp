@@ -0,0 +1,377 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/UdpTransport.h>      // for testing
+#include <utils/IncomingMessage.h>   // for usage
+#include <utils/IPacketProcessor.h>  // for usage
+#include <utils/IBufferProcessor.h>  // for usage
+#include <utils/PduHeader.h>         // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+namespace TestDIS
+{
+   /// tests sending and receiving batches of datagrams over the loopback interface.
+   class UdpTransportTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestUnicastLoopback();
+      void TestMulticastLoopback();
+      void TestInterrupt();
+      void TestBatchLimit();
+      void TestEndBatch();
+      void TestSegmentationOffload();
+      void TestReceiveContext();
+      void TestStatistics();
+
+      CPPUNIT_TEST_SUITE( UdpTransportTests );
+         CPPUNIT_TEST( TestUnicastLoopback );
+         CPPUNIT_TEST( TestMulticastLoopback );
+         CPPUNIT_TEST( TestInterrupt );
+         CPPUNIT_TEST( TestBatchLimit );
+         CPPUNIT_TEST( TestEndBatch );
+         CPPUNIT_TEST( TestSegmentationOffload );
+         CPPUNIT_TEST( TestReceiveContext );
+         CPPUNIT_TEST( TestStatistics );
+      CPPUNIT_TEST_SUITE_END();
+
+   protected:
+      /// send 'count' PDUs from the sender and receive them through an IncomingMessage.
+      void SendAndReceive(DIS::UdpTransport& sender, DIS::UdpTransport& receiver, unsigned int count);
+   };
+
+   /// counts the entity state PDUs
+   class CountingProcessor : public DIS::IPacketProcessor
+   {
+   public:
+      unsigned int _hits;
+      unsigned short _lastSite;
+
+      CountingProcessor() : _hits(0), _lastSite(0) {}
+
+      void Process(const DIS::Pdu& packet)
+      {
+         const DIS::EntityStatePdu& espdu = static_cast<const DIS::EntityStatePdu&>( packet );
+         _lastSite = espdu.getEntityID().getSite();
+         _hits++;
+      }
+
+      void Process(const DIS::Pdu& packet, const DIS::ReceiveContext& context)
+      {
+         _context = context;
+         Process( packet );
+      }
+
+      DIS::ReceiveContext _context;
+   };
+
+   /// counts the datagrams and the batches they were read in.
+   class BatchCountingProcessor : public DIS::IBufferProcessor
+   {
+   public:
+      unsigned int _datagrams;
+      unsigned int _batches;
+
+      BatchCountingProcessor() : _datagrams(0), _batches(0) {}
+
+      void Process(const char* /*buf*/, unsigned int /*size*/, DIS::Endian /*e*/)
+      {
+         _datagrams++;
+      }
+
+      void EndBatch()
+      {
+         _batches++;
+      }
+   };
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( UdpTransportTests );
+
+void UdpTransportTests::SendAndReceive(UdpTransport& sender, UdpTransport& receiver, unsigned int count)
+{
+   CountingProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+
+   EntityStatePdu espdu;
+   for(unsigned int i=0; i<count; ++i)
+   {
+      espdu.getEntityID().setSite( i+1 );
+      DataStream ds( BIG );
+      espdu.marshal( ds );
+      CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+   }
+   CPPUNIT_ASSERT( sender.Flush() );
+   CPPUNIT_ASSERT_EQUAL( sender.GetQueuedCount() , 0u );
+
+   unsigned int received = 0;
+   int attempts = 0;
+   while( received < count && attempts++ < 50 )
+   {
+      int got = receiver.Receive( im , 100 );
+      CPPUNIT_ASSERT( got >= 0 );
+      received += got;
+   }
+
+   CPPUNIT_ASSERT_EQUAL( received , count );
+   CPPUNIT_ASSERT_EQUAL( processor._hits , count );
+   CPPUNIT_ASSERT_EQUAL( processor._lastSite , (unsigned short)count );
+}
+
+void UdpTransportTests::TestUnicastLoopback()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+   rx.batchSize = 8;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+   CPPUNIT_ASSERT( receiver.GetLocalPort() != 0 );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+   tx.batchSize = 8;
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   // more than a full batch in both directions
+   SendAndReceive( sender , receiver , 20 );
+}
+
+void UdpTransportTests::TestMulticastLoopback()
+{
+   UdpTransportSettings rx;
+   rx.address = "239.255.42.99";
+   rx.interfaceAddress = "127.0.0.1";
+   rx.port = 62041;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+
+   UdpTransportSettings tx = rx;
+   tx.address = "";
+   tx.port = 0;
+   tx.destination = "239.255.42.99";
+   tx.destinationPort = 62041;
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   SendAndReceive( sender , receiver , 5 );
+}
+
+void UdpTransportTests::TestInterrupt()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+
+   IncomingMessage im;
+   receiver.Interrupt();
+
+   // the pending wakeup returns immediately rather than waiting forever
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , -1 ) , 0 );
+
+   // nothing to read, so the timeout expires
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 10 ) , 0 );
+}
+
+void UdpTransportTests::TestBatchLimit()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+   rx.batchSize = 4;
+   rx.maxBatches = 2;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   EntityStatePdu espdu;
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   for(unsigned int i=0; i<20; ++i)
+   {
+      CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+   }
+   CPPUNIT_ASSERT( sender.Flush() );
+
+   // each call returns after two batches, and the next one reads on without waiting.
+   IncomingMessage im;
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 1000 ) , 8 );
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 0 ) , 8 );
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 0 ) , 4 );
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 0 ) , 0 );
+}
+
+void UdpTransportTests::TestEndBatch()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+   rx.batchSize = 4;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   const char datagram[PDU_HEADER_SIZE] = { 6,1,1,1, 0,0,0,0, 0,PDU_HEADER_SIZE, 0,0 };
+   for(unsigned int i=0; i<10; ++i)
+   {
+      CPPUNIT_ASSERT( sender.Send( datagram , sizeof(datagram) ) );
+   }
+   CPPUNIT_ASSERT( sender.Flush() );
+
+   // two full batches and a short one.
+   BatchCountingProcessor processor;
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( processor , 1000 ) , 10 );
+   CPPUNIT_ASSERT_EQUAL( processor._datagrams , 10u );
+   CPPUNIT_ASSERT_EQUAL( processor._batches , 3u );
+}
+
+void UdpTransportTests::TestSegmentationOffload()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+   rx.gro = true;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+   CPPUNIT_ASSERT( receiver.IsGroEnabled() );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+   tx.batchSize = 4;
+   tx.gso = true;
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+   CPPUNIT_ASSERT( sender.IsGsoEnabled() );
+
+   // equally sized entity state PDUs are coalesced into a few messages, then split on receipt
+   SendAndReceive( sender , receiver , 100 );
+}
+
+void UdpTransportTests::TestReceiveContext()
+{
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   EntityStatePdu espdu;
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+   CPPUNIT_ASSERT( sender.Flush() );
+
+   CountingProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   CPPUNIT_ASSERT_EQUAL( receiver.Receive( im , 1000 ) , 1 );
+
+   const unsigned int loopback = 0x7f000001;
+   CPPUNIT_ASSERT_EQUAL( processor._context.sourceAddress , loopback );
+   CPPUNIT_ASSERT_EQUAL( processor._context.sourcePort , sender.GetLocalPort() );
+   CPPUNIT_ASSERT_EQUAL( processor._context.destinationAddress , loopback );
+   CPPUNIT_ASSERT( processor._context.interfaceIndex > 0 );
+   CPPUNIT_ASSERT( processor._context.timestamp > 0 );
+   CPPUNIT_ASSERT_EQUAL( processor._context.datagramLength , (unsigned int)ds.size() );
+   CPPUNIT_ASSERT_EQUAL( processor._context.pduOffset , 0u );
+}
+
+void UdpTransportTests::TestStatistics()
+{
+   // a buffer too small for the burst below.
+   UdpTransportSettings rx;
+   rx.address = "127.0.0.1";
+   rx.receiveBufferSize = 4096;
+   rx.sourceStatistics = true;
+
+   UdpTransport receiver;
+   CPPUNIT_ASSERT( receiver.Open( rx ) );
+   CPPUNIT_ASSERT( receiver.GetStatistics().receiveBufferSize > 0 );
+
+   UdpTransportSettings tx;
+   tx.address = "127.0.0.1";
+   tx.destination = "127.0.0.1";
+   tx.destinationPort = receiver.GetLocalPort();
+
+   UdpTransport sender;
+   CPPUNIT_ASSERT( sender.Open( tx ) );
+
+   EntityStatePdu espdu;
+   DataStream ds( BIG );
+   espdu.marshal( ds );
+   const unsigned int burst = 200;
+   for(unsigned int i=0; i<burst; ++i)
+   {
+      CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+   }
+   CPPUNIT_ASSERT( sender.Flush() );
+
+   CountingProcessor processor;
+   IncomingMessage im;
+   im.AddProcessor( PDU_ENTITY_STATE , &processor );
+   int received = 0;
+   int got = 0;
+   while( ( got = receiver.Receive( im , 100 ) ) > 0 )
+   {
+      received += got;
+   }
+   CPPUNIT_ASSERT( received > 0 && received < static_cast<int>( burst ) );
+
+   // the kernel reports the drops with the next datagram.
+   CPPUNIT_ASSERT( sender.Send( &ds[0] , ds.size() ) );
+   CPPUNIT_ASSERT( sender.Flush() );
+   CPPUNIT_ASSERT_EQUAL( 1 , receiver.Receive( im , 1000 ) );
+   ++received;
+
+   const UdpTransportStatistics statistics = receiver.GetStatistics();
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned long long>( received ) , statistics.datagrams );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned long long>( received ) * ds.size() , statistics.bytes );
+   CPPUNIT_ASSERT_EQUAL( static_cast<unsigned long long>( burst + 1 ) , statistics.datagrams + statistics.kernelDrops );
+   CPPUNIT_ASSERT_EQUAL( 0ULL , statistics.truncated );
+
+   CPPUNIT_ASSERT_EQUAL( static_cast<size_t>( 1 ) , statistics.sources.size() );
+   const UdpSourceStatistics& source = statistics.sources[0];
+   CPPUNIT_ASSERT_EQUAL( 0x7f000001u , source.address );
+   CPPUNIT_ASSERT_EQUAL( sender.GetLocalPort() , source.port );
+   CPPUNIT_ASSERT_EQUAL( statistics.datagrams , source.datagrams );
+   CPPUNIT_ASSERT( source.lastTime >= source.firstTime );
+   CPPUNIT_ASSERT( source.maxGap <= source.lastTime - source.firstTime );
+}
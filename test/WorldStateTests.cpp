@@ -0,0 +1,196 @@
+/// Copyright goes here
+/// License goes here
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <utils/RecordingReader.h>   // for testing
+#include <utils/DeadReckoning.h>     // for testing
+#include <utils/RecordingWriter.h>   // for usage
+#include <utils/DataStream.h>        // for usage
+#include <dis6/EntityStatePdu.h>     // for usage
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace TestDIS
+{
+   /// tests keyframes and world state queries over recordings.
+   class WorldStateTests : public CPPUNIT_NS::TestFixture
+   {
+   public:
+      void TestDeadReckoning();
+      void TestWorldState();
+
+      CPPUNIT_TEST_SUITE( WorldStateTests );
+         CPPUNIT_TEST( TestDeadReckoning );
+         CPPUNIT_TEST( TestWorldState );
+      CPPUNIT_TEST_SUITE_END();
+   };
+
+   /// an entity state at a location, moving along x.
+   std::vector<char> MakeEntityState(unsigned short entity, double x, float speed, unsigned char algorithm)
+   {
+      DIS::EntityStatePdu espdu;
+      espdu.getEntityID().setSite( 1 );
+      espdu.getEntityID().setApplication( 1 );
+      espdu.getEntityID().setEntity( entity );
+      espdu.getEntityLocation().setX( x );
+      espdu.getEntityLocation().setY( 200 );
+      espdu.getEntityLocation().setZ( 300 );
+      espdu.getEntityLinearVelocity().setX( speed );
+      espdu.getDeadReckoningParameters().setDeadReckoningAlgorithm( algorithm );
+
+      DIS::DataStream ds( DIS::BIG );
+      espdu.marshal( ds );
+      return std::vector<char>( &ds[0] , &ds[0] + ds.size() );
+   }
+
+   DIS::PduView MakeView(const std::vector<char>& pdu)
+   {
+      DIS::PduView view;
+      view.pdu = &pdu[0];
+      view.length = static_cast<unsigned int>( pdu.size() );
+      return view;
+   }
+
+   /// entity i moves at i meters per second from the time it first reports, at update i.
+   const unsigned int WORLD_ENTITIES = 20;
+   const unsigned int WORLD_UPDATES = 300;
+   const long long WORLD_PERIOD = 100000000;
+   const long long WORLD_START = 1000000000000LL;
+
+   void RecordWorld(const std::string& path, unsigned int keyframeIntervalMs)
+   {
+      DIS::RecordingWriterSettings settings;
+      settings.chunkSize = 16384;
+      settings.chunkCount = 256;
+      settings.maxChunkAgeMs = 0;
+      settings.keyframeIntervalMs = keyframeIntervalMs;
+
+      DIS::RecordingWriter writer;
+      writer.Open( path , settings );
+      DIS::ReceiveContext context;
+      for(unsigned int update=0; update<WORLD_UPDATES; ++update)
+      {
+         context.timestamp = WORLD_START + update * WORLD_PERIOD;
+         const double seconds = update * WORLD_PERIOD / 1e9;
+         for(unsigned int entity=0; entity<WORLD_ENTITIES && entity<=update; ++entity)
+         {
+            const std::vector<char> pdu = MakeEntityState( static_cast<unsigned short>( entity ) , entity * seconds ,
+                                                           static_cast<float>( entity ) , 2 );
+            writer.Record( &pdu[0] , static_cast<unsigned int>( pdu.size() ) , context );
+         }
+      }
+      writer.Close();
+   }
+}
+
+using namespace TestDIS;
+using namespace DIS;
+CPPUNIT_TEST_SUITE_REGISTRATION( WorldStateTests );
+
+void WorldStateTests::TestDeadReckoning()
+{
+   EntitySnapshot snapshot;
+
+   // fixed, position, world coordinates.
+   std::vector<char> pdu = MakeEntityState( 7 , 100 , 10 , 2 );
+   CPPUNIT_ASSERT( DeadReckoning::Read( MakeView( pdu ) , snapshot ) );
+   CPPUNIT_ASSERT_EQUAL( snapshot.entityKey , PduHeader::MakeEntityKey( 1 , 1 , 7 ) );
+   CPPUNIT_ASSERT_EQUAL( snapshot.location[0] , 100.0 );
+   CPPUNIT_ASSERT_EQUAL( snapshot.location[1] , 200.0 );
+   CPPUNIT_ASSERT_EQUAL( snapshot.velocity[0] , 10.0f );
+   CPPUNIT_ASSERT_EQUAL( (unsigned int)snapshot.deadReckoningAlgorithm , 2u );
+   DeadReckoning::Extrapolate( snapshot , 2.0 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.location[0] , 120.0 , 1e-9 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.location[1] , 200.0 , 1e-9 );
+
+   // fixed, velocity, world coordinates.
+   {
+      EntityStatePdu espdu;
+      espdu.getEntityLinearVelocity().setX( 10 );
+      espdu.getDeadReckoningParameters().getEntityLinearAcceleration().setX( 1 );
+      espdu.getDeadReckoningParameters().setDeadReckoningAlgorithm( 5 );
+      DataStream ds( BIG );
+      espdu.marshal( ds );
+      pdu.assign( &ds[0] , &ds[0] + ds.size() );
+   }
+   CPPUNIT_ASSERT( DeadReckoning::Read( MakeView( pdu ) , snapshot ) );
+   DeadReckoning::Extrapolate( snapshot , 2.0 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.location[0] , 22.0 , 1e-9 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.velocity[0] , 12.0 , 1e-6 );
+
+   // fixed, position, body coordinates: heading a quarter turn moves along y.
+   {
+      EntityStatePdu espdu;
+      espdu.getEntityLinearVelocity().setX( 10 );
+      espdu.getEntityOrientation().setPsi( static_cast<float>( M_PI / 2 ) );
+      espdu.getDeadReckoningParameters().setDeadReckoningAlgorithm( 6 );
+      DataStream ds( BIG );
+      espdu.marshal( ds );
+      pdu.assign( &ds[0] , &ds[0] + ds.size() );
+   }
+   CPPUNIT_ASSERT( DeadReckoning::Read( MakeView( pdu ) , snapshot ) );
+   DeadReckoning::Extrapolate( snapshot , 1.0 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.location[0] , 0.0 , 1e-5 );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( snapshot.location[1] , 10.0 , 1e-5 );
+
+   // static entities stay put, and other PDUs are not entity states.
+   pdu = MakeEntityState( 7 , 100 , 10 , 1 );
+   CPPUNIT_ASSERT( DeadReckoning::Read( MakeView( pdu ) , snapshot ) );
+   DeadReckoning::Extrapolate( snapshot , 5.0 );
+   CPPUNIT_ASSERT_EQUAL( snapshot.location[0] , 100.0 );
+   pdu[PDU_TYPE_POSITION] = 2;
+   CPPUNIT_ASSERT( !DeadReckoning::Read( MakeView( pdu ) , snapshot ) );
+}
+
+void WorldStateTests::TestWorldState()
+{
+   const std::string keyframed = "/tmp/opendis_world_keyframes.disrec";
+   const std::string plain = "/tmp/opendis_world_plain.disrec";
+   RecordWorld( keyframed , 2000 );
+   RecordWorld( plain , 0 );
+
+   RecordingReader withKeyframes;
+   RecordingReader withoutKeyframes;
+   CPPUNIT_ASSERT( withKeyframes.Open( keyframed ) );
+   CPPUNIT_ASSERT( withoutKeyframes.Open( plain ) );
+   CPPUNIT_ASSERT( withKeyframes.GetKeyframeCount() >= 10 );
+   CPPUNIT_ASSERT_EQUAL( withoutKeyframes.GetKeyframeCount() , (size_t)0 );
+
+   // the keyframes are not part of the PDU stream.
+   CPPUNIT_ASSERT_EQUAL( withKeyframes.GetRecordCount() , withoutKeyframes.GetRecordCount() );
+
+   // between two updates, late in the recording.
+   const long long time = WORLD_START + 255 * WORLD_PERIOD + WORLD_PERIOD / 2;
+   std::vector<EntitySnapshot> entities;
+   std::vector<EntitySnapshot> replayed;
+   const unsigned long long rolled = withKeyframes.GetWorldState( time , entities );
+   const unsigned long long replayedRolled = withoutKeyframes.GetWorldState( time , replayed );
+   CPPUNIT_ASSERT_EQUAL( entities.size() , (size_t)WORLD_ENTITIES );
+   CPPUNIT_ASSERT_EQUAL( replayed.size() , (size_t)WORLD_ENTITIES );
+   CPPUNIT_ASSERT( rolled * 5 < replayedRolled );
+
+   for(unsigned int entity=0; entity<WORLD_ENTITIES; ++entity)
+   {
+      CPPUNIT_ASSERT_EQUAL( entities[entity].entityKey , PduHeader::MakeEntityKey( 1 , 1 , entity ) );
+      CPPUNIT_ASSERT_EQUAL( entities[entity].view.timestamp , WORLD_START + 255 * WORLD_PERIOD );
+      CPPUNIT_ASSERT_DOUBLES_EQUAL( entities[entity].location[0] , entity * 25.55 , 1e-6 );
+      CPPUNIT_ASSERT_EQUAL( entities[entity].location[0] , replayed[entity].location[0] );
+   }
+
+   // without dead reckoning, as last reported.
+   withKeyframes.GetWorldState( time , entities , false );
+   CPPUNIT_ASSERT_DOUBLES_EQUAL( entities[WORLD_ENTITIES-1].location[0] , ( WORLD_ENTITIES - 1 ) * 25.5 , 1e-6 );
+
+   // before the later entities first reported, and before the recording.
+   withKeyframes.GetWorldState( WORLD_START + 9 * WORLD_PERIOD , entities );
+   CPPUNIT_ASSERT_EQUAL( entities.size() , (size_t)10 );
+   withKeyframes.GetWorldState( WORLD_START - 1 , entities );
+   CPPUNIT_ASSERT( entities.empty() );
+
+   remove( keyframed.c_str() );
+   remove( plain.c_str() );
+}